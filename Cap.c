@@ -0,0 +1,3985 @@
+// This file is auto-generated. DO NOT edit.
+#include "oskimg.h"
+
+static unsigned int s_bitmapCap[ 15876 ] =
+{
+  0x002a1225, 0x00291226, 0x00271423, 0x00281c24, 
+  0x00272222, 0x00272222, 0x00262223, 0x00262122, 
+  0x00262122, 0x00262121, 0x00252122, 0x00252121, 
+  0x00252121, 0x00252020, 0x00242020, 0x00242020, 
+  0x00241f1f, 0x00241f1f, 0x00231e1e, 0x00231d1e, 
+  0x00231d1d, 0x00221c1d, 0x00221c1d, 0x00221c1c, 
+  0x00221b1c, 0x00211b1c, 0x00211b1c, 0x00201a1b, 
+  0x001f1a1b, 0x001f191a, 0x001f1919, 0x001f1819, 
+  0x001e1819, 0x001e1818, 0x001e1818, 0x001d1718, 
+  0x001d1717, 0x001e1819, 0x0023171d, 0x00241220, 
+  0x00291226, 0x002a1225, 0x002a1225, 0x00291226, 
+  0x00271423, 0x00281c24, 0x00272222, 0x00272222, 
+  0x00262223, 0x00262122, 0x00262122, 0x00262121, 
+  0x00252122, 0x00252121, 0x00252121, 0x00252020, 
+  0x00242020, 0x00242020, 0x00241f1f, 0x00241f1f, 
+  0x00231e1e, 0x00231d1e, 0x00231d1d, 0x00221c1d, 
+  0x00221c1d, 0x00221c1c, 0x00221b1c, 0x00211b1c, 
+  0x00211b1c, 0x00201a1b, 0x001f1a1b, 0x001f191a, 
+  0x001f1919, 0x001f1819, 0x001e1819, 0x001e1818, 
+  0x001e1818, 0x001d1718, 0x001d1717, 0x001e1819, 
+  0x0023171d, 0x00241220, 0x00291226, 0x002a1225, 
+  0x002a1225, 0x00291226, 0x00271423, 0x00281c24, 
+  0x00272222, 0x00272222, 0x00262223, 0x00262122, 
+  0x00262122, 0x00262121, 0x00252122, 0x00252121, 
+  0x00252121, 0x00252020, 0x00242020, 0x00242020, 
+  0x00241f1f, 0x00241f1f, 0x00231e1e, 0x00231d1e, 
+  0x00231d1d, 0x00221c1d, 0x00221c1d, 0x00221c1c, 
+  0x00221b1c, 0x00211b1c, 0x00211b1c, 0x00201a1b, 
+  0x001f1a1b, 0x001f191a, 0x001f1919, 0x001f1819, 
+  0x001e1819, 0x001e1818, 0x001e1818, 0x001d1718, 
+  0x001d1717, 0x001e1819, 0x0023171d, 0x00241220, 
+  0x00291226, 0x002a1225, 0x00291226, 0x00493049, 
+  0x00595152, 0x0065595a, 0x0067585a, 0x0069575a, 
+  0x00695458, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695257, 0x00695155, 0x00695054, 0x00694f53, 
+  0x00684e52, 0x00674d51, 0x00664b50, 0x0066484e, 
+  0x0065474d, 0x0064464b, 0x0062464a, 0x00614549, 
+  0x005f4549, 0x005f4448, 0x005e4347, 0x005d4246, 
+  0x005c4045, 0x005b4045, 0x005a3f44, 0x00593d42, 
+  0x00573c40, 0x00553c40, 0x00553c40, 0x00573d42, 
+  0x00573f43, 0x004f3b3d, 0x003e263a, 0x00291226, 
+  0x00291226, 0x00493049, 0x00595152, 0x0065595a, 
+  0x0067585a, 0x0069575a, 0x00695458, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695257, 0x00695155, 
+  0x00695054, 0x00694f53, 0x00684e52, 0x00674d51, 
+  0x00664b50, 0x0066484e, 0x0065474d, 0x0064464b, 
+  0x0062464a, 0x00614549, 0x005f4549, 0x005f4448, 
+  0x005e4347, 0x005d4246, 0x005c4045, 0x005b4045, 
+  0x005a3f44, 0x00593d42, 0x00573c40, 0x00553c40, 
+  0x00553c40, 0x00573d42, 0x00573f43, 0x004f3b3d, 
+  0x003e263a, 0x00291226, 0x00291226, 0x00493049, 
+  0x00595152, 0x0065595a, 0x0067585a, 0x0069575a, 
+  0x00695458, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695257, 0x00695155, 0x00695054, 0x00694f53, 
+  0x00684e52, 0x00674d51, 0x00664b50, 0x0066484e, 
+  0x0065474d, 0x0064464b, 0x0062464a, 0x00614549, 
+  0x005f4549, 0x005f4448, 0x005e4347, 0x005d4246, 
+  0x005c4045, 0x005b4045, 0x005a3f44, 0x00593d42, 
+  0x00573c40, 0x00553c40, 0x00553c40, 0x00573d42, 
+  0x00573f43, 0x004f3b3d, 0x003e263a, 0x00291226, 
+  0x00251423, 0x00594f51, 0x00665758, 0x00654e52, 
+  0x0064494e, 0x0064484d, 0x0064464b, 0x0065464b, 
+  0x0065464b, 0x0066464b, 0x0066464b, 0x0067464b, 
+  0x0068464b, 0x0069464b, 0x0069454b, 0x00674449, 
+  0x00664248, 0x00654047, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x0059363c, 0x0057353b, 0x0055343a, 0x00533339, 
+  0x00513136, 0x00503035, 0x004e2f34, 0x00492f33, 
+  0x00472e32, 0x00452c31, 0x00442b30, 0x00422b2f, 
+  0x003f2a2e, 0x003f2b2f, 0x00452e32, 0x0053393d, 
+  0x004e3839, 0x0021111e, 0x00251423, 0x00594f51, 
+  0x00665758, 0x00654e52, 0x0064494e, 0x0064484d, 
+  0x0064464b, 0x0065464b, 0x0065464b, 0x0066464b, 
+  0x0066464b, 0x0067464b, 0x0068464b, 0x0069464b, 
+  0x0069454b, 0x00674449, 0x00664248, 0x00654047, 
+  0x00623f45, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x005b383d, 0x0059363c, 0x0057353b, 
+  0x0055343a, 0x00533339, 0x00513136, 0x00503035, 
+  0x004e2f34, 0x00492f33, 0x00472e32, 0x00452c31, 
+  0x00442b30, 0x00422b2f, 0x003f2a2e, 0x003f2b2f, 
+  0x00452e32, 0x0053393d, 0x004e3839, 0x0021111e, 
+  0x00251423, 0x00594f51, 0x00665758, 0x00654e52, 
+  0x0064494e, 0x0064484d, 0x0064464b, 0x0065464b, 
+  0x0065464b, 0x0066464b, 0x0066464b, 0x0067464b, 
+  0x0068464b, 0x0069464b, 0x0069454b, 0x00674449, 
+  0x00664248, 0x00654047, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x005d3a3f, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x0057353b, 0x0055343a, 0x00533339, 
+  0x00513136, 0x00503035, 0x004e2f34, 0x00492f33, 
+  0x00472e32, 0x00452c31, 0x00442b30, 0x00422b2f, 
+  0x003f2a2e, 0x003f2b2f, 0x00452e32, 0x0053393d, 
+  0x004e3839, 0x0021111e, 0x00271b23, 0x00645353, 
+  0x00624b4f, 0x0061464a, 0x00614348, 0x00614247, 
+  0x00624247, 0x00624046, 0x00624046, 0x00644046, 
+  0x00654047, 0x00664047, 0x00674047, 0x00684047, 
+  0x006b3f47, 0x00673f46, 0x00673c44, 0x00663b43, 
+  0x00623a40, 0x00ffffff, 0x005d363d, 0x005c353c, 
+  0x005a343b, 0x00ffffff, 0x00553036, 0x00532f35, 
+  0x00512e33, 0x004f2c32, 0x004e2b31, 0x004a2a30, 
+  0x0047292f, 0x00442a2f, 0x0042272b, 0x003e272b, 
+  0x003c2629, 0x003a2528, 0x00392528, 0x00382528, 
+  0x00392528, 0x003f2a2e, 0x0054393d, 0x0023151c, 
+  0x00271b23, 0x00645353, 0x00624b4f, 0x0061464a, 
+  0x00614348, 0x00614247, 0x00624247, 0x00624046, 
+  0x00624046, 0x00644046, 0x00654047, 0x00664047, 
+  0x00674047, 0x00684047, 0x006b3f47, 0x00673f46, 
+  0x00673c44, 0x00663b43, 0x00623a40, 0x005f383e, 
+  0x005d363d, 0x00ffffff, 0x005a343b, 0x00573339, 
+  0x00553036, 0x00532f35, 0x00512e33, 0x004f2c32, 
+  0x004e2b31, 0x004a2a30, 0x0047292f, 0x00442a2f, 
+  0x0042272b, 0x003e272b, 0x003c2629, 0x003a2528, 
+  0x00392528, 0x00382528, 0x00392528, 0x003f2a2e, 
+  0x0054393d, 0x0023151c, 0x00271b23, 0x00645353, 
+  0x00624b4f, 0x0061464a, 0x00614348, 0x00614247, 
+  0x00624247, 0x00624046, 0x00624046, 0x00644046, 
+  0x00654047, 0x00664047, 0x00674047, 0x00684047, 
+  0x006b3f47, 0x00673f46, 0x00673c44, 0x00663b43, 
+  0x00623a40, 0x00ffffff, 0x00ffffff, 0x005c353c, 
+  0x005a343b, 0x00ffffff, 0x00553036, 0x00532f35, 
+  0x00512e33, 0x004f2c32, 0x004e2b31, 0x004a2a30, 
+  0x0047292f, 0x00442a2f, 0x0042272b, 0x003e272b, 
+  0x003c2629, 0x003a2528, 0x00392528, 0x00382528, 
+  0x00392528, 0x003f2a2e, 0x0054393d, 0x0023151c, 
+  0x00241e1f, 0x00665154, 0x005f4549, 0x005e3f45, 
+  0x005e3f45, 0x005e3c42, 0x005e3c42, 0x005f3c42, 
+  0x00613b42, 0x00623b42, 0x00653b42, 0x00663b43, 
+  0x00673b43, 0x00683b43, 0x006b3b43, 0x00693a42, 
+  0x00673940, 0x0065383f, 0x0063353d, 0x00ffffff, 
+  0x005e333b, 0x00ffffff, 0x00572f35, 0x00542e34, 
+  0x00532c33, 0x00502b32, 0x004f2a31, 0x004b292f, 
+  0x0049282e, 0x0046262b, 0x0043252a, 0x003f2529, 
+  0x003d2428, 0x003b2227, 0x00392226, 0x00362125, 
+  0x00342024, 0x00332024, 0x00332024, 0x00382226, 
+  0x004b2e33, 0x00231718, 0x00241e1f, 0x00665154, 
+  0x005f4549, 0x005e3f45, 0x005e3f45, 0x005e3c42, 
+  0x005e3c42, 0x005f3c42, 0x00613b42, 0x00623b42, 
+  0x00653b42, 0x00663b43, 0x00673b43, 0x00683b43, 
+  0x006b3b43, 0x00693a42, 0x00673940, 0x0065383f, 
+  0x0063353d, 0x0061343c, 0x005e333b, 0x00ffffff, 
+  0x00572f35, 0x00542e34, 0x00532c33, 0x00502b32, 
+  0x004f2a31, 0x004b292f, 0x0049282e, 0x0046262b, 
+  0x0043252a, 0x003f2529, 0x003d2428, 0x003b2227, 
+  0x00392226, 0x00362125, 0x00342024, 0x00332024, 
+  0x00332024, 0x00382226, 0x004b2e33, 0x00231718, 
+  0x00241e1f, 0x00665154, 0x005f4549, 0x005e3f45, 
+  0x005e3f45, 0x005e3c42, 0x005e3c42, 0x005f3c42, 
+  0x00613b42, 0x00623b42, 0x00653b42, 0x00663b43, 
+  0x00673b43, 0x00683b43, 0x006b3b43, 0x00693a42, 
+  0x00673940, 0x0065383f, 0x0063353d, 0x00ffffff, 
+  0x00ffffff, 0x005c3038, 0x00572f35, 0x00ffffff, 
+  0x00532c33, 0x00502b32, 0x004f2a31, 0x004b292f, 
+  0x0049282e, 0x0046262b, 0x0043252a, 0x003f2529, 
+  0x003d2428, 0x003b2227, 0x00392226, 0x00362125, 
+  0x00342024, 0x00332024, 0x00332024, 0x00382226, 
+  0x004b2e33, 0x00231718, 0x00221d1d, 0x00654d51, 
+  0x005d3e44, 0x005c3b40, 0x005c3a3f, 0x005c393e, 
+  0x005c383e, 0x005d383e, 0x005e383e, 0x005f383e, 
+  0x0062363e, 0x0063363e, 0x0066363e, 0x0068363f, 
+  0x0069363f, 0x0069363f, 0x0067353e, 0x0066333c, 
+  0x00623139, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00572b33, 0x00542a31, 0x00512930, 0x0050262c, 
+  0x004b252b, 0x0048242a, 0x00462228, 0x00432127, 
+  0x003f2026, 0x003c2025, 0x003a2025, 0x00381f24, 
+  0x00341e21, 0x00321c1f, 0x00311c1f, 0x00311c1f, 
+  0x00301c1f, 0x00321e21, 0x0046282e, 0x00201415, 
+  0x00221d1d, 0x00654d51, 0x005d3e44, 0x005c3b40, 
+  0x005c3a3f, 0x005c393e, 0x005c383e, 0x005d383e, 
+  0x005e383e, 0x005f383e, 0x0062363e, 0x0063363e, 
+  0x0066363e, 0x0068363f, 0x0069363f, 0x0069363f, 
+  0x0067353e, 0x0066333c, 0x00623139, 0x005f3038, 
+  0x005d2e35, 0x00ffffff, 0x00572b33, 0x00542a31, 
+  0x00512930, 0x0050262c, 0x004b252b, 0x0048242a, 
+  0x00462228, 0x00432127, 0x003f2026, 0x003c2025, 
+  0x003a2025, 0x00381f24, 0x00341e21, 0x00321c1f, 
+  0x00311c1f, 0x00311c1f, 0x00301c1f, 0x00321e21, 
+  0x0046282e, 0x00201415, 0x00221d1d, 0x00654d51, 
+  0x005d3e44, 0x005c3b40, 0x005c3a3f, 0x005c393e, 
+  0x005c383e, 0x005d383e, 0x005e383e, 0x005f383e, 
+  0x0062363e, 0x0063363e, 0x0066363e, 0x0068363f, 
+  0x0069363f, 0x0069363f, 0x0067353e, 0x0066333c, 
+  0x00623139, 0x00ffffff, 0x005d2e35, 0x00ffffff, 
+  0x00572b33, 0x00ffffff, 0x00512930, 0x0050262c, 
+  0x004b252b, 0x0048242a, 0x00462228, 0x00432127, 
+  0x003f2026, 0x003c2025, 0x003a2025, 0x00381f24, 
+  0x00341e21, 0x00321c1f, 0x00311c1f, 0x00311c1f, 
+  0x00301c1f, 0x00321e21, 0x0046282e, 0x00201415, 
+  0x00211b1c, 0x0062484d, 0x005b3a3f, 0x005a383d, 
+  0x005a363c, 0x005a353c, 0x005a343b, 0x005b333a, 
+  0x005d333a, 0x005e333b, 0x005f333b, 0x0062333b, 
+  0x0063333b, 0x0066333c, 0x0068323b, 0x006b323c, 
+  0x00682f39, 0x00662e38, 0x00632c35, 0x00ffffff, 
+  0x005c2b33, 0x00ffffff, 0x00552830, 0x0052262e, 
+  0x0050252c, 0x004b242a, 0x00482128, 0x00462128, 
+  0x00441f26, 0x003f1f25, 0x003d1d22, 0x003a1e22, 
+  0x00361b1f, 0x00331b1f, 0x00311a1e, 0x0030181d, 
+  0x002f181c, 0x002f181c, 0x002e181c, 0x00301a1d, 
+  0x00432429, 0x001f1214, 0x00211b1c, 0x0062484d, 
+  0x005b3a3f, 0x005a383d, 0x005a363c, 0x005a353c, 
+  0x005a343b, 0x005b333a, 0x005d333a, 0x005e333b, 
+  0x005f333b, 0x0062333b, 0x0063333b, 0x0066333c, 
+  0x0068323b, 0x006b323c, 0x00682f39, 0x00662e38, 
+  0x00ffffff, 0x005f2c35, 0x005c2b33, 0x00ffffff, 
+  0x00552830, 0x0052262e, 0x0050252c, 0x004b242a, 
+  0x00482128, 0x00462128, 0x00441f26, 0x003f1f25, 
+  0x003d1d22, 0x003a1e22, 0x00361b1f, 0x00331b1f, 
+  0x00311a1e, 0x0030181d, 0x002f181c, 0x002f181c, 
+  0x002e181c, 0x00301a1d, 0x00432429, 0x001f1214, 
+  0x00211b1c, 0x0062484d, 0x005b3a3f, 0x005a383d, 
+  0x005a363c, 0x005a353c, 0x005a343b, 0x005b333a, 
+  0x005d333a, 0x005e333b, 0x005f333b, 0x0062333b, 
+  0x0063333b, 0x0066333c, 0x0068323b, 0x006b323c, 
+  0x00682f39, 0x00662e38, 0x00632c35, 0x00ffffff, 
+  0x005c2b33, 0x00ffffff, 0x00552830, 0x00ffffff, 
+  0x0050252c, 0x004b242a, 0x00482128, 0x00462128, 
+  0x00441f26, 0x003f1f25, 0x003d1d22, 0x003a1e22, 
+  0x00361b1f, 0x00331b1f, 0x00311a1e, 0x0030181d, 
+  0x002f181c, 0x002f181c, 0x002e181c, 0x00301a1d, 
+  0x00432429, 0x001f1214, 0x001f191a, 0x00614549, 
+  0x0059363c, 0x0057343a, 0x00553339, 0x00553036, 
+  0x00573036, 0x00573036, 0x005a2f36, 0x005c2f36, 
+  0x005d2f36, 0x005f2f36, 0x00622f38, 0x00632e36, 
+  0x00672e38, 0x00692e38, 0x00692c36, 0x00662b35, 
+  0x00632a34, 0x00ffffff, 0x005c2730, 0x0058262f, 
+  0x0054242b, 0x0052222a, 0x004f2129, 0x004a2027, 
+  0x00471f26, 0x00451e25, 0x00421d24, 0x003d1b20, 
+  0x003b1a1f, 0x0038181e, 0x0034181d, 0x0032171c, 
+  0x0030161c, 0x002f161b, 0x002c161a, 0x002c161a, 
+  0x002c161a, 0x002e171b, 0x003f2127, 0x001e1113, 
+  0x001f191a, 0x00614549, 0x0059363c, 0x0057343a, 
+  0x00553339, 0x00553036, 0x00573036, 0x00573036, 
+  0x005a2f36, 0x005c2f36, 0x005d2f36, 0x005f2f36, 
+  0x00622f38, 0x00632e36, 0x00672e38, 0x00692e38, 
+  0x00692c36, 0x00662b35, 0x00ffffff, 0x005f2831, 
+  0x005c2730, 0x00ffffff, 0x0054242b, 0x0052222a, 
+  0x004f2129, 0x004a2027, 0x00471f26, 0x00451e25, 
+  0x00421d24, 0x003d1b20, 0x003b1a1f, 0x0038181e, 
+  0x0034181d, 0x0032171c, 0x0030161c, 0x002f161b, 
+  0x002c161a, 0x002c161a, 0x002c161a, 0x002e171b, 
+  0x003f2127, 0x001e1113, 0x001f191a, 0x00614549, 
+  0x0059363c, 0x0057343a, 0x00553339, 0x00553036, 
+  0x00573036, 0x00573036, 0x005a2f36, 0x005c2f36, 
+  0x005d2f36, 0x005f2f36, 0x00622f38, 0x00632e36, 
+  0x00672e38, 0x00692e38, 0x00692c36, 0x00662b35, 
+  0x00632a34, 0x00ffffff, 0x005c2730, 0x00ffffff, 
+  0x0054242b, 0x00ffffff, 0x004f2129, 0x004a2027, 
+  0x00471f26, 0x00451e25, 0x00421d24, 0x003d1b20, 
+  0x003b1a1f, 0x0038181e, 0x0034181d, 0x0032171c, 
+  0x0030161c, 0x002f161b, 0x002c161a, 0x002c161a, 
+  0x002c161a, 0x002e171b, 0x003f2127, 0x001e1113, 
+  0x001e1818, 0x005f4046, 0x00553339, 0x00533035, 
+  0x00532e34, 0x00532e34, 0x00532c33, 0x00552b32, 
+  0x00572b33, 0x005a2b33, 0x005b2b33, 0x005d2b34, 
+  0x005f2a33, 0x00622a33, 0x00652a34, 0x00682a34, 
+  0x00692a35, 0x00682934, 0x00632731, 0x00ffffff, 
+  0x005c242e, 0x0058212a, 0x0054212a, 0x00511f28, 
+  0x004d1f27, 0x00491d25, 0x00471b22, 0x00441a20, 
+  0x003f181f, 0x003d171e, 0x0039171d, 0x0036151b, 
+  0x0032161b, 0x00301418, 0x002f1418, 0x002c1316, 
+  0x002b1317, 0x00291316, 0x00291316, 0x002c1418, 
+  0x003e1f25, 0x001e1012, 0x001e1818, 0x005f4046, 
+  0x00553339, 0x00533035, 0x00532e34, 0x00532e34, 
+  0x00532c33, 0x00552b32, 0x00572b33, 0x005a2b33, 
+  0x005b2b33, 0x005d2b34, 0x005f2a33, 0x00622a33, 
+  0x00652a34, 0x00682a34, 0x00692a35, 0x00682934, 
+  0x00ffffff, 0x005f252f, 0x005c242e, 0x00ffffff, 
+  0x0054212a, 0x00511f28, 0x004d1f27, 0x00491d25, 
+  0x00471b22, 0x00441a20, 0x003f181f, 0x003d171e, 
+  0x0039171d, 0x0036151b, 0x0032161b, 0x00301418, 
+  0x002f1418, 0x002c1316, 0x002b1317, 0x00291316, 
+  0x00291316, 0x002c1418, 0x003e1f25, 0x001e1012, 
+  0x001e1818, 0x005f4046, 0x00553339, 0x00533035, 
+  0x00532e34, 0x00532e34, 0x00532c33, 0x00552b32, 
+  0x00572b33, 0x005a2b33, 0x005b2b33, 0x005d2b34, 
+  0x005f2a33, 0x00622a33, 0x00652a34, 0x00682a34, 
+  0x00692a35, 0x00682934, 0x00632731, 0x00ffffff, 
+  0x005c242e, 0x0058212a, 0x00ffffff, 0x00ffffff, 
+  0x004d1f27, 0x00491d25, 0x00471b22, 0x00441a20, 
+  0x003f181f, 0x003d171e, 0x0039171d, 0x0036151b, 
+  0x0032161b, 0x00301418, 0x002f1418, 0x002c1316, 
+  0x002b1317, 0x00291316, 0x00291316, 0x002c1418, 
+  0x003e1f25, 0x001e1012, 0x001d1717, 0x005d3e44, 
+  0x00522f34, 0x00512c33, 0x00502b32, 0x00502930, 
+  0x00502930, 0x0052282f, 0x00532830, 0x00552830, 
+  0x00582830, 0x005b2831, 0x005d2730, 0x005f2731, 
+  0x00622731, 0x00662732, 0x006b2732, 0x00692732, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005a1f29, 
+  0x00541e27, 0x00511c25, 0x004d1d25, 0x00481a21, 
+  0x00461820, 0x0043171f, 0x003e161d, 0x003b151c, 
+  0x0039141b, 0x00341318, 0x00311217, 0x002f1015, 
+  0x002c0e13, 0x002b1013, 0x00291014, 0x00280e12, 
+  0x00291013, 0x002c1316, 0x003e1d22, 0x001b0b0e, 
+  0x001d1717, 0x005d3e44, 0x00522f34, 0x00512c33, 
+  0x00502b32, 0x00502930, 0x00502930, 0x0052282f, 
+  0x00532830, 0x00552830, 0x00582830, 0x005b2831, 
+  0x005d2730, 0x005f2731, 0x00622731, 0x00662732, 
+  0x006b2732, 0x00692732, 0x0066242f, 0x00ffffff, 
+  0x00ffffff, 0x005a1f29, 0x00541e27, 0x00511c25, 
+  0x004d1d25, 0x00481a21, 0x00461820, 0x0043171f, 
+  0x003e161d, 0x003b151c, 0x0039141b, 0x00341318, 
+  0x00311217, 0x002f1015, 0x002c0e13, 0x002b1013, 
+  0x00291014, 0x00280e12, 0x00291013, 0x002c1316, 
+  0x003e1d22, 0x001b0b0e, 0x001d1717, 0x005d3e44, 
+  0x00522f34, 0x00512c33, 0x00502b32, 0x00502930, 
+  0x00502930, 0x0052282f, 0x00532830, 0x00552830, 
+  0x00582830, 0x005b2831, 0x005d2730, 0x005f2731, 
+  0x00622731, 0x00662732, 0x006b2732, 0x00692732, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005a1f29, 
+  0x00ffffff, 0x00ffffff, 0x004d1d25, 0x00481a21, 
+  0x00461820, 0x0043171f, 0x003e161d, 0x003b151c, 
+  0x0039141b, 0x00341318, 0x00311217, 0x002f1015, 
+  0x002c0e13, 0x002b1013, 0x00291014, 0x00280e12, 
+  0x00291013, 0x002c1316, 0x003e1d22, 0x001b0b0e, 
+  0x001c1516, 0x005b3a3f, 0x004f2b31, 0x004b292f, 
+  0x004b262c, 0x004b262c, 0x004b252b, 0x0050242b, 
+  0x0051242b, 0x0052242b, 0x0054242b, 0x0057242c, 
+  0x005a222b, 0x005d222c, 0x005f222c, 0x0064222e, 
+  0x0068222f, 0x006b222f, 0x0067212e, 0x0063202b, 
+  0x005f1e29, 0x005a1d27, 0x00541c26, 0x00511822, 
+  0x004d1720, 0x0048171f, 0x0046161e, 0x0040151d, 
+  0x003e141b, 0x003b131a, 0x00381218, 0x00331015, 
+  0x00310d12, 0x002e0d13, 0x002b0c11, 0x00290d12, 
+  0x00280d12, 0x00290e13, 0x00270c10, 0x0020080b, 
+  0x00250208, 0x00120102, 0x001c1516, 0x005b3a3f, 
+  0x004f2b31, 0x004b292f, 0x004b262c, 0x004b262c, 
+  0x004b252b, 0x0050242b, 0x0051242b, 0x0052242b, 
+  0x0054242b, 0x0057242c, 0x005a222b, 0x005d222c, 
+  0x005f222c, 0x0064222e, 0x0068222f, 0x006b222f, 
+  0x0067212e, 0x0063202b, 0x005f1e29, 0x005a1d27, 
+  0x00541c26, 0x00511822, 0x004d1720, 0x0048171f, 
+  0x0046161e, 0x0040151d, 0x003e141b, 0x003b131a, 
+  0x00381218, 0x00331015, 0x00310d12, 0x002e0d13, 
+  0x002b0c11, 0x00290d12, 0x00280d12, 0x00290e13, 
+  0x00270c10, 0x0020080b, 0x00250208, 0x00120102, 
+  0x001c1516, 0x005b3a3f, 0x004f2b31, 0x004b292f, 
+  0x004b262c, 0x004b262c, 0x004b252b, 0x0050242b, 
+  0x0051242b, 0x0052242b, 0x0054242b, 0x0057242c, 
+  0x005a222b, 0x005d222c, 0x005f222c, 0x0064222e, 
+  0x0068222f, 0x006b222f, 0x0067212e, 0x0063202b, 
+  0x005f1e29, 0x005a1d27, 0x00541c26, 0x00511822, 
+  0x004d1720, 0x0048171f, 0x0046161e, 0x0040151d, 
+  0x003e141b, 0x003b131a, 0x00381218, 0x00331015, 
+  0x00310d12, 0x002e0d13, 0x002b0c11, 0x00290d12, 
+  0x00280d12, 0x00290e13, 0x00270c10, 0x0020080b, 
+  0x00250208, 0x00120102, 0x001b1314, 0x0059363c, 
+  0x004a282e, 0x0048242a, 0x00482229, 0x00482128, 
+  0x00482128, 0x004a2027, 0x004d2028, 0x004f2028, 
+  0x00522029, 0x00541f28, 0x00571f28, 0x005b1f29, 
+  0x005d1f29, 0x00621f2a, 0x0067202c, 0x0069202c, 
+  0x00691f2b, 0x00641e2a, 0x005f1c27, 0x005b1a25, 
+  0x00541822, 0x00511620, 0x004b151e, 0x0048151e, 
+  0x0045131b, 0x00401218, 0x003d1015, 0x003b0e15, 
+  0x00380d13, 0x00320d14, 0x002f0b10, 0x002c0b11, 
+  0x002b0b11, 0x00290b11, 0x0025090d, 0x00180005, 
+  0x000a0000, 0x00010000, 0x00150000, 0x00120101, 
+  0x001b1314, 0x0059363c, 0x004a282e, 0x0048242a, 
+  0x00482229, 0x00482128, 0x00482128, 0x004a2027, 
+  0x004d2028, 0x004f2028, 0x00522029, 0x00541f28, 
+  0x00571f28, 0x005b1f29, 0x005d1f29, 0x00621f2a, 
+  0x0067202c, 0x0069202c, 0x00691f2b, 0x00641e2a, 
+  0x005f1c27, 0x005b1a25, 0x00541822, 0x00511620, 
+  0x004b151e, 0x0048151e, 0x0045131b, 0x00401218, 
+  0x003d1015, 0x003b0e15, 0x00380d13, 0x00320d14, 
+  0x002f0b10, 0x002c0b11, 0x002b0b11, 0x00290b11, 
+  0x0025090d, 0x00180005, 0x000a0000, 0x00010000, 
+  0x00150000, 0x00120101, 0x001b1314, 0x0059363c, 
+  0x004a282e, 0x0048242a, 0x00482229, 0x00482128, 
+  0x00482128, 0x004a2027, 0x004d2028, 0x004f2028, 
+  0x00522029, 0x00541f28, 0x00571f28, 0x005b1f29, 
+  0x005d1f29, 0x00621f2a, 0x0067202c, 0x0069202c, 
+  0x00691f2b, 0x00641e2a, 0x005f1c27, 0x005b1a25, 
+  0x00541822, 0x00511620, 0x004b151e, 0x0048151e, 
+  0x0045131b, 0x00401218, 0x003d1015, 0x003b0e15, 
+  0x00380d13, 0x00320d14, 0x002f0b10, 0x002c0b11, 
+  0x002b0b11, 0x00290b11, 0x0025090d, 0x00180005, 
+  0x000a0000, 0x00010000, 0x00150000, 0x00120101, 
+  0x001a1213, 0x00553339, 0x00472429, 0x00452027, 
+  0x00451f26, 0x00451e25, 0x00451e25, 0x00471d24, 
+  0x00491d25, 0x004a1d25, 0x004f1d26, 0x00511c25, 
+  0x00541c26, 0x00571c26, 0x005b1c27, 0x005f1c27, 
+  0x00641d29, 0x00681c29, 0x006b1c29, 0x00661c28, 
+  0x00621825, 0x005c1722, 0x00571520, 0x0051141e, 
+  0x004b131d, 0x0048121b, 0x00440e17, 0x00400e16, 
+  0x003d0d15, 0x003a0c13, 0x00380b12, 0x00320b11, 
+  0x00300a10, 0x0029080c, 0x00200106, 0x00130000, 
+  0x00070000, 0x00000000, 0x00010000, 0x00050000, 
+  0x00180000, 0x00120102, 0x001a1213, 0x00553339, 
+  0x00472429, 0x00452027, 0x00451f26, 0x00451e25, 
+  0x00451e25, 0x00471d24, 0x00491d25, 0x004a1d25, 
+  0x004f1d26, 0x00511c25, 0x00541c26, 0x00571c26, 
+  0x005b1c27, 0x005f1c27, 0x00641d29, 0x00681c29, 
+  0x006b1c29, 0x00661c28, 0x00621825, 0x005c1722, 
+  0x00571520, 0x0051141e, 0x004b131d, 0x0048121b, 
+  0x00440e17, 0x00400e16, 0x003d0d15, 0x003a0c13, 
+  0x00380b12, 0x00320b11, 0x00300a10, 0x0029080c, 
+  0x00200106, 0x00130000, 0x00070000, 0x00000000, 
+  0x00010000, 0x00050000, 0x00180000, 0x00120102, 
+  0x001a1213, 0x00553339, 0x00472429, 0x00452027, 
+  0x00451f26, 0x00451e25, 0x00451e25, 0x00471d24, 
+  0x00491d25, 0x004a1d25, 0x004f1d26, 0x00511c25, 
+  0x00541c26, 0x00571c26, 0x005b1c27, 0x005f1c27, 
+  0x00641d29, 0x00681c29, 0x006b1c29, 0x00661c28, 
+  0x00621825, 0x005c1722, 0x00571520, 0x0051141e, 
+  0x004b131d, 0x0048121b, 0x00440e17, 0x00400e16, 
+  0x003d0d15, 0x003a0c13, 0x00380b12, 0x00320b11, 
+  0x00300a10, 0x0029080c, 0x00200106, 0x00130000, 
+  0x00070000, 0x00000000, 0x00010000, 0x00050000, 
+  0x00180000, 0x00120102, 0x00191011, 0x00533035, 
+  0x00442026, 0x003f1d22, 0x003f1b21, 0x00421a20, 
+  0x00441a20, 0x00441a20, 0x00461820, 0x00481820, 
+  0x004a1821, 0x004f1720, 0x00521822, 0x00541822, 
+  0x00581824, 0x005d1824, 0x00621825, 0x00671725, 
+  0x006b1826, 0x00681725, 0x00631522, 0x005d1521, 
+  0x0058141f, 0x0053121d, 0x004d111b, 0x00480e18, 
+  0x00450d16, 0x00400d16, 0x003e0d15, 0x003a0b13, 
+  0x00340911, 0x00270209, 0x001b0001, 0x000e0000, 
+  0x00070000, 0x00020000, 0x00050000, 0x00050000, 
+  0x00050000, 0x00070000, 0x001b0000, 0x00130103, 
+  0x00191011, 0x00533035, 0x00442026, 0x003f1d22, 
+  0x003f1b21, 0x00421a20, 0x00441a20, 0x00441a20, 
+  0x00461820, 0x00481820, 0x004a1821, 0x004f1720, 
+  0x00521822, 0x00541822, 0x00581824, 0x005d1824, 
+  0x00621825, 0x00671725, 0x006b1826, 0x00681725, 
+  0x00631522, 0x005d1521, 0x0058141f, 0x0053121d, 
+  0x004d111b, 0x00480e18, 0x00450d16, 0x00400d16, 
+  0x003e0d15, 0x003a0b13, 0x00340911, 0x00270209, 
+  0x001b0001, 0x000e0000, 0x00070000, 0x00020000, 
+  0x00050000, 0x00050000, 0x00050000, 0x00070000, 
+  0x001b0000, 0x00130103, 0x00191011, 0x00533035, 
+  0x00442026, 0x003f1d22, 0x003f1b21, 0x00421a20, 
+  0x00441a20, 0x00441a20, 0x00461820, 0x00481820, 
+  0x004a1821, 0x004f1720, 0x00521822, 0x00541822, 
+  0x00581824, 0x005d1824, 0x00621825, 0x00671725, 
+  0x006b1826, 0x00681725, 0x00631522, 0x005d1521, 
+  0x0058141f, 0x0053121d, 0x004d111b, 0x00480e18, 
+  0x00450d16, 0x00400d16, 0x003e0d15, 0x003a0b13, 
+  0x00340911, 0x00270209, 0x001b0001, 0x000e0000, 
+  0x00070000, 0x00020000, 0x00050000, 0x00050000, 
+  0x00050000, 0x00070000, 0x001b0000, 0x00130103, 
+  0x00180f0f, 0x00512c33, 0x003f1d22, 0x003c1a1f, 
+  0x003c181e, 0x003d171e, 0x003d161d, 0x0040161d, 
+  0x0043161e, 0x0045161e, 0x0048161f, 0x004a151e, 
+  0x004f151f, 0x0052151f, 0x00551621, 0x005b1621, 
+  0x005f1622, 0x00641522, 0x00691625, 0x00691625, 
+  0x00641522, 0x005e1420, 0x0059131f, 0x0054111b, 
+  0x004d0d17, 0x00480c16, 0x00430912, 0x003a030c, 
+  0x00300008, 0x00260002, 0x001a0000, 0x00110000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x00080000, 
+  0x00070000, 0x00070000, 0x00070000, 0x00080000, 
+  0x001d0000, 0x00140102, 0x00180f0f, 0x00512c33, 
+  0x003f1d22, 0x003c1a1f, 0x003c181e, 0x003d171e, 
+  0x003d161d, 0x0040161d, 0x0043161e, 0x0045161e, 
+  0x0048161f, 0x004a151e, 0x004f151f, 0x0052151f, 
+  0x00551621, 0x005b1621, 0x005f1622, 0x00641522, 
+  0x00691625, 0x00691625, 0x00641522, 0x005e1420, 
+  0x0059131f, 0x0054111b, 0x004d0d17, 0x00480c16, 
+  0x00430912, 0x003a030c, 0x00300008, 0x00260002, 
+  0x001a0000, 0x00110000, 0x000c0000, 0x000b0000, 
+  0x000a0000, 0x00080000, 0x00070000, 0x00070000, 
+  0x00070000, 0x00080000, 0x001d0000, 0x00140102, 
+  0x00180f0f, 0x00512c33, 0x003f1d22, 0x003c1a1f, 
+  0x003c181e, 0x003d171e, 0x003d161d, 0x0040161d, 
+  0x0043161e, 0x0045161e, 0x0048161f, 0x004a151e, 
+  0x004f151f, 0x0052151f, 0x00551621, 0x005b1621, 
+  0x005f1622, 0x00641522, 0x00691625, 0x00691625, 
+  0x00641522, 0x005e1420, 0x0059131f, 0x0054111b, 
+  0x004d0d17, 0x00480c16, 0x00430912, 0x003a030c, 
+  0x00300008, 0x00260002, 0x001a0000, 0x00110000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x00080000, 
+  0x00070000, 0x00070000, 0x00070000, 0x00080000, 
+  0x001d0000, 0x00140102, 0x00160d0e, 0x004f2930, 
+  0x003b1a1f, 0x0039161c, 0x0039151b, 0x0039141b, 
+  0x003a1318, 0x003d131a, 0x003e131b, 0x0043131b, 
+  0x0046131c, 0x0048121a, 0x004b131d, 0x0050141e, 
+  0x0055141f, 0x0058141f, 0x005d131f, 0x0062121f, 
+  0x00671220, 0x006b101e, 0x00650c1b, 0x005c0816, 
+  0x00530512, 0x004a010d, 0x00420007, 0x00380003, 
+  0x002e0000, 0x00260000, 0x001f0000, 0x001c0000, 
+  0x00170000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x000a0000, 
+  0x000a0000, 0x000b0000, 0x001e0000, 0x00140103, 
+  0x00160d0e, 0x004f2930, 0x003b1a1f, 0x0039161c, 
+  0x0039151b, 0x0039141b, 0x003a1318, 0x003d131a, 
+  0x003e131b, 0x0043131b, 0x0046131c, 0x0048121a, 
+  0x004b131d, 0x0050141e, 0x0055141f, 0x0058141f, 
+  0x005d131f, 0x0062121f, 0x00671220, 0x006b101e, 
+  0x00650c1b, 0x005c0816, 0x00530512, 0x004a010d, 
+  0x00420007, 0x00380003, 0x002e0000, 0x00260000, 
+  0x001f0000, 0x001c0000, 0x00170000, 0x00130000, 
+  0x00110000, 0x000e0000, 0x000c0000, 0x000b0000, 
+  0x000a0000, 0x000a0000, 0x000a0000, 0x000b0000, 
+  0x001e0000, 0x00140103, 0x00160d0e, 0x004f2930, 
+  0x003b1a1f, 0x0039161c, 0x0039151b, 0x0039141b, 
+  0x003a1318, 0x003d131a, 0x003e131b, 0x0043131b, 
+  0x0046131c, 0x0048121a, 0x004b131d, 0x0050141e, 
+  0x0055141f, 0x0058141f, 0x005d131f, 0x0062121f, 
+  0x00671220, 0x006b101e, 0x00650c1b, 0x005c0816, 
+  0x00530512, 0x004a010d, 0x00420007, 0x00380003, 
+  0x002e0000, 0x00260000, 0x001f0000, 0x001c0000, 
+  0x00170000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x000a0000, 
+  0x000a0000, 0x000b0000, 0x001e0000, 0x00140103, 
+  0x00150c0d, 0x004b262c, 0x0039161c, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x003f1015, 0x00401017, 0x00440c15, 
+  0x00440a14, 0x00440711, 0x0047020d, 0x004a000c, 
+  0x0051000b, 0x0058000a, 0x0061000b, 0x006c000d, 
+  0x0065000a, 0x00590006, 0x004e0003, 0x00450001, 
+  0x003c0000, 0x00350000, 0x002f0000, 0x00290000, 
+  0x00250000, 0x00210000, 0x001b0000, 0x00170000, 
+  0x00130000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x000c0000, 0x000b0000, 0x000c0000, 
+  0x00210003, 0x00140104, 0x00150c0d, 0x004b262c, 
+  0x0039161c, 0x00341318, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x003f1015, 
+  0x00401017, 0x00440c15, 0x00440a14, 0x00440711, 
+  0x0047020d, 0x004a000c, 0x0051000b, 0x0058000a, 
+  0x0061000b, 0x006c000d, 0x0065000a, 0x00590006, 
+  0x004e0003, 0x00450001, 0x003c0000, 0x00350000, 
+  0x002f0000, 0x00290000, 0x00250000, 0x00210000, 
+  0x001b0000, 0x00170000, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x000d0000, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x000c0000, 0x00210003, 0x00140104, 
+  0x00150c0d, 0x004b262c, 0x0039161c, 0x00341318, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x003a1016, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00440c15, 
+  0x00440a14, 0x00440711, 0x0047020d, 0x004a000c, 
+  0x0051000b, 0x0058000a, 0x0061000b, 0x006c000d, 
+  0x0065000a, 0x00590006, 0x004e0003, 0x00450001, 
+  0x003c0000, 0x00350000, 0x002f0000, 0x00290000, 
+  0x00250000, 0x00210000, 0x001b0000, 0x00170000, 
+  0x00130000, 0x00110000, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x000c0000, 0x000b0000, 0x000c0000, 
+  0x00210003, 0x00140104, 0x00150a0c, 0x0049242a, 
+  0x00341318, 0x00311015, 0x00ffffff, 0x00330e15, 
+  0x00330c12, 0x00320a10, 0x00ffffff, 0x002e0007, 
+  0x002a0005, 0x002a0000, 0x002f0000, 0x00330000, 
+  0x003b0001, 0x00420002, 0x00490002, 0x00540002, 
+  0x005d0008, 0x0069000b, 0x0069000b, 0x005d0009, 
+  0x00530008, 0x00490005, 0x00420003, 0x003b0001, 
+  0x00320000, 0x002e0000, 0x00280000, 0x00240000, 
+  0x001f0000, 0x001b0000, 0x00ffffff, 0x00130000, 
+  0x00110000, 0x000e0000, 0x00ffffff, 0x000d0000, 
+  0x000d0000, 0x000e0000, 0x00220005, 0x00140104, 
+  0x00150a0c, 0x0049242a, 0x00341318, 0x00311015, 
+  0x00320e13, 0x00330e15, 0x00ffffff, 0x00320a10, 
+  0x0030050a, 0x002e0007, 0x002a0005, 0x002a0000, 
+  0x002f0000, 0x00330000, 0x003b0001, 0x00420002, 
+  0x00490002, 0x00540002, 0x005d0008, 0x0069000b, 
+  0x0069000b, 0x005d0009, 0x00530008, 0x00490005, 
+  0x00420003, 0x003b0001, 0x00320000, 0x002e0000, 
+  0x00280000, 0x00240000, 0x001f0000, 0x001b0000, 
+  0x00160000, 0x00ffffff, 0x00110000, 0x000e0000, 
+  0x000e0000, 0x00ffffff, 0x000d0000, 0x000e0000, 
+  0x00220005, 0x00140104, 0x00150a0c, 0x0049242a, 
+  0x00341318, 0x00311015, 0x00320e13, 0x00ffffff, 
+  0x00ffffff, 0x00320a10, 0x00ffffff, 0x00ffffff, 
+  0x002a0005, 0x002a0000, 0x002f0000, 0x00330000, 
+  0x003b0001, 0x00420002, 0x00490002, 0x00540002, 
+  0x005d0008, 0x0069000b, 0x0069000b, 0x005d0009, 
+  0x00530008, 0x00490005, 0x00420003, 0x003b0001, 
+  0x00320000, 0x002e0000, 0x00280000, 0x00240000, 
+  0x001f0000, 0x001b0000, 0x00160000, 0x00ffffff, 
+  0x00110000, 0x000e0000, 0x000e0000, 0x00ffffff, 
+  0x000d0000, 0x000e0000, 0x00220005, 0x00140104, 
+  0x0014090b, 0x00482128, 0x00321015, 0x002f0c11, 
+  0x00ffffff, 0x00220107, 0x00ffffff, 0x00180000, 
+  0x001a0000, 0x001c0000, 0x00240000, 0x00280000, 
+  0x002e0000, 0x00340001, 0x003b0000, 0x00420006, 
+  0x00490006, 0x00520008, 0x005a000a, 0x00650009, 
+  0x006c000d, 0x0061000b, 0x0057000a, 0x004d0008, 
+  0x00460006, 0x003e0005, 0x00390002, 0x00310001, 
+  0x002a0000, 0x00270000, 0x00240000, 0x001d0000, 
+  0x00ffffff, 0x00160000, 0x00130000, 0x00110000, 
+  0x00110000, 0x00100000, 0x000e0000, 0x00110000, 
+  0x00250006, 0x00150205, 0x0014090b, 0x00482128, 
+  0x00321015, 0x002f0c11, 0x0029090e, 0x00220107, 
+  0x00ffffff, 0x00180000, 0x001a0000, 0x001c0000, 
+  0x00240000, 0x00280000, 0x002e0000, 0x00340001, 
+  0x003b0000, 0x00420006, 0x00490006, 0x00520008, 
+  0x005a000a, 0x00650009, 0x006c000d, 0x0061000b, 
+  0x0057000a, 0x004d0008, 0x00460006, 0x003e0005, 
+  0x00390002, 0x00310001, 0x002a0000, 0x00270000, 
+  0x00240000, 0x001d0000, 0x001a0000, 0x00ffffff, 
+  0x00130000, 0x00110000, 0x00ffffff, 0x00100000, 
+  0x000e0000, 0x00110000, 0x00250006, 0x00150205, 
+  0x0014090b, 0x00482128, 0x00321015, 0x002f0c11, 
+  0x0029090e, 0x00ffffff, 0x00ffffff, 0x00180000, 
+  0x00ffffff, 0x00ffffff, 0x00240000, 0x00280000, 
+  0x002e0000, 0x00340001, 0x003b0000, 0x00420006, 
+  0x00490006, 0x00520008, 0x005a000a, 0x00650009, 
+  0x006c000d, 0x0061000b, 0x0057000a, 0x004d0008, 
+  0x00460006, 0x003e0005, 0x00390002, 0x00310001, 
+  0x002a0000, 0x00270000, 0x00240000, 0x001d0000, 
+  0x001a0000, 0x00ffffff, 0x00130000, 0x00110000, 
+  0x00110000, 0x00ffffff, 0x000e0000, 0x00110000, 
+  0x00250006, 0x00150205, 0x0014090a, 0x00451d24, 
+  0x00260508, 0x001a0002, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00170000, 0x001b0000, 0x001e0000, 
+  0x00250000, 0x00290000, 0x002f0000, 0x00330003, 
+  0x003b0005, 0x00400007, 0x00480008, 0x00500009, 
+  0x0059000b, 0x0062000c, 0x006c000e, 0x0064000d, 
+  0x005a000b, 0x00510009, 0x00490008, 0x00420007, 
+  0x003c0003, 0x00340003, 0x00300003, 0x002a0001, 
+  0x00260000, 0x00210000, 0x00ffffff, 0x001a0000, 
+  0x00160000, 0x00130000, 0x00120000, 0x00110000, 
+  0x00110000, 0x00120000, 0x00270007, 0x00150306, 
+  0x0014090a, 0x00451d24, 0x00260508, 0x001a0002, 
+  0x00130000, 0x00120000, 0x00ffffff, 0x00170000, 
+  0x001b0000, 0x001e0000, 0x00250000, 0x00290000, 
+  0x002f0000, 0x00330003, 0x003b0005, 0x00400007, 
+  0x00480008, 0x00500009, 0x0059000b, 0x0062000c, 
+  0x006c000e, 0x0064000d, 0x005a000b, 0x00510009, 
+  0x00490008, 0x00420007, 0x003c0003, 0x00340003, 
+  0x00300003, 0x002a0001, 0x00260000, 0x00210000, 
+  0x001d0000, 0x00ffffff, 0x00160000, 0x00ffffff, 
+  0x00120000, 0x00110000, 0x00110000, 0x00120000, 
+  0x00270007, 0x00150306, 0x0014090a, 0x00451d24, 
+  0x00260508, 0x001a0002, 0x00130000, 0x00ffffff, 
+  0x00130000, 0x00ffffff, 0x001b0000, 0x00ffffff, 
+  0x00250000, 0x00290000, 0x002f0000, 0x00330003, 
+  0x003b0005, 0x00400007, 0x00480008, 0x00500009, 
+  0x0059000b, 0x0062000c, 0x006c000e, 0x0064000d, 
+  0x005a000b, 0x00510009, 0x00490008, 0x00420007, 
+  0x003c0003, 0x00340003, 0x00300003, 0x002a0001, 
+  0x00260000, 0x00210000, 0x001d0000, 0x00ffffff, 
+  0x00160000, 0x00130000, 0x00120000, 0x00ffffff, 
+  0x00110000, 0x00120000, 0x00270007, 0x00150306, 
+  0x00100406, 0x00350a10, 0x00160000, 0x00120000, 
+  0x00ffffff, 0x00150000, 0x00ffffff, 0x001a0000, 
+  0x001d0000, 0x00200000, 0x00260002, 0x002a0002, 
+  0x002f0002, 0x00330005, 0x003a0006, 0x00400007, 
+  0x00470009, 0x004e0009, 0x0057000c, 0x005f000e, 
+  0x00690010, 0x00680010, 0x005e000d, 0x0055000b, 
+  0x004b0009, 0x00460008, 0x003f0007, 0x00390005, 
+  0x00320003, 0x002e0003, 0x00290002, 0x00250000, 
+  0x00ffffff, 0x001c0000, 0x00180000, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00130000, 0x00150000, 
+  0x00280108, 0x00160406, 0x00100406, 0x00350a10, 
+  0x00160000, 0x00120000, 0x00130000, 0x00150000, 
+  0x00ffffff, 0x001a0000, 0x001d0000, 0x00200000, 
+  0x00260002, 0x002a0002, 0x002f0002, 0x00330005, 
+  0x003a0006, 0x00400007, 0x00470009, 0x004e0009, 
+  0x0057000c, 0x005f000e, 0x00690010, 0x00680010, 
+  0x005e000d, 0x0055000b, 0x004b0009, 0x00460008, 
+  0x003f0007, 0x00390005, 0x00320003, 0x002e0003, 
+  0x00290002, 0x00250000, 0x00200000, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00150000, 0x00130000, 
+  0x00130000, 0x00150000, 0x00280108, 0x00160406, 
+  0x00100406, 0x00350a10, 0x00160000, 0x00120000, 
+  0x00130000, 0x00ffffff, 0x00170000, 0x00ffffff, 
+  0x001d0000, 0x00ffffff, 0x00260002, 0x002a0002, 
+  0x002f0002, 0x00330005, 0x003a0006, 0x00400007, 
+  0x00470009, 0x004e0009, 0x0057000c, 0x005f000e, 
+  0x00690010, 0x00680010, 0x005e000d, 0x0055000b, 
+  0x004b0009, 0x00460008, 0x003f0007, 0x00390005, 
+  0x00320003, 0x002e0003, 0x00290002, 0x00250000, 
+  0x00200000, 0x00ffffff, 0x00180000, 0x00170000, 
+  0x00150000, 0x00ffffff, 0x00130000, 0x00150000, 
+  0x00280108, 0x00160406, 0x000d0101, 0x00330810, 
+  0x00180001, 0x00160000, 0x00ffffff, 0x00170000, 
+  0x00180000, 0x001b0000, 0x001d0000, 0x00210001, 
+  0x00270002, 0x002a0003, 0x00300006, 0x00340006, 
+  0x003a0006, 0x003f0008, 0x0047000a, 0x004d000b, 
+  0x0054000d, 0x005e000e, 0x00670011, 0x006b0012, 
+  0x00610011, 0x0059000e, 0x0051000c, 0x0049000a, 
+  0x0044000a, 0x003c0008, 0x00380006, 0x00310005, 
+  0x002e0005, 0x00280003, 0x00ffffff, 0x001e0000, 
+  0x001c0000, 0x001a0000, 0x00ffffff, 0x00160000, 
+  0x00160000, 0x00170000, 0x002b030a, 0x00170406, 
+  0x000d0101, 0x00330810, 0x00180001, 0x00160000, 
+  0x00160000, 0x00170000, 0x00ffffff, 0x001b0000, 
+  0x001d0000, 0x00210001, 0x00270002, 0x002a0003, 
+  0x00300006, 0x00340006, 0x003a0006, 0x003f0008, 
+  0x0047000a, 0x004d000b, 0x0054000d, 0x005e000e, 
+  0x00670011, 0x006b0012, 0x00610011, 0x0059000e, 
+  0x0051000c, 0x0049000a, 0x0044000a, 0x003c0008, 
+  0x00380006, 0x00310005, 0x002e0005, 0x00280003, 
+  0x00220001, 0x00ffffff, 0x001c0000, 0x001a0000, 
+  0x00ffffff, 0x00160000, 0x00160000, 0x00170000, 
+  0x002b030a, 0x00170406, 0x000d0101, 0x00330810, 
+  0x00180001, 0x00160000, 0x00160000, 0x00ffffff, 
+  0x00180000, 0x001b0000, 0x001d0000, 0x00ffffff, 
+  0x00270002, 0x002a0003, 0x00300006, 0x00340006, 
+  0x003a0006, 0x003f0008, 0x0047000a, 0x004d000b, 
+  0x0054000d, 0x005e000e, 0x00670011, 0x006b0012, 
+  0x00610011, 0x0059000e, 0x0051000c, 0x0049000a, 
+  0x0044000a, 0x003c0008, 0x00380006, 0x00310005, 
+  0x002e0005, 0x00280003, 0x00220001, 0x00ffffff, 
+  0x001c0000, 0x001a0000, 0x00180000, 0x00ffffff, 
+  0x00160000, 0x00170000, 0x002b030a, 0x00170406, 
+  0x000e0103, 0x00350a10, 0x001a0002, 0x00180000, 
+  0x00ffffff, 0x00180000, 0x001b0000, 0x001d0000, 
+  0x00ffffff, 0x00220002, 0x00280005, 0x002c0005, 
+  0x00300006, 0x00340006, 0x003a0008, 0x003f0009, 
+  0x0046000b, 0x004b000c, 0x0053000d, 0x005c0111, 
+  0x00640012, 0x006b0113, 0x00640011, 0x005d0011, 
+  0x0053000c, 0x004d000c, 0x0047000b, 0x00400009, 
+  0x003a0008, 0x00340006, 0x00300007, 0x002a0005, 
+  0x00ffffff, 0x00220002, 0x001e0000, 0x001c0000, 
+  0x00ffffff, 0x001a0000, 0x00180000, 0x001a0002, 
+  0x002f0509, 0x00180508, 0x000e0103, 0x00350a10, 
+  0x001a0002, 0x00180000, 0x00180000, 0x00180000, 
+  0x00ffffff, 0x001d0000, 0x00200001, 0x00220002, 
+  0x00280005, 0x002c0005, 0x00300006, 0x00340006, 
+  0x003a0008, 0x003f0009, 0x0046000b, 0x004b000c, 
+  0x0053000d, 0x005c0111, 0x00640012, 0x006b0113, 
+  0x00640011, 0x005d0011, 0x0053000c, 0x004d000c, 
+  0x0047000b, 0x00400009, 0x003a0008, 0x00340006, 
+  0x00300007, 0x002a0005, 0x00270003, 0x00ffffff, 
+  0x001e0000, 0x001c0000, 0x001b0000, 0x00ffffff, 
+  0x00180000, 0x001a0002, 0x002f0509, 0x00180508, 
+  0x000e0103, 0x00350a10, 0x001a0002, 0x00180000, 
+  0x00180000, 0x00ffffff, 0x001b0000, 0x001d0000, 
+  0x00200001, 0x00ffffff, 0x00280005, 0x002c0005, 
+  0x00300006, 0x00340006, 0x003a0008, 0x003f0009, 
+  0x0046000b, 0x004b000c, 0x0053000d, 0x005c0111, 
+  0x00640012, 0x006b0113, 0x00640011, 0x005d0011, 
+  0x0053000c, 0x004d000c, 0x0047000b, 0x00400009, 
+  0x003a0008, 0x00340006, 0x00300007, 0x002a0005, 
+  0x00270003, 0x00ffffff, 0x001e0000, 0x001c0000, 
+  0x001b0000, 0x00ffffff, 0x00180000, 0x001a0002, 
+  0x002f0509, 0x00180508, 0x000f0104, 0x00380c14, 
+  0x001c0003, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00240003, 
+  0x00280005, 0x002c0003, 0x00310007, 0x00340007, 
+  0x003a0009, 0x003e000a, 0x0046000c, 0x004b010d, 
+  0x0052010e, 0x005a0112, 0x00620514, 0x006b0314, 
+  0x00680314, 0x005f020e, 0x00570110, 0x0051000d, 
+  0x0049010d, 0x0045000b, 0x003d0009, 0x00390008, 
+  0x00330007, 0x002f0006, 0x002a0005, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x001d0001, 0x001c0001, 
+  0x001b0002, 0x001c0002, 0x002f070c, 0x00180608, 
+  0x000f0104, 0x00380c14, 0x001c0003, 0x001a0000, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00240003, 0x00280005, 0x002c0003, 
+  0x00310007, 0x00340007, 0x003a0009, 0x003e000a, 
+  0x0046000c, 0x004b010d, 0x0052010e, 0x005a0112, 
+  0x00620514, 0x006b0314, 0x00680314, 0x005f020e, 
+  0x00570110, 0x0051000d, 0x0049010d, 0x0045000b, 
+  0x003d0009, 0x00390008, 0x00330007, 0x002f0006, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00200002, 
+  0x001d0001, 0x00ffffff, 0x00ffffff, 0x001c0002, 
+  0x002f070c, 0x00180608, 0x000f0104, 0x00380c14, 
+  0x001c0003, 0x001a0000, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x001d0001, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x002c0003, 0x00310007, 0x00340007, 
+  0x003a0009, 0x003e000a, 0x0046000c, 0x004b010d, 
+  0x0052010e, 0x005a0112, 0x00620514, 0x006b0314, 
+  0x00680314, 0x005f020e, 0x00570110, 0x0051000d, 
+  0x0049010d, 0x0045000b, 0x003d0009, 0x00390008, 
+  0x00330007, 0x002f0006, 0x002a0005, 0x00250003, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x001c0001, 
+  0x001b0002, 0x001c0002, 0x002f070c, 0x00180608, 
+  0x000f0103, 0x003a0d15, 0x001d0005, 0x001b0002, 
+  0x001b0002, 0x001c0002, 0x001d0002, 0x001e0002, 
+  0x00220003, 0x00250005, 0x00290006, 0x002e0007, 
+  0x00310008, 0x00350008, 0x003a0008, 0x003e000a, 
+  0x0045010c, 0x004a020e, 0x00510210, 0x00580513, 
+  0x00610615, 0x00680717, 0x006b0616, 0x00630614, 
+  0x005b0513, 0x00530210, 0x004e010e, 0x0048020e, 
+  0x0040010c, 0x003c000a, 0x00380009, 0x00320008, 
+  0x002e0007, 0x00290006, 0x00250003, 0x00220003, 
+  0x00200002, 0x001e0002, 0x001d0002, 0x001e0003, 
+  0x00310910, 0x00190609, 0x000f0103, 0x003a0d15, 
+  0x001d0005, 0x001b0002, 0x001b0002, 0x001c0002, 
+  0x001d0002, 0x001e0002, 0x00220003, 0x00250005, 
+  0x00290006, 0x002e0007, 0x00310008, 0x00350008, 
+  0x003a0008, 0x003e000a, 0x0045010c, 0x004a020e, 
+  0x00510210, 0x00580513, 0x00610615, 0x00680717, 
+  0x006b0616, 0x00630614, 0x005b0513, 0x00530210, 
+  0x004e010e, 0x0048020e, 0x0040010c, 0x003c000a, 
+  0x00380009, 0x00320008, 0x002e0007, 0x00290006, 
+  0x00250003, 0x00220003, 0x00200002, 0x001e0002, 
+  0x001d0002, 0x001e0003, 0x00310910, 0x00190609, 
+  0x000f0103, 0x003a0d15, 0x001d0005, 0x001b0002, 
+  0x001b0002, 0x001c0002, 0x001d0002, 0x001e0002, 
+  0x00220003, 0x00250005, 0x00290006, 0x002e0007, 
+  0x00310008, 0x00350008, 0x003a0008, 0x003e000a, 
+  0x0045010c, 0x004a020e, 0x00510210, 0x00580513, 
+  0x00610615, 0x00680717, 0x006b0616, 0x00630614, 
+  0x005b0513, 0x00530210, 0x004e010e, 0x0048020e, 
+  0x0040010c, 0x003c000a, 0x00380009, 0x00320008, 
+  0x002e0007, 0x00290006, 0x00250003, 0x00220003, 
+  0x00200002, 0x001e0002, 0x001d0002, 0x001e0003, 
+  0x00310910, 0x00190609, 0x000f0305, 0x003c1017, 
+  0x00200005, 0x001c0003, 0x001d0002, 0x001d0002, 
+  0x001e0002, 0x00200002, 0x00240005, 0x00260005, 
+  0x002a0007, 0x002f0008, 0x00320009, 0x00350009, 
+  0x003b000a, 0x003f010b, 0x0046020d, 0x004a020d, 
+  0x00510512, 0x00570613, 0x005d0715, 0x00670816, 
+  0x006b091a, 0x00650817, 0x005d0715, 0x00570613, 
+  0x00510512, 0x004b0310, 0x0046020d, 0x003f010b, 
+  0x003b000a, 0x00350009, 0x00310008, 0x002e0007, 
+  0x00270006, 0x00250005, 0x00220005, 0x00210003, 
+  0x00200003, 0x00210005, 0x00330b12, 0x0019070a, 
+  0x000f0305, 0x003c1017, 0x00200005, 0x001c0003, 
+  0x001d0002, 0x001d0002, 0x001e0002, 0x00200002, 
+  0x00240005, 0x00260005, 0x002a0007, 0x002f0008, 
+  0x00320009, 0x00350009, 0x003b000a, 0x003f010b, 
+  0x0046020d, 0x004a020d, 0x00510512, 0x00570613, 
+  0x005d0715, 0x00670816, 0x006b091a, 0x00650817, 
+  0x005d0715, 0x00570613, 0x00510512, 0x004b0310, 
+  0x0046020d, 0x003f010b, 0x003b000a, 0x00350009, 
+  0x00310008, 0x002e0007, 0x00270006, 0x00250005, 
+  0x00220005, 0x00210003, 0x00200003, 0x00210005, 
+  0x00330b12, 0x0019070a, 0x000f0305, 0x003c1017, 
+  0x00200005, 0x001c0003, 0x001d0002, 0x001d0002, 
+  0x001e0002, 0x00200002, 0x00240005, 0x00260005, 
+  0x002a0007, 0x002f0008, 0x00320009, 0x00350009, 
+  0x003b000a, 0x003f010b, 0x0046020d, 0x004a020d, 
+  0x00510512, 0x00570613, 0x005d0715, 0x00670816, 
+  0x006b091a, 0x00650817, 0x005d0715, 0x00570613, 
+  0x00510512, 0x004b0310, 0x0046020d, 0x003f010b, 
+  0x003b000a, 0x00350009, 0x00310008, 0x002e0007, 
+  0x00270006, 0x00250005, 0x00220005, 0x00210003, 
+  0x00200003, 0x00210005, 0x00330b12, 0x0019070a, 
+  0x000f0305, 0x003d1217, 0x00210107, 0x001d0005, 
+  0x001e0003, 0x001e0003, 0x00200003, 0x00220005, 
+  0x00240006, 0x00270006, 0x002a0007, 0x00300009, 
+  0x00320109, 0x00380009, 0x003b020c, 0x003f020c, 
+  0x0046030e, 0x004a0611, 0x00500712, 0x00550714, 
+  0x005c0815, 0x00640917, 0x006b0b1b, 0x00680a18, 
+  0x00620917, 0x005b0816, 0x00540714, 0x004e0713, 
+  0x00490611, 0x0045030e, 0x003e020c, 0x003a010b, 
+  0x0034010a, 0x00300008, 0x002c0008, 0x00280007, 
+  0x00260006, 0x00240006, 0x00220005, 0x00240107, 
+  0x00380c12, 0x001a080a, 0x000f0305, 0x003d1217, 
+  0x00210107, 0x001d0005, 0x001e0003, 0x001e0003, 
+  0x00200003, 0x00220005, 0x00240006, 0x00270006, 
+  0x002a0007, 0x00300009, 0x00320109, 0x00380009, 
+  0x003b020c, 0x003f020c, 0x0046030e, 0x004a0611, 
+  0x00500712, 0x00550714, 0x005c0815, 0x00640917, 
+  0x006b0b1b, 0x00680a18, 0x00620917, 0x005b0816, 
+  0x00540714, 0x004e0713, 0x00490611, 0x0045030e, 
+  0x003e020c, 0x003a010b, 0x0034010a, 0x00300008, 
+  0x002c0008, 0x00280007, 0x00260006, 0x00240006, 
+  0x00220005, 0x00240107, 0x00380c12, 0x001a080a, 
+  0x000f0305, 0x003d1217, 0x00210107, 0x001d0005, 
+  0x001e0003, 0x001e0003, 0x00200003, 0x00220005, 
+  0x00240006, 0x00270006, 0x002a0007, 0x00300009, 
+  0x00320109, 0x00380009, 0x003b020c, 0x003f020c, 
+  0x0046030e, 0x004a0611, 0x00500712, 0x00550714, 
+  0x005c0815, 0x00640917, 0x006b0b1b, 0x00680a18, 
+  0x00620917, 0x005b0816, 0x00540714, 0x004e0713, 
+  0x00490611, 0x0045030e, 0x003e020c, 0x003a010b, 
+  0x0034010a, 0x00300008, 0x002c0008, 0x00280007, 
+  0x00260006, 0x00240006, 0x00220005, 0x00240107, 
+  0x00380c12, 0x001a080a, 0x00100305, 0x003e141b, 
+  0x00220208, 0x00200006, 0x00200006, 0x00200006, 
+  0x00210006, 0x00220006, 0x00250007, 0x00270108, 
+  0x002c0109, 0x0030020a, 0x0032030b, 0x0038020b, 
+  0x003b030c, 0x003e0610, 0x00440711, 0x00490813, 
+  0x004e0813, 0x00540a16, 0x005b0a17, 0x00620b1a, 
+  0x00690c1b, 0x006b0c1b, 0x00640b1a, 0x005d0a17, 
+  0x00570916, 0x00520914, 0x004b0813, 0x00460711, 
+  0x00400610, 0x003c030d, 0x0038020b, 0x0032030b, 
+  0x0030020a, 0x002c0109, 0x00280108, 0x00270108, 
+  0x00260108, 0x00270309, 0x003a0e14, 0x001a090b, 
+  0x00100305, 0x003e141b, 0x00220208, 0x00200006, 
+  0x00200006, 0x00200006, 0x00210006, 0x00220006, 
+  0x00250007, 0x00270108, 0x002c0109, 0x0030020a, 
+  0x0032030b, 0x0038020b, 0x003b030c, 0x003e0610, 
+  0x00440711, 0x00490813, 0x004e0813, 0x00540a16, 
+  0x005b0a17, 0x00620b1a, 0x00690c1b, 0x006b0c1b, 
+  0x00640b1a, 0x005d0a17, 0x00570916, 0x00520914, 
+  0x004b0813, 0x00460711, 0x00400610, 0x003c030d, 
+  0x0038020b, 0x0032030b, 0x0030020a, 0x002c0109, 
+  0x00280108, 0x00270108, 0x00260108, 0x00270309, 
+  0x003a0e14, 0x001a090b, 0x00100305, 0x003e141b, 
+  0x00220208, 0x00200006, 0x00200006, 0x00200006, 
+  0x00210006, 0x00220006, 0x00250007, 0x00270108, 
+  0x002c0109, 0x0030020a, 0x0032030b, 0x0038020b, 
+  0x003b030c, 0x003e0610, 0x00440711, 0x00490813, 
+  0x004e0813, 0x00540a16, 0x005b0a17, 0x00620b1a, 
+  0x00690c1b, 0x006b0c1b, 0x00640b1a, 0x005d0a17, 
+  0x00570916, 0x00520914, 0x004b0813, 0x00460711, 
+  0x00400610, 0x003c030d, 0x0038020b, 0x0032030b, 
+  0x0030020a, 0x002c0109, 0x00280108, 0x00270108, 
+  0x00260108, 0x00270309, 0x003a0e14, 0x001a090b, 
+  0x00100406, 0x003e161d, 0x0024050a, 0x00200208, 
+  0x00200107, 0x00210107, 0x00220107, 0x00240107, 
+  0x00260208, 0x00280209, 0x002b030a, 0x0030030b, 
+  0x0032050c, 0x0038070e, 0x003b060e, 0x003e070e, 
+  0x00440811, 0x00470912, 0x004e0a15, 0x00530b16, 
+  0x00590b18, 0x005f0d1b, 0x0068101e, 0x006c1120, 
+  0x0066101e, 0x005f0c1a, 0x005b0b17, 0x00540c18, 
+  0x004e0a14, 0x00480913, 0x00450811, 0x003e0811, 
+  0x003b060d, 0x0035070e, 0x0032050c, 0x0030030b, 
+  0x002e030a, 0x0029030a, 0x0029030a, 0x0029070c, 
+  0x003c1217, 0x001b090d, 0x00100406, 0x003e161d, 
+  0x0024050a, 0x00200208, 0x00200107, 0x00210107, 
+  0x00220107, 0x00240107, 0x00260208, 0x00280209, 
+  0x002b030a, 0x0030030b, 0x0032050c, 0x0038070e, 
+  0x003b060e, 0x003e070e, 0x00440811, 0x00470912, 
+  0x004e0a15, 0x00530b16, 0x00590b18, 0x005f0d1b, 
+  0x0068101e, 0x006c1120, 0x0066101e, 0x005f0c1a, 
+  0x005b0b17, 0x00540c18, 0x004e0a14, 0x00480913, 
+  0x00450811, 0x003e0811, 0x003b060d, 0x0035070e, 
+  0x0032050c, 0x0030030b, 0x002e030a, 0x0029030a, 
+  0x0029030a, 0x0029070c, 0x003c1217, 0x001b090d, 
+  0x00100406, 0x003e161d, 0x0024050a, 0x00200208, 
+  0x00200107, 0x00210107, 0x00220107, 0x00240107, 
+  0x00260208, 0x00280209, 0x002b030a, 0x0030030b, 
+  0x0032050c, 0x0038070e, 0x003b060e, 0x003e070e, 
+  0x00440811, 0x00470912, 0x004e0a15, 0x00530b16, 
+  0x00590b18, 0x005f0d1b, 0x0068101e, 0x006c1120, 
+  0x0066101e, 0x005f0c1a, 0x005b0b17, 0x00540c18, 
+  0x004e0a14, 0x00480913, 0x00450811, 0x003e0811, 
+  0x003b060d, 0x0035070e, 0x0032050c, 0x0030030b, 
+  0x002e030a, 0x0029030a, 0x0029030a, 0x0029070c, 
+  0x003c1217, 0x001b090d, 0x00100506, 0x003f171d, 
+  0x0025070c, 0x00210309, 0x00220309, 0x00220309, 
+  0x00220309, 0x00250309, 0x00260309, 0x00280309, 
+  0x002c050b, 0x002f070d, 0x0033070d, 0x0035080e, 
+  0x003a0911, 0x003e0912, 0x00430a14, 0x00470a13, 
+  0x004b0c17, 0x00520c17, 0x00580e1b, 0x005e101c, 
+  0x0064111e, 0x00691321, 0x00681220, 0x0062111e, 
+  0x005d101d, 0x00570e1b, 0x00520c17, 0x004b0c17, 
+  0x00470b15, 0x00430a14, 0x003d0810, 0x003a0911, 
+  0x00350810, 0x0032070e, 0x002f070d, 0x002e070d, 
+  0x002c070d, 0x002e080d, 0x003f141a, 0x001c0a0d, 
+  0x00100506, 0x003f171d, 0x0025070c, 0x00210309, 
+  0x00220309, 0x00220309, 0x00220309, 0x00250309, 
+  0x00260309, 0x00280309, 0x002c050b, 0x002f070d, 
+  0x0033070d, 0x0035080e, 0x003a0911, 0x003e0912, 
+  0x00430a14, 0x00470a13, 0x004b0c17, 0x00520c17, 
+  0x00580e1b, 0x005e101c, 0x0064111e, 0x00691321, 
+  0x00681220, 0x0062111e, 0x005d101d, 0x00570e1b, 
+  0x00520c17, 0x004b0c17, 0x00470b15, 0x00430a14, 
+  0x003d0810, 0x003a0911, 0x00350810, 0x0032070e, 
+  0x002f070d, 0x002e070d, 0x002c070d, 0x002e080d, 
+  0x003f141a, 0x001c0a0d, 0x00100506, 0x003f171d, 
+  0x0025070c, 0x00210309, 0x00220309, 0x00220309, 
+  0x00220309, 0x00250309, 0x00260309, 0x00280309, 
+  0x002c050b, 0x002f070d, 0x0033070d, 0x0035080e, 
+  0x003a0911, 0x003e0912, 0x00430a14, 0x00470a13, 
+  0x004b0c17, 0x00520c17, 0x00580e1b, 0x005e101c, 
+  0x0064111e, 0x00691321, 0x00681220, 0x0062111e, 
+  0x005d101d, 0x00570e1b, 0x00520c17, 0x004b0c17, 
+  0x00470b15, 0x00430a14, 0x003d0810, 0x003a0911, 
+  0x00350810, 0x0032070e, 0x002f070d, 0x002e070d, 
+  0x002c070d, 0x002e080d, 0x003f141a, 0x001c0a0d, 
+  0x00100506, 0x003f1a20, 0x00250a0e, 0x0022080c, 
+  0x0022050a, 0x0022050a, 0x0024050a, 0x0026050a, 
+  0x0027050c, 0x0029070c, 0x002c070c, 0x002f080d, 
+  0x00330910, 0x00350910, 0x003a0a11, 0x003d0b14, 
+  0x00400b14, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x0057111c, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00691524, 0x00641421, 0x005f1320, 0x005b121e, 
+  0x0055111b, 0x00510e1a, 0x004a0d17, 0x00460c16, 
+  0x00400a12, 0x003d0b14, 0x003a0a11, 0x00350910, 
+  0x0033090e, 0x00310910, 0x0030090e, 0x00310a10, 
+  0x0043171f, 0x001c0b0d, 0x00100506, 0x003f1a20, 
+  0x00250a0e, 0x0022080c, 0x0022050a, 0x0022050a, 
+  0x0024050a, 0x0026050a, 0x0027050c, 0x0029070c, 
+  0x002c070c, 0x002f080d, 0x00330910, 0x00350910, 
+  0x003a0a11, 0x003d0b14, 0x00400b14, 0x00460c16, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005d131f, 
+  0x00621320, 0x00681422, 0x00691524, 0x00641421, 
+  0x005f1320, 0x005b121e, 0x0055111b, 0x00510e1a, 
+  0x004a0d17, 0x00460c16, 0x00400a12, 0x003d0b14, 
+  0x003a0a11, 0x00350910, 0x0033090e, 0x00310910, 
+  0x0030090e, 0x00310a10, 0x0043171f, 0x001c0b0d, 
+  0x00100506, 0x003f1a20, 0x00250a0e, 0x0022080c, 
+  0x0022050a, 0x0022050a, 0x0024050a, 0x0026050a, 
+  0x0027050c, 0x0029070c, 0x002c070c, 0x002f080d, 
+  0x00330910, 0x00350910, 0x003a0a11, 0x003d0b14, 
+  0x00400b14, 0x00460c16, 0x004a0d16, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00681422, 
+  0x00691524, 0x00641421, 0x005f1320, 0x005b121e, 
+  0x0055111b, 0x00510e1a, 0x004a0d17, 0x00460c16, 
+  0x00400a12, 0x003d0b14, 0x003a0a11, 0x00350910, 
+  0x0033090e, 0x00310910, 0x0030090e, 0x00310a10, 
+  0x0043171f, 0x001c0b0d, 0x00100506, 0x00421d24, 
+  0x00260b0e, 0x0024090d, 0x0024080b, 0x0024080c, 
+  0x0025070c, 0x0026070c, 0x0027080d, 0x0029080c, 
+  0x002c090e, 0x002f090e, 0x00320a10, 0x00350b12, 
+  0x003a0c14, 0x003d0d15, 0x00400d15, 0x00450d15, 
+  0x00ffffff, 0x004f121c, 0x0054131e, 0x005b1420, 
+  0x00ffffff, 0x00661624, 0x006b1726, 0x00681624, 
+  0x00621522, 0x005d1521, 0x0058141f, 0x0052131e, 
+  0x004f121c, 0x00490e16, 0x00450d15, 0x00400d16, 
+  0x003d0d15, 0x003a0c14, 0x00380b12, 0x00380b12, 
+  0x00340c12, 0x00340d14, 0x00461a21, 0x001d0c0e, 
+  0x00100506, 0x00421d24, 0x00260b0e, 0x0024090d, 
+  0x0024080b, 0x0024080c, 0x0025070c, 0x0026070c, 
+  0x0027080d, 0x0029080c, 0x002c090e, 0x002f090e, 
+  0x00320a10, 0x00350b12, 0x003a0c14, 0x003d0d15, 
+  0x00400d15, 0x00450d15, 0x00490e16, 0x00ffffff, 
+  0x0054131e, 0x005b1420, 0x00611622, 0x00661624, 
+  0x006b1726, 0x00681624, 0x00621522, 0x005d1521, 
+  0x0058141f, 0x0052131e, 0x004f121c, 0x00490e16, 
+  0x00450d15, 0x00400d16, 0x003d0d15, 0x003a0c14, 
+  0x00380b12, 0x00380b12, 0x00340c12, 0x00340d14, 
+  0x00461a21, 0x001d0c0e, 0x00100506, 0x00421d24, 
+  0x00260b0e, 0x0024090d, 0x0024080b, 0x0024080c, 
+  0x0025070c, 0x0026070c, 0x0027080d, 0x0029080c, 
+  0x002c090e, 0x002f090e, 0x00320a10, 0x00350b12, 
+  0x003a0c14, 0x003d0d15, 0x00400d15, 0x00450d15, 
+  0x00490e16, 0x004f121c, 0x00ffffff, 0x005b1420, 
+  0x00611622, 0x00ffffff, 0x006b1726, 0x00681624, 
+  0x00621522, 0x005d1521, 0x0058141f, 0x0052131e, 
+  0x004f121c, 0x00490e16, 0x00450d15, 0x00400d16, 
+  0x003d0d15, 0x003a0c14, 0x00380b12, 0x00380b12, 
+  0x00340c12, 0x00340d14, 0x00461a21, 0x001d0c0e, 
+  0x00100607, 0x00431f25, 0x00270c10, 0x00240a0e, 
+  0x00240a0e, 0x0025090c, 0x0025090c, 0x00260a0e, 
+  0x0028090e, 0x0029090d, 0x002c0a0e, 0x002f0b11, 
+  0x00320b11, 0x00340c12, 0x003a0d15, 0x003c0e16, 
+  0x00401017, 0x00450e15, 0x00ffffff, 0x004d131d, 
+  0x0052141e, 0x00591621, 0x00ffffff, 0x00631825, 
+  0x00691826, 0x00691826, 0x00641725, 0x00611724, 
+  0x005c1622, 0x00581520, 0x0052141e, 0x004d131d, 
+  0x0048121b, 0x00450e15, 0x00401017, 0x003e0e15, 
+  0x003c0e16, 0x003b0e16, 0x003a0e16, 0x003b1017, 
+  0x00491d25, 0x001d0d0f, 0x00100607, 0x00431f25, 
+  0x00270c10, 0x00240a0e, 0x00240a0e, 0x0025090c, 
+  0x0025090c, 0x00260a0e, 0x0028090e, 0x0029090d, 
+  0x002c0a0e, 0x002f0b11, 0x00320b11, 0x00340c12, 
+  0x003a0d15, 0x003c0e16, 0x00401017, 0x00450e15, 
+  0x0048121b, 0x00ffffff, 0x0052141e, 0x00591621, 
+  0x005e1724, 0x00631825, 0x00691826, 0x00691826, 
+  0x00641725, 0x00611724, 0x005c1622, 0x00581520, 
+  0x0052141e, 0x004d131d, 0x0048121b, 0x00450e15, 
+  0x00401017, 0x003e0e15, 0x003c0e16, 0x003b0e16, 
+  0x003a0e16, 0x003b1017, 0x00491d25, 0x001d0d0f, 
+  0x00100607, 0x00431f25, 0x00270c10, 0x00240a0e, 
+  0x00240a0e, 0x0025090c, 0x0025090c, 0x00260a0e, 
+  0x0028090e, 0x0029090d, 0x002c0a0e, 0x002f0b11, 
+  0x00320b11, 0x00340c12, 0x003a0d15, 0x003c0e16, 
+  0x00401017, 0x00450e15, 0x0048121b, 0x004d131d, 
+  0x00ffffff, 0x00591621, 0x005e1724, 0x00ffffff, 
+  0x00691826, 0x00691826, 0x00641725, 0x00611724, 
+  0x005c1622, 0x00581520, 0x0052141e, 0x004d131d, 
+  0x0048121b, 0x00450e15, 0x00401017, 0x003e0e15, 
+  0x003c0e16, 0x003b0e16, 0x003a0e16, 0x003b1017, 
+  0x00491d25, 0x001d0d0f, 0x00110608, 0x00432026, 
+  0x00270d11, 0x00250b10, 0x00250a0d, 0x00250a0e, 
+  0x00260a0d, 0x0027090d, 0x00280a10, 0x00290a0e, 
+  0x002c0b11, 0x002f0c12, 0x00320c12, 0x00340d14, 
+  0x003a0e16, 0x003c1017, 0x003f121a, 0x0044131b, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00621a26, 0x00671b28, 0x006b1c29, 
+  0x00671d29, 0x00631a26, 0x005f1825, 0x005b1722, 
+  0x00541620, 0x0050151f, 0x004b141d, 0x0048131c, 
+  0x0045131c, 0x0043131b, 0x003f1218, 0x003e121a, 
+  0x003e121a, 0x003e131b, 0x004b1f27, 0x001e0d0f, 
+  0x00110608, 0x00432026, 0x00270d11, 0x00250b10, 
+  0x00250a0d, 0x00250a0e, 0x00260a0d, 0x0027090d, 
+  0x00280a10, 0x00290a0e, 0x002c0b11, 0x002f0c12, 
+  0x00320c12, 0x00340d14, 0x003a0e16, 0x003c1017, 
+  0x003f121a, 0x0044131b, 0x0048131c, 0x00ffffff, 
+  0x0051151f, 0x00571722, 0x005d1824, 0x00621a26, 
+  0x00671b28, 0x006b1c29, 0x00671d29, 0x00631a26, 
+  0x005f1825, 0x005b1722, 0x00541620, 0x0050151f, 
+  0x004b141d, 0x0048131c, 0x0045131c, 0x0043131b, 
+  0x003f1218, 0x003e121a, 0x003e121a, 0x003e131b, 
+  0x004b1f27, 0x001e0d0f, 0x00110608, 0x00432026, 
+  0x00270d11, 0x00250b10, 0x00250a0d, 0x00250a0e, 
+  0x00260a0d, 0x0027090d, 0x00280a10, 0x00290a0e, 
+  0x002c0b11, 0x002f0c12, 0x00320c12, 0x00340d14, 
+  0x003a0e16, 0x003c1017, 0x003f121a, 0x0044131b, 
+  0x0048131c, 0x004d141e, 0x00ffffff, 0x00571722, 
+  0x005d1824, 0x00ffffff, 0x00671b28, 0x006b1c29, 
+  0x00671d29, 0x00631a26, 0x005f1825, 0x005b1722, 
+  0x00541620, 0x0050151f, 0x004b141d, 0x0048131c, 
+  0x0045131c, 0x0043131b, 0x003f1218, 0x003e121a, 
+  0x003e121a, 0x003e131b, 0x004b1f27, 0x001e0d0f, 
+  0x00110608, 0x00442127, 0x00270e12, 0x00250c11, 
+  0x00250c11, 0x00250b0e, 0x00260b0e, 0x00270c11, 
+  0x00280c11, 0x002b0b10, 0x002c0c12, 0x00300d13, 
+  0x00320d14, 0x00340e14, 0x003a1016, 0x003c1218, 
+  0x003f131b, 0x0044141b, 0x00ffffff, 0x004b151e, 
+  0x00511721, 0x00551822, 0x00ffffff, 0x00611c26, 
+  0x00641e2a, 0x00691f2b, 0x00691f2b, 0x00661e2a, 
+  0x00621d28, 0x005d1c27, 0x00581824, 0x00531721, 
+  0x00501620, 0x004b161f, 0x0048151e, 0x0046151d, 
+  0x0044151d, 0x0043151d, 0x0043151d, 0x0044151e, 
+  0x00502129, 0x001e0f11, 0x00110608, 0x00442127, 
+  0x00270e12, 0x00250c11, 0x00250c11, 0x00250b0e, 
+  0x00260b0e, 0x00270c11, 0x00280c11, 0x002b0b10, 
+  0x002c0c12, 0x00300d13, 0x00320d14, 0x00340e14, 
+  0x003a1016, 0x003c1218, 0x003f131b, 0x0044141b, 
+  0x0048151e, 0x00ffffff, 0x00511721, 0x00551822, 
+  0x005c1a25, 0x00611c26, 0x00641e2a, 0x00691f2b, 
+  0x00691f2b, 0x00661e2a, 0x00621d28, 0x005d1c27, 
+  0x00581824, 0x00531721, 0x00501620, 0x004b161f, 
+  0x0048151e, 0x0046151d, 0x0044151d, 0x0043151d, 
+  0x0043151d, 0x0044151e, 0x00502129, 0x001e0f11, 
+  0x00110608, 0x00442127, 0x00270e12, 0x00250c11, 
+  0x00250c11, 0x00250b0e, 0x00260b0e, 0x00270c11, 
+  0x00280c11, 0x002b0b10, 0x002c0c12, 0x00300d13, 
+  0x00320d14, 0x00340e14, 0x003a1016, 0x003c1218, 
+  0x003f131b, 0x0044141b, 0x0048151e, 0x004b151e, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00611c26, 
+  0x00641e2a, 0x00691f2b, 0x00691f2b, 0x00661e2a, 
+  0x00621d28, 0x005d1c27, 0x00581824, 0x00531721, 
+  0x00501620, 0x004b161f, 0x0048151e, 0x0046151d, 
+  0x0044151d, 0x0043151d, 0x0043151d, 0x0044151e, 
+  0x00502129, 0x001e0f11, 0x00110708, 0x00452429, 
+  0x00281013, 0x00250d12, 0x00250c10, 0x00260c10, 
+  0x00270c10, 0x00270c10, 0x00290d12, 0x002c0c11, 
+  0x002e0d13, 0x00310e13, 0x00331015, 0x00341014, 
+  0x00391217, 0x003d131a, 0x0040141d, 0x0044151e, 
+  0x00ffffff, 0x004b1620, 0x00501821, 0x00541a24, 
+  0x00ffffff, 0x005f1e29, 0x00631f2a, 0x0067202c, 
+  0x006b212e, 0x0068202c, 0x00641f2a, 0x005f1e29, 
+  0x005b1d27, 0x00571c26, 0x00531a24, 0x00501821, 
+  0x004b1821, 0x00491720, 0x0048171f, 0x0046171f, 
+  0x0046171f, 0x00481820, 0x0053242b, 0x001e1012, 
+  0x00110708, 0x00452429, 0x00281013, 0x00250d12, 
+  0x00250c10, 0x00260c10, 0x00270c10, 0x00270c10, 
+  0x00290d12, 0x002c0c11, 0x002e0d13, 0x00310e13, 
+  0x00331015, 0x00341014, 0x00391217, 0x003d131a, 
+  0x0040141d, 0x0044151e, 0x0048161f, 0x00ffffff, 
+  0x00501821, 0x00541a24, 0x00ffffff, 0x005f1e29, 
+  0x00631f2a, 0x0067202c, 0x006b212e, 0x0068202c, 
+  0x00641f2a, 0x005f1e29, 0x005b1d27, 0x00571c26, 
+  0x00531a24, 0x00501821, 0x004b1821, 0x00491720, 
+  0x0048171f, 0x0046171f, 0x0046171f, 0x00481820, 
+  0x0053242b, 0x001e1012, 0x00110708, 0x00452429, 
+  0x00281013, 0x00250d12, 0x00250c10, 0x00260c10, 
+  0x00270c10, 0x00270c10, 0x00290d12, 0x002c0c11, 
+  0x002e0d13, 0x00310e13, 0x00331015, 0x00341014, 
+  0x00391217, 0x003d131a, 0x0040141d, 0x0044151e, 
+  0x0048161f, 0x004b1620, 0x00ffffff, 0x00541a24, 
+  0x005a1d27, 0x005f1e29, 0x00631f2a, 0x0067202c, 
+  0x006b212e, 0x0068202c, 0x00641f2a, 0x005f1e29, 
+  0x005b1d27, 0x00571c26, 0x00531a24, 0x00501821, 
+  0x004b1821, 0x00491720, 0x0048171f, 0x0046171f, 
+  0x0046171f, 0x00481820, 0x0053242b, 0x001e1012, 
+  0x00120709, 0x0046262b, 0x00291316, 0x00260e13, 
+  0x00260d11, 0x00260d11, 0x00270d11, 0x00280e13, 
+  0x00290e13, 0x002c0d12, 0x002f0e13, 0x00311015, 
+  0x00331217, 0x00361318, 0x003a141b, 0x003c151c, 
+  0x0040161d, 0x0045171f, 0x00ffffff, 0x004b1a22, 
+  0x00501d26, 0x00541d26, 0x00ffffff, 0x005d202a, 
+  0x0061212c, 0x0066222e, 0x006b2430, 0x00692430, 
+  0x0067222e, 0x0061212c, 0x005e202a, 0x005a1e29, 
+  0x00571d28, 0x00531c26, 0x00511c25, 0x004f1a22, 
+  0x004b1a22, 0x004a1a21, 0x004a1a21, 0x004b1d25, 
+  0x00552931, 0x001f1112, 0x00120709, 0x0046262b, 
+  0x00291316, 0x00260e13, 0x00260d11, 0x00260d11, 
+  0x00270d11, 0x00280e13, 0x00290e13, 0x002c0d12, 
+  0x002f0e13, 0x00311015, 0x00331217, 0x00361318, 
+  0x003a141b, 0x003c151c, 0x0040161d, 0x0045171f, 
+  0x00481820, 0x00ffffff, 0x00501d26, 0x00541d26, 
+  0x00ffffff, 0x005d202a, 0x0061212c, 0x0066222e, 
+  0x006b2430, 0x00692430, 0x0067222e, 0x0061212c, 
+  0x005e202a, 0x005a1e29, 0x00571d28, 0x00531c26, 
+  0x00511c25, 0x004f1a22, 0x004b1a22, 0x004a1a21, 
+  0x004a1a21, 0x004b1d25, 0x00552931, 0x001f1112, 
+  0x00120709, 0x0046262b, 0x00291316, 0x00260e13, 
+  0x00260d11, 0x00260d11, 0x00270d11, 0x00280e13, 
+  0x00290e13, 0x002c0d12, 0x002f0e13, 0x00311015, 
+  0x00331217, 0x00361318, 0x003a141b, 0x003c151c, 
+  0x0040161d, 0x0045171f, 0x00481820, 0x004b1a22, 
+  0x00ffffff, 0x00541d26, 0x005a1e28, 0x005d202a, 
+  0x0061212c, 0x0066222e, 0x006b2430, 0x00692430, 
+  0x0067222e, 0x0061212c, 0x005e202a, 0x005a1e29, 
+  0x00571d28, 0x00531c26, 0x00511c25, 0x004f1a22, 
+  0x004b1a22, 0x004a1a21, 0x004a1a21, 0x004b1d25, 
+  0x00552931, 0x001f1112, 0x00170d0e, 0x0049292f, 
+  0x002c151a, 0x00270e12, 0x00270e12, 0x00280e12, 
+  0x00280e12, 0x00291014, 0x002c0e13, 0x002e1015, 
+  0x00301013, 0x00321318, 0x00341318, 0x0039141b, 
+  0x003b151c, 0x003e161c, 0x0044171f, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00511e27, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x0061222c, 0x0063252f, 
+  0x00692732, 0x006b2833, 0x00682732, 0x00662530, 
+  0x0061222c, 0x005d222c, 0x005a202a, 0x00571f28, 
+  0x00541e27, 0x00521f28, 0x00501f27, 0x004f1e26, 
+  0x004f1e26, 0x00502028, 0x005a2c34, 0x00221416, 
+  0x00170d0e, 0x0049292f, 0x002c151a, 0x00270e12, 
+  0x00270e12, 0x00280e12, 0x00280e12, 0x00291014, 
+  0x002c0e13, 0x002e1015, 0x00301013, 0x00321318, 
+  0x00341318, 0x0039141b, 0x003b151c, 0x003e161c, 
+  0x0044171f, 0x00461a21, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005d212c, 
+  0x0061222c, 0x0063252f, 0x00692732, 0x006b2833, 
+  0x00682732, 0x00662530, 0x0061222c, 0x005d222c, 
+  0x005a202a, 0x00571f28, 0x00541e27, 0x00521f28, 
+  0x00501f27, 0x004f1e26, 0x004f1e26, 0x00502028, 
+  0x005a2c34, 0x00221416, 0x00170d0e, 0x0049292f, 
+  0x002c151a, 0x00270e12, 0x00270e12, 0x00280e12, 
+  0x00280e12, 0x00291014, 0x002c0e13, 0x002e1015, 
+  0x00301013, 0x00321318, 0x00341318, 0x0039141b, 
+  0x003b151c, 0x003e161c, 0x0044171f, 0x00461a21, 
+  0x00491a21, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x005a202a, 0x005d212c, 0x0061222c, 0x0063252f, 
+  0x00692732, 0x006b2833, 0x00682732, 0x00662530, 
+  0x0061222c, 0x005d222c, 0x005a202a, 0x00571f28, 
+  0x00541e27, 0x00521f28, 0x00501f27, 0x004f1e26, 
+  0x004f1e26, 0x00502028, 0x005a2c34, 0x00221416, 
+  0x001e1118, 0x004b2b2f, 0x00331b1f, 0x00291316, 
+  0x00281115, 0x00291115, 0x00291115, 0x002b1115, 
+  0x002e1013, 0x00301217, 0x00311318, 0x0033141a, 
+  0x0038151b, 0x003a161c, 0x003d171e, 0x003f181f, 
+  0x00451a21, 0x00481b22, 0x004b1d25, 0x00501f27, 
+  0x00522029, 0x0055222b, 0x005a222b, 0x005d242f, 
+  0x0061252f, 0x00632832, 0x00672933, 0x00692a35, 
+  0x00692a35, 0x00662933, 0x00632832, 0x0061252f, 
+  0x005d252f, 0x005b242c, 0x0058222b, 0x0057212a, 
+  0x0054212a, 0x0053212a, 0x0053212a, 0x0054252c, 
+  0x005e343a, 0x00221418, 0x001e1118, 0x004b2b2f, 
+  0x00331b1f, 0x00291316, 0x00281115, 0x00291115, 
+  0x00291115, 0x002b1115, 0x002e1013, 0x00301217, 
+  0x00311318, 0x0033141a, 0x0038151b, 0x003a161c, 
+  0x003d171e, 0x003f181f, 0x00451a21, 0x00481b22, 
+  0x004b1d25, 0x00501f27, 0x00522029, 0x0055222b, 
+  0x005a222b, 0x005d242f, 0x0061252f, 0x00632832, 
+  0x00672933, 0x00692a35, 0x00692a35, 0x00662933, 
+  0x00632832, 0x0061252f, 0x005d252f, 0x005b242c, 
+  0x0058222b, 0x0057212a, 0x0054212a, 0x0053212a, 
+  0x0053212a, 0x0054252c, 0x005e343a, 0x00221418, 
+  0x001e1118, 0x004b2b2f, 0x00331b1f, 0x00291316, 
+  0x00281115, 0x00291115, 0x00291115, 0x002b1115, 
+  0x002e1013, 0x00301217, 0x00311318, 0x0033141a, 
+  0x0038151b, 0x003a161c, 0x003d171e, 0x003f181f, 
+  0x00451a21, 0x00481b22, 0x004b1d25, 0x00501f27, 
+  0x00522029, 0x0055222b, 0x005a222b, 0x005d242f, 
+  0x0061252f, 0x00632832, 0x00672933, 0x00692a35, 
+  0x00692a35, 0x00662933, 0x00632832, 0x0061252f, 
+  0x005d252f, 0x005b242c, 0x0058222b, 0x0057212a, 
+  0x0054212a, 0x0053212a, 0x0053212a, 0x0054252c, 
+  0x005e343a, 0x00221418, 0x0022101e, 0x00472e31, 
+  0x00492b31, 0x00331b1f, 0x002e161b, 0x002c151a, 
+  0x002e1417, 0x002f151a, 0x0031161b, 0x0032161b, 
+  0x0034161c, 0x0038171d, 0x003b181e, 0x003d1a1f, 
+  0x003f1a20, 0x00451d24, 0x00481d25, 0x004d1f27, 
+  0x00502028, 0x0052212a, 0x0054242b, 0x0057252e, 
+  0x005b2831, 0x005d2831, 0x00612932, 0x00632b34, 
+  0x00662c36, 0x00682e38, 0x006b2f39, 0x00682e38, 
+  0x00662c36, 0x00632a33, 0x00612a33, 0x005e2831, 
+  0x005c2932, 0x005b2831, 0x005a252e, 0x0058262f, 
+  0x00582931, 0x005e333b, 0x00513336, 0x001e1019, 
+  0x0022101e, 0x00472e31, 0x00492b31, 0x00331b1f, 
+  0x002e161b, 0x002c151a, 0x002e1417, 0x002f151a, 
+  0x0031161b, 0x0032161b, 0x0034161c, 0x0038171d, 
+  0x003b181e, 0x003d1a1f, 0x003f1a20, 0x00451d24, 
+  0x00481d25, 0x004d1f27, 0x00502028, 0x0052212a, 
+  0x0054242b, 0x0057252e, 0x005b2831, 0x005d2831, 
+  0x00612932, 0x00632b34, 0x00662c36, 0x00682e38, 
+  0x006b2f39, 0x00682e38, 0x00662c36, 0x00632a33, 
+  0x00612a33, 0x005e2831, 0x005c2932, 0x005b2831, 
+  0x005a252e, 0x0058262f, 0x00582931, 0x005e333b, 
+  0x00513336, 0x001e1019, 0x0022101e, 0x00472e31, 
+  0x00492b31, 0x00331b1f, 0x002e161b, 0x002c151a, 
+  0x002e1417, 0x002f151a, 0x0031161b, 0x0032161b, 
+  0x0034161c, 0x0038171d, 0x003b181e, 0x003d1a1f, 
+  0x003f1a20, 0x00451d24, 0x00481d25, 0x004d1f27, 
+  0x00502028, 0x0052212a, 0x0054242b, 0x0057252e, 
+  0x005b2831, 0x005d2831, 0x00612932, 0x00632b34, 
+  0x00662c36, 0x00682e38, 0x006b2f39, 0x00682e38, 
+  0x00662c36, 0x00632a33, 0x00612a33, 0x005e2831, 
+  0x005c2932, 0x005b2831, 0x005a252e, 0x0058262f, 
+  0x00582931, 0x005e333b, 0x00513336, 0x001e1019, 
+  0x00291226, 0x00381e31, 0x00482e31, 0x00503034, 
+  0x0047292f, 0x0043272b, 0x0043252a, 0x0044252a, 
+  0x0045252a, 0x0046262b, 0x0048262b, 0x0049282e, 
+  0x004b282e, 0x004f2930, 0x00512930, 0x00522a31, 
+  0x00552b32, 0x00582c34, 0x005a2e35, 0x005c2f36, 
+  0x005d3038, 0x005f3139, 0x0061333b, 0x0063343b, 
+  0x0066353d, 0x0068363e, 0x006b3840, 0x006b3a42, 
+  0x006b3a42, 0x006b3a42, 0x006b3942, 0x00693840, 
+  0x0067363f, 0x0066353d, 0x0065353d, 0x0063343c, 
+  0x0062343c, 0x0061353d, 0x00613a40, 0x00533438, 
+  0x00361f2e, 0x00271225, 0x00291226, 0x00381e31, 
+  0x00482e31, 0x00503034, 0x0047292f, 0x0043272b, 
+  0x0043252a, 0x0044252a, 0x0045252a, 0x0046262b, 
+  0x0048262b, 0x0049282e, 0x004b282e, 0x004f2930, 
+  0x00512930, 0x00522a31, 0x00552b32, 0x00582c34, 
+  0x005a2e35, 0x005c2f36, 0x005d3038, 0x005f3139, 
+  0x0061333b, 0x0063343b, 0x0066353d, 0x0068363e, 
+  0x006b3840, 0x006b3a42, 0x006b3a42, 0x006b3a42, 
+  0x006b3942, 0x00693840, 0x0067363f, 0x0066353d, 
+  0x0065353d, 0x0063343c, 0x0062343c, 0x0061353d, 
+  0x00613a40, 0x00533438, 0x00361f2e, 0x00271225, 
+  0x00291226, 0x00381e31, 0x00482e31, 0x00503034, 
+  0x0047292f, 0x0043272b, 0x0043252a, 0x0044252a, 
+  0x0045252a, 0x0046262b, 0x0048262b, 0x0049282e, 
+  0x004b282e, 0x004f2930, 0x00512930, 0x00522a31, 
+  0x00552b32, 0x00582c34, 0x005a2e35, 0x005c2f36, 
+  0x005d3038, 0x005f3139, 0x0061333b, 0x0063343b, 
+  0x0066353d, 0x0068363e, 0x006b3840, 0x006b3a42, 
+  0x006b3a42, 0x006b3a42, 0x006b3942, 0x00693840, 
+  0x0067363f, 0x0066353d, 0x0065353d, 0x0063343c, 
+  0x0062343c, 0x0061353d, 0x00613a40, 0x00533438, 
+  0x00361f2e, 0x00271225, 0x002a1225, 0x00291226, 
+  0x001f0f1b, 0x00211419, 0x00221517, 0x001f1214, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x00201214, 
+  0x00201315, 0x00211315, 0x00211315, 0x00221416, 
+  0x00221416, 0x00221416, 0x00221416, 0x00231416, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00231517, 0x00231416, 
+  0x00231416, 0x00221416, 0x00221416, 0x00241719, 
+  0x00231519, 0x001e1019, 0x00271125, 0x002a1325, 
+  0x002a1225, 0x00291226, 0x001f0f1b, 0x00211419, 
+  0x00221517, 0x001f1214, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x00201214, 0x00201315, 0x00211315, 
+  0x00211315, 0x00221416, 0x00221416, 0x00221416, 
+  0x00221416, 0x00231416, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00231517, 0x00231416, 0x00231416, 0x00221416, 
+  0x00221416, 0x00241719, 0x00231519, 0x001e1019, 
+  0x00271125, 0x002a1325, 0x002a1225, 0x00291226, 
+  0x001f0f1b, 0x00211419, 0x00221517, 0x001f1214, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x00201214, 
+  0x00201315, 0x00211315, 0x00211315, 0x00221416, 
+  0x00221416, 0x00221416, 0x00221416, 0x00231416, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00231517, 0x00231416, 
+  0x00231416, 0x00221416, 0x00221416, 0x00241719, 
+  0x00231519, 0x001e1019, 0x00271125, 0x002a1325, 
+  0x002a1225, 0x00291226, 0x00271423, 0x00281c24, 
+  0x00272222, 0x00272222, 0x00262223, 0x00262122, 
+  0x00262122, 0x00262121, 0x00252122, 0x00252121, 
+  0x00252121, 0x00252020, 0x00242020, 0x00242020, 
+  0x00241f1f, 0x00241f1f, 0x00231e1e, 0x00231d1e, 
+  0x00231d1d, 0x00221c1d, 0x00221c1d, 0x00221c1c, 
+  0x00221b1c, 0x00211b1c, 0x00211b1c, 0x00201a1b, 
+  0x001f1a1b, 0x001f191a, 0x001f1919, 0x001f1819, 
+  0x001e1819, 0x001e1818, 0x001e1818, 0x001d1718, 
+  0x001d1717, 0x001e1819, 0x0023171d, 0x00241220, 
+  0x00291226, 0x002a1225, 0x002a1225, 0x00291226, 
+  0x00271423, 0x00281c24, 0x00272222, 0x00272222, 
+  0x00262223, 0x00262122, 0x00262122, 0x00262121, 
+  0x00252122, 0x00252121, 0x00252121, 0x00252020, 
+  0x00242020, 0x00242020, 0x00241f1f, 0x00241f1f, 
+  0x00231e1e, 0x00231d1e, 0x00231d1d, 0x00221c1d, 
+  0x00221c1d, 0x00221c1c, 0x00221b1c, 0x00211b1c, 
+  0x00211b1c, 0x00201a1b, 0x001f1a1b, 0x001f191a, 
+  0x001f1919, 0x001f1819, 0x001e1819, 0x001e1818, 
+  0x001e1818, 0x001d1718, 0x001d1717, 0x001e1819, 
+  0x0023171d, 0x00241220, 0x00291226, 0x002a1225, 
+  0x002a1225, 0x00291226, 0x00271423, 0x00281c24, 
+  0x00272222, 0x00272222, 0x00262223, 0x00262122, 
+  0x00262122, 0x00262121, 0x00252122, 0x00252121, 
+  0x00252121, 0x00252020, 0x00242020, 0x00242020, 
+  0x00241f1f, 0x00241f1f, 0x00231e1e, 0x00231d1e, 
+  0x00231d1d, 0x00221c1d, 0x00221c1d, 0x00221c1c, 
+  0x00221b1c, 0x00211b1c, 0x00211b1c, 0x00201a1b, 
+  0x001f1a1b, 0x001f191a, 0x001f1919, 0x001f1819, 
+  0x001e1819, 0x001e1818, 0x001e1818, 0x001d1718, 
+  0x001d1717, 0x001e1819, 0x0023171d, 0x00241220, 
+  0x00291226, 0x002a1225, 0x00291226, 0x00493049, 
+  0x00595152, 0x0065595a, 0x0067585a, 0x0069575a, 
+  0x00695458, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695257, 0x00695155, 0x00695054, 0x00694f53, 
+  0x00684e52, 0x00674d51, 0x00664b50, 0x0066484e, 
+  0x0065474d, 0x0064464b, 0x0062464a, 0x00614549, 
+  0x005f4549, 0x005f4448, 0x005e4347, 0x005d4246, 
+  0x005c4045, 0x005b4045, 0x005a3f44, 0x00593d42, 
+  0x00573c40, 0x00553c40, 0x00553c40, 0x00573d42, 
+  0x00573f43, 0x004f3b3d, 0x003e263a, 0x00291226, 
+  0x00291226, 0x00493049, 0x00595152, 0x0065595a, 
+  0x0067585a, 0x0069575a, 0x00695458, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695257, 0x00695155, 
+  0x00695054, 0x00694f53, 0x00684e52, 0x00674d51, 
+  0x00664b50, 0x0066484e, 0x0065474d, 0x0064464b, 
+  0x0062464a, 0x00614549, 0x005f4549, 0x005f4448, 
+  0x005e4347, 0x005d4246, 0x005c4045, 0x005b4045, 
+  0x005a3f44, 0x00593d42, 0x00573c40, 0x00553c40, 
+  0x00553c40, 0x00573d42, 0x00573f43, 0x004f3b3d, 
+  0x003e263a, 0x00291226, 0x00291226, 0x00493049, 
+  0x00595152, 0x0065595a, 0x0067585a, 0x0069575a, 
+  0x00695458, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695257, 0x00695155, 0x00695054, 0x00694f53, 
+  0x00684e52, 0x00674d51, 0x00664b50, 0x0066484e, 
+  0x0065474d, 0x0064464b, 0x0062464a, 0x00614549, 
+  0x005f4549, 0x005f4448, 0x005e4347, 0x005d4246, 
+  0x005c4045, 0x005b4045, 0x005a3f44, 0x00593d42, 
+  0x00573c40, 0x00553c40, 0x00553c40, 0x00573d42, 
+  0x00573f43, 0x004f3b3d, 0x003e263a, 0x00291226, 
+  0x00251423, 0x00594f51, 0x00665758, 0x00654e52, 
+  0x0064494e, 0x0064484d, 0x0064464b, 0x0065464b, 
+  0x0065464b, 0x0066464b, 0x0066464b, 0x0067464b, 
+  0x0068464b, 0x0069464b, 0x0069454b, 0x00674449, 
+  0x00664248, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x005c393e, 0x005b383d, 
+  0x0059363c, 0x0057353b, 0x0055343a, 0x00533339, 
+  0x00513136, 0x00503035, 0x004e2f34, 0x00492f33, 
+  0x00472e32, 0x00452c31, 0x00442b30, 0x00422b2f, 
+  0x003f2a2e, 0x003f2b2f, 0x00452e32, 0x0053393d, 
+  0x004e3839, 0x0021111e, 0x00251423, 0x00594f51, 
+  0x00665758, 0x00654e52, 0x0064494e, 0x0064484d, 
+  0x0064464b, 0x0065464b, 0x0065464b, 0x0066464b, 
+  0x0066464b, 0x0067464b, 0x0068464b, 0x0069464b, 
+  0x0069454b, 0x00674449, 0x00664248, 0x00654047, 
+  0x00623f45, 0x00613e44, 0x005f3c42, 0x005d3a3f, 
+  0x005c393e, 0x005b383d, 0x0059363c, 0x0057353b, 
+  0x0055343a, 0x00533339, 0x00513136, 0x00503035, 
+  0x004e2f34, 0x00492f33, 0x00472e32, 0x00452c31, 
+  0x00442b30, 0x00422b2f, 0x003f2a2e, 0x003f2b2f, 
+  0x00452e32, 0x0053393d, 0x004e3839, 0x0021111e, 
+  0x00251423, 0x00594f51, 0x00665758, 0x00654e52, 
+  0x0064494e, 0x0064484d, 0x0064464b, 0x0065464b, 
+  0x0065464b, 0x0066464b, 0x0066464b, 0x0067464b, 
+  0x0068464b, 0x0069464b, 0x0069454b, 0x00674449, 
+  0x00664248, 0x00654047, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005b383d, 
+  0x0059363c, 0x0057353b, 0x0055343a, 0x00533339, 
+  0x00513136, 0x00503035, 0x004e2f34, 0x00492f33, 
+  0x00472e32, 0x00452c31, 0x00442b30, 0x00422b2f, 
+  0x003f2a2e, 0x003f2b2f, 0x00452e32, 0x0053393d, 
+  0x004e3839, 0x0021111e, 0x00271b23, 0x00645353, 
+  0x00624b4f, 0x0061464a, 0x00614348, 0x00614247, 
+  0x00624247, 0x00624046, 0x00624046, 0x00644046, 
+  0x00654047, 0x00664047, 0x00674047, 0x00684047, 
+  0x006b3f47, 0x00673f46, 0x00673c44, 0x00663b43, 
+  0x00ffffff, 0x005f383e, 0x005d363d, 0x005c353c, 
+  0x00ffffff, 0x00573339, 0x00553036, 0x00532f35, 
+  0x00512e33, 0x004f2c32, 0x004e2b31, 0x004a2a30, 
+  0x0047292f, 0x00442a2f, 0x0042272b, 0x003e272b, 
+  0x003c2629, 0x003a2528, 0x00392528, 0x00382528, 
+  0x00392528, 0x003f2a2e, 0x0054393d, 0x0023151c, 
+  0x00271b23, 0x00645353, 0x00624b4f, 0x0061464a, 
+  0x00614348, 0x00614247, 0x00624247, 0x00624046, 
+  0x00624046, 0x00644046, 0x00654047, 0x00664047, 
+  0x00674047, 0x00684047, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005f383e, 
+  0x00ffffff, 0x00ffffff, 0x005a343b, 0x00573339, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x004e2b31, 0x004a2a30, 0x0047292f, 0x00442a2f, 
+  0x0042272b, 0x003e272b, 0x003c2629, 0x003a2528, 
+  0x00392528, 0x00382528, 0x00392528, 0x003f2a2e, 
+  0x0054393d, 0x0023151c, 0x00271b23, 0x00645353, 
+  0x00624b4f, 0x0061464a, 0x00614348, 0x00614247, 
+  0x00624247, 0x00624046, 0x00624046, 0x00644046, 
+  0x00654047, 0x00664047, 0x00674047, 0x00684047, 
+  0x006b3f47, 0x00673f46, 0x00673c44, 0x00663b43, 
+  0x00623a40, 0x00ffffff, 0x005d363d, 0x005c353c, 
+  0x005a343b, 0x00ffffff, 0x00553036, 0x00532f35, 
+  0x00512e33, 0x004f2c32, 0x004e2b31, 0x004a2a30, 
+  0x0047292f, 0x00442a2f, 0x0042272b, 0x003e272b, 
+  0x003c2629, 0x003a2528, 0x00392528, 0x00382528, 
+  0x00392528, 0x003f2a2e, 0x0054393d, 0x0023151c, 
+  0x00241e1f, 0x00665154, 0x005f4549, 0x005e3f45, 
+  0x005e3f45, 0x005e3c42, 0x005e3c42, 0x005f3c42, 
+  0x00613b42, 0x00623b42, 0x00653b42, 0x00663b43, 
+  0x00673b43, 0x00683b43, 0x006b3b43, 0x00693a42, 
+  0x00673940, 0x0065383f, 0x00ffffff, 0x0061343c, 
+  0x005e333b, 0x005c3038, 0x00ffffff, 0x00542e34, 
+  0x00532c33, 0x00502b32, 0x004f2a31, 0x004b292f, 
+  0x0049282e, 0x0046262b, 0x0043252a, 0x003f2529, 
+  0x003d2428, 0x003b2227, 0x00392226, 0x00362125, 
+  0x00342024, 0x00332024, 0x00332024, 0x00382226, 
+  0x004b2e33, 0x00231718, 0x00241e1f, 0x00665154, 
+  0x005f4549, 0x005e3f45, 0x005e3f45, 0x005e3c42, 
+  0x005e3c42, 0x005f3c42, 0x00613b42, 0x00623b42, 
+  0x00653b42, 0x00663b43, 0x00673b43, 0x00683b43, 
+  0x00ffffff, 0x00693a42, 0x00ffffff, 0x0065383f, 
+  0x00ffffff, 0x0061343c, 0x005e333b, 0x00ffffff, 
+  0x00572f35, 0x00542e34, 0x00532c33, 0x00ffffff, 
+  0x004f2a31, 0x004b292f, 0x00ffffff, 0x0046262b, 
+  0x0043252a, 0x003f2529, 0x003d2428, 0x003b2227, 
+  0x00392226, 0x00362125, 0x00342024, 0x00332024, 
+  0x00332024, 0x00382226, 0x004b2e33, 0x00231718, 
+  0x00241e1f, 0x00665154, 0x005f4549, 0x005e3f45, 
+  0x005e3f45, 0x005e3c42, 0x005e3c42, 0x005f3c42, 
+  0x00613b42, 0x00623b42, 0x00653b42, 0x00663b43, 
+  0x00673b43, 0x00683b43, 0x006b3b43, 0x00693a42, 
+  0x00673940, 0x0065383f, 0x0063353d, 0x00ffffff, 
+  0x005e333b, 0x005c3038, 0x00572f35, 0x00ffffff, 
+  0x00532c33, 0x00502b32, 0x004f2a31, 0x004b292f, 
+  0x0049282e, 0x0046262b, 0x0043252a, 0x003f2529, 
+  0x003d2428, 0x003b2227, 0x00392226, 0x00362125, 
+  0x00342024, 0x00332024, 0x00332024, 0x00382226, 
+  0x004b2e33, 0x00231718, 0x00221d1d, 0x00654d51, 
+  0x005d3e44, 0x005c3b40, 0x005c3a3f, 0x005c393e, 
+  0x005c383e, 0x005d383e, 0x005e383e, 0x005f383e, 
+  0x0062363e, 0x0063363e, 0x0066363e, 0x0068363f, 
+  0x0069363f, 0x0069363f, 0x0067353e, 0x0066333c, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00572b33, 0x00542a31, 0x00512930, 0x0050262c, 
+  0x004b252b, 0x0048242a, 0x00462228, 0x00432127, 
+  0x003f2026, 0x003c2025, 0x003a2025, 0x00381f24, 
+  0x00341e21, 0x00321c1f, 0x00311c1f, 0x00311c1f, 
+  0x00301c1f, 0x00321e21, 0x0046282e, 0x00201415, 
+  0x00221d1d, 0x00654d51, 0x005d3e44, 0x005c3b40, 
+  0x005c3a3f, 0x005c393e, 0x005c383e, 0x005d383e, 
+  0x005e383e, 0x005f383e, 0x0062363e, 0x0063363e, 
+  0x0066363e, 0x0068363f, 0x0069363f, 0x0069363f, 
+  0x00ffffff, 0x0066333c, 0x00623139, 0x005f3038, 
+  0x00ffffff, 0x005a2c34, 0x00ffffff, 0x00542a31, 
+  0x00512930, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00462228, 0x00432127, 0x003f2026, 0x003c2025, 
+  0x003a2025, 0x00381f24, 0x00341e21, 0x00321c1f, 
+  0x00311c1f, 0x00311c1f, 0x00301c1f, 0x00321e21, 
+  0x0046282e, 0x00201415, 0x00221d1d, 0x00654d51, 
+  0x005d3e44, 0x005c3b40, 0x005c3a3f, 0x005c393e, 
+  0x005c383e, 0x005d383e, 0x005e383e, 0x005f383e, 
+  0x0062363e, 0x0063363e, 0x0066363e, 0x0068363f, 
+  0x0069363f, 0x0069363f, 0x0067353e, 0x0066333c, 
+  0x00623139, 0x00ffffff, 0x005d2e35, 0x005a2c34, 
+  0x00572b33, 0x00ffffff, 0x00512930, 0x0050262c, 
+  0x004b252b, 0x0048242a, 0x00462228, 0x00432127, 
+  0x003f2026, 0x003c2025, 0x003a2025, 0x00381f24, 
+  0x00341e21, 0x00321c1f, 0x00311c1f, 0x00311c1f, 
+  0x00301c1f, 0x00321e21, 0x0046282e, 0x00201415, 
+  0x00211b1c, 0x0062484d, 0x005b3a3f, 0x005a383d, 
+  0x005a363c, 0x005a353c, 0x005a343b, 0x005b333a, 
+  0x005d333a, 0x005e333b, 0x005f333b, 0x0062333b, 
+  0x0063333b, 0x0066333c, 0x0068323b, 0x006b323c, 
+  0x00682f39, 0x00662e38, 0x00ffffff, 0x005f2c35, 
+  0x005c2b33, 0x005a2931, 0x00ffffff, 0x0052262e, 
+  0x0050252c, 0x004b242a, 0x00482128, 0x00462128, 
+  0x00441f26, 0x003f1f25, 0x003d1d22, 0x003a1e22, 
+  0x00361b1f, 0x00331b1f, 0x00311a1e, 0x0030181d, 
+  0x002f181c, 0x002f181c, 0x002e181c, 0x00301a1d, 
+  0x00432429, 0x001f1214, 0x00211b1c, 0x0062484d, 
+  0x005b3a3f, 0x005a383d, 0x005a363c, 0x005a353c, 
+  0x005a343b, 0x005b333a, 0x005d333a, 0x005e333b, 
+  0x005f333b, 0x0062333b, 0x0063333b, 0x0066333c, 
+  0x0068323b, 0x006b323c, 0x00ffffff, 0x00662e38, 
+  0x00632c35, 0x005f2c35, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x0052262e, 0x0050252c, 0x00ffffff, 
+  0x00482128, 0x00462128, 0x00ffffff, 0x003f1f25, 
+  0x003d1d22, 0x003a1e22, 0x00361b1f, 0x00331b1f, 
+  0x00311a1e, 0x0030181d, 0x002f181c, 0x002f181c, 
+  0x002e181c, 0x00301a1d, 0x00432429, 0x001f1214, 
+  0x00211b1c, 0x0062484d, 0x005b3a3f, 0x005a383d, 
+  0x005a363c, 0x005a353c, 0x005a343b, 0x005b333a, 
+  0x005d333a, 0x005e333b, 0x005f333b, 0x0062333b, 
+  0x0063333b, 0x0066333c, 0x0068323b, 0x006b323c, 
+  0x00682f39, 0x00662e38, 0x00632c35, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0052262e, 
+  0x0050252c, 0x004b242a, 0x00482128, 0x00462128, 
+  0x00441f26, 0x003f1f25, 0x003d1d22, 0x003a1e22, 
+  0x00361b1f, 0x00331b1f, 0x00311a1e, 0x0030181d, 
+  0x002f181c, 0x002f181c, 0x002e181c, 0x00301a1d, 
+  0x00432429, 0x001f1214, 0x001f191a, 0x00614549, 
+  0x0059363c, 0x0057343a, 0x00553339, 0x00553036, 
+  0x00573036, 0x00573036, 0x005a2f36, 0x005c2f36, 
+  0x005d2f36, 0x005f2f36, 0x00622f38, 0x00632e36, 
+  0x00672e38, 0x00692e38, 0x00692c36, 0x00662b35, 
+  0x00ffffff, 0x005f2831, 0x005c2730, 0x0058262f, 
+  0x00ffffff, 0x0052222a, 0x004f2129, 0x004a2027, 
+  0x00471f26, 0x00451e25, 0x00421d24, 0x003d1b20, 
+  0x003b1a1f, 0x0038181e, 0x0034181d, 0x0032171c, 
+  0x0030161c, 0x002f161b, 0x002c161a, 0x002c161a, 
+  0x002c161a, 0x002e171b, 0x003f2127, 0x001e1113, 
+  0x001f191a, 0x00614549, 0x0059363c, 0x0057343a, 
+  0x00553339, 0x00553036, 0x00573036, 0x00573036, 
+  0x005a2f36, 0x005c2f36, 0x005d2f36, 0x005f2f36, 
+  0x00622f38, 0x00632e36, 0x00672e38, 0x00692e38, 
+  0x00ffffff, 0x00662b35, 0x00632a34, 0x00ffffff, 
+  0x005c2730, 0x0058262f, 0x0054242b, 0x00ffffff, 
+  0x004f2129, 0x00ffffff, 0x00471f26, 0x00451e25, 
+  0x00ffffff, 0x003d1b20, 0x003b1a1f, 0x0038181e, 
+  0x0034181d, 0x0032171c, 0x0030161c, 0x002f161b, 
+  0x002c161a, 0x002c161a, 0x002c161a, 0x002e171b, 
+  0x003f2127, 0x001e1113, 0x001f191a, 0x00614549, 
+  0x0059363c, 0x0057343a, 0x00553339, 0x00553036, 
+  0x00573036, 0x00573036, 0x005a2f36, 0x005c2f36, 
+  0x005d2f36, 0x005f2f36, 0x00622f38, 0x00632e36, 
+  0x00672e38, 0x00692e38, 0x00692c36, 0x00662b35, 
+  0x00632a34, 0x00ffffff, 0x005c2730, 0x0058262f, 
+  0x00ffffff, 0x0052222a, 0x004f2129, 0x004a2027, 
+  0x00471f26, 0x00451e25, 0x00421d24, 0x003d1b20, 
+  0x003b1a1f, 0x0038181e, 0x0034181d, 0x0032171c, 
+  0x0030161c, 0x002f161b, 0x002c161a, 0x002c161a, 
+  0x002c161a, 0x002e171b, 0x003f2127, 0x001e1113, 
+  0x001e1818, 0x005f4046, 0x00553339, 0x00533035, 
+  0x00532e34, 0x00532e34, 0x00532c33, 0x00552b32, 
+  0x00572b33, 0x005a2b33, 0x005b2b33, 0x005d2b34, 
+  0x005f2a33, 0x00622a33, 0x00652a34, 0x00682a34, 
+  0x00692a35, 0x00682934, 0x00ffffff, 0x005f252f, 
+  0x005c242e, 0x0058212a, 0x00ffffff, 0x00511f28, 
+  0x004d1f27, 0x00491d25, 0x00471b22, 0x00441a20, 
+  0x003f181f, 0x003d171e, 0x0039171d, 0x0036151b, 
+  0x0032161b, 0x00301418, 0x002f1418, 0x002c1316, 
+  0x002b1317, 0x00291316, 0x00291316, 0x002c1418, 
+  0x003e1f25, 0x001e1012, 0x001e1818, 0x005f4046, 
+  0x00553339, 0x00533035, 0x00532e34, 0x00532e34, 
+  0x00532c33, 0x00552b32, 0x00572b33, 0x005a2b33, 
+  0x005b2b33, 0x005d2b34, 0x005f2a33, 0x00622a33, 
+  0x00652a34, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00632731, 0x00ffffff, 0x00ffffff, 0x0058212a, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x003f181f, 0x003d171e, 
+  0x0039171d, 0x0036151b, 0x0032161b, 0x00301418, 
+  0x002f1418, 0x002c1316, 0x002b1317, 0x00291316, 
+  0x00291316, 0x002c1418, 0x003e1f25, 0x001e1012, 
+  0x001e1818, 0x005f4046, 0x00553339, 0x00533035, 
+  0x00532e34, 0x00532e34, 0x00532c33, 0x00552b32, 
+  0x00572b33, 0x005a2b33, 0x005b2b33, 0x005d2b34, 
+  0x005f2a33, 0x00622a33, 0x00652a34, 0x00682a34, 
+  0x00692a35, 0x00682934, 0x00632731, 0x00ffffff, 
+  0x005c242e, 0x0058212a, 0x0054212a, 0x00ffffff, 
+  0x004d1f27, 0x00491d25, 0x00471b22, 0x00441a20, 
+  0x003f181f, 0x003d171e, 0x0039171d, 0x0036151b, 
+  0x0032161b, 0x00301418, 0x002f1418, 0x002c1316, 
+  0x002b1317, 0x00291316, 0x00291316, 0x002c1418, 
+  0x003e1f25, 0x001e1012, 0x001d1717, 0x005d3e44, 
+  0x00522f34, 0x00512c33, 0x00502b32, 0x00502930, 
+  0x00502930, 0x0052282f, 0x00532830, 0x00552830, 
+  0x00582830, 0x005b2831, 0x005d2730, 0x005f2731, 
+  0x00622731, 0x00662732, 0x006b2732, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00541e27, 0x00511c25, 0x004d1d25, 0x00481a21, 
+  0x00461820, 0x0043171f, 0x003e161d, 0x003b151c, 
+  0x0039141b, 0x00341318, 0x00311217, 0x002f1015, 
+  0x002c0e13, 0x002b1013, 0x00291014, 0x00280e12, 
+  0x00291013, 0x002c1316, 0x003e1d22, 0x001b0b0e, 
+  0x001d1717, 0x005d3e44, 0x00522f34, 0x00512c33, 
+  0x00502b32, 0x00502930, 0x00502930, 0x0052282f, 
+  0x00532830, 0x00552830, 0x00582830, 0x005b2831, 
+  0x005d2730, 0x005f2731, 0x00622731, 0x00662732, 
+  0x006b2732, 0x00692732, 0x0066242f, 0x0061222c, 
+  0x005d212b, 0x005a1f29, 0x00541e27, 0x00511c25, 
+  0x004d1d25, 0x00481a21, 0x00461820, 0x0043171f, 
+  0x003e161d, 0x003b151c, 0x0039141b, 0x00341318, 
+  0x00311217, 0x002f1015, 0x002c0e13, 0x002b1013, 
+  0x00291014, 0x00280e12, 0x00291013, 0x002c1316, 
+  0x003e1d22, 0x001b0b0e, 0x001d1717, 0x005d3e44, 
+  0x00522f34, 0x00512c33, 0x00502b32, 0x00502930, 
+  0x00502930, 0x0052282f, 0x00532830, 0x00552830, 
+  0x00582830, 0x005b2831, 0x005d2730, 0x005f2731, 
+  0x00622731, 0x00662732, 0x006b2732, 0x00692732, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x005a1f29, 
+  0x00541e27, 0x00511c25, 0x00ffffff, 0x00481a21, 
+  0x00461820, 0x0043171f, 0x003e161d, 0x003b151c, 
+  0x0039141b, 0x00341318, 0x00311217, 0x002f1015, 
+  0x002c0e13, 0x002b1013, 0x00291014, 0x00280e12, 
+  0x00291013, 0x002c1316, 0x003e1d22, 0x001b0b0e, 
+  0x001c1516, 0x005b3a3f, 0x004f2b31, 0x004b292f, 
+  0x004b262c, 0x004b262c, 0x004b252b, 0x0050242b, 
+  0x0051242b, 0x0052242b, 0x0054242b, 0x0057242c, 
+  0x005a222b, 0x005d222c, 0x005f222c, 0x0064222e, 
+  0x0068222f, 0x006b222f, 0x0067212e, 0x0063202b, 
+  0x005f1e29, 0x005a1d27, 0x00541c26, 0x00511822, 
+  0x004d1720, 0x0048171f, 0x0046161e, 0x0040151d, 
+  0x003e141b, 0x003b131a, 0x00381218, 0x00331015, 
+  0x00310d12, 0x002e0d13, 0x002b0c11, 0x00290d12, 
+  0x00280d12, 0x00290e13, 0x00270c10, 0x0020080b, 
+  0x00250208, 0x00120102, 0x001c1516, 0x005b3a3f, 
+  0x004f2b31, 0x004b292f, 0x004b262c, 0x004b262c, 
+  0x004b252b, 0x0050242b, 0x0051242b, 0x0052242b, 
+  0x0054242b, 0x0057242c, 0x005a222b, 0x005d222c, 
+  0x005f222c, 0x0064222e, 0x0068222f, 0x006b222f, 
+  0x0067212e, 0x0063202b, 0x005f1e29, 0x005a1d27, 
+  0x00541c26, 0x00511822, 0x004d1720, 0x0048171f, 
+  0x0046161e, 0x0040151d, 0x003e141b, 0x003b131a, 
+  0x00381218, 0x00331015, 0x00310d12, 0x002e0d13, 
+  0x002b0c11, 0x00290d12, 0x00280d12, 0x00290e13, 
+  0x00270c10, 0x0020080b, 0x00250208, 0x00120102, 
+  0x001c1516, 0x005b3a3f, 0x004f2b31, 0x004b292f, 
+  0x004b262c, 0x004b262c, 0x004b252b, 0x0050242b, 
+  0x0051242b, 0x0052242b, 0x0054242b, 0x0057242c, 
+  0x005a222b, 0x005d222c, 0x005f222c, 0x0064222e, 
+  0x0068222f, 0x006b222f, 0x0067212e, 0x0063202b, 
+  0x005f1e29, 0x005a1d27, 0x00541c26, 0x00511822, 
+  0x004d1720, 0x0048171f, 0x0046161e, 0x0040151d, 
+  0x003e141b, 0x003b131a, 0x00381218, 0x00331015, 
+  0x00310d12, 0x002e0d13, 0x002b0c11, 0x00290d12, 
+  0x00280d12, 0x00290e13, 0x00270c10, 0x0020080b, 
+  0x00250208, 0x00120102, 0x001b1314, 0x0059363c, 
+  0x004a282e, 0x0048242a, 0x00482229, 0x00482128, 
+  0x00482128, 0x004a2027, 0x004d2028, 0x004f2028, 
+  0x00522029, 0x00541f28, 0x00571f28, 0x005b1f29, 
+  0x005d1f29, 0x00621f2a, 0x0067202c, 0x0069202c, 
+  0x00691f2b, 0x00641e2a, 0x005f1c27, 0x005b1a25, 
+  0x00541822, 0x00511620, 0x004b151e, 0x0048151e, 
+  0x0045131b, 0x00401218, 0x003d1015, 0x003b0e15, 
+  0x00380d13, 0x00320d14, 0x002f0b10, 0x002c0b11, 
+  0x002b0b11, 0x00290b11, 0x0025090d, 0x00180005, 
+  0x000a0000, 0x00010000, 0x00150000, 0x00120101, 
+  0x001b1314, 0x0059363c, 0x004a282e, 0x0048242a, 
+  0x00482229, 0x00482128, 0x00482128, 0x004a2027, 
+  0x004d2028, 0x004f2028, 0x00522029, 0x00541f28, 
+  0x00571f28, 0x005b1f29, 0x005d1f29, 0x00621f2a, 
+  0x0067202c, 0x0069202c, 0x00691f2b, 0x00641e2a, 
+  0x005f1c27, 0x005b1a25, 0x00541822, 0x00511620, 
+  0x004b151e, 0x0048151e, 0x0045131b, 0x00401218, 
+  0x003d1015, 0x003b0e15, 0x00380d13, 0x00320d14, 
+  0x002f0b10, 0x002c0b11, 0x002b0b11, 0x00290b11, 
+  0x0025090d, 0x00180005, 0x000a0000, 0x00010000, 
+  0x00150000, 0x00120101, 0x001b1314, 0x0059363c, 
+  0x004a282e, 0x0048242a, 0x00482229, 0x00482128, 
+  0x00482128, 0x004a2027, 0x004d2028, 0x004f2028, 
+  0x00522029, 0x00541f28, 0x00571f28, 0x005b1f29, 
+  0x005d1f29, 0x00621f2a, 0x0067202c, 0x0069202c, 
+  0x00691f2b, 0x00641e2a, 0x005f1c27, 0x005b1a25, 
+  0x00541822, 0x00511620, 0x004b151e, 0x0048151e, 
+  0x0045131b, 0x00401218, 0x003d1015, 0x003b0e15, 
+  0x00380d13, 0x00320d14, 0x002f0b10, 0x002c0b11, 
+  0x002b0b11, 0x00290b11, 0x0025090d, 0x00180005, 
+  0x000a0000, 0x00010000, 0x00150000, 0x00120101, 
+  0x001a1213, 0x00553339, 0x00472429, 0x00452027, 
+  0x00451f26, 0x00451e25, 0x00451e25, 0x00471d24, 
+  0x00491d25, 0x004a1d25, 0x004f1d26, 0x00511c25, 
+  0x00541c26, 0x00571c26, 0x005b1c27, 0x005f1c27, 
+  0x00641d29, 0x00681c29, 0x006b1c29, 0x00661c28, 
+  0x00621825, 0x005c1722, 0x00571520, 0x0051141e, 
+  0x004b131d, 0x0048121b, 0x00440e17, 0x00400e16, 
+  0x003d0d15, 0x003a0c13, 0x00380b12, 0x00320b11, 
+  0x00300a10, 0x0029080c, 0x00200106, 0x00130000, 
+  0x00070000, 0x00000000, 0x00010000, 0x00050000, 
+  0x00180000, 0x00120102, 0x001a1213, 0x00553339, 
+  0x00472429, 0x00452027, 0x00451f26, 0x00451e25, 
+  0x00451e25, 0x00471d24, 0x00491d25, 0x004a1d25, 
+  0x004f1d26, 0x00511c25, 0x00541c26, 0x00571c26, 
+  0x005b1c27, 0x005f1c27, 0x00641d29, 0x00681c29, 
+  0x006b1c29, 0x00661c28, 0x00621825, 0x005c1722, 
+  0x00571520, 0x0051141e, 0x004b131d, 0x0048121b, 
+  0x00440e17, 0x00400e16, 0x003d0d15, 0x003a0c13, 
+  0x00380b12, 0x00320b11, 0x00300a10, 0x0029080c, 
+  0x00200106, 0x00130000, 0x00070000, 0x00000000, 
+  0x00010000, 0x00050000, 0x00180000, 0x00120102, 
+  0x001a1213, 0x00553339, 0x00472429, 0x00452027, 
+  0x00451f26, 0x00451e25, 0x00451e25, 0x00471d24, 
+  0x00491d25, 0x004a1d25, 0x004f1d26, 0x00511c25, 
+  0x00541c26, 0x00571c26, 0x005b1c27, 0x005f1c27, 
+  0x00641d29, 0x00681c29, 0x006b1c29, 0x00661c28, 
+  0x00621825, 0x005c1722, 0x00571520, 0x0051141e, 
+  0x004b131d, 0x0048121b, 0x00440e17, 0x00400e16, 
+  0x003d0d15, 0x003a0c13, 0x00380b12, 0x00320b11, 
+  0x00300a10, 0x0029080c, 0x00200106, 0x00130000, 
+  0x00070000, 0x00000000, 0x00010000, 0x00050000, 
+  0x00180000, 0x00120102, 0x00191011, 0x00533035, 
+  0x00442026, 0x003f1d22, 0x003f1b21, 0x00421a20, 
+  0x00441a20, 0x00441a20, 0x00461820, 0x00481820, 
+  0x004a1821, 0x004f1720, 0x00521822, 0x00541822, 
+  0x00581824, 0x005d1824, 0x00621825, 0x00671725, 
+  0x006b1826, 0x00681725, 0x00631522, 0x005d1521, 
+  0x0058141f, 0x0053121d, 0x004d111b, 0x00480e18, 
+  0x00450d16, 0x00400d16, 0x003e0d15, 0x003a0b13, 
+  0x00340911, 0x00270209, 0x001b0001, 0x000e0000, 
+  0x00070000, 0x00020000, 0x00050000, 0x00050000, 
+  0x00050000, 0x00070000, 0x001b0000, 0x00130103, 
+  0x00191011, 0x00533035, 0x00442026, 0x003f1d22, 
+  0x003f1b21, 0x00421a20, 0x00441a20, 0x00441a20, 
+  0x00461820, 0x00481820, 0x004a1821, 0x004f1720, 
+  0x00521822, 0x00541822, 0x00581824, 0x005d1824, 
+  0x00621825, 0x00671725, 0x006b1826, 0x00681725, 
+  0x00631522, 0x005d1521, 0x0058141f, 0x0053121d, 
+  0x004d111b, 0x00480e18, 0x00450d16, 0x00400d16, 
+  0x003e0d15, 0x003a0b13, 0x00340911, 0x00270209, 
+  0x001b0001, 0x000e0000, 0x00070000, 0x00020000, 
+  0x00050000, 0x00050000, 0x00050000, 0x00070000, 
+  0x001b0000, 0x00130103, 0x00191011, 0x00533035, 
+  0x00442026, 0x003f1d22, 0x003f1b21, 0x00421a20, 
+  0x00441a20, 0x00441a20, 0x00461820, 0x00481820, 
+  0x004a1821, 0x004f1720, 0x00521822, 0x00541822, 
+  0x00581824, 0x005d1824, 0x00621825, 0x00671725, 
+  0x006b1826, 0x00681725, 0x00631522, 0x005d1521, 
+  0x0058141f, 0x0053121d, 0x004d111b, 0x00480e18, 
+  0x00450d16, 0x00400d16, 0x003e0d15, 0x003a0b13, 
+  0x00340911, 0x00270209, 0x001b0001, 0x000e0000, 
+  0x00070000, 0x00020000, 0x00050000, 0x00050000, 
+  0x00050000, 0x00070000, 0x001b0000, 0x00130103, 
+  0x00180f0f, 0x00512c33, 0x003f1d22, 0x003c1a1f, 
+  0x003c181e, 0x003d171e, 0x003d161d, 0x0040161d, 
+  0x0043161e, 0x0045161e, 0x0048161f, 0x004a151e, 
+  0x004f151f, 0x0052151f, 0x00551621, 0x005b1621, 
+  0x005f1622, 0x00641522, 0x00691625, 0x00691625, 
+  0x00641522, 0x005e1420, 0x0059131f, 0x0054111b, 
+  0x004d0d17, 0x00480c16, 0x00430912, 0x003a030c, 
+  0x00300008, 0x00260002, 0x001a0000, 0x00110000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x00080000, 
+  0x00070000, 0x00070000, 0x00070000, 0x00080000, 
+  0x001d0000, 0x00140102, 0x00180f0f, 0x00512c33, 
+  0x003f1d22, 0x003c1a1f, 0x003c181e, 0x003d171e, 
+  0x003d161d, 0x0040161d, 0x0043161e, 0x0045161e, 
+  0x0048161f, 0x004a151e, 0x004f151f, 0x0052151f, 
+  0x00551621, 0x005b1621, 0x005f1622, 0x00641522, 
+  0x00691625, 0x00691625, 0x00641522, 0x005e1420, 
+  0x0059131f, 0x0054111b, 0x004d0d17, 0x00480c16, 
+  0x00430912, 0x003a030c, 0x00300008, 0x00260002, 
+  0x001a0000, 0x00110000, 0x000c0000, 0x000b0000, 
+  0x000a0000, 0x00080000, 0x00070000, 0x00070000, 
+  0x00070000, 0x00080000, 0x001d0000, 0x00140102, 
+  0x00180f0f, 0x00512c33, 0x003f1d22, 0x003c1a1f, 
+  0x003c181e, 0x003d171e, 0x003d161d, 0x0040161d, 
+  0x0043161e, 0x0045161e, 0x0048161f, 0x004a151e, 
+  0x004f151f, 0x0052151f, 0x00551621, 0x005b1621, 
+  0x005f1622, 0x00641522, 0x00691625, 0x00691625, 
+  0x00641522, 0x005e1420, 0x0059131f, 0x0054111b, 
+  0x004d0d17, 0x00480c16, 0x00430912, 0x003a030c, 
+  0x00300008, 0x00260002, 0x001a0000, 0x00110000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x00080000, 
+  0x00070000, 0x00070000, 0x00070000, 0x00080000, 
+  0x001d0000, 0x00140102, 0x00160d0e, 0x004f2930, 
+  0x003b1a1f, 0x0039161c, 0x0039151b, 0x0039141b, 
+  0x003a1318, 0x003d131a, 0x003e131b, 0x0043131b, 
+  0x0046131c, 0x0048121a, 0x004b131d, 0x0050141e, 
+  0x0055141f, 0x0058141f, 0x005d131f, 0x0062121f, 
+  0x00671220, 0x006b101e, 0x00650c1b, 0x005c0816, 
+  0x00530512, 0x004a010d, 0x00420007, 0x00380003, 
+  0x002e0000, 0x00260000, 0x001f0000, 0x001c0000, 
+  0x00170000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x000a0000, 
+  0x000a0000, 0x000b0000, 0x001e0000, 0x00140103, 
+  0x00160d0e, 0x004f2930, 0x003b1a1f, 0x0039161c, 
+  0x0039151b, 0x0039141b, 0x003a1318, 0x003d131a, 
+  0x003e131b, 0x0043131b, 0x0046131c, 0x0048121a, 
+  0x004b131d, 0x0050141e, 0x0055141f, 0x0058141f, 
+  0x005d131f, 0x0062121f, 0x00671220, 0x006b101e, 
+  0x00650c1b, 0x005c0816, 0x00530512, 0x004a010d, 
+  0x00420007, 0x00380003, 0x002e0000, 0x00260000, 
+  0x001f0000, 0x001c0000, 0x00170000, 0x00130000, 
+  0x00110000, 0x000e0000, 0x000c0000, 0x000b0000, 
+  0x000a0000, 0x000a0000, 0x000a0000, 0x000b0000, 
+  0x001e0000, 0x00140103, 0x00160d0e, 0x004f2930, 
+  0x003b1a1f, 0x0039161c, 0x0039151b, 0x0039141b, 
+  0x003a1318, 0x003d131a, 0x003e131b, 0x0043131b, 
+  0x0046131c, 0x0048121a, 0x004b131d, 0x0050141e, 
+  0x0055141f, 0x0058141f, 0x005d131f, 0x0062121f, 
+  0x00671220, 0x006b101e, 0x00650c1b, 0x005c0816, 
+  0x00530512, 0x004a010d, 0x00420007, 0x00380003, 
+  0x002e0000, 0x00260000, 0x001f0000, 0x001c0000, 
+  0x00170000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x000a0000, 
+  0x000a0000, 0x000b0000, 0x001e0000, 0x00140103, 
+  0x00150c0d, 0x004b262c, 0x0039161c, 0x00341318, 
+  0x00341217, 0x00ffffff, 0x00ffffff, 0x003a1016, 
+  0x003d1017, 0x003f1015, 0x00401017, 0x00440c15, 
+  0x00440a14, 0x00440711, 0x0047020d, 0x004a000c, 
+  0x0051000b, 0x0058000a, 0x0061000b, 0x006c000d, 
+  0x0065000a, 0x00590006, 0x004e0003, 0x00450001, 
+  0x003c0000, 0x00350000, 0x002f0000, 0x00290000, 
+  0x00250000, 0x00210000, 0x001b0000, 0x00170000, 
+  0x00130000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x000c0000, 0x000b0000, 0x000c0000, 
+  0x00210003, 0x00140104, 0x00150c0d, 0x004b262c, 
+  0x0039161c, 0x00341318, 0x00341217, 0x00341014, 
+  0x00361016, 0x003a1016, 0x003d1017, 0x003f1015, 
+  0x00401017, 0x00440c15, 0x00440a14, 0x00440711, 
+  0x0047020d, 0x004a000c, 0x0051000b, 0x0058000a, 
+  0x0061000b, 0x006c000d, 0x0065000a, 0x00590006, 
+  0x004e0003, 0x00450001, 0x003c0000, 0x00350000, 
+  0x002f0000, 0x00290000, 0x00250000, 0x00210000, 
+  0x001b0000, 0x00170000, 0x00130000, 0x00110000, 
+  0x000e0000, 0x000d0000, 0x000c0000, 0x000c0000, 
+  0x000b0000, 0x000c0000, 0x00210003, 0x00140104, 
+  0x00150c0d, 0x004b262c, 0x0039161c, 0x00341318, 
+  0x00341217, 0x00341014, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x003f1015, 0x00401017, 0x00440c15, 
+  0x00440a14, 0x00440711, 0x0047020d, 0x004a000c, 
+  0x0051000b, 0x0058000a, 0x0061000b, 0x006c000d, 
+  0x0065000a, 0x00590006, 0x004e0003, 0x00450001, 
+  0x003c0000, 0x00350000, 0x002f0000, 0x00290000, 
+  0x00250000, 0x00210000, 0x001b0000, 0x00170000, 
+  0x00130000, 0x00110000, 0x00ffffff, 0x00ffffff, 
+  0x000c0000, 0x00ffffff, 0x000b0000, 0x000c0000, 
+  0x00210003, 0x00140104, 0x00150a0c, 0x0049242a, 
+  0x00341318, 0x00311015, 0x00320e13, 0x00330e15, 
+  0x00ffffff, 0x00320a10, 0x0030050a, 0x002e0007, 
+  0x002a0005, 0x002a0000, 0x002f0000, 0x00330000, 
+  0x003b0001, 0x00420002, 0x00490002, 0x00540002, 
+  0x005d0008, 0x0069000b, 0x0069000b, 0x005d0009, 
+  0x00530008, 0x00490005, 0x00420003, 0x003b0001, 
+  0x00320000, 0x002e0000, 0x00280000, 0x00240000, 
+  0x001f0000, 0x001b0000, 0x00ffffff, 0x00130000, 
+  0x00110000, 0x000e0000, 0x00ffffff, 0x000d0000, 
+  0x000d0000, 0x000e0000, 0x00220005, 0x00140104, 
+  0x00150a0c, 0x0049242a, 0x00341318, 0x00311015, 
+  0x00320e13, 0x00330e15, 0x00330c12, 0x00320a10, 
+  0x0030050a, 0x002e0007, 0x002a0005, 0x002a0000, 
+  0x002f0000, 0x00330000, 0x003b0001, 0x00420002, 
+  0x00490002, 0x00540002, 0x005d0008, 0x0069000b, 
+  0x0069000b, 0x005d0009, 0x00530008, 0x00490005, 
+  0x00420003, 0x003b0001, 0x00320000, 0x002e0000, 
+  0x00280000, 0x00240000, 0x001f0000, 0x001b0000, 
+  0x00160000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000e0000, 0x000d0000, 0x000d0000, 0x000e0000, 
+  0x00220005, 0x00140104, 0x00150a0c, 0x0049242a, 
+  0x00341318, 0x00311015, 0x00320e13, 0x00ffffff, 
+  0x00330c12, 0x00320a10, 0x0030050a, 0x00ffffff, 
+  0x002a0005, 0x002a0000, 0x002f0000, 0x00330000, 
+  0x003b0001, 0x00420002, 0x00490002, 0x00540002, 
+  0x005d0008, 0x0069000b, 0x0069000b, 0x005d0009, 
+  0x00530008, 0x00490005, 0x00420003, 0x003b0001, 
+  0x00320000, 0x002e0000, 0x00280000, 0x00240000, 
+  0x001f0000, 0x001b0000, 0x00160000, 0x00ffffff, 
+  0x00110000, 0x000e0000, 0x00ffffff, 0x00ffffff, 
+  0x000d0000, 0x000e0000, 0x00220005, 0x00140104, 
+  0x0014090b, 0x00482128, 0x00321015, 0x002f0c11, 
+  0x0029090e, 0x00ffffff, 0x001c0001, 0x00ffffff, 
+  0x001a0000, 0x001c0000, 0x00240000, 0x00280000, 
+  0x002e0000, 0x00340001, 0x003b0000, 0x00420006, 
+  0x00490006, 0x00520008, 0x005a000a, 0x00650009, 
+  0x006c000d, 0x0061000b, 0x0057000a, 0x004d0008, 
+  0x00460006, 0x003e0005, 0x00390002, 0x00310001, 
+  0x002a0000, 0x00270000, 0x00240000, 0x001d0000, 
+  0x00ffffff, 0x00160000, 0x00130000, 0x00110000, 
+  0x00110000, 0x00100000, 0x000e0000, 0x00110000, 
+  0x00250006, 0x00150205, 0x0014090b, 0x00482128, 
+  0x00321015, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00180000, 0x001a0000, 0x001c0000, 
+  0x00240000, 0x00280000, 0x002e0000, 0x00340001, 
+  0x00ffffff, 0x00ffffff, 0x00490006, 0x00520008, 
+  0x005a000a, 0x00650009, 0x006c000d, 0x0061000b, 
+  0x0057000a, 0x004d0008, 0x00460006, 0x003e0005, 
+  0x00390002, 0x00310001, 0x002a0000, 0x00270000, 
+  0x00240000, 0x001d0000, 0x001a0000, 0x00160000, 
+  0x00130000, 0x00110000, 0x00110000, 0x00100000, 
+  0x000e0000, 0x00110000, 0x00250006, 0x00150205, 
+  0x0014090b, 0x00482128, 0x00321015, 0x002f0c11, 
+  0x0029090e, 0x00ffffff, 0x001c0001, 0x00180000, 
+  0x001a0000, 0x00ffffff, 0x00240000, 0x00280000, 
+  0x002e0000, 0x00340001, 0x003b0000, 0x00420006, 
+  0x00490006, 0x00520008, 0x005a000a, 0x00650009, 
+  0x006c000d, 0x0061000b, 0x0057000a, 0x004d0008, 
+  0x00460006, 0x003e0005, 0x00390002, 0x00310001, 
+  0x002a0000, 0x00270000, 0x00240000, 0x001d0000, 
+  0x001a0000, 0x00ffffff, 0x00130000, 0x00110000, 
+  0x00110000, 0x00100000, 0x000e0000, 0x00110000, 
+  0x00250006, 0x00150205, 0x0014090a, 0x00451d24, 
+  0x00260508, 0x001a0002, 0x00130000, 0x00ffffff, 
+  0x00130000, 0x00ffffff, 0x001b0000, 0x001e0000, 
+  0x00250000, 0x00290000, 0x002f0000, 0x00330003, 
+  0x003b0005, 0x00400007, 0x00480008, 0x00500009, 
+  0x0059000b, 0x0062000c, 0x006c000e, 0x0064000d, 
+  0x005a000b, 0x00510009, 0x00490008, 0x00420007, 
+  0x003c0003, 0x00340003, 0x00300003, 0x002a0001, 
+  0x00260000, 0x00210000, 0x00ffffff, 0x001a0000, 
+  0x00160000, 0x00130000, 0x00120000, 0x00110000, 
+  0x00110000, 0x00120000, 0x00270007, 0x00150306, 
+  0x0014090a, 0x00451d24, 0x00260508, 0x001a0002, 
+  0x00ffffff, 0x00120000, 0x00130000, 0x00ffffff, 
+  0x001b0000, 0x001e0000, 0x00250000, 0x00290000, 
+  0x002f0000, 0x00330003, 0x003b0005, 0x00ffffff, 
+  0x00480008, 0x00500009, 0x0059000b, 0x0062000c, 
+  0x006c000e, 0x0064000d, 0x005a000b, 0x00510009, 
+  0x00490008, 0x00420007, 0x003c0003, 0x00340003, 
+  0x00300003, 0x002a0001, 0x00260000, 0x00210000, 
+  0x001d0000, 0x001a0000, 0x00160000, 0x00130000, 
+  0x00120000, 0x00110000, 0x00110000, 0x00120000, 
+  0x00270007, 0x00150306, 0x0014090a, 0x00451d24, 
+  0x00260508, 0x001a0002, 0x00130000, 0x00ffffff, 
+  0x00130000, 0x00170000, 0x001b0000, 0x00ffffff, 
+  0x00250000, 0x00290000, 0x002f0000, 0x00330003, 
+  0x003b0005, 0x00400007, 0x00480008, 0x00500009, 
+  0x0059000b, 0x0062000c, 0x006c000e, 0x0064000d, 
+  0x005a000b, 0x00510009, 0x00490008, 0x00420007, 
+  0x003c0003, 0x00340003, 0x00300003, 0x002a0001, 
+  0x00260000, 0x00210000, 0x001d0000, 0x001a0000, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00110000, 
+  0x00110000, 0x00120000, 0x00270007, 0x00150306, 
+  0x00100406, 0x00350a10, 0x00160000, 0x00120000, 
+  0x00130000, 0x00ffffff, 0x00170000, 0x00ffffff, 
+  0x001d0000, 0x00200000, 0x00260002, 0x002a0002, 
+  0x002f0002, 0x00330005, 0x003a0006, 0x00400007, 
+  0x00470009, 0x004e0009, 0x0057000c, 0x005f000e, 
+  0x00690010, 0x00680010, 0x005e000d, 0x0055000b, 
+  0x004b0009, 0x00460008, 0x003f0007, 0x00390005, 
+  0x00320003, 0x002e0003, 0x00290002, 0x00250000, 
+  0x00ffffff, 0x001c0000, 0x00180000, 0x00170000, 
+  0x00150000, 0x00130000, 0x00130000, 0x00150000, 
+  0x00280108, 0x00160406, 0x00100406, 0x00350a10, 
+  0x00160000, 0x00120000, 0x00ffffff, 0x00150000, 
+  0x00170000, 0x00ffffff, 0x001d0000, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x002f0002, 0x00330005, 
+  0x003a0006, 0x00ffffff, 0x00470009, 0x004e0009, 
+  0x0057000c, 0x005f000e, 0x00690010, 0x00680010, 
+  0x005e000d, 0x0055000b, 0x004b0009, 0x00460008, 
+  0x003f0007, 0x00390005, 0x00320003, 0x002e0003, 
+  0x00290002, 0x00250000, 0x00200000, 0x001c0000, 
+  0x00180000, 0x00170000, 0x00150000, 0x00130000, 
+  0x00ffffff, 0x00150000, 0x00280108, 0x00160406, 
+  0x00100406, 0x00350a10, 0x00160000, 0x00120000, 
+  0x00130000, 0x00ffffff, 0x00170000, 0x001a0000, 
+  0x001d0000, 0x00ffffff, 0x00260002, 0x002a0002, 
+  0x002f0002, 0x00330005, 0x003a0006, 0x00400007, 
+  0x00470009, 0x004e0009, 0x0057000c, 0x005f000e, 
+  0x00690010, 0x00680010, 0x005e000d, 0x0055000b, 
+  0x004b0009, 0x00460008, 0x003f0007, 0x00390005, 
+  0x00320003, 0x002e0003, 0x00290002, 0x00250000, 
+  0x00200000, 0x001c0000, 0x00180000, 0x00170000, 
+  0x00150000, 0x00ffffff, 0x00130000, 0x00150000, 
+  0x00280108, 0x00160406, 0x000d0101, 0x00330810, 
+  0x00180001, 0x00160000, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00210001, 
+  0x00270002, 0x002a0003, 0x00300006, 0x00340006, 
+  0x003a0006, 0x003f0008, 0x0047000a, 0x004d000b, 
+  0x0054000d, 0x005e000e, 0x00670011, 0x006b0012, 
+  0x00610011, 0x0059000e, 0x0051000c, 0x0049000a, 
+  0x0044000a, 0x003c0008, 0x00380006, 0x00310005, 
+  0x002e0005, 0x00280003, 0x00ffffff, 0x001e0000, 
+  0x001c0000, 0x001a0000, 0x00180000, 0x00160000, 
+  0x00160000, 0x00170000, 0x002b030a, 0x00170406, 
+  0x000d0101, 0x00330810, 0x00180001, 0x00160000, 
+  0x00ffffff, 0x00170000, 0x00180000, 0x00ffffff, 
+  0x001d0000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00300006, 0x00340006, 0x003a0006, 0x00ffffff, 
+  0x0047000a, 0x004d000b, 0x0054000d, 0x005e000e, 
+  0x00670011, 0x006b0012, 0x00610011, 0x0059000e, 
+  0x0051000c, 0x0049000a, 0x0044000a, 0x003c0008, 
+  0x00380006, 0x00310005, 0x002e0005, 0x00280003, 
+  0x00220001, 0x001e0000, 0x00ffffff, 0x001a0000, 
+  0x00180000, 0x00160000, 0x00ffffff, 0x00170000, 
+  0x002b030a, 0x00170406, 0x000d0101, 0x00330810, 
+  0x00180001, 0x00160000, 0x00160000, 0x00ffffff, 
+  0x00180000, 0x001b0000, 0x001d0000, 0x00ffffff, 
+  0x00270002, 0x002a0003, 0x00300006, 0x00340006, 
+  0x003a0006, 0x003f0008, 0x0047000a, 0x004d000b, 
+  0x0054000d, 0x005e000e, 0x00670011, 0x006b0012, 
+  0x00610011, 0x0059000e, 0x0051000c, 0x0049000a, 
+  0x0044000a, 0x003c0008, 0x00380006, 0x00310005, 
+  0x002e0005, 0x00280003, 0x00220001, 0x001e0000, 
+  0x001c0000, 0x001a0000, 0x00180000, 0x00ffffff, 
+  0x00160000, 0x00170000, 0x002b030a, 0x00170406, 
+  0x000e0103, 0x00350a10, 0x001a0002, 0x00180000, 
+  0x00ffffff, 0x00180000, 0x001b0000, 0x001d0000, 
+  0x00ffffff, 0x00220002, 0x00280005, 0x002c0005, 
+  0x00300006, 0x00340006, 0x003a0008, 0x003f0009, 
+  0x0046000b, 0x004b000c, 0x0053000d, 0x005c0111, 
+  0x00640012, 0x006b0113, 0x00640011, 0x005d0011, 
+  0x0053000c, 0x004d000c, 0x0047000b, 0x00400009, 
+  0x003a0008, 0x00340006, 0x00300007, 0x002a0005, 
+  0x00ffffff, 0x00220002, 0x001e0000, 0x001c0000, 
+  0x00ffffff, 0x001a0000, 0x00180000, 0x001a0002, 
+  0x002f0509, 0x00180508, 0x000e0103, 0x00350a10, 
+  0x001a0002, 0x00180000, 0x00ffffff, 0x00180000, 
+  0x001b0000, 0x00ffffff, 0x00200001, 0x00ffffff, 
+  0x00280005, 0x002c0005, 0x00300006, 0x00340006, 
+  0x003a0008, 0x00ffffff, 0x0046000b, 0x004b000c, 
+  0x0053000d, 0x005c0111, 0x00640012, 0x006b0113, 
+  0x00640011, 0x005d0011, 0x0053000c, 0x004d000c, 
+  0x0047000b, 0x00400009, 0x003a0008, 0x00340006, 
+  0x00300007, 0x002a0005, 0x00270003, 0x00ffffff, 
+  0x001e0000, 0x001c0000, 0x001b0000, 0x001a0000, 
+  0x00ffffff, 0x001a0002, 0x002f0509, 0x00180508, 
+  0x000e0103, 0x00350a10, 0x001a0002, 0x00180000, 
+  0x00180000, 0x00ffffff, 0x001b0000, 0x001d0000, 
+  0x00200001, 0x00ffffff, 0x00280005, 0x002c0005, 
+  0x00300006, 0x00340006, 0x003a0008, 0x003f0009, 
+  0x0046000b, 0x004b000c, 0x0053000d, 0x005c0111, 
+  0x00640012, 0x006b0113, 0x00640011, 0x005d0011, 
+  0x0053000c, 0x004d000c, 0x0047000b, 0x00400009, 
+  0x003a0008, 0x00340006, 0x00300007, 0x002a0005, 
+  0x00270003, 0x00ffffff, 0x00ffffff, 0x001c0000, 
+  0x001b0000, 0x00ffffff, 0x00180000, 0x001a0002, 
+  0x002f0509, 0x00180508, 0x000f0104, 0x00380c14, 
+  0x001c0003, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x001c0001, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00280005, 0x002c0003, 0x00310007, 0x00340007, 
+  0x003a0009, 0x003e000a, 0x0046000c, 0x004b010d, 
+  0x0052010e, 0x005a0112, 0x00620514, 0x006b0314, 
+  0x00680314, 0x005f020e, 0x00570110, 0x0051000d, 
+  0x0049010d, 0x0045000b, 0x003d0009, 0x00390008, 
+  0x00330007, 0x002f0006, 0x002a0005, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x001d0001, 0x001c0001, 
+  0x001b0002, 0x001c0002, 0x002f070c, 0x00180608, 
+  0x000f0104, 0x00380c14, 0x001c0003, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x001d0001, 
+  0x00210002, 0x00240003, 0x00ffffff, 0x00ffffff, 
+  0x00310007, 0x00340007, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x004b010d, 0x0052010e, 0x005a0112, 
+  0x00620514, 0x006b0314, 0x00680314, 0x005f020e, 
+  0x00570110, 0x0051000d, 0x0049010d, 0x0045000b, 
+  0x003d0009, 0x00390008, 0x00330007, 0x002f0006, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x001c0002, 
+  0x002f070c, 0x00180608, 0x000f0104, 0x00380c14, 
+  0x001c0003, 0x001a0000, 0x001a0001, 0x001b0001, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00240003, 
+  0x00280005, 0x002c0003, 0x00310007, 0x00340007, 
+  0x003a0009, 0x003e000a, 0x0046000c, 0x004b010d, 
+  0x0052010e, 0x005a0112, 0x00620514, 0x006b0314, 
+  0x00680314, 0x005f020e, 0x00570110, 0x0051000d, 
+  0x0049010d, 0x0045000b, 0x003d0009, 0x00390008, 
+  0x00330007, 0x002f0006, 0x002a0005, 0x00ffffff, 
+  0x00220002, 0x00ffffff, 0x00ffffff, 0x001c0001, 
+  0x001b0002, 0x001c0002, 0x002f070c, 0x00180608, 
+  0x000f0103, 0x003a0d15, 0x001d0005, 0x001b0002, 
+  0x001b0002, 0x001c0002, 0x001d0002, 0x001e0002, 
+  0x00220003, 0x00250005, 0x00290006, 0x002e0007, 
+  0x00310008, 0x00350008, 0x003a0008, 0x003e000a, 
+  0x0045010c, 0x004a020e, 0x00510210, 0x00580513, 
+  0x00610615, 0x00680717, 0x006b0616, 0x00630614, 
+  0x005b0513, 0x00530210, 0x004e010e, 0x0048020e, 
+  0x0040010c, 0x003c000a, 0x00380009, 0x00320008, 
+  0x002e0007, 0x00290006, 0x00250003, 0x00220003, 
+  0x00200002, 0x001e0002, 0x001d0002, 0x001e0003, 
+  0x00310910, 0x00190609, 0x000f0103, 0x003a0d15, 
+  0x001d0005, 0x001b0002, 0x001b0002, 0x001c0002, 
+  0x001d0002, 0x001e0002, 0x00220003, 0x00250005, 
+  0x00290006, 0x002e0007, 0x00310008, 0x00350008, 
+  0x003a0008, 0x003e000a, 0x0045010c, 0x004a020e, 
+  0x00510210, 0x00580513, 0x00610615, 0x00680717, 
+  0x006b0616, 0x00630614, 0x005b0513, 0x00530210, 
+  0x004e010e, 0x0048020e, 0x0040010c, 0x003c000a, 
+  0x00380009, 0x00320008, 0x002e0007, 0x00ffffff, 
+  0x00250003, 0x00220003, 0x00200002, 0x001e0002, 
+  0x001d0002, 0x001e0003, 0x00310910, 0x00190609, 
+  0x000f0103, 0x003a0d15, 0x001d0005, 0x001b0002, 
+  0x001b0002, 0x001c0002, 0x001d0002, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00290006, 0x002e0007, 
+  0x00310008, 0x00350008, 0x003a0008, 0x003e000a, 
+  0x0045010c, 0x004a020e, 0x00510210, 0x00580513, 
+  0x00610615, 0x00680717, 0x006b0616, 0x00630614, 
+  0x005b0513, 0x00530210, 0x004e010e, 0x0048020e, 
+  0x0040010c, 0x003c000a, 0x00380009, 0x00320008, 
+  0x002e0007, 0x00290006, 0x00250003, 0x00220003, 
+  0x00200002, 0x001e0002, 0x001d0002, 0x001e0003, 
+  0x00310910, 0x00190609, 0x000f0305, 0x003c1017, 
+  0x00200005, 0x001c0003, 0x001d0002, 0x001d0002, 
+  0x001e0002, 0x00200002, 0x00240005, 0x00260005, 
+  0x002a0007, 0x002f0008, 0x00320009, 0x00350009, 
+  0x003b000a, 0x003f010b, 0x0046020d, 0x004a020d, 
+  0x00510512, 0x00570613, 0x005d0715, 0x00670816, 
+  0x006b091a, 0x00650817, 0x005d0715, 0x00570613, 
+  0x00510512, 0x004b0310, 0x0046020d, 0x003f010b, 
+  0x003b000a, 0x00350009, 0x00310008, 0x002e0007, 
+  0x00270006, 0x00250005, 0x00220005, 0x00210003, 
+  0x00200003, 0x00210005, 0x00330b12, 0x0019070a, 
+  0x000f0305, 0x003c1017, 0x00200005, 0x001c0003, 
+  0x001d0002, 0x001d0002, 0x001e0002, 0x00200002, 
+  0x00240005, 0x00260005, 0x002a0007, 0x002f0008, 
+  0x00320009, 0x00350009, 0x003b000a, 0x003f010b, 
+  0x0046020d, 0x004a020d, 0x00510512, 0x00570613, 
+  0x005d0715, 0x00670816, 0x006b091a, 0x00650817, 
+  0x005d0715, 0x00570613, 0x00510512, 0x004b0310, 
+  0x0046020d, 0x003f010b, 0x003b000a, 0x00350009, 
+  0x00310008, 0x002e0007, 0x00ffffff, 0x00250005, 
+  0x00220005, 0x00210003, 0x00200003, 0x00210005, 
+  0x00330b12, 0x0019070a, 0x000f0305, 0x003c1017, 
+  0x00200005, 0x001c0003, 0x001d0002, 0x001d0002, 
+  0x001e0002, 0x00200002, 0x00240005, 0x00260005, 
+  0x002a0007, 0x002f0008, 0x00320009, 0x00350009, 
+  0x003b000a, 0x003f010b, 0x0046020d, 0x004a020d, 
+  0x00510512, 0x00570613, 0x005d0715, 0x00670816, 
+  0x006b091a, 0x00650817, 0x005d0715, 0x00570613, 
+  0x00510512, 0x004b0310, 0x0046020d, 0x003f010b, 
+  0x003b000a, 0x00350009, 0x00310008, 0x002e0007, 
+  0x00270006, 0x00250005, 0x00220005, 0x00210003, 
+  0x00200003, 0x00210005, 0x00330b12, 0x0019070a, 
+  0x000f0305, 0x003d1217, 0x00210107, 0x001d0005, 
+  0x001e0003, 0x001e0003, 0x00200003, 0x00220005, 
+  0x00240006, 0x00270006, 0x002a0007, 0x00300009, 
+  0x00320109, 0x00380009, 0x003b020c, 0x003f020c, 
+  0x0046030e, 0x004a0611, 0x00500712, 0x00550714, 
+  0x005c0815, 0x00640917, 0x006b0b1b, 0x00680a18, 
+  0x00620917, 0x005b0816, 0x00540714, 0x004e0713, 
+  0x00490611, 0x0045030e, 0x003e020c, 0x003a010b, 
+  0x0034010a, 0x00300008, 0x002c0008, 0x00280007, 
+  0x00260006, 0x00240006, 0x00220005, 0x00240107, 
+  0x00380c12, 0x001a080a, 0x000f0305, 0x003d1217, 
+  0x00210107, 0x001d0005, 0x001e0003, 0x001e0003, 
+  0x00200003, 0x00220005, 0x00240006, 0x00270006, 
+  0x002a0007, 0x00300009, 0x00320109, 0x00380009, 
+  0x003b020c, 0x003f020c, 0x0046030e, 0x004a0611, 
+  0x00500712, 0x00550714, 0x005c0815, 0x00640917, 
+  0x006b0b1b, 0x00680a18, 0x00620917, 0x005b0816, 
+  0x00540714, 0x004e0713, 0x00490611, 0x0045030e, 
+  0x003e020c, 0x003a010b, 0x0034010a, 0x00300008, 
+  0x002c0008, 0x00280007, 0x00260006, 0x00240006, 
+  0x00220005, 0x00240107, 0x00380c12, 0x001a080a, 
+  0x000f0305, 0x003d1217, 0x00210107, 0x001d0005, 
+  0x001e0003, 0x001e0003, 0x00200003, 0x00220005, 
+  0x00240006, 0x00270006, 0x002a0007, 0x00300009, 
+  0x00320109, 0x00380009, 0x003b020c, 0x003f020c, 
+  0x0046030e, 0x004a0611, 0x00500712, 0x00550714, 
+  0x005c0815, 0x00640917, 0x006b0b1b, 0x00680a18, 
+  0x00620917, 0x005b0816, 0x00540714, 0x004e0713, 
+  0x00490611, 0x0045030e, 0x003e020c, 0x003a010b, 
+  0x0034010a, 0x00300008, 0x002c0008, 0x00280007, 
+  0x00260006, 0x00240006, 0x00220005, 0x00240107, 
+  0x00380c12, 0x001a080a, 0x00100305, 0x003e141b, 
+  0x00220208, 0x00200006, 0x00200006, 0x00200006, 
+  0x00210006, 0x00220006, 0x00250007, 0x00270108, 
+  0x002c0109, 0x0030020a, 0x0032030b, 0x0038020b, 
+  0x003b030c, 0x003e0610, 0x00440711, 0x00490813, 
+  0x004e0813, 0x00540a16, 0x005b0a17, 0x00620b1a, 
+  0x00690c1b, 0x006b0c1b, 0x00640b1a, 0x005d0a17, 
+  0x00570916, 0x00520914, 0x004b0813, 0x00460711, 
+  0x00400610, 0x003c030d, 0x0038020b, 0x0032030b, 
+  0x0030020a, 0x002c0109, 0x00280108, 0x00270108, 
+  0x00260108, 0x00270309, 0x003a0e14, 0x001a090b, 
+  0x00100305, 0x003e141b, 0x00220208, 0x00200006, 
+  0x00200006, 0x00200006, 0x00210006, 0x00220006, 
+  0x00250007, 0x00270108, 0x002c0109, 0x0030020a, 
+  0x0032030b, 0x0038020b, 0x003b030c, 0x003e0610, 
+  0x00440711, 0x00490813, 0x004e0813, 0x00540a16, 
+  0x005b0a17, 0x00620b1a, 0x00690c1b, 0x006b0c1b, 
+  0x00640b1a, 0x005d0a17, 0x00570916, 0x00520914, 
+  0x004b0813, 0x00460711, 0x00400610, 0x003c030d, 
+  0x0038020b, 0x0032030b, 0x0030020a, 0x002c0109, 
+  0x00280108, 0x00270108, 0x00260108, 0x00270309, 
+  0x003a0e14, 0x001a090b, 0x00100305, 0x003e141b, 
+  0x00220208, 0x00200006, 0x00200006, 0x00200006, 
+  0x00210006, 0x00220006, 0x00250007, 0x00270108, 
+  0x002c0109, 0x0030020a, 0x0032030b, 0x0038020b, 
+  0x003b030c, 0x003e0610, 0x00440711, 0x00490813, 
+  0x004e0813, 0x00540a16, 0x005b0a17, 0x00620b1a, 
+  0x00690c1b, 0x006b0c1b, 0x00640b1a, 0x005d0a17, 
+  0x00570916, 0x00520914, 0x004b0813, 0x00460711, 
+  0x00400610, 0x003c030d, 0x0038020b, 0x0032030b, 
+  0x0030020a, 0x002c0109, 0x00280108, 0x00270108, 
+  0x00260108, 0x00270309, 0x003a0e14, 0x001a090b, 
+  0x00100406, 0x003e161d, 0x0024050a, 0x00200208, 
+  0x00200107, 0x00210107, 0x00220107, 0x00240107, 
+  0x00260208, 0x00280209, 0x002b030a, 0x0030030b, 
+  0x0032050c, 0x0038070e, 0x003b060e, 0x003e070e, 
+  0x00440811, 0x00470912, 0x004e0a15, 0x00530b16, 
+  0x00590b18, 0x005f0d1b, 0x0068101e, 0x006c1120, 
+  0x0066101e, 0x005f0c1a, 0x005b0b17, 0x00540c18, 
+  0x004e0a14, 0x00480913, 0x00450811, 0x003e0811, 
+  0x003b060d, 0x0035070e, 0x0032050c, 0x0030030b, 
+  0x002e030a, 0x0029030a, 0x0029030a, 0x0029070c, 
+  0x003c1217, 0x001b090d, 0x00100406, 0x003e161d, 
+  0x0024050a, 0x00200208, 0x00200107, 0x00210107, 
+  0x00220107, 0x00240107, 0x00260208, 0x00280209, 
+  0x002b030a, 0x0030030b, 0x0032050c, 0x0038070e, 
+  0x003b060e, 0x003e070e, 0x00440811, 0x00470912, 
+  0x004e0a15, 0x00530b16, 0x00590b18, 0x005f0d1b, 
+  0x0068101e, 0x006c1120, 0x0066101e, 0x005f0c1a, 
+  0x005b0b17, 0x00540c18, 0x004e0a14, 0x00480913, 
+  0x00450811, 0x003e0811, 0x003b060d, 0x0035070e, 
+  0x0032050c, 0x0030030b, 0x002e030a, 0x0029030a, 
+  0x0029030a, 0x0029070c, 0x003c1217, 0x001b090d, 
+  0x00100406, 0x003e161d, 0x0024050a, 0x00200208, 
+  0x00200107, 0x00210107, 0x00220107, 0x00240107, 
+  0x00260208, 0x00280209, 0x002b030a, 0x0030030b, 
+  0x0032050c, 0x0038070e, 0x003b060e, 0x003e070e, 
+  0x00440811, 0x00470912, 0x004e0a15, 0x00530b16, 
+  0x00590b18, 0x005f0d1b, 0x0068101e, 0x006c1120, 
+  0x0066101e, 0x005f0c1a, 0x005b0b17, 0x00540c18, 
+  0x004e0a14, 0x00480913, 0x00450811, 0x003e0811, 
+  0x003b060d, 0x0035070e, 0x0032050c, 0x0030030b, 
+  0x002e030a, 0x0029030a, 0x0029030a, 0x0029070c, 
+  0x003c1217, 0x001b090d, 0x00100506, 0x003f171d, 
+  0x0025070c, 0x00210309, 0x00220309, 0x00220309, 
+  0x00220309, 0x00250309, 0x00260309, 0x00280309, 
+  0x002c050b, 0x002f070d, 0x0033070d, 0x0035080e, 
+  0x003a0911, 0x003e0912, 0x00430a14, 0x00470a13, 
+  0x004b0c17, 0x00520c17, 0x00580e1b, 0x005e101c, 
+  0x0064111e, 0x00691321, 0x00681220, 0x0062111e, 
+  0x005d101d, 0x00570e1b, 0x00520c17, 0x004b0c17, 
+  0x00470b15, 0x00430a14, 0x003d0810, 0x003a0911, 
+  0x00350810, 0x0032070e, 0x002f070d, 0x002e070d, 
+  0x002c070d, 0x002e080d, 0x003f141a, 0x001c0a0d, 
+  0x00100506, 0x003f171d, 0x0025070c, 0x00210309, 
+  0x00220309, 0x00220309, 0x00220309, 0x00250309, 
+  0x00260309, 0x00280309, 0x002c050b, 0x002f070d, 
+  0x0033070d, 0x0035080e, 0x003a0911, 0x003e0912, 
+  0x00430a14, 0x00470a13, 0x004b0c17, 0x00520c17, 
+  0x00580e1b, 0x005e101c, 0x0064111e, 0x00691321, 
+  0x00681220, 0x0062111e, 0x005d101d, 0x00570e1b, 
+  0x00520c17, 0x004b0c17, 0x00470b15, 0x00430a14, 
+  0x003d0810, 0x003a0911, 0x00350810, 0x0032070e, 
+  0x002f070d, 0x002e070d, 0x002c070d, 0x002e080d, 
+  0x003f141a, 0x001c0a0d, 0x00100506, 0x003f171d, 
+  0x0025070c, 0x00210309, 0x00220309, 0x00220309, 
+  0x00220309, 0x00250309, 0x00260309, 0x00280309, 
+  0x002c050b, 0x002f070d, 0x0033070d, 0x0035080e, 
+  0x003a0911, 0x003e0912, 0x00430a14, 0x00470a13, 
+  0x004b0c17, 0x00520c17, 0x00580e1b, 0x005e101c, 
+  0x0064111e, 0x00691321, 0x00681220, 0x0062111e, 
+  0x005d101d, 0x00570e1b, 0x00520c17, 0x004b0c17, 
+  0x00470b15, 0x00430a14, 0x003d0810, 0x003a0911, 
+  0x00350810, 0x0032070e, 0x002f070d, 0x002e070d, 
+  0x002c070d, 0x002e080d, 0x003f141a, 0x001c0a0d, 
+  0x00100506, 0x003f1a20, 0x00250a0e, 0x0022080c, 
+  0x0022050a, 0x0022050a, 0x0024050a, 0x0026050a, 
+  0x0027050c, 0x0029070c, 0x002c070c, 0x002f080d, 
+  0x00330910, 0x00350910, 0x003a0a11, 0x003d0b14, 
+  0x00400b14, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x005d131f, 0x00621320, 0x00681422, 
+  0x00691524, 0x00641421, 0x005f1320, 0x005b121e, 
+  0x0055111b, 0x00510e1a, 0x004a0d17, 0x00460c16, 
+  0x00400a12, 0x003d0b14, 0x003a0a11, 0x00350910, 
+  0x0033090e, 0x00310910, 0x0030090e, 0x00310a10, 
+  0x0043171f, 0x001c0b0d, 0x00100506, 0x003f1a20, 
+  0x00250a0e, 0x0022080c, 0x0022050a, 0x0022050a, 
+  0x0024050a, 0x0026050a, 0x0027050c, 0x0029070c, 
+  0x002c070c, 0x002f080d, 0x00330910, 0x00350910, 
+  0x003a0a11, 0x003d0b14, 0x00400b14, 0x00460c16, 
+  0x004a0d16, 0x00510e1a, 0x0057111c, 0x005d131f, 
+  0x00621320, 0x00681422, 0x00691524, 0x00641421, 
+  0x005f1320, 0x005b121e, 0x0055111b, 0x00510e1a, 
+  0x004a0d17, 0x00460c16, 0x00400a12, 0x003d0b14, 
+  0x003a0a11, 0x00350910, 0x0033090e, 0x00310910, 
+  0x0030090e, 0x00310a10, 0x0043171f, 0x001c0b0d, 
+  0x00100506, 0x003f1a20, 0x00250a0e, 0x0022080c, 
+  0x0022050a, 0x0022050a, 0x0024050a, 0x0026050a, 
+  0x0027050c, 0x0029070c, 0x002c070c, 0x002f080d, 
+  0x00330910, 0x00350910, 0x003a0a11, 0x003d0b14, 
+  0x00400b14, 0x00460c16, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00641421, 0x005f1320, 0x005b121e, 
+  0x0055111b, 0x00510e1a, 0x004a0d17, 0x00460c16, 
+  0x00400a12, 0x003d0b14, 0x003a0a11, 0x00350910, 
+  0x0033090e, 0x00310910, 0x0030090e, 0x00310a10, 
+  0x0043171f, 0x001c0b0d, 0x00100506, 0x00421d24, 
+  0x00260b0e, 0x0024090d, 0x0024080b, 0x0024080c, 
+  0x0025070c, 0x0026070c, 0x0027080d, 0x0029080c, 
+  0x002c090e, 0x002f090e, 0x00320a10, 0x00350b12, 
+  0x003a0c14, 0x003d0d15, 0x00400d15, 0x00450d15, 
+  0x00ffffff, 0x004f121c, 0x0054131e, 0x00ffffff, 
+  0x00611622, 0x00661624, 0x006b1726, 0x00681624, 
+  0x00621522, 0x005d1521, 0x0058141f, 0x0052131e, 
+  0x004f121c, 0x00490e16, 0x00450d15, 0x00400d16, 
+  0x003d0d15, 0x003a0c14, 0x00380b12, 0x00380b12, 
+  0x00340c12, 0x00340d14, 0x00461a21, 0x001d0c0e, 
+  0x00100506, 0x00421d24, 0x00260b0e, 0x0024090d, 
+  0x0024080b, 0x0024080c, 0x0025070c, 0x0026070c, 
+  0x0027080d, 0x0029080c, 0x002c090e, 0x002f090e, 
+  0x00320a10, 0x00350b12, 0x003a0c14, 0x003d0d15, 
+  0x00400d15, 0x00450d15, 0x00490e16, 0x004f121c, 
+  0x0054131e, 0x005b1420, 0x00611622, 0x00661624, 
+  0x006b1726, 0x00681624, 0x00621522, 0x005d1521, 
+  0x0058141f, 0x0052131e, 0x004f121c, 0x00490e16, 
+  0x00450d15, 0x00400d16, 0x003d0d15, 0x003a0c14, 
+  0x00380b12, 0x00380b12, 0x00340c12, 0x00340d14, 
+  0x00461a21, 0x001d0c0e, 0x00100506, 0x00421d24, 
+  0x00260b0e, 0x0024090d, 0x0024080b, 0x0024080c, 
+  0x0025070c, 0x0026070c, 0x0027080d, 0x0029080c, 
+  0x002c090e, 0x002f090e, 0x00320a10, 0x00350b12, 
+  0x003a0c14, 0x003d0d15, 0x00400d15, 0x00450d15, 
+  0x00ffffff, 0x004f121c, 0x0054131e, 0x00ffffff, 
+  0x00611622, 0x00661624, 0x00ffffff, 0x00681624, 
+  0x00621522, 0x005d1521, 0x0058141f, 0x0052131e, 
+  0x004f121c, 0x00490e16, 0x00450d15, 0x00400d16, 
+  0x003d0d15, 0x003a0c14, 0x00380b12, 0x00380b12, 
+  0x00340c12, 0x00340d14, 0x00461a21, 0x001d0c0e, 
+  0x00100607, 0x00431f25, 0x00270c10, 0x00240a0e, 
+  0x00240a0e, 0x0025090c, 0x0025090c, 0x00260a0e, 
+  0x0028090e, 0x0029090d, 0x002c0a0e, 0x002f0b11, 
+  0x00320b11, 0x00340c12, 0x003a0d15, 0x003c0e16, 
+  0x00401017, 0x00450e15, 0x00ffffff, 0x004d131d, 
+  0x0052141e, 0x00591621, 0x00ffffff, 0x00631825, 
+  0x00691826, 0x00691826, 0x00641725, 0x00611724, 
+  0x005c1622, 0x00581520, 0x0052141e, 0x004d131d, 
+  0x0048121b, 0x00450e15, 0x00401017, 0x003e0e15, 
+  0x003c0e16, 0x003b0e16, 0x003a0e16, 0x003b1017, 
+  0x00491d25, 0x001d0d0f, 0x00100607, 0x00431f25, 
+  0x00270c10, 0x00240a0e, 0x00240a0e, 0x0025090c, 
+  0x0025090c, 0x00260a0e, 0x0028090e, 0x0029090d, 
+  0x002c0a0e, 0x002f0b11, 0x00320b11, 0x00340c12, 
+  0x003a0d15, 0x003c0e16, 0x00401017, 0x00450e15, 
+  0x0048121b, 0x004d131d, 0x0052141e, 0x00591621, 
+  0x005e1724, 0x00631825, 0x00691826, 0x00691826, 
+  0x00641725, 0x00611724, 0x005c1622, 0x00581520, 
+  0x0052141e, 0x004d131d, 0x0048121b, 0x00450e15, 
+  0x00401017, 0x003e0e15, 0x003c0e16, 0x003b0e16, 
+  0x003a0e16, 0x003b1017, 0x00491d25, 0x001d0d0f, 
+  0x00100607, 0x00431f25, 0x00270c10, 0x00240a0e, 
+  0x00240a0e, 0x0025090c, 0x0025090c, 0x00260a0e, 
+  0x0028090e, 0x0029090d, 0x002c0a0e, 0x002f0b11, 
+  0x00320b11, 0x00340c12, 0x003a0d15, 0x003c0e16, 
+  0x00401017, 0x00450e15, 0x0048121b, 0x004d131d, 
+  0x0052141e, 0x00ffffff, 0x005e1724, 0x00631825, 
+  0x00691826, 0x00691826, 0x00641725, 0x00611724, 
+  0x005c1622, 0x00581520, 0x0052141e, 0x004d131d, 
+  0x0048121b, 0x00450e15, 0x00401017, 0x003e0e15, 
+  0x003c0e16, 0x003b0e16, 0x003a0e16, 0x003b1017, 
+  0x00491d25, 0x001d0d0f, 0x00110608, 0x00432026, 
+  0x00270d11, 0x00250b10, 0x00250a0d, 0x00250a0e, 
+  0x00260a0d, 0x0027090d, 0x00280a10, 0x00290a0e, 
+  0x002c0b11, 0x002f0c12, 0x00320c12, 0x00340d14, 
+  0x003a0e16, 0x003c1017, 0x003f121a, 0x0044131b, 
+  0x00ffffff, 0x004d141e, 0x0051151f, 0x00571722, 
+  0x00ffffff, 0x00621a26, 0x00671b28, 0x006b1c29, 
+  0x00671d29, 0x00631a26, 0x005f1825, 0x005b1722, 
+  0x00541620, 0x0050151f, 0x004b141d, 0x0048131c, 
+  0x0045131c, 0x0043131b, 0x003f1218, 0x003e121a, 
+  0x003e121a, 0x003e131b, 0x004b1f27, 0x001e0d0f, 
+  0x00110608, 0x00432026, 0x00270d11, 0x00250b10, 
+  0x00250a0d, 0x00250a0e, 0x00260a0d, 0x0027090d, 
+  0x00280a10, 0x00290a0e, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00330d14, 0x00390e16, 0x003b1017, 
+  0x003e121a, 0x0043131b, 0x0048131c, 0x004d141e, 
+  0x0051151f, 0x00571722, 0x005d1824, 0x00621a26, 
+  0x00671b28, 0x00ffffff, 0x00ffffff, 0x00621a26, 
+  0x005e1825, 0x005a1721, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x0047131b, 0x0044131b, 0x0042131b, 
+  0x003e1218, 0x003e121a, 0x003e121a, 0x003e131b, 
+  0x004b1f27, 0x001e0d0f, 0x00110608, 0x00432026, 
+  0x00270d11, 0x00250b10, 0x00250a0d, 0x00250a0e, 
+  0x00260a0d, 0x0027090d, 0x00280a10, 0x00290a0e, 
+  0x002c0b11, 0x002f0c12, 0x00320c12, 0x00340d14, 
+  0x003a0e16, 0x003c1017, 0x003f121a, 0x0044131b, 
+  0x0048131c, 0x004d141e, 0x0051151f, 0x00ffffff, 
+  0x005d1824, 0x00621a26, 0x00671b28, 0x006b1c29, 
+  0x00671d29, 0x00631a26, 0x005f1825, 0x005b1722, 
+  0x00541620, 0x0050151f, 0x004b141d, 0x0048131c, 
+  0x0045131c, 0x0043131b, 0x003f1218, 0x003e121a, 
+  0x003e121a, 0x003e131b, 0x004b1f27, 0x001e0d0f, 
+  0x00110608, 0x00442127, 0x00270e12, 0x00250c11, 
+  0x00250c11, 0x00250b0e, 0x00260b0e, 0x00270c11, 
+  0x00280c11, 0x002b0b10, 0x002c0c12, 0x00300d13, 
+  0x00320d14, 0x00340e14, 0x003a1016, 0x003c1218, 
+  0x003f131b, 0x0044141b, 0x00ffffff, 0x004b151e, 
+  0x00511721, 0x00551822, 0x00ffffff, 0x00611c26, 
+  0x00641e2a, 0x00691f2b, 0x00691f2b, 0x00661e2a, 
+  0x00621d28, 0x005d1c27, 0x00581824, 0x00531721, 
+  0x00501620, 0x004b161f, 0x0048151e, 0x0046151d, 
+  0x0044151d, 0x0043151d, 0x0043151d, 0x0044151e, 
+  0x00502129, 0x001e0f11, 0x00110608, 0x00442127, 
+  0x00270e12, 0x00250c11, 0x00250c11, 0x00250b0e, 
+  0x00260b0e, 0x00270c11, 0x00280c11, 0x002b0b10, 
+  0x00ffffff, 0x002f0d13, 0x00ffffff, 0x00310d13, 
+  0x00370f15, 0x00ffffff, 0x003c121a, 0x0042131a, 
+  0x0047151d, 0x004a151e, 0x00511721, 0x00551822, 
+  0x005c1a25, 0x00611c26, 0x00641e2a, 0x00681f2b, 
+  0x00ffffff, 0x00641d29, 0x005f1c27, 0x00591b25, 
+  0x00ffffff, 0x004f1620, 0x00ffffff, 0x0047151d, 
+  0x0044141c, 0x0042141c, 0x0042141c, 0x0041151c, 
+  0x0042151d, 0x0044151e, 0x00502129, 0x001e0f11, 
+  0x00110608, 0x00442127, 0x00270e12, 0x00250c11, 
+  0x00250c11, 0x00250b0e, 0x00260b0e, 0x00270c11, 
+  0x00280c11, 0x002b0b10, 0x002c0c12, 0x00300d13, 
+  0x00320d14, 0x00340e14, 0x003a1016, 0x003c1218, 
+  0x003f131b, 0x0044141b, 0x0048151e, 0x004b151e, 
+  0x00511721, 0x00ffffff, 0x005c1a25, 0x00611c26, 
+  0x00641e2a, 0x00691f2b, 0x00691f2b, 0x00661e2a, 
+  0x00621d28, 0x005d1c27, 0x00581824, 0x00531721, 
+  0x00501620, 0x004b161f, 0x0048151e, 0x0046151d, 
+  0x0044151d, 0x0043151d, 0x0043151d, 0x0044151e, 
+  0x00502129, 0x001e0f11, 0x00110708, 0x00452429, 
+  0x00281013, 0x00250d12, 0x00250c10, 0x00260c10, 
+  0x00270c10, 0x00270c10, 0x00290d12, 0x002c0c11, 
+  0x002e0d13, 0x00310e13, 0x00331015, 0x00341014, 
+  0x00391217, 0x003d131a, 0x0040141d, 0x0044151e, 
+  0x00ffffff, 0x004b1620, 0x00501821, 0x00541a24, 
+  0x00ffffff, 0x005f1e29, 0x00631f2a, 0x0067202c, 
+  0x006b212e, 0x0068202c, 0x00641f2a, 0x005f1e29, 
+  0x005b1d27, 0x00571c26, 0x00531a24, 0x00501821, 
+  0x004b1821, 0x00491720, 0x0048171f, 0x0046171f, 
+  0x0046171f, 0x00481820, 0x0053242b, 0x001e1012, 
+  0x00110708, 0x00452429, 0x00281013, 0x00250d12, 
+  0x00250c10, 0x00260c10, 0x00270c10, 0x00270c10, 
+  0x00290d12, 0x002c0c11, 0x00ffffff, 0x002f0d12, 
+  0x00300f14, 0x002f0f12, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x0044151d, 0x0047151e, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00601e29, 0x00631f2a, 0x00ffffff, 0x00611e29, 
+  0x005d1d27, 0x00581c26, 0x00ffffff, 0x00501a23, 
+  0x004c1821, 0x0048161e, 0x0044161e, 0x0043151d, 
+  0x0043161d, 0x0043161e, 0x0045171e, 0x00471820, 
+  0x0053242b, 0x001e1012, 0x00110708, 0x00452429, 
+  0x00281013, 0x00250d12, 0x00250c10, 0x00260c10, 
+  0x00270c10, 0x00270c10, 0x00290d12, 0x002c0c11, 
+  0x002e0d13, 0x00310e13, 0x00331015, 0x00341014, 
+  0x00391217, 0x003d131a, 0x0040141d, 0x0044151e, 
+  0x0048161f, 0x004b1620, 0x00501821, 0x00ffffff, 
+  0x005a1d27, 0x005f1e29, 0x00631f2a, 0x0067202c, 
+  0x006b212e, 0x0068202c, 0x00641f2a, 0x005f1e29, 
+  0x005b1d27, 0x00571c26, 0x00531a24, 0x00501821, 
+  0x004b1821, 0x00491720, 0x0048171f, 0x0046171f, 
+  0x0046171f, 0x00481820, 0x0053242b, 0x001e1012, 
+  0x00120709, 0x0046262b, 0x00291316, 0x00260e13, 
+  0x00260d11, 0x00260d11, 0x00270d11, 0x00280e13, 
+  0x00290e13, 0x002c0d12, 0x002f0e13, 0x00311015, 
+  0x00331217, 0x00361318, 0x003a141b, 0x003c151c, 
+  0x0040161d, 0x0045171f, 0x00ffffff, 0x004b1a22, 
+  0x00501d26, 0x00ffffff, 0x005a1e28, 0x005d202a, 
+  0x0061212c, 0x0066222e, 0x006b2430, 0x00692430, 
+  0x0067222e, 0x0061212c, 0x005e202a, 0x005a1e29, 
+  0x00571d28, 0x00531c26, 0x00511c25, 0x004f1a22, 
+  0x004b1a22, 0x004a1a21, 0x004a1a21, 0x004b1d25, 
+  0x00552931, 0x001f1112, 0x00120709, 0x0046262b, 
+  0x00291316, 0x00260e13, 0x00260d11, 0x00260d11, 
+  0x00270d11, 0x00280e13, 0x00290e13, 0x002b0d12, 
+  0x00ffffff, 0x002e0f14, 0x002e1015, 0x002e1015, 
+  0x00311117, 0x00ffffff, 0x00371319, 0x003c141b, 
+  0x0040151c, 0x0044181f, 0x004a1b23, 0x00ffffff, 
+  0x00551c26, 0x00581e28, 0x005b1f29, 0x005d1f2a, 
+  0x00ffffff, 0x005e202b, 0x005b1e29, 0x00541d26, 
+  0x00ffffff, 0x004e1a24, 0x004b1922, 0x00461820, 
+  0x00461820, 0x0045171e, 0x0044181f, 0x0046181f, 
+  0x00481920, 0x004a1d25, 0x00552931, 0x001f1112, 
+  0x00120709, 0x0046262b, 0x00291316, 0x00260e13, 
+  0x00260d11, 0x00260d11, 0x00270d11, 0x00280e13, 
+  0x00290e13, 0x002c0d12, 0x002f0e13, 0x00311015, 
+  0x00331217, 0x00361318, 0x003a141b, 0x003c151c, 
+  0x0040161d, 0x0045171f, 0x00481820, 0x004b1a22, 
+  0x00501d26, 0x00ffffff, 0x005a1e28, 0x005d202a, 
+  0x0061212c, 0x0066222e, 0x006b2430, 0x00692430, 
+  0x0067222e, 0x0061212c, 0x005e202a, 0x005a1e29, 
+  0x00571d28, 0x00531c26, 0x00511c25, 0x004f1a22, 
+  0x004b1a22, 0x004a1a21, 0x004a1a21, 0x004b1d25, 
+  0x00552931, 0x001f1112, 0x00170d0e, 0x0049292f, 
+  0x002c151a, 0x00270e12, 0x00270e12, 0x00280e12, 
+  0x00280e12, 0x00291014, 0x002c0e13, 0x002e1015, 
+  0x00301013, 0x00321318, 0x00341318, 0x0039141b, 
+  0x003b151c, 0x003e161c, 0x0044171f, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00541f28, 
+  0x005a202a, 0x005d212c, 0x0061222c, 0x0063252f, 
+  0x00692732, 0x006b2833, 0x00682732, 0x00662530, 
+  0x0061222c, 0x005d222c, 0x005a202a, 0x00571f28, 
+  0x00541e27, 0x00521f28, 0x00501f27, 0x004f1e26, 
+  0x004f1e26, 0x00502028, 0x005a2c34, 0x00221416, 
+  0x00170d0e, 0x0049292f, 0x002c151a, 0x00270e12, 
+  0x00270e12, 0x00280e12, 0x00280e12, 0x00291014, 
+  0x002c0e13, 0x002d1015, 0x00ffffff, 0x002d1116, 
+  0x002c1015, 0x002e1016, 0x002e1016, 0x00ffffff, 
+  0x00361219, 0x0038151b, 0x00ffffff, 0x00421920, 
+  0x00471a22, 0x00ffffff, 0x00501d26, 0x00541e28, 
+  0x00561e27, 0x00552029, 0x00ffffff, 0x005a222b, 
+  0x0056202a, 0x00531e27, 0x00ffffff, 0x004b1c24, 
+  0x00481921, 0x0044181f, 0x00441820, 0x00441a21, 
+  0x00461b22, 0x00481c23, 0x004c1d25, 0x004f2028, 
+  0x005a2c34, 0x00221416, 0x00170d0e, 0x0049292f, 
+  0x002c151a, 0x00270e12, 0x00270e12, 0x00280e12, 
+  0x00280e12, 0x00291014, 0x002c0e13, 0x002e1015, 
+  0x00301013, 0x00321318, 0x00341318, 0x0039141b, 
+  0x003b151c, 0x003e161c, 0x0044171f, 0x00461a21, 
+  0x00491a21, 0x004d1d25, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x005d212c, 0x0061222c, 0x0063252f, 
+  0x00692732, 0x006b2833, 0x00682732, 0x00662530, 
+  0x0061222c, 0x005d222c, 0x005a202a, 0x00571f28, 
+  0x00541e27, 0x00521f28, 0x00501f27, 0x004f1e26, 
+  0x004f1e26, 0x00502028, 0x005a2c34, 0x00221416, 
+  0x001e1118, 0x004b2b2f, 0x00331b1f, 0x00291316, 
+  0x00281115, 0x00291115, 0x00291115, 0x002b1115, 
+  0x002e1013, 0x00301217, 0x00311318, 0x0033141a, 
+  0x0038151b, 0x003a161c, 0x003d171e, 0x003f181f, 
+  0x00451a21, 0x00481b22, 0x004b1d25, 0x00501f27, 
+  0x00522029, 0x0055222b, 0x005a222b, 0x005d242f, 
+  0x0061252f, 0x00632832, 0x00672933, 0x00692a35, 
+  0x00692a35, 0x00662933, 0x00632832, 0x0061252f, 
+  0x005d252f, 0x005b242c, 0x0058222b, 0x0057212a, 
+  0x0054212a, 0x0053212a, 0x0053212a, 0x0054252c, 
+  0x005e343a, 0x00221418, 0x001e1118, 0x004b2b2f, 
+  0x00331b1f, 0x00291316, 0x00281115, 0x00291115, 
+  0x00291115, 0x002b1115, 0x002e1013, 0x002f1216, 
+  0x002e1216, 0x00ffffff, 0x00ffffff, 0x002d1116, 
+  0x002e1116, 0x002e1217, 0x00ffffff, 0x00ffffff, 
+  0x0039161c, 0x003f181f, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x004d1e27, 0x004f1e26, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x0052212a, 0x004e1f27, 
+  0x004d1f27, 0x00ffffff, 0x00ffffff, 0x00441b21, 
+  0x00451b22, 0x00461b22, 0x00481c24, 0x004c1e26, 
+  0x00502028, 0x0053242b, 0x005e343a, 0x00221418, 
+  0x001e1118, 0x004b2b2f, 0x00331b1f, 0x00291316, 
+  0x00281115, 0x00291115, 0x00291115, 0x002b1115, 
+  0x002e1013, 0x00301217, 0x00311318, 0x0033141a, 
+  0x0038151b, 0x003a161c, 0x003d171e, 0x003f181f, 
+  0x00451a21, 0x00481b22, 0x004b1d25, 0x00501f27, 
+  0x00522029, 0x0055222b, 0x005a222b, 0x005d242f, 
+  0x0061252f, 0x00632832, 0x00672933, 0x00692a35, 
+  0x00692a35, 0x00662933, 0x00632832, 0x0061252f, 
+  0x005d252f, 0x005b242c, 0x0058222b, 0x0057212a, 
+  0x0054212a, 0x0053212a, 0x0053212a, 0x0054252c, 
+  0x005e343a, 0x00221418, 0x0022101e, 0x00472e31, 
+  0x00492b31, 0x00331b1f, 0x002e161b, 0x002c151a, 
+  0x002e1417, 0x002f151a, 0x0031161b, 0x0032161b, 
+  0x0034161c, 0x0038171d, 0x003b181e, 0x003d1a1f, 
+  0x003f1a20, 0x00451d24, 0x00481d25, 0x004d1f27, 
+  0x00502028, 0x0052212a, 0x0054242b, 0x0057252e, 
+  0x005b2831, 0x005d2831, 0x00612932, 0x00632b34, 
+  0x00662c36, 0x00682e38, 0x006b2f39, 0x00682e38, 
+  0x00662c36, 0x00632a33, 0x00612a33, 0x005e2831, 
+  0x005c2932, 0x005b2831, 0x005a252e, 0x0058262f, 
+  0x00582931, 0x005e333b, 0x00513336, 0x001e1019, 
+  0x0022101e, 0x00472e31, 0x00492b31, 0x00331b1f, 
+  0x002e161b, 0x002c151a, 0x002e1417, 0x002f151a, 
+  0x0031161b, 0x0031151a, 0x0031151a, 0x00311419, 
+  0x00311419, 0x002f1418, 0x002f1318, 0x0032151a, 
+  0x0034151b, 0x0037161c, 0x0039171d, 0x003c181f, 
+  0x003f1b20, 0x00411c22, 0x00451e25, 0x00461e25, 
+  0x00491f25, 0x00492026, 0x004b2028, 0x004d222a, 
+  0x0050232b, 0x004c2229, 0x004c2128, 0x004a1f26, 
+  0x00481f26, 0x00451d24, 0x00482027, 0x004a2028, 
+  0x004d2028, 0x0050232b, 0x0055282f, 0x005d323a, 
+  0x00513336, 0x001e1019, 0x0022101e, 0x00472e31, 
+  0x00492b31, 0x00331b1f, 0x002e161b, 0x002c151a, 
+  0x002e1417, 0x002f151a, 0x0031161b, 0x0032161b, 
+  0x0034161c, 0x0038171d, 0x003b181e, 0x003d1a1f, 
+  0x003f1a20, 0x00451d24, 0x00481d25, 0x004d1f27, 
+  0x00502028, 0x0052212a, 0x0054242b, 0x0057252e, 
+  0x005b2831, 0x005d2831, 0x00612932, 0x00632b34, 
+  0x00662c36, 0x00682e38, 0x006b2f39, 0x00682e38, 
+  0x00662c36, 0x00632a33, 0x00612a33, 0x005e2831, 
+  0x005c2932, 0x005b2831, 0x005a252e, 0x0058262f, 
+  0x00582931, 0x005e333b, 0x00513336, 0x001e1019, 
+  0x00291226, 0x00381e31, 0x00482e31, 0x00503034, 
+  0x0047292f, 0x0043272b, 0x0043252a, 0x0044252a, 
+  0x0045252a, 0x0046262b, 0x0048262b, 0x0049282e, 
+  0x004b282e, 0x004f2930, 0x00512930, 0x00522a31, 
+  0x00552b32, 0x00582c34, 0x005a2e35, 0x005c2f36, 
+  0x005d3038, 0x005f3139, 0x0061333b, 0x0063343b, 
+  0x0066353d, 0x0068363e, 0x006b3840, 0x006b3a42, 
+  0x006b3a42, 0x006b3a42, 0x006b3942, 0x00693840, 
+  0x0067363f, 0x0066353d, 0x0065353d, 0x0063343c, 
+  0x0062343c, 0x0061353d, 0x00613a40, 0x00533438, 
+  0x00361f2e, 0x00271225, 0x00291226, 0x00381e31, 
+  0x00482e31, 0x00503034, 0x0047292f, 0x0043272b, 
+  0x0043252a, 0x0044252a, 0x0045252a, 0x0044252a, 
+  0x00432428, 0x00412329, 0x003f2126, 0x003e2025, 
+  0x003d1f24, 0x003c1f24, 0x003e2025, 0x003f2026, 
+  0x00412126, 0x00442328, 0x00452329, 0x0046242a, 
+  0x0048262c, 0x004a272c, 0x004b272d, 0x004c272d, 
+  0x004e292f, 0x004f2b31, 0x00502b31, 0x004e2a30, 
+  0x00502b31, 0x004f2a30, 0x004d282f, 0x004c272d, 
+  0x00502a30, 0x00512b31, 0x00552d34, 0x00593138, 
+  0x005e383e, 0x00523337, 0x00361f2e, 0x00271225, 
+  0x00291226, 0x00381e31, 0x00482e31, 0x00503034, 
+  0x0047292f, 0x0043272b, 0x0043252a, 0x0044252a, 
+  0x0045252a, 0x0046262b, 0x0048262b, 0x0049282e, 
+  0x004b282e, 0x004f2930, 0x00512930, 0x00522a31, 
+  0x00552b32, 0x00582c34, 0x005a2e35, 0x005c2f36, 
+  0x005d3038, 0x005f3139, 0x0061333b, 0x0063343b, 
+  0x0066353d, 0x0068363e, 0x006b3840, 0x006b3a42, 
+  0x006b3a42, 0x006b3a42, 0x006b3942, 0x00693840, 
+  0x0067363f, 0x0066353d, 0x0065353d, 0x0063343c, 
+  0x0062343c, 0x0061353d, 0x00613a40, 0x00533438, 
+  0x00361f2e, 0x00271225, 0x002a1225, 0x00291226, 
+  0x001f0f1b, 0x00211419, 0x00221517, 0x001f1214, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x00201214, 
+  0x00201315, 0x00211315, 0x00211315, 0x00221416, 
+  0x00221416, 0x00221416, 0x00221416, 0x00231416, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00231517, 0x00231416, 
+  0x00231416, 0x00221416, 0x00221416, 0x00241719, 
+  0x00231519, 0x001e1019, 0x00271125, 0x002a1325, 
+  0x002a1225, 0x00291226, 0x001f0f1b, 0x00211419, 
+  0x00221517, 0x001f1214, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001d1113, 0x001c1012, 0x001c1012, 
+  0x001b0f11, 0x00190f10, 0x00180e10, 0x00180e0f, 
+  0x00180e0f, 0x00180d0f, 0x00180e10, 0x00190e10, 
+  0x00190e10, 0x00190f10, 0x00190f10, 0x00190f10, 
+  0x00190f10, 0x001a0f10, 0x001b1011, 0x001b1011, 
+  0x001b1011, 0x001b1011, 0x001c1012, 0x001c1012, 
+  0x001b1012, 0x001b0f11, 0x001d1012, 0x001d1113, 
+  0x001e1213, 0x00211517, 0x00221418, 0x001e1019, 
+  0x00271125, 0x002a1325, 0x002a1225, 0x00291226, 
+  0x001f0f1b, 0x00211419, 0x00221517, 0x001f1214, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x00201214, 
+  0x00201315, 0x00211315, 0x00211315, 0x00221416, 
+  0x00221416, 0x00221416, 0x00221416, 0x00231416, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00231517, 0x00231416, 
+  0x00231416, 0x00221416, 0x00221416, 0x00241719, 
+  0x00231519, 0x001e1019, 0x00271125, 0x002a1325, 
+  0x002a1225, 0x00291226, 0x00271423, 0x00281c24, 
+  0x00272222, 0x00272222, 0x00262223, 0x00262122, 
+  0x00262122, 0x00262121, 0x00252122, 0x00252121, 
+  0x00252121, 0x00252020, 0x00242020, 0x00242020, 
+  0x00241f1f, 0x00241f1f, 0x00231e1e, 0x00231d1e, 
+  0x00231d1d, 0x00221c1d, 0x00221c1d, 0x00221c1c, 
+  0x00221b1c, 0x00211b1c, 0x00211b1c, 0x00201a1b, 
+  0x001f1a1b, 0x001f191a, 0x001f1919, 0x001f1819, 
+  0x001e1819, 0x001e1818, 0x001e1818, 0x001d1718, 
+  0x001d1717, 0x001e1819, 0x0023171d, 0x00241220, 
+  0x00291226, 0x002a1225, 0x002a1225, 0x00291226, 
+  0x00271423, 0x00281c24, 0x00272222, 0x00272222, 
+  0x00262223, 0x00262122, 0x00262122, 0x00252020, 
+  0x00242021, 0x00221f1f, 0x00211e1e, 0x00201b1b, 
+  0x001e1b1b, 0x001e1a1a, 0x001d1919, 0x001d1919, 
+  0x001c1818, 0x001c1718, 0x001b1717, 0x001a1616, 
+  0x001a1616, 0x001a1515, 0x001a1415, 0x00191515, 
+  0x00191516, 0x00191415, 0x00181415, 0x00181414, 
+  0x00191414, 0x00191314, 0x00181414, 0x00191414, 
+  0x001a1414, 0x00191415, 0x001a1515, 0x001c1718, 
+  0x0022161c, 0x00241220, 0x00291226, 0x002a1225, 
+  0x002a1225, 0x00291226, 0x00271423, 0x00281c24, 
+  0x00272222, 0x00272222, 0x00262223, 0x00262122, 
+  0x00262122, 0x00262121, 0x00252122, 0x00252121, 
+  0x00252121, 0x00252020, 0x00242020, 0x00242020, 
+  0x00241f1f, 0x00241f1f, 0x00231e1e, 0x00231d1e, 
+  0x00231d1d, 0x00221c1d, 0x00221c1d, 0x00221c1c, 
+  0x00221b1c, 0x00211b1c, 0x00211b1c, 0x00201a1b, 
+  0x001f1a1b, 0x001f191a, 0x001f1919, 0x001f1819, 
+  0x001e1819, 0x001e1818, 0x001e1818, 0x001d1718, 
+  0x001d1717, 0x001e1819, 0x0023171d, 0x00241220, 
+  0x00291226, 0x002a1225, 0x00291226, 0x00493049, 
+  0x00595152, 0x0065595a, 0x0067585a, 0x0069575a, 
+  0x00695458, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695257, 0x00695155, 0x00695054, 0x00694f53, 
+  0x00684e52, 0x00674d51, 0x00664b50, 0x0066484e, 
+  0x0065474d, 0x0064464b, 0x0062464a, 0x00614549, 
+  0x005f4549, 0x005f4448, 0x005e4347, 0x005d4246, 
+  0x005c4045, 0x005b4045, 0x005a3f44, 0x00593d42, 
+  0x00573c40, 0x00553c40, 0x00553c40, 0x00573d42, 
+  0x00573f43, 0x004f3b3d, 0x003e263a, 0x00291226, 
+  0x00291226, 0x00493049, 0x00595152, 0x0065595a, 
+  0x0067585a, 0x0069575a, 0x00695458, 0x00695357, 
+  0x00695357, 0x00685256, 0x00675155, 0x00644f53, 
+  0x00624d51, 0x005f4b4f, 0x005e494e, 0x005d474b, 
+  0x005c464a, 0x005b4548, 0x005a4347, 0x00584246, 
+  0x00564044, 0x00553c41, 0x00543b40, 0x00533a3e, 
+  0x00513a3d, 0x00513a3d, 0x00503a3d, 0x00503a3d, 
+  0x0050393c, 0x004f383c, 0x004f373b, 0x004f373c, 
+  0x004f373b, 0x004e363a, 0x004e3639, 0x004e373a, 
+  0x0050383c, 0x00543b3f, 0x00563e42, 0x004f3b3d, 
+  0x003e263a, 0x00291226, 0x00291226, 0x00493049, 
+  0x00595152, 0x0065595a, 0x0067585a, 0x0069575a, 
+  0x00695458, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695357, 0x00695357, 0x00695357, 0x00695357, 
+  0x00695257, 0x00695155, 0x00695054, 0x00694f53, 
+  0x00684e52, 0x00674d51, 0x00664b50, 0x0066484e, 
+  0x0065474d, 0x0064464b, 0x0062464a, 0x00614549, 
+  0x005f4549, 0x005f4448, 0x005e4347, 0x005d4246, 
+  0x005c4045, 0x005b4045, 0x005a3f44, 0x00593d42, 
+  0x00573c40, 0x00553c40, 0x00553c40, 0x00573d42, 
+  0x00573f43, 0x004f3b3d, 0x003e263a, 0x00291226, 
+  0x00251423, 0x00594f51, 0x00665758, 0x00654e52, 
+  0x0064494e, 0x0064484d, 0x0064464b, 0x0065464b, 
+  0x0065464b, 0x0066464b, 0x0066464b, 0x0067464b, 
+  0x0068464b, 0x0069464b, 0x0069454b, 0x00674449, 
+  0x00664248, 0x00654047, 0x00623f45, 0x00613e44, 
+  0x005f3c42, 0x00ffffff, 0x005c393e, 0x005b383d, 
+  0x0059363c, 0x0057353b, 0x0055343a, 0x00533339, 
+  0x00513136, 0x00503035, 0x004e2f34, 0x00492f33, 
+  0x00472e32, 0x00452c31, 0x00442b30, 0x00422b2f, 
+  0x003f2a2e, 0x003f2b2f, 0x00452e32, 0x0053393d, 
+  0x004e3839, 0x0021111e, 0x00251423, 0x00594f51, 
+  0x00665758, 0x00654e52, 0x0064494e, 0x0064484d, 
+  0x0064464b, 0x0065464b, 0x0065464b, 0x0066464b, 
+  0x0065454a, 0x00644449, 0x00644348, 0x00634247, 
+  0x00624046, 0x00603f44, 0x005f3d43, 0x005d3b42, 
+  0x005b3a40, 0x0059393f, 0x0057373c, 0x00543539, 
+  0x00533338, 0x00523337, 0x00503036, 0x004e3035, 
+  0x004d2f35, 0x004b2e34, 0x00492c31, 0x00482b30, 
+  0x00472b2f, 0x00432b2f, 0x00412a2e, 0x0040292d, 
+  0x003f282d, 0x003e292c, 0x003c282c, 0x003d2a2e, 
+  0x00442d31, 0x0053393d, 0x004e3839, 0x0021111e, 
+  0x00251423, 0x00594f51, 0x00665758, 0x00654e52, 
+  0x0064494e, 0x0064484d, 0x0064464b, 0x0065464b, 
+  0x0065464b, 0x0066464b, 0x0066464b, 0x0067464b, 
+  0x0068464b, 0x0069464b, 0x0069454b, 0x00674449, 
+  0x00664248, 0x00654047, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x005d3a3f, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x0057353b, 0x0055343a, 0x00533339, 
+  0x00513136, 0x00503035, 0x004e2f34, 0x00492f33, 
+  0x00472e32, 0x00452c31, 0x00442b30, 0x00422b2f, 
+  0x003f2a2e, 0x003f2b2f, 0x00452e32, 0x0053393d, 
+  0x004e3839, 0x0021111e, 0x00271b23, 0x00645353, 
+  0x00624b4f, 0x0061464a, 0x00614348, 0x00614247, 
+  0x00624247, 0x00624046, 0x00624046, 0x00644046, 
+  0x00654047, 0x00664047, 0x00674047, 0x00684047, 
+  0x006b3f47, 0x00673f46, 0x00673c44, 0x00663b43, 
+  0x00623a40, 0x005f383e, 0x00ffffff, 0x005c353c, 
+  0x005a343b, 0x00573339, 0x00553036, 0x00532f35, 
+  0x00512e33, 0x004f2c32, 0x004e2b31, 0x004a2a30, 
+  0x0047292f, 0x00442a2f, 0x0042272b, 0x003e272b, 
+  0x003c2629, 0x003a2528, 0x00392528, 0x00382528, 
+  0x00392528, 0x003f2a2e, 0x0054393d, 0x0023151c, 
+  0x00271b23, 0x00645353, 0x00624b4f, 0x0061464a, 
+  0x00614348, 0x00614247, 0x00624247, 0x00624046, 
+  0x00624046, 0x00644046, 0x00654047, 0x00653f46, 
+  0x00653f46, 0x00653e45, 0x00673d44, 0x00633d43, 
+  0x00633a41, 0x00623940, 0x005e373d, 0x005b363b, 
+  0x0058333a, 0x00573239, 0x00553138, 0x00523036, 
+  0x00502d33, 0x004e2c32, 0x004d2b30, 0x004b2a2f, 
+  0x004a292e, 0x0046282e, 0x0043272d, 0x0041282d, 
+  0x003f2529, 0x003c2529, 0x003a2528, 0x00382427, 
+  0x00382427, 0x00372427, 0x00392528, 0x003f2a2e, 
+  0x0054393d, 0x0023151c, 0x00271b23, 0x00645353, 
+  0x00624b4f, 0x0061464a, 0x00614348, 0x00614247, 
+  0x00624247, 0x00624046, 0x00624046, 0x00644046, 
+  0x00654047, 0x00664047, 0x00674047, 0x00684047, 
+  0x006b3f47, 0x00673f46, 0x00673c44, 0x00663b43, 
+  0x00623a40, 0x00ffffff, 0x005d363d, 0x005c353c, 
+  0x005a343b, 0x00ffffff, 0x00553036, 0x00532f35, 
+  0x00512e33, 0x004f2c32, 0x004e2b31, 0x004a2a30, 
+  0x0047292f, 0x00442a2f, 0x0042272b, 0x003e272b, 
+  0x003c2629, 0x003a2528, 0x00392528, 0x00382528, 
+  0x00392528, 0x003f2a2e, 0x0054393d, 0x0023151c, 
+  0x00241e1f, 0x00665154, 0x005f4549, 0x005e3f45, 
+  0x005e3f45, 0x005e3c42, 0x005e3c42, 0x005f3c42, 
+  0x00613b42, 0x00623b42, 0x00653b42, 0x00663b43, 
+  0x00673b43, 0x00683b43, 0x006b3b43, 0x00693a42, 
+  0x00673940, 0x0065383f, 0x0063353d, 0x0061343c, 
+  0x00ffffff, 0x005c3038, 0x00572f35, 0x00542e34, 
+  0x00532c33, 0x00502b32, 0x004f2a31, 0x004b292f, 
+  0x0049282e, 0x0046262b, 0x0043252a, 0x003f2529, 
+  0x003d2428, 0x003b2227, 0x00392226, 0x00362125, 
+  0x00342024, 0x00332024, 0x00332024, 0x00382226, 
+  0x004b2e33, 0x00231718, 0x00241e1f, 0x00665154, 
+  0x005f4549, 0x005e3f45, 0x005e3f45, 0x005e3c42, 
+  0x005e3c42, 0x005f3c42, 0x00613b42, 0x00623b42, 
+  0x00653b42, 0x00663b43, 0x00663b42, 0x00673b42, 
+  0x006a3a42, 0x00673941, 0x0065383f, 0x0063373e, 
+  0x0061343c, 0x005f333b, 0x005d323a, 0x005a2f37, 
+  0x00552e34, 0x00522d33, 0x00512b32, 0x004e2a31, 
+  0x004d2930, 0x0049282e, 0x0047272d, 0x0045252a, 
+  0x00422429, 0x003e2428, 0x003c2327, 0x003a2126, 
+  0x00382125, 0x00352125, 0x00342024, 0x00332024, 
+  0x00332024, 0x00382226, 0x004b2e33, 0x00231718, 
+  0x00241e1f, 0x00665154, 0x005f4549, 0x005e3f45, 
+  0x005e3f45, 0x005e3c42, 0x005e3c42, 0x005f3c42, 
+  0x00613b42, 0x00623b42, 0x00653b42, 0x00663b43, 
+  0x00673b43, 0x00683b43, 0x006b3b43, 0x00693a42, 
+  0x00673940, 0x0065383f, 0x0063353d, 0x00ffffff, 
+  0x005e333b, 0x005c3038, 0x00572f35, 0x00ffffff, 
+  0x00532c33, 0x00502b32, 0x004f2a31, 0x004b292f, 
+  0x0049282e, 0x0046262b, 0x0043252a, 0x003f2529, 
+  0x003d2428, 0x003b2227, 0x00392226, 0x00362125, 
+  0x00342024, 0x00332024, 0x00332024, 0x00382226, 
+  0x004b2e33, 0x00231718, 0x00221d1d, 0x00654d51, 
+  0x005d3e44, 0x005c3b40, 0x005c3a3f, 0x005c393e, 
+  0x005c383e, 0x005d383e, 0x005e383e, 0x005f383e, 
+  0x0062363e, 0x0063363e, 0x0066363e, 0x0068363f, 
+  0x0069363f, 0x0069363f, 0x0067353e, 0x0066333c, 
+  0x00623139, 0x005f3038, 0x00ffffff, 0x005a2c34, 
+  0x00572b33, 0x00542a31, 0x00512930, 0x0050262c, 
+  0x004b252b, 0x0048242a, 0x00462228, 0x00432127, 
+  0x003f2026, 0x003c2025, 0x003a2025, 0x00381f24, 
+  0x00341e21, 0x00321c1f, 0x00311c1f, 0x00311c1f, 
+  0x00301c1f, 0x00321e21, 0x0046282e, 0x00201415, 
+  0x00221d1d, 0x00654d51, 0x005d3e44, 0x005c3b40, 
+  0x005c3a3f, 0x005c393e, 0x005c383e, 0x005d383e, 
+  0x005e383e, 0x005f383e, 0x0062363e, 0x0063363e, 
+  0x0066363e, 0x0068363f, 0x0069363f, 0x0069363f, 
+  0x0067353e, 0x0066333c, 0x00623139, 0x005f3038, 
+  0x005d2e35, 0x005a2c34, 0x00572b33, 0x00542a31, 
+  0x00512930, 0x0050262c, 0x004b252b, 0x0048242a, 
+  0x00462228, 0x00432127, 0x003f2026, 0x003c2025, 
+  0x003a2025, 0x00381f24, 0x00341e21, 0x00321c1f, 
+  0x00311c1f, 0x00311c1f, 0x00301c1f, 0x00321e21, 
+  0x0046282e, 0x00201415, 0x00221d1d, 0x00654d51, 
+  0x005d3e44, 0x005c3b40, 0x005c3a3f, 0x005c393e, 
+  0x005c383e, 0x005d383e, 0x005e383e, 0x005f383e, 
+  0x0062363e, 0x0063363e, 0x0066363e, 0x0068363f, 
+  0x0069363f, 0x0069363f, 0x0067353e, 0x0066333c, 
+  0x00623139, 0x005f3038, 0x00ffffff, 0x005a2c34, 
+  0x00ffffff, 0x00542a31, 0x00512930, 0x0050262c, 
+  0x004b252b, 0x0048242a, 0x00462228, 0x00432127, 
+  0x003f2026, 0x003c2025, 0x003a2025, 0x00381f24, 
+  0x00341e21, 0x00321c1f, 0x00311c1f, 0x00311c1f, 
+  0x00301c1f, 0x00321e21, 0x0046282e, 0x00201415, 
+  0x00211b1c, 0x0062484d, 0x005b3a3f, 0x005a383d, 
+  0x005a363c, 0x005a353c, 0x005a343b, 0x005b333a, 
+  0x005d333a, 0x005e333b, 0x005f333b, 0x0062333b, 
+  0x0063333b, 0x0066333c, 0x0068323b, 0x006b323c, 
+  0x00682f39, 0x00662e38, 0x00632c35, 0x005f2c35, 
+  0x00ffffff, 0x005a2931, 0x00552830, 0x0052262e, 
+  0x0050252c, 0x004b242a, 0x00482128, 0x00462128, 
+  0x00441f26, 0x003f1f25, 0x003d1d22, 0x003a1e22, 
+  0x00361b1f, 0x00331b1f, 0x00311a1e, 0x0030181d, 
+  0x002f181c, 0x002f181c, 0x002e181c, 0x00301a1d, 
+  0x00432429, 0x001f1214, 0x00211b1c, 0x0062484d, 
+  0x005b3a3f, 0x005a383d, 0x005a363c, 0x005a353c, 
+  0x005a343b, 0x005b333a, 0x005d333a, 0x005e333b, 
+  0x005f333b, 0x0062333b, 0x0063333b, 0x0066333c, 
+  0x0068323b, 0x006b323c, 0x00682f39, 0x00662e38, 
+  0x00632c35, 0x005f2c35, 0x005c2b33, 0x005a2931, 
+  0x00552830, 0x0052262e, 0x0050252c, 0x004b242a, 
+  0x00482128, 0x00462128, 0x00441f26, 0x003f1f25, 
+  0x003d1d22, 0x003a1e22, 0x00361b1f, 0x00331b1f, 
+  0x00311a1e, 0x0030181d, 0x002f181c, 0x002f181c, 
+  0x002e181c, 0x00301a1d, 0x00432429, 0x001f1214, 
+  0x00211b1c, 0x0062484d, 0x005b3a3f, 0x005a383d, 
+  0x005a363c, 0x005a353c, 0x005a343b, 0x005b333a, 
+  0x005d333a, 0x005e333b, 0x005f333b, 0x0062333b, 
+  0x0063333b, 0x0066333c, 0x0068323b, 0x006b323c, 
+  0x00682f39, 0x00662e38, 0x00632c35, 0x005f2c35, 
+  0x00ffffff, 0x005a2931, 0x00ffffff, 0x0052262e, 
+  0x0050252c, 0x004b242a, 0x00482128, 0x00462128, 
+  0x00441f26, 0x003f1f25, 0x003d1d22, 0x003a1e22, 
+  0x00361b1f, 0x00331b1f, 0x00311a1e, 0x0030181d, 
+  0x002f181c, 0x002f181c, 0x002e181c, 0x00301a1d, 
+  0x00432429, 0x001f1214, 0x001f191a, 0x00614549, 
+  0x0059363c, 0x0057343a, 0x00553339, 0x00553036, 
+  0x00573036, 0x00573036, 0x005a2f36, 0x005c2f36, 
+  0x005d2f36, 0x005f2f36, 0x00622f38, 0x00632e36, 
+  0x00672e38, 0x00692e38, 0x00692c36, 0x00662b35, 
+  0x00632a34, 0x00ffffff, 0x005c2730, 0x0058262f, 
+  0x0054242b, 0x0052222a, 0x004f2129, 0x004a2027, 
+  0x00471f26, 0x00451e25, 0x00421d24, 0x003d1b20, 
+  0x003b1a1f, 0x0038181e, 0x0034181d, 0x0032171c, 
+  0x0030161c, 0x002f161b, 0x002c161a, 0x002c161a, 
+  0x002c161a, 0x002e171b, 0x003f2127, 0x001e1113, 
+  0x001f191a, 0x00614549, 0x0059363c, 0x0057343a, 
+  0x00553339, 0x00553036, 0x00573036, 0x00573036, 
+  0x005a2f36, 0x005c2f36, 0x005d2f36, 0x005f2f36, 
+  0x00622f38, 0x00632e36, 0x00672e38, 0x00692e38, 
+  0x00692c36, 0x00662b35, 0x00632a34, 0x005f2831, 
+  0x005c2730, 0x0058262f, 0x0054242b, 0x0052222a, 
+  0x004f2129, 0x004a2027, 0x00471f26, 0x00451e25, 
+  0x00421d24, 0x003d1b20, 0x003b1a1f, 0x0038181e, 
+  0x0034181d, 0x0032171c, 0x0030161c, 0x002f161b, 
+  0x002c161a, 0x002c161a, 0x002c161a, 0x002e171b, 
+  0x003f2127, 0x001e1113, 0x001f191a, 0x00614549, 
+  0x0059363c, 0x0057343a, 0x00553339, 0x00553036, 
+  0x00573036, 0x00573036, 0x005a2f36, 0x005c2f36, 
+  0x005d2f36, 0x005f2f36, 0x00622f38, 0x00632e36, 
+  0x00672e38, 0x00692e38, 0x00692c36, 0x00662b35, 
+  0x00632a34, 0x005f2831, 0x00ffffff, 0x0058262f, 
+  0x00ffffff, 0x0052222a, 0x004f2129, 0x004a2027, 
+  0x00471f26, 0x00451e25, 0x00421d24, 0x003d1b20, 
+  0x003b1a1f, 0x0038181e, 0x0034181d, 0x0032171c, 
+  0x0030161c, 0x002f161b, 0x002c161a, 0x002c161a, 
+  0x002c161a, 0x002e171b, 0x003f2127, 0x001e1113, 
+  0x001e1818, 0x005f4046, 0x00553339, 0x00533035, 
+  0x00532e34, 0x00532e34, 0x00532c33, 0x00552b32, 
+  0x00572b33, 0x005a2b33, 0x005b2b33, 0x005d2b34, 
+  0x005f2a33, 0x00622a33, 0x00652a34, 0x00682a34, 
+  0x00692a35, 0x00682934, 0x00632731, 0x005f252f, 
+  0x00ffffff, 0x0058212a, 0x0054212a, 0x00511f28, 
+  0x004d1f27, 0x00491d25, 0x00471b22, 0x00441a20, 
+  0x003f181f, 0x003d171e, 0x0039171d, 0x0036151b, 
+  0x0032161b, 0x00301418, 0x002f1418, 0x002c1316, 
+  0x002b1317, 0x00291316, 0x00291316, 0x002c1418, 
+  0x003e1f25, 0x001e1012, 0x001e1818, 0x005f4046, 
+  0x00553339, 0x00533035, 0x00532e34, 0x00532e34, 
+  0x00532c33, 0x00552b32, 0x00572b33, 0x005a2b33, 
+  0x005b2b33, 0x005d2b34, 0x005f2a33, 0x00622a33, 
+  0x00652a34, 0x00682a34, 0x00692a35, 0x00682934, 
+  0x00632731, 0x00ffffff, 0x00ffffff, 0x0058212a, 
+  0x0054212a, 0x00511f28, 0x004d1f27, 0x00491d25, 
+  0x00471b22, 0x00441a20, 0x003f181f, 0x003d171e, 
+  0x0039171d, 0x0036151b, 0x0032161b, 0x00301418, 
+  0x002f1418, 0x002c1316, 0x002b1317, 0x00291316, 
+  0x00291316, 0x002c1418, 0x003e1f25, 0x001e1012, 
+  0x001e1818, 0x005f4046, 0x00553339, 0x00533035, 
+  0x00532e34, 0x00532e34, 0x00532c33, 0x00552b32, 
+  0x00572b33, 0x005a2b33, 0x005b2b33, 0x005d2b34, 
+  0x005f2a33, 0x00622a33, 0x00652a34, 0x00682a34, 
+  0x00692a35, 0x00682934, 0x00632731, 0x005f252f, 
+  0x005c242e, 0x00ffffff, 0x0054212a, 0x00511f28, 
+  0x004d1f27, 0x00491d25, 0x00471b22, 0x00441a20, 
+  0x003f181f, 0x003d171e, 0x0039171d, 0x0036151b, 
+  0x0032161b, 0x00301418, 0x002f1418, 0x002c1316, 
+  0x002b1317, 0x00291316, 0x00291316, 0x002c1418, 
+  0x003e1f25, 0x001e1012, 0x001d1717, 0x005d3e44, 
+  0x00522f34, 0x00512c33, 0x00502b32, 0x00502930, 
+  0x00502930, 0x0052282f, 0x00532830, 0x00552830, 
+  0x00582830, 0x005b2831, 0x005d2730, 0x005f2731, 
+  0x00622731, 0x00662732, 0x006b2732, 0x00692732, 
+  0x0066242f, 0x0061222c, 0x00ffffff, 0x005a1f29, 
+  0x00541e27, 0x00511c25, 0x004d1d25, 0x00481a21, 
+  0x00461820, 0x0043171f, 0x003e161d, 0x003b151c, 
+  0x0039141b, 0x00341318, 0x00311217, 0x002f1015, 
+  0x002c0e13, 0x002b1013, 0x00291014, 0x00280e12, 
+  0x00291013, 0x002c1316, 0x003e1d22, 0x001b0b0e, 
+  0x001d1717, 0x005d3e44, 0x00522f34, 0x00512c33, 
+  0x00502b32, 0x00502930, 0x00502930, 0x0052282f, 
+  0x00532830, 0x00552830, 0x00582830, 0x005b2831, 
+  0x005d2730, 0x005f2731, 0x00622731, 0x00662732, 
+  0x006b2732, 0x00692732, 0x0066242f, 0x00ffffff, 
+  0x00ffffff, 0x005a1f29, 0x00541e27, 0x00511c25, 
+  0x004d1d25, 0x00481a21, 0x00461820, 0x0043171f, 
+  0x003e161d, 0x003b151c, 0x0039141b, 0x00341318, 
+  0x00311217, 0x002f1015, 0x002c0e13, 0x002b1013, 
+  0x00291014, 0x00280e12, 0x00291013, 0x002c1316, 
+  0x003e1d22, 0x001b0b0e, 0x001d1717, 0x005d3e44, 
+  0x00522f34, 0x00512c33, 0x00502b32, 0x00502930, 
+  0x00502930, 0x0052282f, 0x00532830, 0x00552830, 
+  0x00582830, 0x005b2831, 0x005d2730, 0x005f2731, 
+  0x00622731, 0x00662732, 0x006b2732, 0x00692732, 
+  0x0066242f, 0x0061222c, 0x005d212b, 0x00ffffff, 
+  0x00541e27, 0x00511c25, 0x004d1d25, 0x00481a21, 
+  0x00461820, 0x0043171f, 0x003e161d, 0x003b151c, 
+  0x0039141b, 0x00341318, 0x00311217, 0x002f1015, 
+  0x002c0e13, 0x002b1013, 0x00291014, 0x00280e12, 
+  0x00291013, 0x002c1316, 0x003e1d22, 0x001b0b0e, 
+  0x001c1516, 0x005b3a3f, 0x004f2b31, 0x004b292f, 
+  0x004b262c, 0x004b262c, 0x004b252b, 0x0050242b, 
+  0x0051242b, 0x0052242b, 0x0054242b, 0x0057242c, 
+  0x005a222b, 0x005d222c, 0x005f222c, 0x0064222e, 
+  0x0068222f, 0x006b222f, 0x0067212e, 0x0063202b, 
+  0x00ffffff, 0x005a1d27, 0x00541c26, 0x00511822, 
+  0x004d1720, 0x0048171f, 0x0046161e, 0x0040151d, 
+  0x003e141b, 0x003b131a, 0x00381218, 0x00331015, 
+  0x00310d12, 0x002e0d13, 0x002b0c11, 0x00290d12, 
+  0x00280d12, 0x00290e13, 0x00270c10, 0x0020080b, 
+  0x00250208, 0x00120102, 0x001c1516, 0x005b3a3f, 
+  0x004f2b31, 0x004b292f, 0x004b262c, 0x004b262c, 
+  0x004b252b, 0x0050242b, 0x0051242b, 0x0052242b, 
+  0x0054242b, 0x0057242c, 0x005a222b, 0x005d222c, 
+  0x005f222c, 0x0064222e, 0x0068222f, 0x006b222f, 
+  0x0067212e, 0x0063202b, 0x005f1e29, 0x005a1d27, 
+  0x00541c26, 0x00511822, 0x004d1720, 0x0048171f, 
+  0x0046161e, 0x0040151d, 0x003e141b, 0x003b131a, 
+  0x00381218, 0x00331015, 0x00310d12, 0x002e0d13, 
+  0x002b0c11, 0x00290d12, 0x00280d12, 0x00290e13, 
+  0x00270c10, 0x0020080b, 0x00250208, 0x00120102, 
+  0x001c1516, 0x005b3a3f, 0x004f2b31, 0x004b292f, 
+  0x004b262c, 0x004b262c, 0x004b252b, 0x0050242b, 
+  0x0051242b, 0x0052242b, 0x0054242b, 0x0057242c, 
+  0x005a222b, 0x005d222c, 0x005f222c, 0x0064222e, 
+  0x0068222f, 0x006b222f, 0x0067212e, 0x0063202b, 
+  0x005f1e29, 0x005a1d27, 0x00541c26, 0x00511822, 
+  0x004d1720, 0x0048171f, 0x0046161e, 0x0040151d, 
+  0x003e141b, 0x003b131a, 0x00381218, 0x00331015, 
+  0x00310d12, 0x002e0d13, 0x002b0c11, 0x00290d12, 
+  0x00280d12, 0x00290e13, 0x00270c10, 0x0020080b, 
+  0x00250208, 0x00120102, 0x001b1314, 0x0059363c, 
+  0x004a282e, 0x0048242a, 0x00482229, 0x00482128, 
+  0x00482128, 0x004a2027, 0x004d2028, 0x004f2028, 
+  0x00522029, 0x00541f28, 0x00571f28, 0x005b1f29, 
+  0x005d1f29, 0x00621f2a, 0x0067202c, 0x0069202c, 
+  0x00691f2b, 0x00641e2a, 0x005f1c27, 0x00ffffff, 
+  0x00541822, 0x00511620, 0x004b151e, 0x0048151e, 
+  0x0045131b, 0x00401218, 0x003d1015, 0x003b0e15, 
+  0x00380d13, 0x00320d14, 0x002f0b10, 0x002c0b11, 
+  0x002b0b11, 0x00290b11, 0x0025090d, 0x00180005, 
+  0x000a0000, 0x00010000, 0x00150000, 0x00120101, 
+  0x001b1314, 0x0059363c, 0x004a282e, 0x0048242a, 
+  0x00482229, 0x00482128, 0x00482128, 0x004a2027, 
+  0x004d2028, 0x004f2028, 0x00522029, 0x00541f28, 
+  0x00571f28, 0x005b1f29, 0x005d1f29, 0x00621f2a, 
+  0x0067202c, 0x0069202c, 0x00691f2b, 0x00641e2a, 
+  0x005f1c27, 0x005b1a25, 0x00541822, 0x00511620, 
+  0x004b151e, 0x0048151e, 0x0045131b, 0x00401218, 
+  0x003d1015, 0x003b0e15, 0x00380d13, 0x00320d14, 
+  0x002f0b10, 0x002c0b11, 0x002b0b11, 0x00290b11, 
+  0x0025090d, 0x00180005, 0x000a0000, 0x00010000, 
+  0x00150000, 0x00120101, 0x001b1314, 0x0059363c, 
+  0x004a282e, 0x0048242a, 0x00482229, 0x00482128, 
+  0x00482128, 0x004a2027, 0x004d2028, 0x004f2028, 
+  0x00522029, 0x00541f28, 0x00571f28, 0x005b1f29, 
+  0x005d1f29, 0x00621f2a, 0x0067202c, 0x0069202c, 
+  0x00691f2b, 0x00641e2a, 0x005f1c27, 0x005b1a25, 
+  0x00541822, 0x00511620, 0x004b151e, 0x0048151e, 
+  0x0045131b, 0x00401218, 0x003d1015, 0x003b0e15, 
+  0x00380d13, 0x00320d14, 0x002f0b10, 0x002c0b11, 
+  0x002b0b11, 0x00290b11, 0x0025090d, 0x00180005, 
+  0x000a0000, 0x00010000, 0x00150000, 0x00120101, 
+  0x001a1213, 0x00553339, 0x00472429, 0x00452027, 
+  0x00451f26, 0x00451e25, 0x00451e25, 0x00471d24, 
+  0x00491d25, 0x004a1d25, 0x004f1d26, 0x00511c25, 
+  0x00541c26, 0x00571c26, 0x005b1c27, 0x005f1c27, 
+  0x00641d29, 0x00681c29, 0x006b1c29, 0x00661c28, 
+  0x00621825, 0x005c1722, 0x00571520, 0x0051141e, 
+  0x004b131d, 0x0048121b, 0x00440e17, 0x00400e16, 
+  0x003d0d15, 0x003a0c13, 0x00380b12, 0x00320b11, 
+  0x00300a10, 0x0029080c, 0x00200106, 0x00130000, 
+  0x00070000, 0x00000000, 0x00010000, 0x00050000, 
+  0x00180000, 0x00120102, 0x001a1213, 0x00553339, 
+  0x00472429, 0x00452027, 0x00451f26, 0x00451e25, 
+  0x00451e25, 0x00471d24, 0x00491d25, 0x004a1d25, 
+  0x004f1d26, 0x00511c25, 0x00541c26, 0x00571c26, 
+  0x005b1c27, 0x005f1c27, 0x00641d29, 0x00681c29, 
+  0x006b1c29, 0x00661c28, 0x00621825, 0x005c1722, 
+  0x00571520, 0x0051141e, 0x004b131d, 0x0048121b, 
+  0x00440e17, 0x00400e16, 0x003d0d15, 0x003a0c13, 
+  0x00380b12, 0x00320b11, 0x00300a10, 0x0029080c, 
+  0x00200106, 0x00130000, 0x00070000, 0x00000000, 
+  0x00010000, 0x00050000, 0x00180000, 0x00120102, 
+  0x001a1213, 0x00553339, 0x00472429, 0x00452027, 
+  0x00451f26, 0x00451e25, 0x00451e25, 0x00471d24, 
+  0x00491d25, 0x004a1d25, 0x004f1d26, 0x00511c25, 
+  0x00541c26, 0x00571c26, 0x005b1c27, 0x005f1c27, 
+  0x00641d29, 0x00681c29, 0x006b1c29, 0x00661c28, 
+  0x00621825, 0x005c1722, 0x00571520, 0x0051141e, 
+  0x004b131d, 0x0048121b, 0x00440e17, 0x00400e16, 
+  0x003d0d15, 0x003a0c13, 0x00380b12, 0x00320b11, 
+  0x00300a10, 0x0029080c, 0x00200106, 0x00130000, 
+  0x00070000, 0x00000000, 0x00010000, 0x00050000, 
+  0x00180000, 0x00120102, 0x00191011, 0x00533035, 
+  0x00442026, 0x003f1d22, 0x003f1b21, 0x00421a20, 
+  0x00441a20, 0x00441a20, 0x00461820, 0x00481820, 
+  0x004a1821, 0x004f1720, 0x00521822, 0x00541822, 
+  0x00581824, 0x005d1824, 0x00621825, 0x00671725, 
+  0x006b1826, 0x00681725, 0x00631522, 0x005d1521, 
+  0x0058141f, 0x0053121d, 0x004d111b, 0x00480e18, 
+  0x00450d16, 0x00400d16, 0x003e0d15, 0x003a0b13, 
+  0x00340911, 0x00270209, 0x001b0001, 0x000e0000, 
+  0x00070000, 0x00020000, 0x00050000, 0x00050000, 
+  0x00050000, 0x00070000, 0x001b0000, 0x00130103, 
+  0x00191011, 0x00533035, 0x00442026, 0x003f1d22, 
+  0x003f1b21, 0x00421a20, 0x00441a20, 0x00441a20, 
+  0x00461820, 0x00481820, 0x004a1821, 0x004f1720, 
+  0x00521822, 0x00541822, 0x00581824, 0x005d1824, 
+  0x00621825, 0x00671725, 0x006b1826, 0x00681725, 
+  0x00631522, 0x005d1521, 0x0058141f, 0x0053121d, 
+  0x004d111b, 0x00480e18, 0x00450d16, 0x00400d16, 
+  0x003e0d15, 0x003a0b13, 0x00340911, 0x00270209, 
+  0x001b0001, 0x000e0000, 0x00070000, 0x00020000, 
+  0x00050000, 0x00050000, 0x00050000, 0x00070000, 
+  0x001b0000, 0x00130103, 0x00191011, 0x00533035, 
+  0x00442026, 0x003f1d22, 0x003f1b21, 0x00421a20, 
+  0x00441a20, 0x00441a20, 0x00461820, 0x00481820, 
+  0x004a1821, 0x004f1720, 0x00521822, 0x00541822, 
+  0x00581824, 0x005d1824, 0x00621825, 0x00671725, 
+  0x006b1826, 0x00681725, 0x00631522, 0x005d1521, 
+  0x0058141f, 0x0053121d, 0x004d111b, 0x00480e18, 
+  0x00450d16, 0x00400d16, 0x003e0d15, 0x003a0b13, 
+  0x00340911, 0x00270209, 0x001b0001, 0x000e0000, 
+  0x00070000, 0x00020000, 0x00050000, 0x00050000, 
+  0x00050000, 0x00070000, 0x001b0000, 0x00130103, 
+  0x00180f0f, 0x00512c33, 0x003f1d22, 0x003c1a1f, 
+  0x003c181e, 0x003d171e, 0x003d161d, 0x0040161d, 
+  0x0043161e, 0x0045161e, 0x0048161f, 0x004a151e, 
+  0x004f151f, 0x0052151f, 0x00551621, 0x005b1621, 
+  0x005f1622, 0x00641522, 0x00691625, 0x00691625, 
+  0x00641522, 0x005e1420, 0x0059131f, 0x0054111b, 
+  0x004d0d17, 0x00480c16, 0x00430912, 0x003a030c, 
+  0x00300008, 0x00260002, 0x001a0000, 0x00110000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x00080000, 
+  0x00070000, 0x00070000, 0x00070000, 0x00080000, 
+  0x001d0000, 0x00140102, 0x00180f0f, 0x00512c33, 
+  0x003f1d22, 0x003c1a1f, 0x003c181e, 0x003d171e, 
+  0x003d161d, 0x0040161d, 0x0043161e, 0x0045161e, 
+  0x0048161f, 0x004a151e, 0x004f151f, 0x0052151f, 
+  0x00551621, 0x005b1621, 0x005f1622, 0x00641522, 
+  0x00691625, 0x00691625, 0x00641522, 0x005e1420, 
+  0x0059131f, 0x0054111b, 0x004d0d17, 0x00480c16, 
+  0x00430912, 0x003a030c, 0x00300008, 0x00260002, 
+  0x001a0000, 0x00110000, 0x000c0000, 0x000b0000, 
+  0x000a0000, 0x00080000, 0x00070000, 0x00070000, 
+  0x00070000, 0x00080000, 0x001d0000, 0x00140102, 
+  0x00180f0f, 0x00512c33, 0x003f1d22, 0x003c1a1f, 
+  0x003c181e, 0x003d171e, 0x003d161d, 0x0040161d, 
+  0x0043161e, 0x0045161e, 0x0048161f, 0x004a151e, 
+  0x004f151f, 0x0052151f, 0x00551621, 0x005b1621, 
+  0x005f1622, 0x00641522, 0x00691625, 0x00691625, 
+  0x00641522, 0x005e1420, 0x0059131f, 0x0054111b, 
+  0x004d0d17, 0x00480c16, 0x00430912, 0x003a030c, 
+  0x00300008, 0x00260002, 0x001a0000, 0x00110000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x00080000, 
+  0x00070000, 0x00070000, 0x00070000, 0x00080000, 
+  0x001d0000, 0x00140102, 0x00160d0e, 0x004f2930, 
+  0x003b1a1f, 0x0039161c, 0x0039151b, 0x0039141b, 
+  0x003a1318, 0x003d131a, 0x003e131b, 0x0043131b, 
+  0x0046131c, 0x0048121a, 0x004b131d, 0x0050141e, 
+  0x0055141f, 0x0058141f, 0x005d131f, 0x0062121f, 
+  0x00671220, 0x006b101e, 0x00650c1b, 0x005c0816, 
+  0x00530512, 0x004a010d, 0x00420007, 0x00380003, 
+  0x002e0000, 0x00260000, 0x001f0000, 0x001c0000, 
+  0x00170000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x000a0000, 
+  0x000a0000, 0x000b0000, 0x001e0000, 0x00140103, 
+  0x00160d0e, 0x004f2930, 0x003b1a1f, 0x0039161c, 
+  0x0039151b, 0x0039141b, 0x003a1318, 0x003d131a, 
+  0x003e131b, 0x0043131b, 0x0046131c, 0x0048121a, 
+  0x004b131d, 0x0050141e, 0x0055141f, 0x0058141f, 
+  0x005d131f, 0x0062121f, 0x00671220, 0x006b101e, 
+  0x00650c1b, 0x005c0816, 0x00530512, 0x004a010d, 
+  0x00420007, 0x00380003, 0x002e0000, 0x00260000, 
+  0x001f0000, 0x001c0000, 0x00170000, 0x00130000, 
+  0x00110000, 0x000e0000, 0x000c0000, 0x000b0000, 
+  0x000a0000, 0x000a0000, 0x000a0000, 0x000b0000, 
+  0x001e0000, 0x00140103, 0x00160d0e, 0x004f2930, 
+  0x003b1a1f, 0x0039161c, 0x0039151b, 0x0039141b, 
+  0x003a1318, 0x003d131a, 0x003e131b, 0x0043131b, 
+  0x0046131c, 0x0048121a, 0x004b131d, 0x0050141e, 
+  0x0055141f, 0x0058141f, 0x005d131f, 0x0062121f, 
+  0x00671220, 0x006b101e, 0x00650c1b, 0x005c0816, 
+  0x00530512, 0x004a010d, 0x00420007, 0x00380003, 
+  0x002e0000, 0x00260000, 0x001f0000, 0x001c0000, 
+  0x00170000, 0x00130000, 0x00110000, 0x000e0000, 
+  0x000c0000, 0x000b0000, 0x000a0000, 0x000a0000, 
+  0x000a0000, 0x000b0000, 0x001e0000, 0x00140103, 
+  0x00150c0d, 0x004b262c, 0x0039161c, 0x00341318, 
+  0x00341217, 0x00341014, 0x00361016, 0x00ffffff, 
+  0x003d1017, 0x003f1015, 0x00401017, 0x00440c15, 
+  0x00440a14, 0x00440711, 0x0047020d, 0x004a000c, 
+  0x0051000b, 0x0058000a, 0x0061000b, 0x006c000d, 
+  0x0065000a, 0x00590006, 0x004e0003, 0x00450001, 
+  0x003c0000, 0x00350000, 0x002f0000, 0x00290000, 
+  0x00250000, 0x00210000, 0x001b0000, 0x00170000, 
+  0x00130000, 0x00ffffff, 0x000e0000, 0x000d0000, 
+  0x000c0000, 0x000c0000, 0x000b0000, 0x000c0000, 
+  0x00210003, 0x00140104, 0x00150c0d, 0x004b262c, 
+  0x0039161c, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00361016, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00401017, 0x00440c15, 0x00440a14, 0x00440711, 
+  0x0047020d, 0x004a000c, 0x0051000b, 0x0058000a, 
+  0x0061000b, 0x006c000d, 0x0065000a, 0x00590006, 
+  0x004e0003, 0x00450001, 0x003c0000, 0x00350000, 
+  0x002f0000, 0x00290000, 0x00250000, 0x00210000, 
+  0x001b0000, 0x00170000, 0x00130000, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x000b0000, 0x000c0000, 0x00210003, 0x00140104, 
+  0x00150c0d, 0x004b262c, 0x0039161c, 0x00341318, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x003a1016, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00440c15, 
+  0x00440a14, 0x00440711, 0x0047020d, 0x004a000c, 
+  0x0051000b, 0x0058000a, 0x0061000b, 0x006c000d, 
+  0x0065000a, 0x00590006, 0x004e0003, 0x00450001, 
+  0x003c0000, 0x00350000, 0x002f0000, 0x00290000, 
+  0x00250000, 0x00210000, 0x001b0000, 0x00170000, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x000d0000, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x000c0000, 
+  0x00210003, 0x00140104, 0x00150a0c, 0x0049242a, 
+  0x00341318, 0x00311015, 0x00320e13, 0x00330e15, 
+  0x00330c12, 0x00ffffff, 0x0030050a, 0x002e0007, 
+  0x002a0005, 0x002a0000, 0x002f0000, 0x00330000, 
+  0x003b0001, 0x00420002, 0x00490002, 0x00540002, 
+  0x005d0008, 0x0069000b, 0x0069000b, 0x005d0009, 
+  0x00530008, 0x00490005, 0x00420003, 0x003b0001, 
+  0x00320000, 0x002e0000, 0x00280000, 0x00240000, 
+  0x001f0000, 0x001b0000, 0x00160000, 0x00ffffff, 
+  0x00110000, 0x000e0000, 0x000e0000, 0x000d0000, 
+  0x000d0000, 0x000e0000, 0x00220005, 0x00140104, 
+  0x00150a0c, 0x0049242a, 0x00341318, 0x00311015, 
+  0x00ffffff, 0x00330e15, 0x00330c12, 0x00320a10, 
+  0x00ffffff, 0x002e0007, 0x002a0005, 0x002a0000, 
+  0x002f0000, 0x00330000, 0x003b0001, 0x00420002, 
+  0x00490002, 0x00540002, 0x005d0008, 0x0069000b, 
+  0x0069000b, 0x005d0009, 0x00530008, 0x00490005, 
+  0x00420003, 0x003b0001, 0x00320000, 0x002e0000, 
+  0x00280000, 0x00240000, 0x001f0000, 0x001b0000, 
+  0x00160000, 0x00ffffff, 0x00110000, 0x000e0000, 
+  0x000e0000, 0x00ffffff, 0x000d0000, 0x000e0000, 
+  0x00220005, 0x00140104, 0x00150a0c, 0x0049242a, 
+  0x00341318, 0x00311015, 0x00320e13, 0x00ffffff, 
+  0x00330c12, 0x00320a10, 0x0030050a, 0x00ffffff, 
+  0x002a0005, 0x002a0000, 0x002f0000, 0x00330000, 
+  0x003b0001, 0x00420002, 0x00490002, 0x00540002, 
+  0x005d0008, 0x0069000b, 0x0069000b, 0x005d0009, 
+  0x00530008, 0x00490005, 0x00420003, 0x003b0001, 
+  0x00320000, 0x002e0000, 0x00280000, 0x00240000, 
+  0x001f0000, 0x001b0000, 0x00160000, 0x00ffffff, 
+  0x00110000, 0x000e0000, 0x000e0000, 0x00ffffff, 
+  0x000d0000, 0x000e0000, 0x00220005, 0x00140104, 
+  0x0014090b, 0x00482128, 0x00321015, 0x002f0c11, 
+  0x0029090e, 0x00220107, 0x00ffffff, 0x00180000, 
+  0x001a0000, 0x001c0000, 0x00240000, 0x00280000, 
+  0x002e0000, 0x00340001, 0x003b0000, 0x00420006, 
+  0x00490006, 0x00520008, 0x005a000a, 0x00650009, 
+  0x006c000d, 0x0061000b, 0x0057000a, 0x004d0008, 
+  0x00460006, 0x003e0005, 0x00390002, 0x00310001, 
+  0x002a0000, 0x00270000, 0x00240000, 0x001d0000, 
+  0x001a0000, 0x00160000, 0x00ffffff, 0x00110000, 
+  0x00110000, 0x00100000, 0x000e0000, 0x00110000, 
+  0x00250006, 0x00150205, 0x0014090b, 0x00482128, 
+  0x00321015, 0x002f0c11, 0x0029090e, 0x00ffffff, 
+  0x001c0001, 0x00ffffff, 0x001a0000, 0x001c0000, 
+  0x00240000, 0x00280000, 0x002e0000, 0x00340001, 
+  0x003b0000, 0x00420006, 0x00490006, 0x00520008, 
+  0x005a000a, 0x00650009, 0x006c000d, 0x0061000b, 
+  0x0057000a, 0x004d0008, 0x00460006, 0x003e0005, 
+  0x00390002, 0x00310001, 0x002a0000, 0x00270000, 
+  0x00240000, 0x001d0000, 0x001a0000, 0x00160000, 
+  0x00130000, 0x00110000, 0x00ffffff, 0x00100000, 
+  0x000e0000, 0x00110000, 0x00250006, 0x00150205, 
+  0x0014090b, 0x00482128, 0x00321015, 0x002f0c11, 
+  0x0029090e, 0x00ffffff, 0x001c0001, 0x00180000, 
+  0x001a0000, 0x00ffffff, 0x00240000, 0x00280000, 
+  0x002e0000, 0x00340001, 0x003b0000, 0x00420006, 
+  0x00490006, 0x00520008, 0x005a000a, 0x00650009, 
+  0x006c000d, 0x0061000b, 0x0057000a, 0x004d0008, 
+  0x00460006, 0x003e0005, 0x00390002, 0x00310001, 
+  0x002a0000, 0x00270000, 0x00240000, 0x001d0000, 
+  0x001a0000, 0x00ffffff, 0x00130000, 0x00110000, 
+  0x00110000, 0x00ffffff, 0x000e0000, 0x00110000, 
+  0x00250006, 0x00150205, 0x0014090a, 0x00451d24, 
+  0x00260508, 0x001a0002, 0x00130000, 0x00120000, 
+  0x00ffffff, 0x00170000, 0x001b0000, 0x001e0000, 
+  0x00250000, 0x00290000, 0x002f0000, 0x00330003, 
+  0x003b0005, 0x00400007, 0x00480008, 0x00500009, 
+  0x0059000b, 0x0062000c, 0x006c000e, 0x0064000d, 
+  0x005a000b, 0x00510009, 0x00490008, 0x00420007, 
+  0x003c0003, 0x00340003, 0x00300003, 0x002a0001, 
+  0x00260000, 0x00210000, 0x001d0000, 0x001a0000, 
+  0x00ffffff, 0x00130000, 0x00120000, 0x00110000, 
+  0x00110000, 0x00120000, 0x00270007, 0x00150306, 
+  0x0014090a, 0x00451d24, 0x00260508, 0x001a0002, 
+  0x00130000, 0x00ffffff, 0x00130000, 0x00ffffff, 
+  0x001b0000, 0x001e0000, 0x00250000, 0x00290000, 
+  0x002f0000, 0x00330003, 0x003b0005, 0x00400007, 
+  0x00480008, 0x00500009, 0x0059000b, 0x0062000c, 
+  0x006c000e, 0x0064000d, 0x005a000b, 0x00510009, 
+  0x00490008, 0x00420007, 0x003c0003, 0x00340003, 
+  0x00300003, 0x002a0001, 0x00260000, 0x00210000, 
+  0x001d0000, 0x001a0000, 0x00160000, 0x00ffffff, 
+  0x00120000, 0x00110000, 0x00110000, 0x00120000, 
+  0x00270007, 0x00150306, 0x0014090a, 0x00451d24, 
+  0x00260508, 0x001a0002, 0x00130000, 0x00ffffff, 
+  0x00130000, 0x00170000, 0x001b0000, 0x00ffffff, 
+  0x00250000, 0x00290000, 0x002f0000, 0x00330003, 
+  0x003b0005, 0x00400007, 0x00480008, 0x00500009, 
+  0x0059000b, 0x0062000c, 0x006c000e, 0x0064000d, 
+  0x005a000b, 0x00510009, 0x00490008, 0x00420007, 
+  0x003c0003, 0x00340003, 0x00300003, 0x002a0001, 
+  0x00260000, 0x00210000, 0x001d0000, 0x00ffffff, 
+  0x00160000, 0x00ffffff, 0x00120000, 0x00ffffff, 
+  0x00110000, 0x00120000, 0x00270007, 0x00150306, 
+  0x00100406, 0x00350a10, 0x00160000, 0x00120000, 
+  0x00130000, 0x00150000, 0x00ffffff, 0x001a0000, 
+  0x001d0000, 0x00200000, 0x00260002, 0x002a0002, 
+  0x002f0002, 0x00330005, 0x003a0006, 0x00400007, 
+  0x00470009, 0x004e0009, 0x0057000c, 0x005f000e, 
+  0x00690010, 0x00680010, 0x005e000d, 0x0055000b, 
+  0x004b0009, 0x00460008, 0x003f0007, 0x00390005, 
+  0x00320003, 0x002e0003, 0x00290002, 0x00250000, 
+  0x00200000, 0x001c0000, 0x00ffffff, 0x00170000, 
+  0x00150000, 0x00130000, 0x00130000, 0x00150000, 
+  0x00280108, 0x00160406, 0x00100406, 0x00350a10, 
+  0x00160000, 0x00120000, 0x00130000, 0x00150000, 
+  0x00ffffff, 0x001a0000, 0x001d0000, 0x00200000, 
+  0x00260002, 0x002a0002, 0x002f0002, 0x00330005, 
+  0x003a0006, 0x00400007, 0x00470009, 0x004e0009, 
+  0x0057000c, 0x005f000e, 0x00690010, 0x00680010, 
+  0x005e000d, 0x0055000b, 0x004b0009, 0x00460008, 
+  0x003f0007, 0x00390005, 0x00320003, 0x002e0003, 
+  0x00290002, 0x00250000, 0x00200000, 0x001c0000, 
+  0x00180000, 0x00ffffff, 0x00150000, 0x00130000, 
+  0x00130000, 0x00150000, 0x00280108, 0x00160406, 
+  0x00100406, 0x00350a10, 0x00160000, 0x00120000, 
+  0x00130000, 0x00ffffff, 0x00170000, 0x001a0000, 
+  0x001d0000, 0x00ffffff, 0x00260002, 0x002a0002, 
+  0x002f0002, 0x00330005, 0x003a0006, 0x00400007, 
+  0x00470009, 0x004e0009, 0x0057000c, 0x005f000e, 
+  0x00690010, 0x00680010, 0x005e000d, 0x0055000b, 
+  0x004b0009, 0x00460008, 0x003f0007, 0x00390005, 
+  0x00320003, 0x002e0003, 0x00290002, 0x00250000, 
+  0x00200000, 0x00ffffff, 0x00180000, 0x00ffffff, 
+  0x00150000, 0x00ffffff, 0x00130000, 0x00150000, 
+  0x00280108, 0x00160406, 0x000d0101, 0x00330810, 
+  0x00180001, 0x00160000, 0x00160000, 0x00170000, 
+  0x00ffffff, 0x001b0000, 0x001d0000, 0x00210001, 
+  0x00270002, 0x002a0003, 0x00300006, 0x00340006, 
+  0x003a0006, 0x003f0008, 0x0047000a, 0x004d000b, 
+  0x0054000d, 0x005e000e, 0x00670011, 0x006b0012, 
+  0x00610011, 0x0059000e, 0x0051000c, 0x0049000a, 
+  0x0044000a, 0x003c0008, 0x00380006, 0x00310005, 
+  0x002e0005, 0x00280003, 0x00220001, 0x001e0000, 
+  0x00ffffff, 0x001a0000, 0x00180000, 0x00160000, 
+  0x00160000, 0x00170000, 0x002b030a, 0x00170406, 
+  0x000d0101, 0x00330810, 0x00180001, 0x00160000, 
+  0x00160000, 0x00170000, 0x00ffffff, 0x001b0000, 
+  0x001d0000, 0x00210001, 0x00270002, 0x002a0003, 
+  0x00300006, 0x00340006, 0x003a0006, 0x003f0008, 
+  0x0047000a, 0x004d000b, 0x0054000d, 0x005e000e, 
+  0x00670011, 0x006b0012, 0x00610011, 0x0059000e, 
+  0x0051000c, 0x0049000a, 0x0044000a, 0x003c0008, 
+  0x00380006, 0x00310005, 0x002e0005, 0x00280003, 
+  0x00220001, 0x001e0000, 0x00ffffff, 0x001a0000, 
+  0x00180000, 0x00160000, 0x00160000, 0x00170000, 
+  0x002b030a, 0x00170406, 0x000d0101, 0x00330810, 
+  0x00180001, 0x00160000, 0x00160000, 0x00ffffff, 
+  0x00180000, 0x001b0000, 0x001d0000, 0x00ffffff, 
+  0x00270002, 0x002a0003, 0x00300006, 0x00340006, 
+  0x003a0006, 0x003f0008, 0x0047000a, 0x004d000b, 
+  0x0054000d, 0x005e000e, 0x00670011, 0x006b0012, 
+  0x00610011, 0x0059000e, 0x0051000c, 0x0049000a, 
+  0x0044000a, 0x003c0008, 0x00380006, 0x00310005, 
+  0x002e0005, 0x00280003, 0x00220001, 0x00ffffff, 
+  0x001c0000, 0x00ffffff, 0x00180000, 0x00ffffff, 
+  0x00160000, 0x00170000, 0x002b030a, 0x00170406, 
+  0x000e0103, 0x00350a10, 0x001a0002, 0x00180000, 
+  0x00180000, 0x00180000, 0x00ffffff, 0x001d0000, 
+  0x00200001, 0x00220002, 0x00280005, 0x002c0005, 
+  0x00300006, 0x00340006, 0x003a0008, 0x003f0009, 
+  0x0046000b, 0x004b000c, 0x0053000d, 0x005c0111, 
+  0x00640012, 0x006b0113, 0x00640011, 0x005d0011, 
+  0x0053000c, 0x004d000c, 0x0047000b, 0x00400009, 
+  0x003a0008, 0x00340006, 0x00300007, 0x002a0005, 
+  0x00270003, 0x00220002, 0x00ffffff, 0x001c0000, 
+  0x001b0000, 0x001a0000, 0x00180000, 0x001a0002, 
+  0x002f0509, 0x00180508, 0x000e0103, 0x00350a10, 
+  0x001a0002, 0x00180000, 0x00180000, 0x00180000, 
+  0x00ffffff, 0x001d0000, 0x00200001, 0x00220002, 
+  0x00280005, 0x002c0005, 0x00300006, 0x00340006, 
+  0x003a0008, 0x003f0009, 0x0046000b, 0x004b000c, 
+  0x0053000d, 0x005c0111, 0x00640012, 0x006b0113, 
+  0x00640011, 0x005d0011, 0x0053000c, 0x004d000c, 
+  0x0047000b, 0x00400009, 0x003a0008, 0x00340006, 
+  0x00300007, 0x002a0005, 0x00270003, 0x00ffffff, 
+  0x001e0000, 0x001c0000, 0x001b0000, 0x00ffffff, 
+  0x00180000, 0x001a0002, 0x002f0509, 0x00180508, 
+  0x000e0103, 0x00350a10, 0x001a0002, 0x00180000, 
+  0x00180000, 0x00ffffff, 0x001b0000, 0x001d0000, 
+  0x00200001, 0x00ffffff, 0x00280005, 0x002c0005, 
+  0x00300006, 0x00340006, 0x003a0008, 0x003f0009, 
+  0x0046000b, 0x004b000c, 0x0053000d, 0x005c0111, 
+  0x00640012, 0x006b0113, 0x00640011, 0x005d0011, 
+  0x0053000c, 0x004d000c, 0x0047000b, 0x00400009, 
+  0x003a0008, 0x00340006, 0x00300007, 0x002a0005, 
+  0x00270003, 0x00ffffff, 0x001e0000, 0x00ffffff, 
+  0x001b0000, 0x00ffffff, 0x00180000, 0x001a0002, 
+  0x002f0509, 0x00180508, 0x000f0104, 0x00380c14, 
+  0x001c0003, 0x001a0000, 0x001a0001, 0x001b0001, 
+  0x00ffffff, 0x001d0001, 0x00210002, 0x00240003, 
+  0x00280005, 0x002c0003, 0x00310007, 0x00340007, 
+  0x003a0009, 0x003e000a, 0x0046000c, 0x004b010d, 
+  0x0052010e, 0x005a0112, 0x00620514, 0x006b0314, 
+  0x00680314, 0x005f020e, 0x00570110, 0x0051000d, 
+  0x0049010d, 0x0045000b, 0x003d0009, 0x00390008, 
+  0x00330007, 0x002f0006, 0x002a0005, 0x00250003, 
+  0x00ffffff, 0x00200002, 0x001d0001, 0x001c0001, 
+  0x001b0002, 0x001c0002, 0x002f070c, 0x00180608, 
+  0x000f0104, 0x00380c14, 0x001c0003, 0x001a0000, 
+  0x001a0001, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00210002, 0x00240003, 0x00280005, 0x002c0003, 
+  0x00310007, 0x00340007, 0x003a0009, 0x003e000a, 
+  0x0046000c, 0x004b010d, 0x0052010e, 0x005a0112, 
+  0x00620514, 0x006b0314, 0x00680314, 0x005f020e, 
+  0x00570110, 0x0051000d, 0x0049010d, 0x0045000b, 
+  0x003d0009, 0x00390008, 0x00330007, 0x002f0006, 
+  0x002a0005, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x001b0002, 0x001c0002, 
+  0x002f070c, 0x00180608, 0x000f0104, 0x00380c14, 
+  0x001c0003, 0x001a0000, 0x001a0001, 0x001b0001, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00240003, 
+  0x00280005, 0x002c0003, 0x00310007, 0x00340007, 
+  0x003a0009, 0x003e000a, 0x0046000c, 0x004b010d, 
+  0x0052010e, 0x005a0112, 0x00620514, 0x006b0314, 
+  0x00680314, 0x005f020e, 0x00570110, 0x0051000d, 
+  0x0049010d, 0x0045000b, 0x003d0009, 0x00390008, 
+  0x00330007, 0x002f0006, 0x002a0005, 0x00250003, 
+  0x00ffffff, 0x00200002, 0x00ffffff, 0x001c0001, 
+  0x001b0002, 0x001c0002, 0x002f070c, 0x00180608, 
+  0x000f0103, 0x003a0d15, 0x001d0005, 0x001b0002, 
+  0x001b0002, 0x001c0002, 0x001d0002, 0x00ffffff, 
+  0x00220003, 0x00250005, 0x00290006, 0x002e0007, 
+  0x00310008, 0x00350008, 0x003a0008, 0x003e000a, 
+  0x0045010c, 0x004a020e, 0x00510210, 0x00580513, 
+  0x00610615, 0x00680717, 0x006b0616, 0x00630614, 
+  0x005b0513, 0x00530210, 0x004e010e, 0x0048020e, 
+  0x0040010c, 0x003c000a, 0x00380009, 0x00320008, 
+  0x002e0007, 0x00ffffff, 0x00250003, 0x00220003, 
+  0x00200002, 0x001e0002, 0x001d0002, 0x001e0003, 
+  0x00310910, 0x00190609, 0x000f0103, 0x003a0d15, 
+  0x001d0005, 0x001b0002, 0x001b0002, 0x001c0002, 
+  0x001d0002, 0x001e0002, 0x00220003, 0x00250005, 
+  0x00290006, 0x002e0007, 0x00310008, 0x00350008, 
+  0x003a0008, 0x003e000a, 0x0045010c, 0x004a020e, 
+  0x00510210, 0x00580513, 0x00610615, 0x00680717, 
+  0x006b0616, 0x00630614, 0x005b0513, 0x00530210, 
+  0x004e010e, 0x0048020e, 0x0040010c, 0x003c000a, 
+  0x00380009, 0x00320008, 0x002e0007, 0x00290006, 
+  0x00250003, 0x00220003, 0x00200002, 0x001e0002, 
+  0x001d0002, 0x001e0003, 0x00310910, 0x00190609, 
+  0x000f0103, 0x003a0d15, 0x001d0005, 0x001b0002, 
+  0x001b0002, 0x001c0002, 0x001d0002, 0x001e0002, 
+  0x00220003, 0x00250005, 0x00290006, 0x002e0007, 
+  0x00310008, 0x00350008, 0x003a0008, 0x003e000a, 
+  0x0045010c, 0x004a020e, 0x00510210, 0x00580513, 
+  0x00610615, 0x00680717, 0x006b0616, 0x00630614, 
+  0x005b0513, 0x00530210, 0x004e010e, 0x0048020e, 
+  0x0040010c, 0x003c000a, 0x00380009, 0x00320008, 
+  0x002e0007, 0x00290006, 0x00250003, 0x00220003, 
+  0x00200002, 0x001e0002, 0x001d0002, 0x001e0003, 
+  0x00310910, 0x00190609, 0x000f0305, 0x003c1017, 
+  0x00200005, 0x001c0003, 0x001d0002, 0x001d0002, 
+  0x001e0002, 0x00ffffff, 0x00240005, 0x00260005, 
+  0x002a0007, 0x002f0008, 0x00320009, 0x00350009, 
+  0x003b000a, 0x003f010b, 0x0046020d, 0x004a020d, 
+  0x00510512, 0x00570613, 0x005d0715, 0x00670816, 
+  0x006b091a, 0x00650817, 0x005d0715, 0x00570613, 
+  0x00510512, 0x004b0310, 0x0046020d, 0x003f010b, 
+  0x003b000a, 0x00350009, 0x00310008, 0x00ffffff, 
+  0x00270006, 0x00250005, 0x00220005, 0x00210003, 
+  0x00200003, 0x00210005, 0x00330b12, 0x0019070a, 
+  0x000f0305, 0x003c1017, 0x00200005, 0x001c0003, 
+  0x001d0002, 0x001d0002, 0x001e0002, 0x00200002, 
+  0x00240005, 0x00260005, 0x002a0007, 0x002f0008, 
+  0x00320009, 0x00350009, 0x003b000a, 0x003f010b, 
+  0x0046020d, 0x004a020d, 0x00510512, 0x00570613, 
+  0x005d0715, 0x00670816, 0x006b091a, 0x00650817, 
+  0x005d0715, 0x00570613, 0x00510512, 0x004b0310, 
+  0x0046020d, 0x003f010b, 0x003b000a, 0x00350009, 
+  0x00310008, 0x002e0007, 0x00270006, 0x00250005, 
+  0x00220005, 0x00210003, 0x00200003, 0x00210005, 
+  0x00330b12, 0x0019070a, 0x000f0305, 0x003c1017, 
+  0x00200005, 0x001c0003, 0x001d0002, 0x001d0002, 
+  0x001e0002, 0x00200002, 0x00240005, 0x00260005, 
+  0x002a0007, 0x002f0008, 0x00320009, 0x00350009, 
+  0x003b000a, 0x003f010b, 0x0046020d, 0x004a020d, 
+  0x00510512, 0x00570613, 0x005d0715, 0x00670816, 
+  0x006b091a, 0x00650817, 0x005d0715, 0x00570613, 
+  0x00510512, 0x004b0310, 0x0046020d, 0x003f010b, 
+  0x003b000a, 0x00350009, 0x00310008, 0x002e0007, 
+  0x00270006, 0x00250005, 0x00220005, 0x00210003, 
+  0x00200003, 0x00210005, 0x00330b12, 0x0019070a, 
+  0x000f0305, 0x003d1217, 0x00210107, 0x001d0005, 
+  0x001e0003, 0x001e0003, 0x00200003, 0x00220005, 
+  0x00240006, 0x00270006, 0x002a0007, 0x00300009, 
+  0x00320109, 0x00380009, 0x003b020c, 0x003f020c, 
+  0x0046030e, 0x004a0611, 0x00500712, 0x00550714, 
+  0x005c0815, 0x00640917, 0x006b0b1b, 0x00680a18, 
+  0x00620917, 0x005b0816, 0x00540714, 0x004e0713, 
+  0x00490611, 0x0045030e, 0x003e020c, 0x003a010b, 
+  0x0034010a, 0x00300008, 0x002c0008, 0x00280007, 
+  0x00260006, 0x00240006, 0x00220005, 0x00240107, 
+  0x00380c12, 0x001a080a, 0x000f0305, 0x003d1217, 
+  0x00210107, 0x001d0005, 0x001e0003, 0x001e0003, 
+  0x00200003, 0x00220005, 0x00240006, 0x00270006, 
+  0x002a0007, 0x00300009, 0x00320109, 0x00380009, 
+  0x003b020c, 0x003f020c, 0x0046030e, 0x004a0611, 
+  0x00500712, 0x00550714, 0x005c0815, 0x00640917, 
+  0x006b0b1b, 0x00680a18, 0x00620917, 0x005b0816, 
+  0x00540714, 0x004e0713, 0x00490611, 0x0045030e, 
+  0x003e020c, 0x003a010b, 0x0034010a, 0x00300008, 
+  0x002c0008, 0x00280007, 0x00260006, 0x00240006, 
+  0x00220005, 0x00240107, 0x00380c12, 0x001a080a, 
+  0x000f0305, 0x003d1217, 0x00210107, 0x001d0005, 
+  0x001e0003, 0x001e0003, 0x00200003, 0x00220005, 
+  0x00240006, 0x00270006, 0x002a0007, 0x00300009, 
+  0x00320109, 0x00380009, 0x003b020c, 0x003f020c, 
+  0x0046030e, 0x004a0611, 0x00500712, 0x00550714, 
+  0x005c0815, 0x00640917, 0x006b0b1b, 0x00680a18, 
+  0x00620917, 0x005b0816, 0x00540714, 0x004e0713, 
+  0x00490611, 0x0045030e, 0x003e020c, 0x003a010b, 
+  0x0034010a, 0x00300008, 0x002c0008, 0x00280007, 
+  0x00260006, 0x00240006, 0x00220005, 0x00240107, 
+  0x00380c12, 0x001a080a, 0x00100305, 0x003e141b, 
+  0x00220208, 0x00200006, 0x00200006, 0x00200006, 
+  0x00210006, 0x00220006, 0x00250007, 0x00270108, 
+  0x002c0109, 0x0030020a, 0x0032030b, 0x0038020b, 
+  0x003b030c, 0x003e0610, 0x00440711, 0x00490813, 
+  0x004e0813, 0x00540a16, 0x005b0a17, 0x00620b1a, 
+  0x00690c1b, 0x006b0c1b, 0x00640b1a, 0x005d0a17, 
+  0x00570916, 0x00520914, 0x004b0813, 0x00460711, 
+  0x00400610, 0x003c030d, 0x0038020b, 0x0032030b, 
+  0x0030020a, 0x002c0109, 0x00280108, 0x00270108, 
+  0x00260108, 0x00270309, 0x003a0e14, 0x001a090b, 
+  0x00100305, 0x003e141b, 0x00220208, 0x00200006, 
+  0x00200006, 0x00200006, 0x00210006, 0x00220006, 
+  0x00250007, 0x00270108, 0x002c0109, 0x0030020a, 
+  0x0032030b, 0x0038020b, 0x003b030c, 0x003e0610, 
+  0x00440711, 0x00490813, 0x004e0813, 0x00540a16, 
+  0x005b0a17, 0x00620b1a, 0x00690c1b, 0x006b0c1b, 
+  0x00640b1a, 0x005d0a17, 0x00570916, 0x00520914, 
+  0x004b0813, 0x00460711, 0x00400610, 0x003c030d, 
+  0x0038020b, 0x0032030b, 0x0030020a, 0x002c0109, 
+  0x00280108, 0x00270108, 0x00260108, 0x00270309, 
+  0x003a0e14, 0x001a090b, 0x00100305, 0x003e141b, 
+  0x00220208, 0x00200006, 0x00200006, 0x00200006, 
+  0x00210006, 0x00220006, 0x00250007, 0x00270108, 
+  0x002c0109, 0x0030020a, 0x0032030b, 0x0038020b, 
+  0x003b030c, 0x003e0610, 0x00440711, 0x00490813, 
+  0x004e0813, 0x00540a16, 0x005b0a17, 0x00620b1a, 
+  0x00690c1b, 0x006b0c1b, 0x00640b1a, 0x005d0a17, 
+  0x00570916, 0x00520914, 0x004b0813, 0x00460711, 
+  0x00400610, 0x003c030d, 0x0038020b, 0x0032030b, 
+  0x0030020a, 0x002c0109, 0x00280108, 0x00270108, 
+  0x00260108, 0x00270309, 0x003a0e14, 0x001a090b, 
+  0x00100406, 0x003e161d, 0x0024050a, 0x00200208, 
+  0x00200107, 0x00210107, 0x00220107, 0x00240107, 
+  0x00260208, 0x00280209, 0x002b030a, 0x0030030b, 
+  0x0032050c, 0x0038070e, 0x003b060e, 0x003e070e, 
+  0x00440811, 0x00470912, 0x004e0a15, 0x00530b16, 
+  0x00590b18, 0x005f0d1b, 0x0068101e, 0x006c1120, 
+  0x0066101e, 0x005f0c1a, 0x005b0b17, 0x00540c18, 
+  0x004e0a14, 0x00480913, 0x00450811, 0x003e0811, 
+  0x003b060d, 0x0035070e, 0x0032050c, 0x0030030b, 
+  0x002e030a, 0x0029030a, 0x0029030a, 0x0029070c, 
+  0x003c1217, 0x001b090d, 0x00100406, 0x003e161d, 
+  0x0024050a, 0x00200208, 0x00200107, 0x00210107, 
+  0x00220107, 0x00240107, 0x00260208, 0x00280209, 
+  0x002b030a, 0x0030030b, 0x0032050c, 0x0038070e, 
+  0x003b060e, 0x003e070e, 0x00440811, 0x00470912, 
+  0x004e0a15, 0x00530b16, 0x00590b18, 0x005f0d1b, 
+  0x0068101e, 0x006c1120, 0x0066101e, 0x005f0c1a, 
+  0x005b0b17, 0x00540c18, 0x004e0a14, 0x00480913, 
+  0x00450811, 0x003e0811, 0x003b060d, 0x0035070e, 
+  0x0032050c, 0x0030030b, 0x002e030a, 0x0029030a, 
+  0x0029030a, 0x0029070c, 0x003c1217, 0x001b090d, 
+  0x00100406, 0x003e161d, 0x0024050a, 0x00200208, 
+  0x00200107, 0x00210107, 0x00220107, 0x00240107, 
+  0x00260208, 0x00280209, 0x002b030a, 0x0030030b, 
+  0x0032050c, 0x0038070e, 0x003b060e, 0x003e070e, 
+  0x00440811, 0x00470912, 0x004e0a15, 0x00530b16, 
+  0x00590b18, 0x005f0d1b, 0x0068101e, 0x006c1120, 
+  0x0066101e, 0x005f0c1a, 0x005b0b17, 0x00540c18, 
+  0x004e0a14, 0x00480913, 0x00450811, 0x003e0811, 
+  0x003b060d, 0x0035070e, 0x0032050c, 0x0030030b, 
+  0x002e030a, 0x0029030a, 0x0029030a, 0x0029070c, 
+  0x003c1217, 0x001b090d, 0x00100506, 0x003f171d, 
+  0x0025070c, 0x00210309, 0x00220309, 0x00220309, 
+  0x00220309, 0x00250309, 0x00260309, 0x00280309, 
+  0x002c050b, 0x002f070d, 0x0033070d, 0x0035080e, 
+  0x003a0911, 0x003e0912, 0x00430a14, 0x00470a13, 
+  0x004b0c17, 0x00520c17, 0x00580e1b, 0x005e101c, 
+  0x0064111e, 0x00691321, 0x00681220, 0x0062111e, 
+  0x005d101d, 0x00570e1b, 0x00520c17, 0x004b0c17, 
+  0x00470b15, 0x00430a14, 0x003d0810, 0x003a0911, 
+  0x00350810, 0x0032070e, 0x002f070d, 0x002e070d, 
+  0x002c070d, 0x002e080d, 0x003f141a, 0x001c0a0d, 
+  0x00100506, 0x003f171d, 0x0025070c, 0x00210309, 
+  0x00220309, 0x00220309, 0x00220309, 0x00250309, 
+  0x00260309, 0x00280309, 0x002c050b, 0x002f070d, 
+  0x0033070d, 0x0035080e, 0x003a0911, 0x003e0912, 
+  0x00430a14, 0x00470a13, 0x004b0c17, 0x00520c17, 
+  0x00580e1b, 0x005e101c, 0x0064111e, 0x00691321, 
+  0x00681220, 0x0062111e, 0x005d101d, 0x00570e1b, 
+  0x00520c17, 0x004b0c17, 0x00470b15, 0x00430a14, 
+  0x003d0810, 0x003a0911, 0x00350810, 0x0032070e, 
+  0x002f070d, 0x002e070d, 0x002c070d, 0x002e080d, 
+  0x003f141a, 0x001c0a0d, 0x00100506, 0x003f171d, 
+  0x0025070c, 0x00210309, 0x00220309, 0x00220309, 
+  0x00220309, 0x00250309, 0x00260309, 0x00280309, 
+  0x002c050b, 0x002f070d, 0x0033070d, 0x0035080e, 
+  0x003a0911, 0x003e0912, 0x00430a14, 0x00470a13, 
+  0x004b0c17, 0x00520c17, 0x00580e1b, 0x005e101c, 
+  0x0064111e, 0x00691321, 0x00681220, 0x0062111e, 
+  0x005d101d, 0x00570e1b, 0x00520c17, 0x004b0c17, 
+  0x00470b15, 0x00430a14, 0x003d0810, 0x003a0911, 
+  0x00350810, 0x0032070e, 0x002f070d, 0x002e070d, 
+  0x002c070d, 0x002e080d, 0x003f141a, 0x001c0a0d, 
+  0x00100506, 0x003f1a20, 0x00250a0e, 0x0022080c, 
+  0x0022050a, 0x0022050a, 0x0024050a, 0x0026050a, 
+  0x0027050c, 0x0029070c, 0x002c070c, 0x002f080d, 
+  0x00330910, 0x00350910, 0x003a0a11, 0x003d0b14, 
+  0x00400b14, 0x00460c16, 0x004a0d16, 0x00ffffff, 
+  0x0057111c, 0x005d131f, 0x00621320, 0x00681422, 
+  0x00691524, 0x00641421, 0x005f1320, 0x005b121e, 
+  0x0055111b, 0x00510e1a, 0x004a0d17, 0x00460c16, 
+  0x00400a12, 0x003d0b14, 0x003a0a11, 0x00350910, 
+  0x0033090e, 0x00310910, 0x0030090e, 0x00310a10, 
+  0x0043171f, 0x001c0b0d, 0x00100506, 0x003f1a20, 
+  0x00250a0e, 0x0022080c, 0x0022050a, 0x0022050a, 
+  0x0024050a, 0x0026050a, 0x0027050c, 0x0029070c, 
+  0x002c070c, 0x002f080d, 0x00330910, 0x00350910, 
+  0x003a0a11, 0x003d0b14, 0x00400b14, 0x00460c16, 
+  0x004a0d16, 0x00510e1a, 0x0057111c, 0x005d131f, 
+  0x00621320, 0x00681422, 0x00691524, 0x00641421, 
+  0x005f1320, 0x005b121e, 0x0055111b, 0x00510e1a, 
+  0x004a0d17, 0x00460c16, 0x00400a12, 0x003d0b14, 
+  0x003a0a11, 0x00350910, 0x0033090e, 0x00310910, 
+  0x0030090e, 0x00310a10, 0x0043171f, 0x001c0b0d, 
+  0x00100506, 0x003f1a20, 0x00250a0e, 0x0022080c, 
+  0x0022050a, 0x0022050a, 0x0024050a, 0x0026050a, 
+  0x0027050c, 0x0029070c, 0x002c070c, 0x002f080d, 
+  0x00330910, 0x00350910, 0x003a0a11, 0x003d0b14, 
+  0x00400b14, 0x00460c16, 0x00ffffff, 0x00ffffff, 
+  0x0057111c, 0x005d131f, 0x00621320, 0x00ffffff, 
+  0x00ffffff, 0x00641421, 0x005f1320, 0x005b121e, 
+  0x0055111b, 0x00510e1a, 0x004a0d17, 0x00460c16, 
+  0x00400a12, 0x003d0b14, 0x003a0a11, 0x00350910, 
+  0x0033090e, 0x00310910, 0x0030090e, 0x00310a10, 
+  0x0043171f, 0x001c0b0d, 0x00100506, 0x00421d24, 
+  0x00260b0e, 0x0024090d, 0x0024080b, 0x0024080c, 
+  0x0025070c, 0x0026070c, 0x0027080d, 0x0029080c, 
+  0x002c090e, 0x002f090e, 0x00320a10, 0x00350b12, 
+  0x003a0c14, 0x003d0d15, 0x00400d15, 0x00450d15, 
+  0x00490e16, 0x004f121c, 0x00ffffff, 0x005b1420, 
+  0x00611622, 0x00661624, 0x006b1726, 0x00681624, 
+  0x00621522, 0x005d1521, 0x0058141f, 0x0052131e, 
+  0x004f121c, 0x00490e16, 0x00450d15, 0x00400d16, 
+  0x003d0d15, 0x003a0c14, 0x00380b12, 0x00380b12, 
+  0x00340c12, 0x00340d14, 0x00461a21, 0x001d0c0e, 
+  0x00100506, 0x00421d24, 0x00260b0e, 0x0024090d, 
+  0x0024080b, 0x0024080c, 0x0025070c, 0x0026070c, 
+  0x0027080d, 0x0029080c, 0x002c090e, 0x002f090e, 
+  0x00320a10, 0x00350b12, 0x003a0c14, 0x003d0d15, 
+  0x00400d15, 0x00450d15, 0x00490e16, 0x004f121c, 
+  0x0054131e, 0x005b1420, 0x00611622, 0x00661624, 
+  0x006b1726, 0x00681624, 0x00621522, 0x005d1521, 
+  0x0058141f, 0x0052131e, 0x004f121c, 0x00490e16, 
+  0x00450d15, 0x00400d16, 0x003d0d15, 0x003a0c14, 
+  0x00380b12, 0x00380b12, 0x00340c12, 0x00340d14, 
+  0x00461a21, 0x001d0c0e, 0x00100506, 0x00421d24, 
+  0x00260b0e, 0x0024090d, 0x0024080b, 0x0024080c, 
+  0x0025070c, 0x0026070c, 0x0027080d, 0x0029080c, 
+  0x002c090e, 0x002f090e, 0x00320a10, 0x00350b12, 
+  0x003a0c14, 0x003d0d15, 0x00400d15, 0x00450d15, 
+  0x00490e16, 0x00ffffff, 0x0054131e, 0x005b1420, 
+  0x00611622, 0x00ffffff, 0x006b1726, 0x00681624, 
+  0x00621522, 0x005d1521, 0x0058141f, 0x0052131e, 
+  0x004f121c, 0x00490e16, 0x00450d15, 0x00400d16, 
+  0x003d0d15, 0x003a0c14, 0x00380b12, 0x00380b12, 
+  0x00340c12, 0x00340d14, 0x00461a21, 0x001d0c0e, 
+  0x00100607, 0x00431f25, 0x00270c10, 0x00240a0e, 
+  0x00240a0e, 0x0025090c, 0x0025090c, 0x00260a0e, 
+  0x0028090e, 0x0029090d, 0x002c0a0e, 0x002f0b11, 
+  0x00320b11, 0x00340c12, 0x003a0d15, 0x003c0e16, 
+  0x00401017, 0x00450e15, 0x0048121b, 0x004d131d, 
+  0x00ffffff, 0x00591621, 0x005e1724, 0x00631825, 
+  0x00691826, 0x00691826, 0x00641725, 0x00611724, 
+  0x005c1622, 0x00581520, 0x0052141e, 0x004d131d, 
+  0x0048121b, 0x00450e15, 0x00401017, 0x003e0e15, 
+  0x003c0e16, 0x003b0e16, 0x003a0e16, 0x003b1017, 
+  0x00491d25, 0x001d0d0f, 0x00100607, 0x00431f25, 
+  0x00270c10, 0x00240a0e, 0x00240a0e, 0x0025090c, 
+  0x0025090c, 0x00260a0e, 0x0028090e, 0x0029090d, 
+  0x002c0a0e, 0x002f0b11, 0x00320b11, 0x00340c12, 
+  0x003a0d15, 0x003c0e16, 0x00401017, 0x00450e15, 
+  0x0048121b, 0x004d131d, 0x0052141e, 0x00591621, 
+  0x005e1724, 0x00631825, 0x00691826, 0x00691826, 
+  0x00641725, 0x00611724, 0x005c1622, 0x00581520, 
+  0x0052141e, 0x004d131d, 0x0048121b, 0x00450e15, 
+  0x00401017, 0x003e0e15, 0x003c0e16, 0x003b0e16, 
+  0x003a0e16, 0x003b1017, 0x00491d25, 0x001d0d0f, 
+  0x00100607, 0x00431f25, 0x00270c10, 0x00240a0e, 
+  0x00240a0e, 0x0025090c, 0x0025090c, 0x00260a0e, 
+  0x0028090e, 0x0029090d, 0x002c0a0e, 0x002f0b11, 
+  0x00320b11, 0x00340c12, 0x003a0d15, 0x003c0e16, 
+  0x00401017, 0x00450e15, 0x0048121b, 0x004d131d, 
+  0x00ffffff, 0x00591621, 0x00ffffff, 0x00631825, 
+  0x00691826, 0x00691826, 0x00641725, 0x00611724, 
+  0x005c1622, 0x00581520, 0x0052141e, 0x004d131d, 
+  0x0048121b, 0x00450e15, 0x00401017, 0x003e0e15, 
+  0x003c0e16, 0x003b0e16, 0x003a0e16, 0x003b1017, 
+  0x00491d25, 0x001d0d0f, 0x00110608, 0x00432026, 
+  0x00270d11, 0x00250b10, 0x00250a0d, 0x00250a0e, 
+  0x00260a0d, 0x0027090d, 0x00280a10, 0x00290a0e, 
+  0x002c0b11, 0x002f0c12, 0x00320c12, 0x00340d14, 
+  0x003a0e16, 0x003c1017, 0x003f121a, 0x0044131b, 
+  0x0048131c, 0x004d141e, 0x00ffffff, 0x00571722, 
+  0x005d1824, 0x00621a26, 0x00671b28, 0x006b1c29, 
+  0x00671d29, 0x00631a26, 0x005f1825, 0x005b1722, 
+  0x00541620, 0x0050151f, 0x004b141d, 0x0048131c, 
+  0x0045131c, 0x0043131b, 0x003f1218, 0x003e121a, 
+  0x003e121a, 0x003e131b, 0x004b1f27, 0x001e0d0f, 
+  0x00110608, 0x00432026, 0x00270d11, 0x00250b10, 
+  0x00250a0d, 0x00250a0e, 0x00260a0d, 0x0027090d, 
+  0x00280a10, 0x00290a0e, 0x002c0b11, 0x002f0c12, 
+  0x00320c12, 0x00340d14, 0x003a0e16, 0x003c1017, 
+  0x003f121a, 0x0044131b, 0x0048131c, 0x004d141e, 
+  0x0051151f, 0x00571722, 0x005d1824, 0x00621a26, 
+  0x00671b28, 0x006b1c29, 0x00671d29, 0x00631a26, 
+  0x005f1825, 0x005b1722, 0x00541620, 0x0050151f, 
+  0x004b141d, 0x0048131c, 0x0045131c, 0x0043131b, 
+  0x003f1218, 0x003e121a, 0x003e121a, 0x003e131b, 
+  0x004b1f27, 0x001e0d0f, 0x00110608, 0x00432026, 
+  0x00270d11, 0x00250b10, 0x00250a0d, 0x00250a0e, 
+  0x00260a0d, 0x0027090d, 0x00280a10, 0x00290a0e, 
+  0x002c0b11, 0x002f0c12, 0x00320c12, 0x00340d14, 
+  0x003a0e16, 0x003c1017, 0x003f121a, 0x0044131b, 
+  0x0048131c, 0x004d141e, 0x0051151f, 0x00ffffff, 
+  0x005d1824, 0x00621a26, 0x00671b28, 0x006b1c29, 
+  0x00671d29, 0x00631a26, 0x005f1825, 0x005b1722, 
+  0x00541620, 0x0050151f, 0x004b141d, 0x0048131c, 
+  0x0045131c, 0x0043131b, 0x003f1218, 0x003e121a, 
+  0x003e121a, 0x003e131b, 0x004b1f27, 0x001e0d0f, 
+  0x00110608, 0x00442127, 0x00270e12, 0x00250c11, 
+  0x00250c11, 0x00250b0e, 0x00260b0e, 0x00270c11, 
+  0x00280c11, 0x002b0b10, 0x002c0c12, 0x00300d13, 
+  0x00320d14, 0x00340e14, 0x003a1016, 0x003c1218, 
+  0x003f131b, 0x0044141b, 0x0048151e, 0x004b151e, 
+  0x00ffffff, 0x00551822, 0x005c1a25, 0x00611c26, 
+  0x00641e2a, 0x00691f2b, 0x00691f2b, 0x00661e2a, 
+  0x00621d28, 0x005d1c27, 0x00581824, 0x00531721, 
+  0x00501620, 0x004b161f, 0x0048151e, 0x0046151d, 
+  0x0044151d, 0x0043151d, 0x0043151d, 0x0044151e, 
+  0x00502129, 0x001e0f11, 0x00110608, 0x00442127, 
+  0x00270e12, 0x00250c11, 0x00250c11, 0x00250b0e, 
+  0x00260b0e, 0x00270c11, 0x00280c11, 0x002b0b10, 
+  0x002c0c12, 0x00300d13, 0x00320d14, 0x00340e14, 
+  0x003a1016, 0x003c1218, 0x003f131b, 0x0044141b, 
+  0x0048151e, 0x004b151e, 0x00511721, 0x00551822, 
+  0x005c1a25, 0x00611c26, 0x00641e2a, 0x00691f2b, 
+  0x00691f2b, 0x00661e2a, 0x00621d28, 0x005d1c27, 
+  0x00581824, 0x00531721, 0x00501620, 0x004b161f, 
+  0x0048151e, 0x0046151d, 0x0044151d, 0x0043151d, 
+  0x0043151d, 0x0044151e, 0x00502129, 0x001e0f11, 
+  0x00110608, 0x00442127, 0x00270e12, 0x00250c11, 
+  0x00250c11, 0x00250b0e, 0x00260b0e, 0x00270c11, 
+  0x00280c11, 0x002b0b10, 0x002c0c12, 0x00300d13, 
+  0x00320d14, 0x00340e14, 0x003a1016, 0x003c1218, 
+  0x003f131b, 0x0044141b, 0x0048151e, 0x004b151e, 
+  0x00511721, 0x00ffffff, 0x005c1a25, 0x00611c26, 
+  0x00641e2a, 0x00691f2b, 0x00691f2b, 0x00661e2a, 
+  0x00621d28, 0x005d1c27, 0x00581824, 0x00531721, 
+  0x00501620, 0x004b161f, 0x0048151e, 0x0046151d, 
+  0x0044151d, 0x0043151d, 0x0043151d, 0x0044151e, 
+  0x00502129, 0x001e0f11, 0x00110708, 0x00452429, 
+  0x00281013, 0x00250d12, 0x00250c10, 0x00260c10, 
+  0x00270c10, 0x00270c10, 0x00290d12, 0x002c0c11, 
+  0x002e0d13, 0x00310e13, 0x00331015, 0x00341014, 
+  0x00391217, 0x003d131a, 0x0040141d, 0x0044151e, 
+  0x0048161f, 0x004b1620, 0x00501821, 0x00ffffff, 
+  0x005a1d27, 0x005f1e29, 0x00631f2a, 0x0067202c, 
+  0x006b212e, 0x0068202c, 0x00641f2a, 0x005f1e29, 
+  0x005b1d27, 0x00571c26, 0x00531a24, 0x00501821, 
+  0x004b1821, 0x00491720, 0x0048171f, 0x0046171f, 
+  0x0046171f, 0x00481820, 0x0053242b, 0x001e1012, 
+  0x00110708, 0x00452429, 0x00281013, 0x00250d12, 
+  0x00250c10, 0x00260c10, 0x00270c10, 0x00270c10, 
+  0x00290d12, 0x002c0c11, 0x002e0d13, 0x00310e13, 
+  0x00331015, 0x00341014, 0x00391217, 0x003d131a, 
+  0x0040141d, 0x0044151e, 0x0048161f, 0x004b1620, 
+  0x00501821, 0x00541a24, 0x005a1d27, 0x005f1e29, 
+  0x00631f2a, 0x0067202c, 0x006b212e, 0x0068202c, 
+  0x00641f2a, 0x005f1e29, 0x005b1d27, 0x00571c26, 
+  0x00531a24, 0x00501821, 0x004b1821, 0x00491720, 
+  0x0048171f, 0x0046171f, 0x0046171f, 0x00481820, 
+  0x0053242b, 0x001e1012, 0x00110708, 0x00452429, 
+  0x00281013, 0x00250d12, 0x00250c10, 0x00260c10, 
+  0x00270c10, 0x00270c10, 0x00290d12, 0x002c0c11, 
+  0x002e0d13, 0x00310e13, 0x00331015, 0x00341014, 
+  0x00391217, 0x003d131a, 0x0040141d, 0x0044151e, 
+  0x0048161f, 0x004b1620, 0x00ffffff, 0x00541a24, 
+  0x00ffffff, 0x005f1e29, 0x00631f2a, 0x0067202c, 
+  0x006b212e, 0x0068202c, 0x00641f2a, 0x005f1e29, 
+  0x005b1d27, 0x00571c26, 0x00531a24, 0x00501821, 
+  0x004b1821, 0x00491720, 0x0048171f, 0x0046171f, 
+  0x0046171f, 0x00481820, 0x0053242b, 0x001e1012, 
+  0x00120709, 0x0046262b, 0x00291316, 0x00260e13, 
+  0x00260d11, 0x00260d11, 0x00270d11, 0x00280e13, 
+  0x00290e13, 0x002c0d12, 0x002f0e13, 0x00311015, 
+  0x00331217, 0x00361318, 0x003a141b, 0x003c151c, 
+  0x0040161d, 0x0045171f, 0x00481820, 0x004b1a22, 
+  0x00ffffff, 0x00541d26, 0x005a1e28, 0x005d202a, 
+  0x0061212c, 0x0066222e, 0x006b2430, 0x00692430, 
+  0x0067222e, 0x0061212c, 0x005e202a, 0x005a1e29, 
+  0x00571d28, 0x00531c26, 0x00511c25, 0x004f1a22, 
+  0x004b1a22, 0x004a1a21, 0x004a1a21, 0x004b1d25, 
+  0x00552931, 0x001f1112, 0x00120709, 0x0046262b, 
+  0x00291316, 0x00260e13, 0x00260d11, 0x00260d11, 
+  0x00270d11, 0x00280e13, 0x00290e13, 0x002c0d12, 
+  0x002f0e13, 0x00311015, 0x00331217, 0x00361318, 
+  0x003a141b, 0x003c151c, 0x0040161d, 0x0045171f, 
+  0x00481820, 0x004b1a22, 0x00ffffff, 0x00ffffff, 
+  0x005a1e28, 0x005d202a, 0x0061212c, 0x0066222e, 
+  0x006b2430, 0x00692430, 0x0067222e, 0x0061212c, 
+  0x005e202a, 0x005a1e29, 0x00571d28, 0x00531c26, 
+  0x00511c25, 0x004f1a22, 0x004b1a22, 0x004a1a21, 
+  0x004a1a21, 0x004b1d25, 0x00552931, 0x001f1112, 
+  0x00120709, 0x0046262b, 0x00291316, 0x00260e13, 
+  0x00260d11, 0x00260d11, 0x00270d11, 0x00280e13, 
+  0x00290e13, 0x002c0d12, 0x002f0e13, 0x00311015, 
+  0x00331217, 0x00361318, 0x003a141b, 0x003c151c, 
+  0x0040161d, 0x0045171f, 0x00481820, 0x00ffffff, 
+  0x00501d26, 0x00541d26, 0x005a1e28, 0x00ffffff, 
+  0x0061212c, 0x0066222e, 0x006b2430, 0x00692430, 
+  0x0067222e, 0x0061212c, 0x005e202a, 0x005a1e29, 
+  0x00571d28, 0x00531c26, 0x00511c25, 0x004f1a22, 
+  0x004b1a22, 0x004a1a21, 0x004a1a21, 0x004b1d25, 
+  0x00552931, 0x001f1112, 0x00170d0e, 0x0049292f, 
+  0x002c151a, 0x00270e12, 0x00270e12, 0x00280e12, 
+  0x00280e12, 0x00291014, 0x002c0e13, 0x002e1015, 
+  0x00301013, 0x00321318, 0x00341318, 0x0039141b, 
+  0x003b151c, 0x003e161c, 0x0044171f, 0x00461a21, 
+  0x00491a21, 0x004d1d25, 0x00ffffff, 0x00541f28, 
+  0x005a202a, 0x005d212c, 0x0061222c, 0x0063252f, 
+  0x00692732, 0x006b2833, 0x00682732, 0x00662530, 
+  0x0061222c, 0x005d222c, 0x005a202a, 0x00571f28, 
+  0x00541e27, 0x00521f28, 0x00501f27, 0x004f1e26, 
+  0x004f1e26, 0x00502028, 0x005a2c34, 0x00221416, 
+  0x00170d0e, 0x0049292f, 0x002c151a, 0x00270e12, 
+  0x00270e12, 0x00280e12, 0x00280e12, 0x00291014, 
+  0x002c0e13, 0x002e1015, 0x00301013, 0x00321318, 
+  0x00341318, 0x0039141b, 0x003b151c, 0x003e161c, 
+  0x0044171f, 0x00461a21, 0x00491a21, 0x004d1d25, 
+  0x00ffffff, 0x00541f28, 0x005a202a, 0x005d212c, 
+  0x0061222c, 0x0063252f, 0x00692732, 0x006b2833, 
+  0x00682732, 0x00662530, 0x0061222c, 0x005d222c, 
+  0x005a202a, 0x00571f28, 0x00541e27, 0x00521f28, 
+  0x00501f27, 0x004f1e26, 0x004f1e26, 0x00502028, 
+  0x005a2c34, 0x00221416, 0x00170d0e, 0x0049292f, 
+  0x002c151a, 0x00270e12, 0x00270e12, 0x00280e12, 
+  0x00280e12, 0x00291014, 0x002c0e13, 0x002e1015, 
+  0x00301013, 0x00321318, 0x00341318, 0x0039141b, 
+  0x003b151c, 0x003e161c, 0x0044171f, 0x00461a21, 
+  0x00ffffff, 0x00ffffff, 0x00511e27, 0x00541f28, 
+  0x005a202a, 0x00ffffff, 0x00ffffff, 0x0063252f, 
+  0x00692732, 0x006b2833, 0x00682732, 0x00662530, 
+  0x0061222c, 0x005d222c, 0x005a202a, 0x00571f28, 
+  0x00541e27, 0x00521f28, 0x00501f27, 0x004f1e26, 
+  0x004f1e26, 0x00502028, 0x005a2c34, 0x00221416, 
+  0x001e1118, 0x004b2b2f, 0x00331b1f, 0x00291316, 
+  0x00281115, 0x00291115, 0x00291115, 0x002b1115, 
+  0x002e1013, 0x00301217, 0x00311318, 0x0033141a, 
+  0x0038151b, 0x003a161c, 0x003d171e, 0x003f181f, 
+  0x00451a21, 0x00481b22, 0x004b1d25, 0x00501f27, 
+  0x00ffffff, 0x0055222b, 0x005a222b, 0x005d242f, 
+  0x0061252f, 0x00632832, 0x00672933, 0x00692a35, 
+  0x00692a35, 0x00662933, 0x00632832, 0x0061252f, 
+  0x005d252f, 0x005b242c, 0x0058222b, 0x0057212a, 
+  0x0054212a, 0x0053212a, 0x0053212a, 0x0054252c, 
+  0x005e343a, 0x00221418, 0x001e1118, 0x004b2b2f, 
+  0x00331b1f, 0x00291316, 0x00281115, 0x00291115, 
+  0x00291115, 0x002b1115, 0x002e1013, 0x00301217, 
+  0x00311318, 0x0033141a, 0x0038151b, 0x003a161c, 
+  0x003d171e, 0x003f181f, 0x00451a21, 0x00481b22, 
+  0x004b1d25, 0x00ffffff, 0x00ffffff, 0x0055222b, 
+  0x005a222b, 0x005d242f, 0x0061252f, 0x00632832, 
+  0x00672933, 0x00692a35, 0x00692a35, 0x00662933, 
+  0x00632832, 0x0061252f, 0x005d252f, 0x005b242c, 
+  0x0058222b, 0x0057212a, 0x0054212a, 0x0053212a, 
+  0x0053212a, 0x0054252c, 0x005e343a, 0x00221418, 
+  0x001e1118, 0x004b2b2f, 0x00331b1f, 0x00291316, 
+  0x00281115, 0x00291115, 0x00291115, 0x002b1115, 
+  0x002e1013, 0x00301217, 0x00311318, 0x0033141a, 
+  0x0038151b, 0x003a161c, 0x003d171e, 0x003f181f, 
+  0x00451a21, 0x00481b22, 0x004b1d25, 0x00501f27, 
+  0x00522029, 0x0055222b, 0x005a222b, 0x005d242f, 
+  0x0061252f, 0x00632832, 0x00672933, 0x00692a35, 
+  0x00692a35, 0x00662933, 0x00632832, 0x0061252f, 
+  0x005d252f, 0x005b242c, 0x0058222b, 0x0057212a, 
+  0x0054212a, 0x0053212a, 0x0053212a, 0x0054252c, 
+  0x005e343a, 0x00221418, 0x0022101e, 0x00472e31, 
+  0x00492b31, 0x00331b1f, 0x002e161b, 0x002c151a, 
+  0x002e1417, 0x002f151a, 0x0031161b, 0x0032161b, 
+  0x0034161c, 0x0038171d, 0x003b181e, 0x003d1a1f, 
+  0x003f1a20, 0x00451d24, 0x00481d25, 0x004d1f27, 
+  0x00502028, 0x00ffffff, 0x0054242b, 0x0057252e, 
+  0x005b2831, 0x005d2831, 0x00612932, 0x00632b34, 
+  0x00662c36, 0x00682e38, 0x006b2f39, 0x00682e38, 
+  0x00662c36, 0x00632a33, 0x00612a33, 0x005e2831, 
+  0x005c2932, 0x005b2831, 0x005a252e, 0x0058262f, 
+  0x00582931, 0x005e333b, 0x00513336, 0x001e1019, 
+  0x0022101e, 0x00472e31, 0x00492b31, 0x00331b1f, 
+  0x002e161b, 0x002c151a, 0x002e1417, 0x002f151a, 
+  0x0031161b, 0x0032161b, 0x0034161c, 0x0038171d, 
+  0x003b181e, 0x003d1a1f, 0x003f1a20, 0x00451d24, 
+  0x00481d25, 0x004d1f27, 0x00502028, 0x00ffffff, 
+  0x0054242b, 0x0057252e, 0x005b2831, 0x005d2831, 
+  0x00612932, 0x00632b34, 0x00662c36, 0x00682e38, 
+  0x006b2f39, 0x00682e38, 0x00662c36, 0x00632a33, 
+  0x00612a33, 0x005e2831, 0x005c2932, 0x005b2831, 
+  0x005a252e, 0x0058262f, 0x00582931, 0x005e333b, 
+  0x00513336, 0x001e1019, 0x0022101e, 0x00472e31, 
+  0x00492b31, 0x00331b1f, 0x002e161b, 0x002c151a, 
+  0x002e1417, 0x002f151a, 0x0031161b, 0x0032161b, 
+  0x0034161c, 0x0038171d, 0x003b181e, 0x003d1a1f, 
+  0x003f1a20, 0x00451d24, 0x00481d25, 0x004d1f27, 
+  0x00502028, 0x0052212a, 0x0054242b, 0x0057252e, 
+  0x005b2831, 0x005d2831, 0x00612932, 0x00632b34, 
+  0x00662c36, 0x00682e38, 0x006b2f39, 0x00682e38, 
+  0x00662c36, 0x00632a33, 0x00612a33, 0x005e2831, 
+  0x005c2932, 0x005b2831, 0x005a252e, 0x0058262f, 
+  0x00582931, 0x005e333b, 0x00513336, 0x001e1019, 
+  0x00291226, 0x00381e31, 0x00482e31, 0x00503034, 
+  0x0047292f, 0x0043272b, 0x0043252a, 0x0044252a, 
+  0x0045252a, 0x0046262b, 0x0048262b, 0x0049282e, 
+  0x004b282e, 0x004f2930, 0x00512930, 0x00522a31, 
+  0x00552b32, 0x00582c34, 0x005a2e35, 0x005c2f36, 
+  0x005d3038, 0x005f3139, 0x0061333b, 0x0063343b, 
+  0x0066353d, 0x0068363e, 0x006b3840, 0x006b3a42, 
+  0x006b3a42, 0x006b3a42, 0x006b3942, 0x00693840, 
+  0x0067363f, 0x0066353d, 0x0065353d, 0x0063343c, 
+  0x0062343c, 0x0061353d, 0x00613a40, 0x00533438, 
+  0x00361f2e, 0x00271225, 0x00291226, 0x00381e31, 
+  0x00482e31, 0x00503034, 0x0047292f, 0x0043272b, 
+  0x0043252a, 0x0044252a, 0x0045252a, 0x0046262b, 
+  0x0048262b, 0x0049282e, 0x004b282e, 0x004f2930, 
+  0x00512930, 0x00522a31, 0x00552b32, 0x00582c34, 
+  0x005a2e35, 0x005c2f36, 0x005d3038, 0x005f3139, 
+  0x0061333b, 0x0063343b, 0x0066353d, 0x0068363e, 
+  0x006b3840, 0x006b3a42, 0x006b3a42, 0x006b3a42, 
+  0x006b3942, 0x00693840, 0x0067363f, 0x0066353d, 
+  0x0065353d, 0x0063343c, 0x0062343c, 0x0061353d, 
+  0x00613a40, 0x00533438, 0x00361f2e, 0x00271225, 
+  0x00291226, 0x00381e31, 0x00482e31, 0x00503034, 
+  0x0047292f, 0x0043272b, 0x0043252a, 0x0044252a, 
+  0x0045252a, 0x0046262b, 0x0048262b, 0x0049282e, 
+  0x004b282e, 0x004f2930, 0x00512930, 0x00522a31, 
+  0x00552b32, 0x00582c34, 0x005a2e35, 0x005c2f36, 
+  0x005d3038, 0x005f3139, 0x0061333b, 0x0063343b, 
+  0x0066353d, 0x0068363e, 0x006b3840, 0x006b3a42, 
+  0x006b3a42, 0x006b3a42, 0x006b3942, 0x00693840, 
+  0x0067363f, 0x0066353d, 0x0065353d, 0x0063343c, 
+  0x0062343c, 0x0061353d, 0x00613a40, 0x00533438, 
+  0x00361f2e, 0x00271225, 0x002a1225, 0x00291226, 
+  0x001f0f1b, 0x00211419, 0x00221517, 0x001f1214, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x00201214, 
+  0x00201315, 0x00211315, 0x00211315, 0x00221416, 
+  0x00221416, 0x00221416, 0x00221416, 0x00231416, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00231517, 0x00231416, 
+  0x00231416, 0x00221416, 0x00221416, 0x00241719, 
+  0x00231519, 0x001e1019, 0x00271125, 0x002a1325, 
+  0x002a1225, 0x00291226, 0x001f0f1b, 0x00211419, 
+  0x00221517, 0x001f1214, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x00201214, 0x00201315, 0x00211315, 
+  0x00211315, 0x00221416, 0x00221416, 0x00221416, 
+  0x00221416, 0x00231416, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00231517, 0x00231416, 0x00231416, 0x00221416, 
+  0x00221416, 0x00241719, 0x00231519, 0x001e1019, 
+  0x00271125, 0x002a1325, 0x002a1225, 0x00291226, 
+  0x001f0f1b, 0x00211419, 0x00221517, 0x001f1214, 
+  0x001e1113, 0x001e1113, 0x001e1113, 0x001e1113, 
+  0x001e1113, 0x001f1214, 0x001f1214, 0x001f1214, 
+  0x001f1214, 0x001f1214, 0x001f1214, 0x00201214, 
+  0x00201315, 0x00211315, 0x00211315, 0x00221416, 
+  0x00221416, 0x00221416, 0x00221416, 0x00231416, 
+  0x00241517, 0x00241517, 0x00241517, 0x00241517, 
+  0x00241517, 0x00241517, 0x00231517, 0x00231416, 
+  0x00231416, 0x00221416, 0x00221416, 0x00241719, 
+  0x00231519, 0x001e1019, 0x00271125, 0x002a1325, 
+  
+  // End of bitmap
+};
+
+OskImgData s_imgCap =
+{
+  .width = 126,
+  .height = 126,
+  .bitmap = s_bitmapCap,
+};
+
@@ -0,0 +1,457 @@
+// This file is auto-generated. DO NOT edit.
+#include "oskimg.h"
+
+static unsigned int s_bitmapMouse[ 1764 ] =
+{
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x0017434c, 
+  0x00494859, 0x0053516a, 0x004e4e6d, 0x004b4b71, 
+  0x00464773, 0x00454673, 0x00454673, 0x00454673, 
+  0x00454673, 0x00454673, 0x00454673, 0x00454673, 
+  0x00434573, 0x00424274, 0x003f3f74, 0x003f3e75, 
+  0x003d3d72, 0x003c3c71, 0x00393a71, 0x00333672, 
+  0x00323571, 0x0032326f, 0x0033326c, 0x0032316b, 
+  0x00323267, 0x00313068, 0x00302f67, 0x002f2e66, 
+  0x002a2c64, 0x002b2d63, 0x002a2b62, 0x00272761, 
+  0x0027265e, 0x0026265b, 0x0026265b, 0x0028295d, 
+  0x002b2b5d, 0x002a2851, 0x000c2d3e, 0x00000000, 
+  0x00000000, 0x0045465a, 0x00514d6c, 0x003e3e6e, 
+  0x0037386e, 0x0034366e, 0x0032326f, 0x00323171, 
+  0x00323171, 0x00323173, 0x00323173, 0x00313074, 
+  0x00323075, 0x00312f78, 0x002f2e78, 0x002c2c75, 
+  0x002b2a74, 0x00262874, 0x0026276f, 0x0025256e, 
+  0x0022236b, 0x00222069, 0x00222067, 0x001d1d66, 
+  0x001b1b64, 0x001b1b60, 0x00191b5e, 0x00191b5b, 
+  0x00181759, 0x00151657, 0x00151454, 0x0017164d, 
+  0x00161649, 0x00121547, 0x00121345, 0x00121242, 
+  0x0012133d, 0x0014153d, 0x00161646, 0x00232358, 
+  0x00272351, 0x00000000, 0x00000000, 0x004d476a, 
+  0x003a3a6a, 0x0034336b, 0x002d2d6c, 0x002d2c6c, 
+  0x002d2c6e, 0x0028296f, 0x0028296f, 0x00272871, 
+  0x00262874, 0x00262875, 0x00262877, 0x00252678, 
+  0x0023247e, 0x00242577, 0x001f2178, 0x001e2077, 
+  0x00201e71, 0x001c1c6d, 0x001a1c6b, 0x00191968, 
+  0x00171966, 0x00171861, 0x00121260, 0x0012135c, 
+  0x0013115a, 0x000e0f57, 0x000d0e56, 0x000e0f50, 
+  0x000e0f4b, 0x00101145, 0x000d0c44, 0x000d0d3d, 
+  0x000e0d3a, 0x000e0c37, 0x000f0d36, 0x000e0d33, 
+  0x000f0d36, 0x0012133d, 0x0024235a, 0x00000000, 
+  0x00000000, 0x0045436e, 0x00323267, 0x00282a68, 
+  0x00282a68, 0x0023246a, 0x0023246a, 0x0022236b, 
+  0x0020226f, 0x00202271, 0x00202077, 0x00222478, 
+  0x001f2079, 0x001d1e7a, 0x001c1c7f, 0x001c1c7d, 
+  0x00393786, 0x00313081, 0x00161774, 0x00141572, 
+  0x0014166d, 0x0010116b, 0x00101063, 0x0011105e, 
+  0x000d0f5e, 0x000d0f59, 0x000c0e58, 0x000c0c51, 
+  0x000a0c4f, 0x000a094b, 0x00090946, 0x000a0a3f, 
+  0x0008083d, 0x0007083a, 0x00070737, 0x00070832, 
+  0x0006072f, 0x0006082e, 0x0006082e, 0x00080935, 
+  0x0014144f, 0x00000000, 0x00000000, 0x003d3d6f, 
+  0x00272867, 0x00232266, 0x00232166, 0x00222067, 
+  0x001d1e67, 0x001c1c6a, 0x001d1d6b, 0x00373778, 
+  0x0077798e, 0x009b9c9e, 0x00626490, 0x00242582, 
+  0x0015167f, 0x0015167f, 0x004f508d, 0x00797b95, 
+  0x00131377, 0x000f0f70, 0x000e0d6e, 0x000a0b6a, 
+  0x000a0b65, 0x000a0b60, 0x0009095c, 0x0008055b, 
+  0x00060553, 0x0004054e, 0x0003024c, 0x00020247, 
+  0x00010341, 0x0002043c, 0x0003063a, 0x00030436, 
+  0x00040330, 0x0001002e, 0x0001002d, 0x0001002d, 
+  0x0001012a, 0x0004042d, 0x000b0e4a, 0x00000000, 
+  0x00000000, 0x0035386c, 0x00222165, 0x001e1e65, 
+  0x001c1b65, 0x001a1b66, 0x00171966, 0x00151668, 
+  0x003a3a7c, 0x008f9090, 0x007a7b92, 0x006a6c90, 
+  0x0083868b, 0x008c8d9d, 0x00262688, 0x000e0e83, 
+  0x002d2e8e, 0x00999a9c, 0x001a1b7f, 0x00080a72, 
+  0x0008086d, 0x0006066b, 0x00050663, 0x0004055f, 
+  0x0004035b, 0x00030354, 0x0000004f, 0x0001024d, 
+  0x00000248, 0x00000242, 0x0001003e, 0x0001003a, 
+  0x00010032, 0x0000002e, 0x0000002b, 0x00000326, 
+  0x00000025, 0x00000025, 0x00000124, 0x00010029, 
+  0x00060746, 0x00000000, 0x00000000, 0x0032316b, 
+  0x001b1b64, 0x00181961, 0x0018195f, 0x00121260, 
+  0x00121263, 0x00121263, 0x00919398, 0x0063658d, 
+  0x00171672, 0x000f0d70, 0x0020217a, 0x0071728e, 
+  0x00898b99, 0x00606196, 0x0085879b, 0x007f829c, 
+  0x000e0e7d, 0x00010273, 0x0001016e, 0x00020368, 
+  0x00020062, 0x0000005e, 0x00000159, 0x00000051, 
+  0x0000014c, 0x00000149, 0x00000144, 0x0001003b, 
+  0x00010037, 0x00000230, 0x0000022b, 0x00000028, 
+  0x00000224, 0x00000123, 0x0000011f, 0x0000011f, 
+  0x0000011f, 0x00000023, 0x00040541, 0x00000000, 
+  0x00000000, 0x00292b69, 0x0018195f, 0x0013135c, 
+  0x0012115d, 0x0012115d, 0x000d0f5e, 0x000a0a62, 
+  0x00929494, 0x00464786, 0x0008086b, 0x0007086f, 
+  0x00050572, 0x0012127c, 0x006f7190, 0x008d9090, 
+  0x00838792, 0x00363692, 0x00000179, 0x00000072, 
+  0x0000026c, 0x00000064, 0x0000015f, 0x00000159, 
+  0x00000154, 0x0000014d, 0x00000047, 0x00020042, 
+  0x00000139, 0x00000136, 0x00000131, 0x0000002b, 
+  0x00000027, 0x00020022, 0x00010021, 0x0003001d, 
+  0x0002001c, 0x0002001a, 0x0002001a, 0x0001001d, 
+  0x00000240, 0x00000000, 0x00000000, 0x00272867, 
+  0x0014125b, 0x000d0f5b, 0x000d0f59, 0x000a0a59, 
+  0x000a0a59, 0x0006065e, 0x0077798e, 0x00808291, 
+  0x00191973, 0x0003056d, 0x00010171, 0x00000274, 
+  0x0005067a, 0x001e1f8a, 0x00121288, 0x00000181, 
+  0x00000079, 0x00010071, 0x0000036c, 0x00020968, 
+  0x0002085f, 0x00000255, 0x00000052, 0x00010047, 
+  0x00000142, 0x0000013d, 0x00000136, 0x00000031, 
+  0x0000002e, 0x00020027, 0x00030024, 0x00040021, 
+  0x0005001d, 0x0005001c, 0x0004001a, 0x00040018, 
+  0x0004001a, 0x0003001d, 0x0001003f, 0x00000000, 
+  0x00000000, 0x00222165, 0x000d0e57, 0x000c0c51, 
+  0x00080753, 0x00080753, 0x00060553, 0x0001015c, 
+  0x00201f6c, 0x00757784, 0x00787993, 0x001e1e72, 
+  0x0011106e, 0x0000006c, 0x0001006e, 0x00000274, 
+  0x00000279, 0x0002067f, 0x000d2d88, 0x0004478b, 
+  0x000a6293, 0x002b80a4, 0x00237e9f, 0x00065481, 
+  0x00051457, 0x00000043, 0x00000040, 0x00000137, 
+  0x00010034, 0x00010030, 0x0003002c, 0x00050026, 
+  0x00060024, 0x00050020, 0x0005001c, 0x0004001a, 
+  0x00040018, 0x0004001a, 0x00040017, 0x0002000e, 
+  0x00030015, 0x00000000, 0x00000000, 0x001b1b64, 
+  0x000a0b51, 0x0004054e, 0x0001034f, 0x0000004f, 
+  0x0000004f, 0x00000051, 0x00000155, 0x000d0d5c, 
+  0x0080818d, 0x00939495, 0x008a8b99, 0x00575988, 
+  0x000a0a6b, 0x0000006e, 0x00070d7b, 0x00005691, 
+  0x00008596, 0x0011a5b1, 0x007bd0d7, 0x00a3e1e6, 
+  0x00a4e4e7, 0x0028adb8, 0x00006583, 0x0004154f, 
+  0x0002003d, 0x00050036, 0x00070033, 0x00070030, 
+  0x0007002c, 0x00060025, 0x00050021, 0x0005001d, 
+  0x0005001c, 0x0004001a, 0x00030015, 0x00010004, 
+  0x00000000, 0x00000000, 0x00000001, 0x00000000, 
+  0x00000000, 0x0018195f, 0x0004044d, 0x0000024b, 
+  0x0000024a, 0x00000149, 0x00000149, 0x0001004a, 
+  0x0000014d, 0x0000014e, 0x00585a83, 0x008d8f8d, 
+  0x008c8f8f, 0x00909290, 0x006c667b, 0x001b3374, 
+  0x0005749d, 0x00009da8, 0x009ae0e3, 0x00dafbfb, 
+  0x00bceeee, 0x0099e1e3, 0x00a7e7e8, 0x00b7ebed, 
+  0x00009ba8, 0x0000607f, 0x0008174c, 0x00070036, 
+  0x00070033, 0x0008002f, 0x0007002c, 0x00060025, 
+  0x00060022, 0x0004001a, 0x0002000e, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00010004, 0x00000000, 0x00000000, 0x0013135c, 
+  0x00000149, 0x00010040, 0x0000013d, 0x00010040, 
+  0x00020042, 0x00020042, 0x00000142, 0x00000044, 
+  0x00464774, 0x00919394, 0x00949493, 0x008f8d8c, 
+  0x001b6065, 0x00006f7e, 0x00029dab, 0x00c1f2f2, 
+  0x00d0f7f5, 0x0092ddde, 0x006acfd2, 0x005bcbcd, 
+  0x0054c6cb, 0x006fd2d4, 0x0085d7dc, 0x001aa8b4, 
+  0x00026d86, 0x00081747, 0x00080034, 0x0008002f, 
+  0x00060027, 0x00040017, 0x00010008, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00010008, 0x00000000, 
+  0x00000000, 0x000d0f5b, 0x00010040, 0x00010038, 
+  0x00000135, 0x00000136, 0x00000135, 0x00000038, 
+  0x0000013c, 0x0000003f, 0x000f104d, 0x0085858c, 
+  0x0088827f, 0x00406f74, 0x00007c90, 0x0007a5b4, 
+  0x0025abb7, 0x0002a0ab, 0x0051c5c9, 0x0086dddd, 
+  0x0063cbcf, 0x0051c3c8, 0x0043bcc3, 0x0033b5bc, 
+  0x0047c1c6, 0x0080d4d9, 0x0020abb5, 0x0002677f, 
+  0x00071837, 0x00040016, 0x00010007, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x0002000b, 0x00000000, 0x00000000, 0x000a0a58, 
+  0x00010037, 0x00000030, 0x0000002f, 0x0000002e, 
+  0x0004002f, 0x00010033, 0x00010034, 0x0002003a, 
+  0x0001003e, 0x00404068, 0x00033132, 0x00006a7b, 
+  0x006ed0da, 0x00f0f5f4, 0x00def0ee, 0x008ad3da, 
+  0x00008d9d, 0x0024aeb8, 0x0060cbcd, 0x003dbbc2, 
+  0x002eb5bc, 0x0020adb7, 0x000eaab1, 0x0028b1b9, 
+  0x0064c8cd, 0x000096a4, 0x00006375, 0x00051620, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x0002000c, 0x00000000, 
+  0x00000000, 0x00080753, 0x00000030, 0x00020027, 
+  0x00030027, 0x00060027, 0x0005002a, 0x0006002f, 
+  0x00050033, 0x00080035, 0x00060036, 0x00162959, 
+  0x00016e7e, 0x000096a5, 0x00abdee3, 0x00a4bcbb, 
+  0x0080a3a1, 0x00f1f5f1, 0x00bcebee, 0x000099a4, 
+  0x001aabb5, 0x002fb5bc, 0x0020adb7, 0x0014a7b1, 
+  0x0002a1ab, 0x00009aa5, 0x0014a8b4, 0x002bb1bb, 
+  0x00007689, 0x0007737f, 0x000a0c14, 0x00000003, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00030010, 0x00000000, 0x00000000, 0x00030351, 
+  0x00020027, 0x00050024, 0x00060025, 0x00050026, 
+  0x00060026, 0x00060025, 0x00060022, 0x00050020, 
+  0x0012142d, 0x00017a8c, 0x004ac3cd, 0x0082d6da, 
+  0x0097dade, 0x00c5dada, 0x00729997, 0x006e9694, 
+  0x00cbe4e3, 0x007ecfd6, 0x00009aa7, 0x001aadb5, 
+  0x0011a7b1, 0x0002a1ab, 0x00009aa5, 0x000090a0, 
+  0x00007c8f, 0x00008293, 0x0071ccd3, 0x00bbe4e7, 
+  0x00506b71, 0x00020109, 0x00000002, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00030011, 0x00000000, 
+  0x00000000, 0x0000004f, 0x00050025, 0x00050021, 
+  0x0004001a, 0x00030011, 0x00010009, 0x00010004, 
+  0x00010007, 0x00010009, 0x001f4050, 0x000094a3, 
+  0x00e6fffc, 0x0080d7da, 0x002cb1bb, 0x00dafafa, 
+  0x00aed3d4, 0x00336e6e, 0x002a6c6f, 0x0072bec3, 
+  0x0003a0ad, 0x0004a1ad, 0x0004a4ad, 0x00009aa7, 
+  0x00008d9e, 0x0000768a, 0x00008594, 0x008fd6d9, 
+  0x00fcffff, 0x00ffffff, 0x00b2d7d8, 0x00435d62, 
+  0x00010007, 0x00000002, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00030015, 0x00000000, 0x00000000, 0x00000048, 
+  0x00040016, 0x00010007, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000003, 0x00010008, 0x0002000c, 
+  0x00116d7d, 0x007bd6d9, 0x00b8f0ee, 0x006bcfd2, 
+  0x000093a1, 0x001eaab5, 0x0085d6da, 0x00409aa1, 
+  0x00137479, 0x0053b1b8, 0x00009baa, 0x00009ea8, 
+  0x00009da8, 0x00008c9d, 0x0000788a, 0x00008897, 
+  0x0096d7dc, 0x00edfcfb, 0x00d3f1f1, 0x00eafcfb, 
+  0x00ffffff, 0x00a5d3d3, 0x0043565c, 0x00010007, 
+  0x00000002, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00040017, 0x00000000, 
+  0x00000000, 0x00070029, 0x00000002, 0x00000000, 
+  0x00000000, 0x00000001, 0x00000003, 0x00010007, 
+  0x0002000b, 0x001c313d, 0x000397a4, 0x00aae6e8, 
+  0x0060c8cd, 0x0047bfc5, 0x0038b8bf, 0x00009ba7, 
+  0x00008a9b, 0x000099a7, 0x0016a1ae, 0x000094a4, 
+  0x00008897, 0x000097a4, 0x00008c9a, 0x0000798d, 
+  0x0035b1bb, 0x00c9eded, 0x00e3f8f8, 0x00d6f2f1, 
+  0x00d3f2f0, 0x00cff0ee, 0x00edfafc, 0x00ffffff, 
+  0x00a3cdcc, 0x00272c33, 0x00010004, 0x00000003, 
+  0x00000001, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00000000, 0x00000000, 0x00060026, 
+  0x00010004, 0x00000002, 0x00000002, 0x00000003, 
+  0x00010004, 0x00010008, 0x0002000b, 0x000f5361, 
+  0x0010a3ae, 0x008ad9dc, 0x003fbbc1, 0x0032b8be, 
+  0x0024afb8, 0x001eaab4, 0x00009ba8, 0x00008596, 
+  0x00008293, 0x00008594, 0x00008594, 0x00008092, 
+  0x00007488, 0x002caab7, 0x00eaf8f7, 0x00e1f4f5, 
+  0x00d4f2f2, 0x00d4f2f1, 0x00d3f1f0, 0x00cfeeed, 
+  0x00c9ebeb, 0x00faffff, 0x00f2fefe, 0x00607b7f, 
+  0x00010009, 0x00010007, 0x00010004, 0x00000002, 
+  0x00000002, 0x00000003, 0x0005001c, 0x00000000, 
+  0x00000000, 0x00070029, 0x00010007, 0x00010004, 
+  0x00010004, 0x00010004, 0x00010008, 0x0002000b, 
+  0x0002000e, 0x00015a69, 0x001baab5, 0x0079d4d7, 
+  0x0031b8be, 0x0028b1b9, 0x0016a8b2, 0x000ea5af, 
+  0x000aa5af, 0x0002a1ab, 0x00009aa5, 0x000099a5, 
+  0x00008697, 0x00007283, 0x001baab1, 0x00dcf2f4, 
+  0x00e0f7f5, 0x00d3f2f1, 0x00d4f2f1, 0x00d3f1f0, 
+  0x00d0f0ee, 0x00d0f0ee, 0x00c9eaea, 0x00d4f1f1, 
+  0x00ffffff, 0x0098c5c4, 0x00282d37, 0x00010009, 
+  0x00010008, 0x00010007, 0x00010004, 0x00010007, 
+  0x00050021, 0x00000000, 0x00000000, 0x0007002c, 
+  0x00010009, 0x00010007, 0x00010007, 0x00010008, 
+  0x00010009, 0x0002000b, 0x00030010, 0x00144e5f, 
+  0x00009aa7, 0x0092dde0, 0x0040bbc2, 0x0018aab4, 
+  0x000da4ae, 0x0003a0ab, 0x00009da8, 0x000097a4, 
+  0x000094a1, 0x00008899, 0x00008394, 0x0065c1cb, 
+  0x00bce4e3, 0x00b4dedc, 0x00d3f2f1, 0x00d6f4f2, 
+  0x00d3f1f0, 0x00d0eeee, 0x00cdeded, 0x00cdedeb, 
+  0x00cbebeb, 0x00c2e6e7, 0x00eafbfb, 0x00d6f1f0, 
+  0x00628086, 0x0002000e, 0x0002000b, 0x00010009, 
+  0x00010008, 0x00010009, 0x00050021, 0x00000000, 
+  0x00000000, 0x0007002f, 0x0002000b, 0x00010008, 
+  0x00010008, 0x00010009, 0x0002000b, 0x0002000c, 
+  0x00030011, 0x00111226, 0x00017588, 0x0046bbc3, 
+  0x007bd2d6, 0x002ab1b9, 0x0003a0ab, 0x00009daa, 
+  0x00009da7, 0x000093a1, 0x00008999, 0x00007486, 
+  0x0032afbb, 0x00eefafb, 0x00def5f4, 0x00adddda, 
+  0x00afdedd, 0x00d7f2f0, 0x00d2f0f0, 0x00cfeeed, 
+  0x00cceded, 0x00cbebeb, 0x00c8eaea, 0x00c2e6e7, 
+  0x00d2edee, 0x00f7feff, 0x008bb7b9, 0x00030011, 
+  0x0002000e, 0x0002000c, 0x0002000b, 0x0002000c, 
+  0x00060024, 0x00000000, 0x00000000, 0x00050031, 
+  0x0002000e, 0x00010009, 0x0002000b, 0x0002000b, 
+  0x0002000c, 0x0002000e, 0x00030013, 0x00040016, 
+  0x001a334a, 0x00007a8c, 0x0036b8bf, 0x006ecfd3, 
+  0x0017abb5, 0x00009ba7, 0x000099a5, 0x00008c9d, 
+  0x00007486, 0x000096a1, 0x00c2eeee, 0x00ddf7f7, 
+  0x00d7f4f4, 0x00d0f0ee, 0x009bd3d3, 0x00addddc, 
+  0x00d2edee, 0x00cfeded, 0x00ccedeb, 0x00c9ebea, 
+  0x00c5e8e8, 0x00c2e7e7, 0x00cbeaeb, 0x00feffff, 
+  0x00a4cccd, 0x00030015, 0x00030011, 0x00030010, 
+  0x0002000e, 0x00030010, 0x00060026, 0x00000000, 
+  0x00000000, 0x00050033, 0x00030010, 0x0002000b, 
+  0x0002000c, 0x0002000c, 0x0002000e, 0x00030011, 
+  0x00030013, 0x00040017, 0x0004001b, 0x0014425b, 
+  0x00017789, 0x0010a5b1, 0x0056c5cb, 0x0013a5b1, 
+  0x000090a0, 0x0000758c, 0x000092a1, 0x00bbe6e8, 
+  0x00e4f8f8, 0x00d6f2f2, 0x00d4f2f1, 0x00d7f4f2, 
+  0x00cbeaeb, 0x00a5d9d7, 0x00addcdc, 0x00cdeded, 
+  0x00cbebeb, 0x00c5e8e8, 0x00c3e7e7, 0x00c1e7e7, 
+  0x00c3e8e7, 0x00feffff, 0x00c4e7e6, 0x00040018, 
+  0x00040016, 0x00030013, 0x00030011, 0x00030013, 
+  0x0007002c, 0x00000000, 0x00000000, 0x00010034, 
+  0x00030011, 0x0002000e, 0x0002000e, 0x0002000e, 
+  0x00030010, 0x00030011, 0x00030015, 0x00040017, 
+  0x0005001d, 0x00060324, 0x000e2848, 0x00016a83, 
+  0x0016a7b2, 0x006ccfd2, 0x000092a1, 0x00008999, 
+  0x00c6eeee, 0x00ebfaf8, 0x00d4f2f1, 0x00d4f2f1, 
+  0x00d4f1f1, 0x00d0eeee, 0x00d2f0ee, 0x00d2eeee, 
+  0x00a7dad9, 0x00a8dada, 0x00c9e8ea, 0x00c6e8e8, 
+  0x00c2e8e7, 0x00bce6e6, 0x00bee4e4, 0x00feffff, 
+  0x00cfeded, 0x0005001d, 0x00040018, 0x00040017, 
+  0x00040016, 0x00040017, 0x0008002f, 0x00000000, 
+  0x00000000, 0x00000136, 0x00030013, 0x0002000e, 
+  0x0002000e, 0x00030010, 0x00030011, 0x00030013, 
+  0x00040016, 0x00040018, 0x0005001c, 0x00060022, 
+  0x00060328, 0x00122a4f, 0x0001758c, 0x000ea8b1, 
+  0x000090a0, 0x0075cbd2, 0x00f2fefb, 0x00d2f1f1, 
+  0x00d3f1f0, 0x00d2f0ee, 0x00d2edee, 0x00cfeeed, 
+  0x00ccebea, 0x00cceded, 0x00c8eae8, 0x0099d0d0, 
+  0x00a5d6d7, 0x00c6eae8, 0x00c1e7e7, 0x00bbe3e1, 
+  0x00bee4e4, 0x00fcffff, 0x00c6e8e7, 0x00060022, 
+  0x00050020, 0x0004001a, 0x0004001a, 0x0004001a, 
+  0x00050031, 0x00000000, 0x00000000, 0x00000038, 
+  0x00030015, 0x00030010, 0x00030011, 0x00030011, 
+  0x00030011, 0x00030015, 0x00040016, 0x00040018, 
+  0x0005001d, 0x00050021, 0x00060026, 0x0007022a, 
+  0x0018365b, 0x00026f87, 0x000099a5, 0x00feffff, 
+  0x00e8fbfb, 0x00cff0ee, 0x00d2f0f0, 0x00d0eeee, 
+  0x00cdedee, 0x00cceded, 0x00c9eaea, 0x00c6eae8, 
+  0x00c9eaea, 0x00bfe6e6, 0x00a1d7d6, 0x00a1d7d7, 
+  0x00bbe3e3, 0x00bbe3e1, 0x00c3e7e7, 0x00fbffff, 
+  0x00a2cbcd, 0x00060025, 0x00050021, 0x00050020, 
+  0x0005001d, 0x00050020, 0x00020035, 0x00000000, 
+  0x00000000, 0x0001003c, 0x00030015, 0x00030011, 
+  0x00030011, 0x00030011, 0x00030013, 0x00040016, 
+  0x00040017, 0x0004001a, 0x0005001d, 0x00050021, 
+  0x00060026, 0x00070029, 0x0008002f, 0x00161a48, 
+  0x00597c93, 0x00ddf2f2, 0x00ffffff, 0x00e7faf8, 
+  0x00cbeded, 0x00ccebed, 0x00ccebea, 0x00cbebeb, 
+  0x00c8eae8, 0x00c3e6e7, 0x00c3e7e7, 0x00c3eae8, 
+  0x00c1e4e6, 0x00a3d7d6, 0x00a3d7d6, 0x00b7e1e1, 
+  0x00d7f2f1, 0x00eafbfa, 0x007197a4, 0x00070029, 
+  0x00060026, 0x00060024, 0x00060022, 0x00060024, 
+  0x0000013d, 0x00000000, 0x00000000, 0x00000144, 
+  0x00040016, 0x00030013, 0x00030013, 0x00030013, 
+  0x00030015, 0x00040016, 0x00040017, 0x0004001a, 
+  0x0005001d, 0x00050021, 0x00060025, 0x00070029, 
+  0x0008002f, 0x00070033, 0x00130d40, 0x00749cab, 
+  0x00d4f0ee, 0x00ffffff, 0x00eafbfb, 0x00c8eaea, 
+  0x00c6e8e8, 0x00c6eae7, 0x00c3e7e8, 0x00c3e7e7, 
+  0x00c3e8e8, 0x00bfe6e6, 0x00bee4e4, 0x00bbe1e1, 
+  0x0092cdcf, 0x00a0d6d6, 0x00ffffff, 0x00b9e3e3, 
+  0x00485876, 0x0008002f, 0x0007002c, 0x0007002c, 
+  0x00060027, 0x00060027, 0x00000045, 0x00000000, 
+  0x00000000, 0x00000147, 0x00040017, 0x00030013, 
+  0x00030013, 0x00030015, 0x00030015, 0x00040016, 
+  0x00040018, 0x0004001a, 0x0005001d, 0x00050021, 
+  0x00060025, 0x00060027, 0x0007002f, 0x00060031, 
+  0x00060036, 0x00282659, 0x00638a9f, 0x00bad9de, 
+  0x00fbffff, 0x00f7ffff, 0x00ddf5f4, 0x00ccedeb, 
+  0x00bce4e6, 0x00bbe6e3, 0x00b8e3e3, 0x00b5dee0, 
+  0x00b4dedd, 0x00b9e1e1, 0x00cbebeb, 0x00bce3e3, 
+  0x00c5e7e7, 0x006f8ca2, 0x000d083c, 0x00080034, 
+  0x00060031, 0x00060030, 0x0006002f, 0x00050030, 
+  0x0000014d, 0x00000000, 0x00000000, 0x00000148, 
+  0x00040017, 0x00030015, 0x00030015, 0x00030015, 
+  0x00040016, 0x00040017, 0x00040018, 0x0004001a, 
+  0x0005001d, 0x00050021, 0x00060025, 0x00060027, 
+  0x0006002f, 0x00050031, 0x00020035, 0x0002003b, 
+  0x00010040, 0x002d3e70, 0x0081a9b9, 0x00d4f0ee, 
+  0x00ffffff, 0x00ffffff, 0x00eefcfc, 0x00dcf4f4, 
+  0x00d3eeed, 0x00d2eeee, 0x00ddf4f4, 0x00f2ffff, 
+  0x00ffffff, 0x00cdebeb, 0x006192a3, 0x0011134e, 
+  0x0001003d, 0x0002003a, 0x00050035, 0x00020034, 
+  0x00020034, 0x00010034, 0x00000151, 0x00000000, 
+  0x00000000, 0x00020249, 0x00040017, 0x00030015, 
+  0x00030015, 0x00030015, 0x00040016, 0x00040017, 
+  0x00040018, 0x0005001c, 0x0005001d, 0x00060022, 
+  0x00060025, 0x00060027, 0x0006002f, 0x00040031, 
+  0x00010035, 0x0002003b, 0x00000141, 0x00000045, 
+  0x00141b5f, 0x005b7d9f, 0x008abac5, 0x00c6e8e7, 
+  0x00f4ffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00e6f8f8, 0x00a8d5d8, 0x00527497, 
+  0x0014195c, 0x00000046, 0x00000141, 0x0000003f, 
+  0x0000003c, 0x0000013b, 0x0000013b, 0x0000013c, 
+  0x0000015a, 0x00000000, 0x00000000, 0x0005054a, 
+  0x00040018, 0x00030015, 0x00030015, 0x00040016, 
+  0x00040017, 0x00040017, 0x0004001a, 0x0005001d, 
+  0x00050020, 0x00060024, 0x00050026, 0x00060027, 
+  0x0004002e, 0x00010033, 0x00000236, 0x0000013c, 
+  0x00000142, 0x00000146, 0x0000014e, 0x00040559, 
+  0x00161d71, 0x0049609a, 0x006e9ab6, 0x008cc0ca, 
+  0x0099cad1, 0x0097c7cd, 0x0082b3c2, 0x00587fa5, 
+  0x00303c84, 0x0003045e, 0x00000055, 0x0000014e, 
+  0x00000248, 0x00000145, 0x00000043, 0x00000041, 
+  0x00000041, 0x00000044, 0x00010061, 0x00000000, 
+  0x00000000, 0x000a094b, 0x0002001a, 0x00040016, 
+  0x00040016, 0x00040016, 0x00040017, 0x00040018, 
+  0x0004001a, 0x0005001d, 0x00050021, 0x00050024, 
+  0x00030026, 0x0003002a, 0x0000002f, 0x00000032, 
+  0x00000038, 0x00000040, 0x00000044, 0x0000004b, 
+  0x00000155, 0x0000005a, 0x00000063, 0x00000069, 
+  0x00000070, 0x00000177, 0x0000007f, 0x0000017d, 
+  0x00000178, 0x00000070, 0x0000006a, 0x00000263, 
+  0x0000015e, 0x00000257, 0x00000155, 0x00010050, 
+  0x0000004b, 0x0001004a, 0x0001004a, 0x0000014f, 
+  0x00080963, 0x00000000, 0x00000000, 0x000d0e4f, 
+  0x0000021e, 0x00040017, 0x00040017, 0x00040018, 
+  0x00040018, 0x0004001a, 0x0005001d, 0x00040020, 
+  0x00060022, 0x00020025, 0x00020027, 0x0000002e, 
+  0x00000031, 0x00010036, 0x0000013e, 0x00000045, 
+  0x00010049, 0x00000052, 0x00000158, 0x0000005c, 
+  0x00000165, 0x0000016b, 0x00010071, 0x00010077, 
+  0x00000181, 0x00000184, 0x0000017f, 0x0000007b, 
+  0x00010071, 0x0000006c, 0x00000165, 0x00010060, 
+  0x0000005b, 0x0000015a, 0x00000057, 0x00000055, 
+  0x00000055, 0x00000058, 0x000a0b6a, 0x00000000, 
+  0x00000000, 0x00120f51, 0x0000002e, 0x0002001a, 
+  0x00030018, 0x0003001a, 0x0003001a, 0x0004001c, 
+  0x00050020, 0x00030022, 0x00020024, 0x00000126, 
+  0x0000002d, 0x00000031, 0x00000136, 0x00000139, 
+  0x00000044, 0x00000048, 0x0000014f, 0x00000057, 
+  0x0000025b, 0x00000162, 0x00010068, 0x0000036e, 
+  0x00000075, 0x0000017a, 0x00020180, 0x00010384, 
+  0x00010384, 0x0002017f, 0x0000017a, 0x00000075, 
+  0x00000170, 0x0002006b, 0x00000065, 0x00000063, 
+  0x0000015f, 0x0000015e, 0x0000015e, 0x00050262, 
+  0x0016156d, 0x00000000, 0x00000000, 0x00181649, 
+  0x000f124e, 0x0000002e, 0x00000122, 0x0000021e, 
+  0x00020020, 0x00000122, 0x00000026, 0x00000027, 
+  0x00000129, 0x0000012f, 0x00000134, 0x0002003a, 
+  0x0001003c, 0x00000048, 0x0000024b, 0x00000154, 
+  0x00000058, 0x0000015d, 0x00020062, 0x00010267, 
+  0x0003056d, 0x00020471, 0x00040377, 0x00060579, 
+  0x0005067e, 0x0008087f, 0x00080984, 0x0008087f, 
+  0x0005067e, 0x00050479, 0x00040476, 0x00020372, 
+  0x0005066d, 0x0003056d, 0x0000006c, 0x00020368, 
+  0x00070867, 0x0014166d, 0x001d1958, 0x00000000, 
+  0x00000000, 0x00012036, 0x0017154a, 0x00181557, 
+  0x000e0f4b, 0x000c0b45, 0x00090946, 0x00080847, 
+  0x0009084a, 0x000a094b, 0x000a084d, 0x000a0c4f, 
+  0x00090a52, 0x000a0a58, 0x0009095c, 0x000a0b5d, 
+  0x000a0a62, 0x000b0c66, 0x000e0e69, 0x000e0e6b, 
+  0x000f106d, 0x0011126f, 0x00131473, 0x00151475, 
+  0x0015157a, 0x0016167c, 0x00181781, 0x001b1b80, 
+  0x001b1b80, 0x001b1b80, 0x001a1b80, 0x0018187e, 
+  0x0016187b, 0x0015157a, 0x00151578, 0x00141475, 
+  0x00141574, 0x00171872, 0x00211f70, 0x001c1a5a, 
+  0x00031a33, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 
+  
+  // End of bitmap
+};
+
+OskImgData s_imgMouse =
+{
+  .width = 42,
+  .height = 42,
+  .bitmap = s_bitmapMouse,
+};
+
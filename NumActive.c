@@ -0,0 +1,3985 @@
+// This file is auto-generated. DO NOT edit.
+#include "oskimg.h"
+
+static unsigned int s_bitmapNumActive[ 15876 ] =
+{
+  0x000e2a34, 0x000c2c36, 0x00102731, 0x001d282f, 
+  0x0027252b, 0x0028252b, 0x0028262b, 0x0027252b, 
+  0x0027252b, 0x0025242b, 0x00272628, 0x00252329, 
+  0x00252329, 0x00252329, 0x00242328, 0x00242228, 
+  0x00222128, 0x00232228, 0x00232127, 0x00211f27, 
+  0x00201e26, 0x00201e26, 0x00201e26, 0x001f1d26, 
+  0x001e1d26, 0x001f1d25, 0x001e1c26, 0x001c1c24, 
+  0x001c1c23, 0x001c1a23, 0x001c1a22, 0x001a1923, 
+  0x001a1922, 0x001a1922, 0x001a1921, 0x00191821, 
+  0x001a1721, 0x001a1922, 0x00161f29, 0x000e242d, 
+  0x000c2c35, 0x000e2a34, 0x000e2a34, 0x000c2c36, 
+  0x00102731, 0x001d282f, 0x0027252b, 0x0028252b, 
+  0x0028262b, 0x0027252b, 0x0027252b, 0x0025242b, 
+  0x00272628, 0x00252329, 0x00252329, 0x00252329, 
+  0x00242328, 0x00242228, 0x00222128, 0x00232228, 
+  0x00232127, 0x00211f27, 0x00201e26, 0x00201e26, 
+  0x00201e26, 0x001f1d26, 0x001e1d26, 0x001f1d25, 
+  0x001e1c26, 0x001c1c24, 0x001c1c23, 0x001c1a23, 
+  0x001c1a22, 0x001a1923, 0x001a1922, 0x001a1922, 
+  0x001a1921, 0x00191821, 0x001a1721, 0x001a1922, 
+  0x00161f29, 0x000e242d, 0x000c2c35, 0x000e2a34, 
+  0x000e2a34, 0x000c2c36, 0x00102731, 0x001d282f, 
+  0x0027252b, 0x0028252b, 0x0028262b, 0x0027252b, 
+  0x0027252b, 0x0025242b, 0x00272628, 0x00252329, 
+  0x00252329, 0x00252329, 0x00242328, 0x00242228, 
+  0x00222128, 0x00232228, 0x00232127, 0x00211f27, 
+  0x00201e26, 0x00201e26, 0x00201e26, 0x001f1d26, 
+  0x001e1d26, 0x001f1d25, 0x001e1c26, 0x001c1c24, 
+  0x001c1c23, 0x001c1a23, 0x001c1a22, 0x001a1923, 
+  0x001a1922, 0x001a1922, 0x001a1921, 0x00191821, 
+  0x001a1721, 0x001a1922, 0x00161f29, 0x000e242d, 
+  0x000c2c35, 0x000e2a34, 0x000c2d36, 0x002b555d, 
+  0x005a596a, 0x00646279, 0x005f5f7e, 0x005d5e81, 
+  0x00595982, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00555783, 0x00535383, 0x00525284, 0x00535184, 
+  0x004e4e83, 0x004d4d82, 0x004b4c80, 0x00464881, 
+  0x00454780, 0x0044447f, 0x0048457d, 0x0044437b, 
+  0x00434378, 0x00434279, 0x00424178, 0x00414077, 
+  0x003d3e75, 0x003d3e74, 0x003c3d73, 0x003a3b72, 
+  0x0039386f, 0x0039396c, 0x0039396c, 0x003b3c6e, 
+  0x003d3d6d, 0x003c3a63, 0x001f3f4f, 0x000c2d35, 
+  0x000c2d36, 0x002b555d, 0x005a596a, 0x00646279, 
+  0x005f5f7e, 0x005d5e81, 0x00595982, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00555783, 0x00535383, 
+  0x00525284, 0x00535184, 0x004e4e83, 0x004d4d82, 
+  0x004b4c80, 0x00464881, 0x00454780, 0x0044447f, 
+  0x0048457d, 0x0044437b, 0x00434378, 0x00434279, 
+  0x00424178, 0x00414077, 0x003d3e75, 0x003d3e74, 
+  0x003c3d73, 0x003a3b72, 0x0039386f, 0x0039396c, 
+  0x0039396c, 0x003b3c6e, 0x003d3d6d, 0x003c3a63, 
+  0x001f3f4f, 0x000c2d35, 0x000c2d36, 0x002b555d, 
+  0x005a596a, 0x00646279, 0x005f5f7e, 0x005d5e81, 
+  0x00595982, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00555783, 0x00535383, 0x00525284, 0x00535184, 
+  0x004e4e83, 0x004d4d82, 0x004b4c80, 0x00464881, 
+  0x00454780, 0x0044447f, 0x0048457d, 0x0044437b, 
+  0x00434378, 0x00434279, 0x00424178, 0x00414077, 
+  0x003d3e75, 0x003d3e74, 0x003c3d73, 0x003a3b72, 
+  0x0039386f, 0x0039396c, 0x0039396c, 0x003b3c6e, 
+  0x003d3d6d, 0x003c3a63, 0x001f3f4f, 0x000c2d35, 
+  0x0010282f, 0x0057576b, 0x00615e7c, 0x0050517e, 
+  0x0048497f, 0x0047487f, 0x0044447f, 0x00444481, 
+  0x00444481, 0x00434382, 0x00434382, 0x00444385, 
+  0x00434286, 0x00444287, 0x003f4088, 0x00413f86, 
+  0x003d3d84, 0x00393c83, 0x00393980, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00343277, 0x00333176, 
+  0x002e2e75, 0x002d2e71, 0x002d2e6f, 0x002c2d6b, 
+  0x002a2969, 0x00292868, 0x00282865, 0x002a2a5d, 
+  0x0028285b, 0x00262858, 0x00252757, 0x00262754, 
+  0x0026264f, 0x0027294f, 0x00292a57, 0x00363669, 
+  0x003b3661, 0x000d2129, 0x0010282f, 0x0057576b, 
+  0x00615e7c, 0x0050517e, 0x0048497f, 0x0047487f, 
+  0x0044447f, 0x00444481, 0x00444481, 0x00434382, 
+  0x00434382, 0x00444385, 0x00434286, 0x00444287, 
+  0x003f4088, 0x00413f86, 0x003d3d84, 0x00393c83, 
+  0x00393980, 0x0038387d, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00333176, 0x002e2e75, 0x002d2e71, 
+  0x002d2e6f, 0x002c2d6b, 0x002a2969, 0x00292868, 
+  0x00282865, 0x002a2a5d, 0x0028285b, 0x00262858, 
+  0x00252757, 0x00262754, 0x0026264f, 0x0027294f, 
+  0x00292a57, 0x00363669, 0x003b3661, 0x000d2129, 
+  0x0010282f, 0x0057576b, 0x00615e7c, 0x0050517e, 
+  0x0048497f, 0x0047487f, 0x0044447f, 0x00444481, 
+  0x00444481, 0x00434382, 0x00434382, 0x00444385, 
+  0x00434286, 0x00444287, 0x003f4088, 0x00413f86, 
+  0x003d3d84, 0x00393c83, 0x00393980, 0x00ffffff, 
+  0x00ffffff, 0x0035337a, 0x00ffffff, 0x00ffffff, 
+  0x002e2e75, 0x002d2e71, 0x002d2e6f, 0x002c2d6b, 
+  0x002a2969, 0x00292868, 0x00282865, 0x002a2a5d, 
+  0x0028285b, 0x00262858, 0x00252757, 0x00262754, 
+  0x0026264f, 0x0027294f, 0x00292a57, 0x00363669, 
+  0x003b3661, 0x000d2129, 0x001c262e, 0x005e587b, 
+  0x004d4e7b, 0x0047457a, 0x0040407b, 0x003f3f7c, 
+  0x003f3e7e, 0x003a3c7f, 0x003a3c7f, 0x00393a82, 
+  0x00393c83, 0x00393b85, 0x00383a87, 0x00383a89, 
+  0x0035378e, 0x00373988, 0x00313389, 0x00313387, 
+  0x00ffffff, 0x00302f7d, 0x002c2e7b, 0x002b2b79, 
+  0x00ffffff, 0x002b2b72, 0x00272670, 0x0026266d, 
+  0x0024246b, 0x00222269, 0x00212166, 0x00212260, 
+  0x0020235d, 0x00242557, 0x00201f56, 0x0021224f, 
+  0x0022204b, 0x00222049, 0x00222048, 0x00212046, 
+  0x00222048, 0x0026264f, 0x0036356c, 0x00141c2a, 
+  0x001c262e, 0x005e587b, 0x004d4e7b, 0x0047457a, 
+  0x0040407b, 0x003f3f7c, 0x003f3e7e, 0x003a3c7f, 
+  0x003a3c7f, 0x00393a82, 0x00393c83, 0x00393b85, 
+  0x00383a87, 0x00383a89, 0x0035378e, 0x00373988, 
+  0x00313389, 0x00313387, 0x00333182, 0x00ffffff, 
+  0x002c2e7b, 0x002b2b79, 0x002b2c77, 0x002b2b72, 
+  0x00272670, 0x0026266d, 0x0024246b, 0x00222269, 
+  0x00212166, 0x00212260, 0x0020235d, 0x00242557, 
+  0x00201f56, 0x0021224f, 0x0022204b, 0x00222049, 
+  0x00222048, 0x00212046, 0x00222048, 0x0026264f, 
+  0x0036356c, 0x00141c2a, 0x001c262e, 0x005e587b, 
+  0x004d4e7b, 0x0047457a, 0x0040407b, 0x003f3f7c, 
+  0x003f3e7e, 0x003a3c7f, 0x003a3c7f, 0x00393a82, 
+  0x00393c83, 0x00393b85, 0x00383a87, 0x00383a89, 
+  0x0035378e, 0x00373988, 0x00313389, 0x00313387, 
+  0x00333182, 0x00ffffff, 0x002c2e7b, 0x002b2b79, 
+  0x00ffffff, 0x002b2b72, 0x00272670, 0x0026266d, 
+  0x0024246b, 0x00222269, 0x00212166, 0x00212260, 
+  0x0020235d, 0x00242557, 0x00201f56, 0x0021224f, 
+  0x0022204b, 0x00222049, 0x00222048, 0x00212046, 
+  0x00222048, 0x0026264f, 0x0036356c, 0x00141c2a, 
+  0x00222228, 0x0055557e, 0x00434378, 0x003a3b79, 
+  0x003a3b79, 0x0035377a, 0x0035377a, 0x0035367c, 
+  0x0033357f, 0x00323481, 0x00313285, 0x00313387, 
+  0x00303289, 0x0030318b, 0x002f2f90, 0x002e2f8c, 
+  0x002f2d8a, 0x002e2d86, 0x00282985, 0x00282881, 
+  0x0028297e, 0x0023257b, 0x00ffffff, 0x00222270, 
+  0x0020226e, 0x0020216a, 0x001f2069, 0x001e2063, 
+  0x001e1f60, 0x001d1c5c, 0x001c1c57, 0x00201e51, 
+  0x001c1c4f, 0x001a1c4c, 0x001b1c49, 0x001b1c44, 
+  0x00191a42, 0x00191b41, 0x00191b41, 0x001b1c48, 
+  0x00262861, 0x00171529, 0x00222228, 0x0055557e, 
+  0x00434378, 0x003a3b79, 0x003a3b79, 0x0035377a, 
+  0x0035377a, 0x0035367c, 0x0033357f, 0x00323481, 
+  0x00313285, 0x00313387, 0x00303289, 0x0030318b, 
+  0x002f2f90, 0x002e2f8c, 0x002f2d8a, 0x002e2d86, 
+  0x00ffffff, 0x00282881, 0x0028297e, 0x0023257b, 
+  0x00262473, 0x00222270, 0x0020226e, 0x0020216a, 
+  0x001f2069, 0x001e2063, 0x001e1f60, 0x001d1c5c, 
+  0x001c1c57, 0x00201e51, 0x001c1c4f, 0x001a1c4c, 
+  0x001b1c49, 0x001b1c44, 0x00191a42, 0x00191b41, 
+  0x00191b41, 0x001b1c48, 0x00262861, 0x00171529, 
+  0x00222228, 0x0055557e, 0x00434378, 0x003a3b79, 
+  0x003a3b79, 0x0035377a, 0x0035377a, 0x0035367c, 
+  0x0033357f, 0x00323481, 0x00313285, 0x00313387, 
+  0x00303289, 0x0030318b, 0x002f2f90, 0x002e2f8c, 
+  0x002f2d8a, 0x002e2d86, 0x00282985, 0x00ffffff, 
+  0x0028297e, 0x0023257b, 0x00ffffff, 0x00222270, 
+  0x0020226e, 0x0020216a, 0x001f2069, 0x001e2063, 
+  0x001e1f60, 0x001d1c5c, 0x001c1c57, 0x00201e51, 
+  0x001c1c4f, 0x001a1c4c, 0x001b1c49, 0x001b1c44, 
+  0x00191a42, 0x00191b41, 0x00191b41, 0x001b1c48, 
+  0x00262861, 0x00171529, 0x00201f26, 0x004e4e7e, 
+  0x00393a78, 0x00363577, 0x00343377, 0x00343277, 
+  0x00313178, 0x0031307a, 0x0031307c, 0x00302f7d, 
+  0x002a2c83, 0x002a2b85, 0x00292a89, 0x00282a8d, 
+  0x0028298e, 0x0028298e, 0x0027298c, 0x0025258a, 
+  0x00222285, 0x00222380, 0x00201f7f, 0x00ffffff, 
+  0x001d1f75, 0x001e1d71, 0x001c1e6d, 0x001a186c, 
+  0x001a1965, 0x00171860, 0x0015155e, 0x00151659, 
+  0x00141753, 0x0016184e, 0x0016194b, 0x00161749, 
+  0x00171643, 0x0016143f, 0x0017153e, 0x0017153e, 
+  0x0017153d, 0x0017173f, 0x001f205c, 0x00131126, 
+  0x00201f26, 0x004e4e7e, 0x00393a78, 0x00363577, 
+  0x00343377, 0x00343277, 0x00313178, 0x0031307a, 
+  0x0031307c, 0x00302f7d, 0x002a2c83, 0x002a2b85, 
+  0x00292a89, 0x00282a8d, 0x0028298e, 0x0028298e, 
+  0x0027298c, 0x0025258a, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x001d1f75, 0x001e1d71, 
+  0x001c1e6d, 0x001a186c, 0x001a1965, 0x00171860, 
+  0x0015155e, 0x00151659, 0x00141753, 0x0016184e, 
+  0x0016194b, 0x00161749, 0x00171643, 0x0016143f, 
+  0x0017153e, 0x0017153e, 0x0017153d, 0x0017173f, 
+  0x001f205c, 0x00131126, 0x00201f26, 0x004e4e7e, 
+  0x00393a78, 0x00363577, 0x00343377, 0x00343277, 
+  0x00313178, 0x0031307a, 0x0031307c, 0x00302f7d, 
+  0x002a2c83, 0x002a2b85, 0x00292a89, 0x00282a8d, 
+  0x0028298e, 0x0028298e, 0x0027298c, 0x0025258a, 
+  0x00222285, 0x00222380, 0x00201f7f, 0x001d1e7a, 
+  0x001d1f75, 0x001e1d71, 0x001c1e6d, 0x001a186c, 
+  0x001a1965, 0x00171860, 0x0015155e, 0x00151659, 
+  0x00141753, 0x0016184e, 0x0016194b, 0x00161749, 
+  0x00171643, 0x0016143f, 0x0017153e, 0x0017153e, 
+  0x0017153d, 0x0017173f, 0x001f205c, 0x00131126, 
+  0x001f1d25, 0x0047487c, 0x00353476, 0x00323175, 
+  0x002d2d76, 0x002c2d76, 0x002b2c77, 0x00292978, 
+  0x0029287c, 0x0028297e, 0x0027277f, 0x00272684, 
+  0x00272686, 0x0025258a, 0x0021218e, 0x00202194, 
+  0x001d1e8f, 0x001c1f8c, 0x001a1a89, 0x001c1d82, 
+  0x00ffffff, 0x0018187b, 0x00191a74, 0x0017176f, 
+  0x0018176d, 0x00161665, 0x00131361, 0x0014155e, 
+  0x0011145b, 0x00131553, 0x00121151, 0x0015144c, 
+  0x00111047, 0x00111143, 0x0011123f, 0x000e103e, 
+  0x000f103d, 0x000f103d, 0x000f103a, 0x0012113e, 
+  0x00191958, 0x00110f25, 0x001f1d25, 0x0047487c, 
+  0x00353476, 0x00323175, 0x002d2d76, 0x002c2d76, 
+  0x002b2c77, 0x00292978, 0x0029287c, 0x0028297e, 
+  0x0027277f, 0x00272684, 0x00272686, 0x0025258a, 
+  0x0021218e, 0x00202194, 0x001d1e8f, 0x001c1f8c, 
+  0x00ffffff, 0x001c1d82, 0x001c1c7d, 0x0018187b, 
+  0x00ffffff, 0x0017176f, 0x0018176d, 0x00161665, 
+  0x00131361, 0x0014155e, 0x0011145b, 0x00131553, 
+  0x00121151, 0x0015144c, 0x00111047, 0x00111143, 
+  0x0011123f, 0x000e103e, 0x000f103d, 0x000f103d, 
+  0x000f103a, 0x0012113e, 0x00191958, 0x00110f25, 
+  0x001f1d25, 0x0047487c, 0x00353476, 0x00323175, 
+  0x002d2d76, 0x002c2d76, 0x002b2c77, 0x00292978, 
+  0x0029287c, 0x0028297e, 0x0027277f, 0x00272684, 
+  0x00272686, 0x0025258a, 0x0021218e, 0x00202194, 
+  0x001d1e8f, 0x001c1f8c, 0x001a1a89, 0x001c1d82, 
+  0x001c1c7d, 0x0018187b, 0x00191a74, 0x0017176f, 
+  0x0018176d, 0x00161665, 0x00131361, 0x0014155e, 
+  0x0011145b, 0x00131553, 0x00121151, 0x0015144c, 
+  0x00111047, 0x00111143, 0x0011123f, 0x000e103e, 
+  0x000f103d, 0x000f103d, 0x000f103a, 0x0012113e, 
+  0x00191958, 0x00110f25, 0x001c1a23, 0x0044437b, 
+  0x002e2e75, 0x002c2c71, 0x002b2c6f, 0x00272670, 
+  0x00262573, 0x00262573, 0x00242379, 0x0023227b, 
+  0x0023217e, 0x00242181, 0x00202186, 0x001e1d88, 
+  0x001b1d8f, 0x001a1c91, 0x00181892, 0x0018188d, 
+  0x00171889, 0x00ffffff, 0x0015167f, 0x00151778, 
+  0x00141374, 0x00111271, 0x0010106d, 0x00101164, 
+  0x00101261, 0x000f115d, 0x000f1059, 0x000f0d52, 
+  0x000e0d4f, 0x000b0c4b, 0x000d0e45, 0x000c0d41, 
+  0x000a0f3f, 0x000b0c3e, 0x000c0d39, 0x000c0d39, 
+  0x000c0d39, 0x000f0e3b, 0x00171952, 0x000e0e24, 
+  0x001c1a23, 0x0044437b, 0x002e2e75, 0x002c2c71, 
+  0x002b2c6f, 0x00272670, 0x00262573, 0x00262573, 
+  0x00242379, 0x0023227b, 0x0023217e, 0x00242181, 
+  0x00202186, 0x001e1d88, 0x001b1d8f, 0x001a1c91, 
+  0x00181892, 0x0018188d, 0x00ffffff, 0x00151584, 
+  0x0015167f, 0x00151778, 0x00ffffff, 0x00111271, 
+  0x0010106d, 0x00101164, 0x00101261, 0x000f115d, 
+  0x000f1059, 0x000f0d52, 0x000e0d4f, 0x000b0c4b, 
+  0x000d0e45, 0x000c0d41, 0x000a0f3f, 0x000b0c3e, 
+  0x000c0d39, 0x000c0d39, 0x000c0d39, 0x000f0e3b, 
+  0x00171952, 0x000e0e24, 0x001c1a23, 0x0044437b, 
+  0x002e2e75, 0x002c2c71, 0x002b2c6f, 0x00272670, 
+  0x00262573, 0x00262573, 0x00242379, 0x0023227b, 
+  0x0023217e, 0x00242181, 0x00202186, 0x001e1d88, 
+  0x001b1d8f, 0x001a1c91, 0x00181892, 0x0018188d, 
+  0x00171889, 0x00151584, 0x0015167f, 0x00151778, 
+  0x00141374, 0x00111271, 0x0010106d, 0x00101164, 
+  0x00101261, 0x000f115d, 0x000f1059, 0x000f0d52, 
+  0x000e0d4f, 0x000b0c4b, 0x000d0e45, 0x000c0d41, 
+  0x000a0f3f, 0x000b0c3e, 0x000c0d39, 0x000c0d39, 
+  0x000c0d39, 0x000f0e3b, 0x00171952, 0x000e0e24, 
+  0x001a1922, 0x003b3e7a, 0x002b2c6f, 0x0029276c, 
+  0x0023246d, 0x0023246d, 0x0020226e, 0x001f1e72, 
+  0x001d1f75, 0x001c1d7a, 0x001c1d7c, 0x001b1d80, 
+  0x00191a83, 0x00181888, 0x0017178c, 0x00151591, 
+  0x00151693, 0x00131592, 0x00ffffff, 0x00111285, 
+  0x00101180, 0x000d0d7a, 0x00ffffff, 0x000c0e71, 
+  0x000d0e6a, 0x000c0e64, 0x00090962, 0x000b095d, 
+  0x00080856, 0x00080954, 0x00090a4d, 0x00070849, 
+  0x000a0b42, 0x00090840, 0x0009083f, 0x000b083a, 
+  0x00080838, 0x000b0934, 0x000b0934, 0x00090939, 
+  0x00131652, 0x000c0c25, 0x001a1922, 0x003b3e7a, 
+  0x002b2c6f, 0x0029276c, 0x0023246d, 0x0023246d, 
+  0x0020226e, 0x001f1e72, 0x001d1f75, 0x001c1d7a, 
+  0x001c1d7c, 0x001b1d80, 0x00191a83, 0x00181888, 
+  0x0017178c, 0x00151591, 0x00151693, 0x00131592, 
+  0x00ffffff, 0x00111285, 0x00101180, 0x000d0d7a, 
+  0x00ffffff, 0x000c0e71, 0x000d0e6a, 0x000c0e64, 
+  0x00090962, 0x000b095d, 0x00080856, 0x00080954, 
+  0x00090a4d, 0x00070849, 0x000a0b42, 0x00090840, 
+  0x0009083f, 0x000b083a, 0x00080838, 0x000b0934, 
+  0x000b0934, 0x00090939, 0x00131652, 0x000c0c25, 
+  0x001a1922, 0x003b3e7a, 0x002b2c6f, 0x0029276c, 
+  0x0023246d, 0x0023246d, 0x0020226e, 0x001f1e72, 
+  0x001d1f75, 0x001c1d7a, 0x001c1d7c, 0x001b1d80, 
+  0x00191a83, 0x00181888, 0x0017178c, 0x00151591, 
+  0x00151693, 0x00131592, 0x0012128b, 0x00111285, 
+  0x00101180, 0x000d0d7a, 0x000f1075, 0x000c0e71, 
+  0x000d0e6a, 0x000c0e64, 0x00090962, 0x000b095d, 
+  0x00080856, 0x00080954, 0x00090a4d, 0x00070849, 
+  0x000a0b42, 0x00090840, 0x0009083f, 0x000b083a, 
+  0x00080838, 0x000b0934, 0x000b0934, 0x00090939, 
+  0x00131652, 0x000c0c25, 0x00191721, 0x00393a78, 
+  0x0028266b, 0x0021246b, 0x0020216a, 0x001c1e6b, 
+  0x001c1e6b, 0x001a1b6e, 0x001a1c70, 0x00191a74, 
+  0x00181978, 0x0017187d, 0x00141481, 0x00141584, 
+  0x00121289, 0x0011128f, 0x00100f98, 0x00111094, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00080972, 0x000b0c6b, 0x00070764, 
+  0x00050562, 0x0005055d, 0x00050756, 0x00050751, 
+  0x0004054e, 0x00060547, 0x00030442, 0x00010140, 
+  0x0000003b, 0x0005033a, 0x00040436, 0x00040235, 
+  0x00060436, 0x000b083a, 0x00121153, 0x00060621, 
+  0x00191721, 0x00393a78, 0x0028266b, 0x0021246b, 
+  0x0020216a, 0x001c1e6b, 0x001c1e6b, 0x001a1b6e, 
+  0x001a1c70, 0x00191a74, 0x00181978, 0x0017187d, 
+  0x00141481, 0x00141584, 0x00121289, 0x0011128f, 
+  0x00100f98, 0x00111094, 0x000c0e90, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00090976, 0x00080972, 
+  0x000b0c6b, 0x00070764, 0x00050562, 0x0005055d, 
+  0x00050756, 0x00050751, 0x0004054e, 0x00060547, 
+  0x00030442, 0x00010140, 0x0000003b, 0x0005033a, 
+  0x00040436, 0x00040235, 0x00060436, 0x000b083a, 
+  0x00121153, 0x00060621, 0x00191721, 0x00393a78, 
+  0x0028266b, 0x0021246b, 0x0020216a, 0x001c1e6b, 
+  0x001c1e6b, 0x001a1b6e, 0x001a1c70, 0x00191a74, 
+  0x00181978, 0x0017187d, 0x00141481, 0x00141584, 
+  0x00121289, 0x0011128f, 0x00100f98, 0x00111094, 
+  0x000c0e90, 0x000c0b89, 0x000b0b84, 0x0008087f, 
+  0x00090976, 0x00080972, 0x000b0c6b, 0x00070764, 
+  0x00050562, 0x0005055d, 0x00050756, 0x00050751, 
+  0x0004054e, 0x00060547, 0x00030442, 0x00010140, 
+  0x0000003b, 0x0005033a, 0x00040436, 0x00040235, 
+  0x00060436, 0x000b083a, 0x00121153, 0x00060621, 
+  0x00161520, 0x00353476, 0x00202069, 0x001e2063, 
+  0x001b1a64, 0x001b1a64, 0x001a1965, 0x0014146d, 
+  0x0014146f, 0x00131370, 0x00141374, 0x00121278, 
+  0x000e0e7e, 0x000c0c83, 0x000c0c86, 0x000a0c8e, 
+  0x00080b94, 0x0007099a, 0x00070993, 0x0006078d, 
+  0x00050588, 0x00060680, 0x00070877, 0x00010273, 
+  0x0003026d, 0x00050465, 0x00020263, 0x00030559, 
+  0x00030256, 0x00020251, 0x0000004e, 0x00020047, 
+  0x00020040, 0x0000023c, 0x00000038, 0x00000136, 
+  0x00000135, 0x00010236, 0x00010033, 0x00010025, 
+  0x00020028, 0x00050111, 0x00161520, 0x00353476, 
+  0x00202069, 0x001e2063, 0x001b1a64, 0x001b1a64, 
+  0x001a1965, 0x0014146d, 0x0014146f, 0x00131370, 
+  0x00141374, 0x00121278, 0x000e0e7e, 0x000c0c83, 
+  0x000c0c86, 0x000a0c8e, 0x00080b94, 0x0007099a, 
+  0x00070993, 0x0006078d, 0x00050588, 0x00060680, 
+  0x00070877, 0x00010273, 0x0003026d, 0x00050465, 
+  0x00020263, 0x00030559, 0x00030256, 0x00020251, 
+  0x0000004e, 0x00020047, 0x00020040, 0x0000023c, 
+  0x00000038, 0x00000136, 0x00000135, 0x00010236, 
+  0x00010033, 0x00010025, 0x00020028, 0x00050111, 
+  0x00161520, 0x00353476, 0x00202069, 0x001e2063, 
+  0x001b1a64, 0x001b1a64, 0x001a1965, 0x0014146d, 
+  0x0014146f, 0x00131370, 0x00141374, 0x00121278, 
+  0x000e0e7e, 0x000c0c83, 0x000c0c86, 0x000a0c8e, 
+  0x00080b94, 0x0007099a, 0x00070993, 0x0006078d, 
+  0x00050588, 0x00060680, 0x00070877, 0x00010273, 
+  0x0003026d, 0x00050465, 0x00020263, 0x00030559, 
+  0x00030256, 0x00020251, 0x0000004e, 0x00020047, 
+  0x00020040, 0x0000023c, 0x00000038, 0x00000136, 
+  0x00000135, 0x00010236, 0x00010033, 0x00010025, 
+  0x00020028, 0x00050111, 0x0014111e, 0x002e2e75, 
+  0x001d1e61, 0x00171860, 0x00151661, 0x00131361, 
+  0x00131361, 0x00101164, 0x000f106a, 0x000e0f6e, 
+  0x000d0f72, 0x000b0b76, 0x000a0a7a, 0x00080881, 
+  0x00080785, 0x0005068c, 0x00040594, 0x00040597, 
+  0x00020397, 0x0003058f, 0x00030288, 0x00000283, 
+  0x00000079, 0x00000072, 0x0000006a, 0x00000166, 
+  0x00010060, 0x00020058, 0x00050053, 0x0001004e, 
+  0x00010049, 0x00000241, 0x0002003c, 0x00000138, 
+  0x00000137, 0x00000234, 0x0002002e, 0x00030018, 
+  0x00010007, 0x00000000, 0x00030014, 0x00050111, 
+  0x0014111e, 0x002e2e75, 0x001d1e61, 0x00171860, 
+  0x00151661, 0x00131361, 0x00131361, 0x00101164, 
+  0x000f106a, 0x000e0f6e, 0x000d0f72, 0x000b0b76, 
+  0x000a0a7a, 0x00080881, 0x00080785, 0x0005068c, 
+  0x00040594, 0x00040597, 0x00020397, 0x0003058f, 
+  0x00030288, 0x00000283, 0x00000079, 0x00000072, 
+  0x0000006a, 0x00000166, 0x00010060, 0x00020058, 
+  0x00050053, 0x0001004e, 0x00010049, 0x00000241, 
+  0x0002003c, 0x00000138, 0x00000137, 0x00000234, 
+  0x0002002e, 0x00030018, 0x00010007, 0x00000000, 
+  0x00030014, 0x00050111, 0x0014111e, 0x002e2e75, 
+  0x001d1e61, 0x00171860, 0x00151661, 0x00131361, 
+  0x00131361, 0x00101164, 0x000f106a, 0x000e0f6e, 
+  0x000d0f72, 0x000b0b76, 0x000a0a7a, 0x00080881, 
+  0x00080785, 0x0005068c, 0x00040594, 0x00040597, 
+  0x00020397, 0x0003058f, 0x00030288, 0x00000283, 
+  0x00000079, 0x00000072, 0x0000006a, 0x00000166, 
+  0x00010060, 0x00020058, 0x00050053, 0x0001004e, 
+  0x00010049, 0x00000241, 0x0002003c, 0x00000138, 
+  0x00000137, 0x00000234, 0x0002002e, 0x00030018, 
+  0x00010007, 0x00000000, 0x00030014, 0x00050111, 
+  0x0013111d, 0x002b2c6f, 0x001a185f, 0x0012155c, 
+  0x0011135d, 0x000f115d, 0x000f115d, 0x000e0d61, 
+  0x000c0e64, 0x000c0e65, 0x000a0c6f, 0x00080972, 
+  0x00070877, 0x0006067b, 0x00040582, 0x00030288, 
+  0x00020290, 0x00000096, 0x0001009a, 0x00010093, 
+  0x0000028a, 0x00010081, 0x00000078, 0x00000070, 
+  0x00000168, 0x00000062, 0x00000059, 0x00010054, 
+  0x0000004f, 0x0000004a, 0x00010047, 0x0001003f, 
+  0x0001003c, 0x00020030, 0x00030021, 0x00030012, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00050111, 0x0013111d, 0x002b2c6f, 
+  0x001a185f, 0x0012155c, 0x0011135d, 0x000f115d, 
+  0x000f115d, 0x000e0d61, 0x000c0e64, 0x000c0e65, 
+  0x000a0c6f, 0x00080972, 0x00070877, 0x0006067b, 
+  0x00040582, 0x00030288, 0x00020290, 0x00000096, 
+  0x0001009a, 0x00010093, 0x0000028a, 0x00010081, 
+  0x00000078, 0x00000070, 0x00000168, 0x00000062, 
+  0x00000059, 0x00010054, 0x0000004f, 0x0000004a, 
+  0x00010047, 0x0001003f, 0x0001003c, 0x00020030, 
+  0x00030021, 0x00030012, 0x00000003, 0x00000000, 
+  0x00000000, 0x00000001, 0x00040018, 0x00050111, 
+  0x0013111d, 0x002b2c6f, 0x001a185f, 0x0012155c, 
+  0x0011135d, 0x000f115d, 0x000f115d, 0x000e0d61, 
+  0x000c0e64, 0x000c0e65, 0x000a0c6f, 0x00080972, 
+  0x00070877, 0x0006067b, 0x00040582, 0x00030288, 
+  0x00020290, 0x00000096, 0x0001009a, 0x00010093, 
+  0x0000028a, 0x00010081, 0x00000078, 0x00000070, 
+  0x00000168, 0x00000062, 0x00000059, 0x00010054, 
+  0x0000004f, 0x0000004a, 0x00010047, 0x0001003f, 
+  0x0001003c, 0x00020030, 0x00030021, 0x00030012, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00050111, 0x00100e1c, 0x0029276c, 
+  0x0012135b, 0x00111054, 0x000c0d55, 0x000c0a5b, 
+  0x000b095d, 0x000b095d, 0x00050562, 0x00060565, 
+  0x00040667, 0x00030171, 0x00010275, 0x00000079, 
+  0x0000027d, 0x00000184, 0x0000028a, 0x0000028f, 
+  0x00000195, 0x00000190, 0x00000187, 0x00000080, 
+  0x00010078, 0x0000016f, 0x00000067, 0x0000015e, 
+  0x00000058, 0x00000152, 0x00000050, 0x00000149, 
+  0x00000040, 0x0001002a, 0x0004001b, 0x0002000c, 
+  0x00000003, 0x00000000, 0x00000001, 0x00000001, 
+  0x00000001, 0x00000003, 0x0004001b, 0x00040112, 
+  0x00100e1c, 0x0029276c, 0x0012135b, 0x00111054, 
+  0x000c0d55, 0x000c0a5b, 0x000b095d, 0x000b095d, 
+  0x00050562, 0x00060565, 0x00040667, 0x00030171, 
+  0x00010275, 0x00000079, 0x0000027d, 0x00000184, 
+  0x0000028a, 0x0000028f, 0x00000195, 0x00000190, 
+  0x00000187, 0x00000080, 0x00010078, 0x0000016f, 
+  0x00000067, 0x0000015e, 0x00000058, 0x00000152, 
+  0x00000050, 0x00000149, 0x00000040, 0x0001002a, 
+  0x0004001b, 0x0002000c, 0x00000003, 0x00000000, 
+  0x00000001, 0x00000001, 0x00000001, 0x00000003, 
+  0x0004001b, 0x00040112, 0x00100e1c, 0x0029276c, 
+  0x0012135b, 0x00111054, 0x000c0d55, 0x000c0a5b, 
+  0x000b095d, 0x000b095d, 0x00050562, 0x00060565, 
+  0x00040667, 0x00030171, 0x00010275, 0x00000079, 
+  0x0000027d, 0x00000184, 0x0000028a, 0x0000028f, 
+  0x00000195, 0x00000190, 0x00000187, 0x00000080, 
+  0x00010078, 0x0000016f, 0x00000067, 0x0000015e, 
+  0x00000058, 0x00000152, 0x00000050, 0x00000149, 
+  0x00000040, 0x0001002a, 0x0004001b, 0x0002000c, 
+  0x00000003, 0x00000000, 0x00000001, 0x00000001, 
+  0x00000001, 0x00000003, 0x0004001b, 0x00040112, 
+  0x000f0c1b, 0x0021246b, 0x00111054, 0x000d0c50, 
+  0x000a0a51, 0x00080954, 0x00050754, 0x00040558, 
+  0x0003045e, 0x00020360, 0x00010366, 0x00000168, 
+  0x0000006f, 0x00000072, 0x00000277, 0x0000007e, 
+  0x00000183, 0x00000188, 0x0000038f, 0x0000038f, 
+  0x00000188, 0x00010080, 0x00000079, 0x00020070, 
+  0x00000062, 0x0000005b, 0x00020052, 0x00020041, 
+  0x00050035, 0x00070029, 0x0004001a, 0x0002000f, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010004, 
+  0x00000003, 0x00000003, 0x00000003, 0x00010004, 
+  0x0005001e, 0x00050113, 0x000f0c1b, 0x0021246b, 
+  0x00111054, 0x000d0c50, 0x000a0a51, 0x00080954, 
+  0x00050754, 0x00040558, 0x0003045e, 0x00020360, 
+  0x00010366, 0x00000168, 0x0000006f, 0x00000072, 
+  0x00000277, 0x0000007e, 0x00000183, 0x00000188, 
+  0x0000038f, 0x0000038f, 0x00000188, 0x00010080, 
+  0x00000079, 0x00020070, 0x00000062, 0x0000005b, 
+  0x00020052, 0x00020041, 0x00050035, 0x00070029, 
+  0x0004001a, 0x0002000f, 0x00010009, 0x00010008, 
+  0x00010007, 0x00010004, 0x00000003, 0x00000003, 
+  0x00000003, 0x00010004, 0x0005001e, 0x00050113, 
+  0x000f0c1b, 0x0021246b, 0x00111054, 0x000d0c50, 
+  0x000a0a51, 0x00080954, 0x00050754, 0x00040558, 
+  0x0003045e, 0x00020360, 0x00010366, 0x00000168, 
+  0x0000006f, 0x00000072, 0x00000277, 0x0000007e, 
+  0x00000183, 0x00000188, 0x0000038f, 0x0000038f, 
+  0x00000188, 0x00010080, 0x00000079, 0x00020070, 
+  0x00000062, 0x0000005b, 0x00020052, 0x00020041, 
+  0x00050035, 0x00070029, 0x0004001a, 0x0002000f, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010004, 
+  0x00000003, 0x00000003, 0x00000003, 0x00010004, 
+  0x0005001e, 0x00050113, 0x000c0a19, 0x001c1e6a, 
+  0x000e0d4f, 0x0007084e, 0x0005054e, 0x0004054e, 
+  0x00050250, 0x00020155, 0x00010257, 0x0001005e, 
+  0x00000162, 0x00010062, 0x00000168, 0x0000006f, 
+  0x00000075, 0x00010078, 0x0001007e, 0x00000082, 
+  0x00000088, 0x0002008b, 0x0000007e, 0x0000006e, 
+  0x00000060, 0x00040054, 0x0009004b, 0x000a003f, 
+  0x00080032, 0x00070029, 0x00050020, 0x0005001d, 
+  0x00040017, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010007, 
+  0x00010007, 0x00010008, 0x0005001f, 0x00040113, 
+  0x000c0a19, 0x001c1e6a, 0x000e0d4f, 0x0007084e, 
+  0x0005054e, 0x0004054e, 0x00050250, 0x00020155, 
+  0x00010257, 0x0001005e, 0x00000162, 0x00010062, 
+  0x00000168, 0x0000006f, 0x00000075, 0x00010078, 
+  0x0001007e, 0x00000082, 0x00000088, 0x0002008b, 
+  0x0000007e, 0x0000006e, 0x00000060, 0x00040054, 
+  0x0009004b, 0x000a003f, 0x00080032, 0x00070029, 
+  0x00050020, 0x0005001d, 0x00040017, 0x00030012, 
+  0x0002000f, 0x0002000c, 0x00010009, 0x00010008, 
+  0x00010007, 0x00010007, 0x00010007, 0x00010008, 
+  0x0005001f, 0x00040113, 0x000c0a19, 0x001c1e6a, 
+  0x000e0d4f, 0x0007084e, 0x0005054e, 0x0004054e, 
+  0x00050250, 0x00020155, 0x00010257, 0x0001005e, 
+  0x00000162, 0x00010062, 0x00000168, 0x0000006f, 
+  0x00000075, 0x00010078, 0x0001007e, 0x00000082, 
+  0x00000088, 0x0002008b, 0x0000007e, 0x0000006e, 
+  0x00000060, 0x00040054, 0x0009004b, 0x000a003f, 
+  0x00080032, 0x00070029, 0x00050020, 0x0005001d, 
+  0x00040017, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010007, 
+  0x00010007, 0x00010008, 0x0005001f, 0x00040113, 
+  0x000b0917, 0x001b1a64, 0x0007084e, 0x00060547, 
+  0x00020247, 0x00ffffff, 0x00ffffff, 0x0002004f, 
+  0x00000053, 0x00050055, 0x00010056, 0x00000056, 
+  0x00000154, 0x00000050, 0x00030051, 0x00050054, 
+  0x0007005d, 0x00090065, 0x000a0070, 0x000b007e, 
+  0x000c0075, 0x000f0067, 0x000f0059, 0x000d004e, 
+  0x000b0043, 0x000a003b, 0x00090034, 0x0007002c, 
+  0x00070028, 0x00060023, 0x0004001b, 0x00040017, 
+  0x00030012, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00010009, 0x00010009, 0x00010008, 0x00010009, 
+  0x00060023, 0x00040114, 0x000b0917, 0x001b1a64, 
+  0x0007084e, 0x00060547, 0x00020247, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00050055, 
+  0x00010056, 0x00000056, 0x00000154, 0x00000050, 
+  0x00030051, 0x00050054, 0x0007005d, 0x00090065, 
+  0x000a0070, 0x000b007e, 0x000c0075, 0x000f0067, 
+  0x000f0059, 0x000d004e, 0x000b0043, 0x000a003b, 
+  0x00090034, 0x0007002c, 0x00070028, 0x00060023, 
+  0x0004001b, 0x00040017, 0x00030012, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00010008, 0x00010009, 0x00060023, 0x00040114, 
+  0x000b0917, 0x001b1a64, 0x0007084e, 0x00060547, 
+  0x00020247, 0x00040048, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00050055, 0x00010056, 0x00000056, 
+  0x00000154, 0x00000050, 0x00030051, 0x00050054, 
+  0x0007005d, 0x00090065, 0x000a0070, 0x000b007e, 
+  0x000c0075, 0x000f0067, 0x000f0059, 0x000d004e, 
+  0x000b0043, 0x000a003b, 0x00090034, 0x0007002c, 
+  0x00070028, 0x00060023, 0x0004001b, 0x00040017, 
+  0x00030012, 0x0002000f, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00010009, 0x00010008, 0x00010009, 
+  0x00060023, 0x00040114, 0x00080618, 0x00171861, 
+  0x00060547, 0x00020143, 0x00020043, 0x00000145, 
+  0x00ffffff, 0x0001003e, 0x00030036, 0x00050032, 
+  0x0006002e, 0x0008002e, 0x00090034, 0x00090039, 
+  0x000b0042, 0x000c004b, 0x000e0053, 0x00100061, 
+  0x000e006c, 0x000c007a, 0x000c007a, 0x000c006c, 
+  0x000c005f, 0x000d0053, 0x000c004b, 0x000b0042, 
+  0x00090037, 0x00080032, 0x0007002b, 0x00060026, 
+  0x00050020, 0x0004001b, 0x00ffffff, 0x00030012, 
+  0x0002000f, 0x0002000c, 0x00ffffff, 0x0002000a, 
+  0x0002000a, 0x0002000c, 0x00050024, 0x00040114, 
+  0x00080618, 0x00171861, 0x00060547, 0x00020143, 
+  0x00020043, 0x00ffffff, 0x00010042, 0x0001003e, 
+  0x00030036, 0x00050032, 0x0006002e, 0x0008002e, 
+  0x00090034, 0x00090039, 0x000b0042, 0x000c004b, 
+  0x000e0053, 0x00100061, 0x000e006c, 0x000c007a, 
+  0x000c007a, 0x000c006c, 0x000c005f, 0x000d0053, 
+  0x000c004b, 0x000b0042, 0x00090037, 0x00080032, 
+  0x0007002b, 0x00060026, 0x00050020, 0x0004001b, 
+  0x00030015, 0x00ffffff, 0x0002000f, 0x0002000c, 
+  0x0002000c, 0x00ffffff, 0x0002000a, 0x0002000c, 
+  0x00050024, 0x00040114, 0x00080618, 0x00171861, 
+  0x00060547, 0x00020143, 0x00020043, 0x00ffffff, 
+  0x00010042, 0x0001003e, 0x00030036, 0x00ffffff, 
+  0x0006002e, 0x0008002e, 0x00090034, 0x00090039, 
+  0x000b0042, 0x000c004b, 0x000e0053, 0x00100061, 
+  0x000e006c, 0x000c007a, 0x000c007a, 0x000c006c, 
+  0x000c005f, 0x000d0053, 0x000c004b, 0x000b0042, 
+  0x00090037, 0x00080032, 0x0007002b, 0x00060026, 
+  0x00050020, 0x0004001b, 0x00030015, 0x00ffffff, 
+  0x0002000f, 0x0002000c, 0x0002000c, 0x00ffffff, 
+  0x0002000a, 0x0002000c, 0x00050024, 0x00040114, 
+  0x00070517, 0x00131361, 0x00010044, 0x0001003d, 
+  0x00000032, 0x00030024, 0x00ffffff, 0x00040018, 
+  0x0004001a, 0x0005001d, 0x00060026, 0x0007002b, 
+  0x00080032, 0x000a003a, 0x000b0042, 0x000a004b, 
+  0x000c0053, 0x000b005e, 0x000a0068, 0x000d0075, 
+  0x000b007e, 0x000a0070, 0x00090064, 0x000a0058, 
+  0x000b0050, 0x000a0046, 0x000a0040, 0x00090036, 
+  0x0008002e, 0x0007002a, 0x00060026, 0x0005001e, 
+  0x0004001a, 0x00030015, 0x00030012, 0x0002000f, 
+  0x00ffffff, 0x0002000e, 0x0002000c, 0x0002000f, 
+  0x00050028, 0x00020115, 0x00070517, 0x00131361, 
+  0x00010044, 0x0001003d, 0x00000032, 0x00ffffff, 
+  0x0005001d, 0x00040018, 0x0004001a, 0x0005001d, 
+  0x00060026, 0x0007002b, 0x00080032, 0x000a003a, 
+  0x000b0042, 0x000a004b, 0x000c0053, 0x000b005e, 
+  0x000a0068, 0x000d0075, 0x000b007e, 0x000a0070, 
+  0x00090064, 0x000a0058, 0x000b0050, 0x000a0046, 
+  0x000a0040, 0x00090036, 0x0008002e, 0x0007002a, 
+  0x00060026, 0x0005001e, 0x0004001a, 0x00030015, 
+  0x00030012, 0x0002000f, 0x0002000f, 0x00ffffff, 
+  0x0002000c, 0x0002000f, 0x00050028, 0x00020115, 
+  0x00070517, 0x00131361, 0x00010044, 0x0001003d, 
+  0x00000032, 0x00ffffff, 0x0005001d, 0x00040018, 
+  0x0004001a, 0x00ffffff, 0x00060026, 0x0007002b, 
+  0x00080032, 0x000a003a, 0x000b0042, 0x000a004b, 
+  0x000c0053, 0x000b005e, 0x000a0068, 0x000d0075, 
+  0x000b007e, 0x000a0070, 0x00090064, 0x000a0058, 
+  0x000b0050, 0x000a0046, 0x000a0040, 0x00090036, 
+  0x0008002e, 0x0007002a, 0x00060026, 0x0005001e, 
+  0x0004001a, 0x00ffffff, 0x00030012, 0x0002000f, 
+  0x0002000f, 0x00ffffff, 0x0002000c, 0x0002000f, 
+  0x00050028, 0x00020115, 0x00050417, 0x000e0e5d, 
+  0x0004002a, 0x0004001a, 0x00030012, 0x00030010, 
+  0x00ffffff, 0x00040017, 0x0004001b, 0x0005001f, 
+  0x00070028, 0x0007002c, 0x00090034, 0x00090039, 
+  0x000a0042, 0x00090048, 0x000a0052, 0x0009005c, 
+  0x00090067, 0x000a0072, 0x0009007e, 0x00090074, 
+  0x00090068, 0x0009005d, 0x000a0053, 0x0009004b, 
+  0x000b0043, 0x000a003a, 0x00090035, 0x0008002e, 
+  0x00070029, 0x00060023, 0x0005001e, 0x0004001a, 
+  0x00ffffff, 0x00ffffff, 0x00030010, 0x0002000f, 
+  0x0002000f, 0x00030010, 0x0004002a, 0x00020116, 
+  0x00050417, 0x000e0e5d, 0x0004002a, 0x0004001a, 
+  0x00030012, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x0004001b, 0x0005001f, 0x00070028, 0x0007002c, 
+  0x00090034, 0x00090039, 0x000a0042, 0x00090048, 
+  0x000a0052, 0x0009005c, 0x00090067, 0x000a0072, 
+  0x0009007e, 0x00090074, 0x00090068, 0x0009005d, 
+  0x000a0053, 0x0009004b, 0x000b0043, 0x000a003a, 
+  0x00090035, 0x0008002e, 0x00070029, 0x00060023, 
+  0x0005001e, 0x0004001a, 0x00030015, 0x00030012, 
+  0x00ffffff, 0x0002000f, 0x0002000f, 0x00030010, 
+  0x0004002a, 0x00020116, 0x00050417, 0x000e0e5d, 
+  0x0004002a, 0x0004001a, 0x00030012, 0x00ffffff, 
+  0x00030012, 0x00040017, 0x0004001b, 0x00ffffff, 
+  0x00070028, 0x0007002c, 0x00090034, 0x00090039, 
+  0x000a0042, 0x00090048, 0x000a0052, 0x0009005c, 
+  0x00090067, 0x000a0072, 0x0009007e, 0x00090074, 
+  0x00090068, 0x0009005d, 0x000a0053, 0x0009004b, 
+  0x000b0043, 0x000a003a, 0x00090035, 0x0008002e, 
+  0x00070029, 0x00060023, 0x0005001e, 0x00ffffff, 
+  0x00030015, 0x00030012, 0x00030010, 0x00ffffff, 
+  0x0002000f, 0x00030010, 0x0004002a, 0x00020116, 
+  0x00020110, 0x00020042, 0x00030015, 0x00030010, 
+  0x00030012, 0x00030014, 0x00ffffff, 0x0004001a, 
+  0x0005001e, 0x00050021, 0x00070029, 0x0008002e, 
+  0x00090034, 0x00080039, 0x00090041, 0x00090048, 
+  0x00070051, 0x00090059, 0x00070064, 0x0006006e, 
+  0x0006007a, 0x00060079, 0x0008006d, 0x00080062, 
+  0x00080056, 0x00090050, 0x00090047, 0x00090040, 
+  0x00090037, 0x00080032, 0x0007002c, 0x00070028, 
+  0x00050021, 0x0005001d, 0x00040018, 0x00040017, 
+  0x00ffffff, 0x00030012, 0x00030012, 0x00030014, 
+  0x0003002b, 0x00020118, 0x00020110, 0x00020042, 
+  0x00030015, 0x00030010, 0x00030012, 0x00030014, 
+  0x00040017, 0x0004001a, 0x00ffffff, 0x00050021, 
+  0x00070029, 0x0008002e, 0x00090034, 0x00080039, 
+  0x00090041, 0x00090048, 0x00070051, 0x00090059, 
+  0x00070064, 0x0006006e, 0x0006007a, 0x00060079, 
+  0x0008006d, 0x00080062, 0x00080056, 0x00090050, 
+  0x00090047, 0x00090040, 0x00090037, 0x00080032, 
+  0x0007002c, 0x00070028, 0x00050021, 0x0005001d, 
+  0x00040018, 0x00040017, 0x00ffffff, 0x00030012, 
+  0x00030012, 0x00030014, 0x0003002b, 0x00020118, 
+  0x00020110, 0x00020042, 0x00030015, 0x00030010, 
+  0x00030012, 0x00030014, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00070029, 0x0008002e, 
+  0x00090034, 0x00080039, 0x00090041, 0x00090048, 
+  0x00070051, 0x00090059, 0x00070064, 0x0006006e, 
+  0x0006007a, 0x00060079, 0x0008006d, 0x00080062, 
+  0x00080056, 0x00090050, 0x00090047, 0x00090040, 
+  0x00090037, 0x00080032, 0x0007002c, 0x00070028, 
+  0x00050021, 0x00ffffff, 0x00040018, 0x00040017, 
+  0x00030014, 0x00ffffff, 0x00030012, 0x00030014, 
+  0x0003002b, 0x00020118, 0x0004010c, 0x0000013d, 
+  0x00040018, 0x00030015, 0x00030015, 0x00040017, 
+  0x00ffffff, 0x0004001b, 0x0005001e, 0x00060023, 
+  0x0007002a, 0x0008002e, 0x00070035, 0x0007003a, 
+  0x00090041, 0x00080047, 0x00060051, 0x00070058, 
+  0x00060061, 0x0006006d, 0x00050078, 0x0004007d, 
+  0x00030070, 0x00050067, 0x0006005d, 0x00060053, 
+  0x0006004d, 0x00070043, 0x0008003f, 0x00080036, 
+  0x00070032, 0x0007002b, 0x00060024, 0x0005001f, 
+  0x0005001d, 0x0004001a, 0x00ffffff, 0x00030015, 
+  0x00030015, 0x00040017, 0x0001002f, 0x00030119, 
+  0x0004010c, 0x0000013d, 0x00040018, 0x00030015, 
+  0x00030015, 0x00040017, 0x00040018, 0x0004001b, 
+  0x00ffffff, 0x00060023, 0x0007002a, 0x0008002e, 
+  0x00070035, 0x0007003a, 0x00090041, 0x00080047, 
+  0x00060051, 0x00070058, 0x00060061, 0x0006006d, 
+  0x00050078, 0x0004007d, 0x00030070, 0x00050067, 
+  0x0006005d, 0x00060053, 0x0006004d, 0x00070043, 
+  0x0008003f, 0x00080036, 0x00070032, 0x0007002b, 
+  0x00060024, 0x0005001f, 0x0005001d, 0x0004001a, 
+  0x00ffffff, 0x00030015, 0x00030015, 0x00040017, 
+  0x0001002f, 0x00030119, 0x0004010c, 0x0000013d, 
+  0x00040018, 0x00030015, 0x00030015, 0x00040017, 
+  0x00040018, 0x0004001b, 0x0005001e, 0x00ffffff, 
+  0x0007002a, 0x0008002e, 0x00070035, 0x0007003a, 
+  0x00090041, 0x00080047, 0x00060051, 0x00070058, 
+  0x00060061, 0x0006006d, 0x00050078, 0x0004007d, 
+  0x00030070, 0x00050067, 0x0006005d, 0x00060053, 
+  0x0006004d, 0x00070043, 0x0008003f, 0x00080036, 
+  0x00070032, 0x0007002b, 0x00060024, 0x00ffffff, 
+  0x0005001d, 0x0004001a, 0x00040018, 0x00ffffff, 
+  0x00030015, 0x00040017, 0x0001002f, 0x00030119, 
+  0x0003010d, 0x00020042, 0x0004001a, 0x00040018, 
+  0x00040018, 0x00040018, 0x00ffffff, 0x0005001e, 
+  0x00050021, 0x00060024, 0x0006002b, 0x00070030, 
+  0x00070035, 0x0007003a, 0x00070041, 0x00060047, 
+  0x00050050, 0x00050056, 0x0006005f, 0x0002006a, 
+  0x00030074, 0x0002007d, 0x00040074, 0x0003006c, 
+  0x0007005f, 0x00050058, 0x00050051, 0x00060048, 
+  0x00070041, 0x0007003a, 0x00060035, 0x0006002e, 
+  0x00ffffff, 0x00060024, 0x0005001f, 0x0005001d, 
+  0x00ffffff, 0x0004001a, 0x00040018, 0x0004001a, 
+  0x00040035, 0x0002011b, 0x0003010d, 0x00020042, 
+  0x0004001a, 0x00040018, 0x00ffffff, 0x00040018, 
+  0x0004001b, 0x0005001e, 0x00ffffff, 0x00060024, 
+  0x0006002b, 0x00070030, 0x00070035, 0x0007003a, 
+  0x00070041, 0x00060047, 0x00050050, 0x00050056, 
+  0x0006005f, 0x0002006a, 0x00030074, 0x0002007d, 
+  0x00040074, 0x0003006c, 0x0007005f, 0x00050058, 
+  0x00050051, 0x00060048, 0x00070041, 0x0007003a, 
+  0x00060035, 0x0006002e, 0x0007002a, 0x00060024, 
+  0x0005001f, 0x00ffffff, 0x0004001b, 0x0004001a, 
+  0x00040018, 0x0004001a, 0x00040035, 0x0002011b, 
+  0x0003010d, 0x00020042, 0x0004001a, 0x00040018, 
+  0x00040018, 0x00040018, 0x0004001b, 0x0005001e, 
+  0x00ffffff, 0x00060024, 0x0006002b, 0x00070030, 
+  0x00070035, 0x0007003a, 0x00070041, 0x00060047, 
+  0x00050050, 0x00050056, 0x0006005f, 0x0002006a, 
+  0x00030074, 0x0002007d, 0x00040074, 0x0003006c, 
+  0x0007005f, 0x00050058, 0x00050051, 0x00060048, 
+  0x00070041, 0x0007003a, 0x00060035, 0x0006002e, 
+  0x0007002a, 0x00ffffff, 0x0005001f, 0x0005001d, 
+  0x0004001b, 0x00ffffff, 0x00040018, 0x0004001a, 
+  0x00040035, 0x0002011b, 0x0003010d, 0x00000148, 
+  0x0005001d, 0x0004001a, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00060026, 
+  0x0006002b, 0x00080030, 0x00060036, 0x0007003a, 
+  0x00050041, 0x00040046, 0x00040050, 0x00040056, 
+  0x0003005e, 0x00010068, 0x00000073, 0x0001007d, 
+  0x00010079, 0x0006006e, 0x00020064, 0x0005005d, 
+  0x00040053, 0x0005004e, 0x00050045, 0x00060040, 
+  0x00060039, 0x00060034, 0x0006002e, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x0005001e, 0x0005001d, 
+  0x0004001b, 0x0005001d, 0x00020037, 0x0002011d, 
+  0x0003010d, 0x00000148, 0x0005001d, 0x0004001a, 
+  0x0004001a, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00060023, 0x00060026, 0x0006002b, 0x00080030, 
+  0x00060036, 0x0007003a, 0x00050041, 0x00040046, 
+  0x00040050, 0x00040056, 0x0003005e, 0x00010068, 
+  0x00000073, 0x0001007d, 0x00010079, 0x0006006e, 
+  0x00020064, 0x0005005d, 0x00040053, 0x0005004e, 
+  0x00050045, 0x00060040, 0x00060039, 0x00060034, 
+  0x0006002e, 0x00070028, 0x00060024, 0x00ffffff, 
+  0x0005001e, 0x0005001d, 0x0004001b, 0x0005001d, 
+  0x00020037, 0x0002011d, 0x0003010d, 0x00000148, 
+  0x0005001d, 0x0004001a, 0x0004001a, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00060023, 0x00060026, 
+  0x0006002b, 0x00080030, 0x00060036, 0x0007003a, 
+  0x00050041, 0x00040046, 0x00040050, 0x00040056, 
+  0x0003005e, 0x00010068, 0x00000073, 0x0001007d, 
+  0x00010079, 0x0006006e, 0x00020064, 0x0005005d, 
+  0x00040053, 0x0005004e, 0x00050045, 0x00060040, 
+  0x00060039, 0x00060034, 0x0006002e, 0x00070028, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0005001d, 
+  0x0004001b, 0x0005001d, 0x00020037, 0x0002011d, 
+  0x0003010d, 0x0000014b, 0x0004001e, 0x0004001b, 
+  0x0004001b, 0x0005001d, 0x0005001e, 0x0005001f, 
+  0x00060024, 0x00060028, 0x0005002c, 0x00050032, 
+  0x00050036, 0x0006003b, 0x00070041, 0x00040046, 
+  0x0004004e, 0x00020054, 0x0001005d, 0x00000066, 
+  0x00000072, 0x0000007c, 0x0001007f, 0x00020075, 
+  0x0000006a, 0x0001005f, 0x00030059, 0x00020052, 
+  0x00030048, 0x00040043, 0x0004003f, 0x00050037, 
+  0x00050032, 0x0005002c, 0x00070028, 0x00060024, 
+  0x00050021, 0x0005001f, 0x0005001e, 0x0005001f, 
+  0x0000003c, 0x0002011e, 0x0003010d, 0x0000014b, 
+  0x0004001e, 0x0004001b, 0x0004001b, 0x0005001d, 
+  0x0005001e, 0x0005001f, 0x00060024, 0x00060028, 
+  0x0005002c, 0x00050032, 0x00050036, 0x0006003b, 
+  0x00070041, 0x00040046, 0x0004004e, 0x00020054, 
+  0x0001005d, 0x00000066, 0x00000072, 0x0000007c, 
+  0x0001007f, 0x00020075, 0x0000006a, 0x0001005f, 
+  0x00030059, 0x00020052, 0x00030048, 0x00040043, 
+  0x0004003f, 0x00050037, 0x00050032, 0x0005002c, 
+  0x00070028, 0x00060024, 0x00050021, 0x0005001f, 
+  0x0005001e, 0x0005001f, 0x0000003c, 0x0002011e, 
+  0x0003010d, 0x0000014b, 0x0004001e, 0x0004001b, 
+  0x0004001b, 0x0005001d, 0x0005001e, 0x0005001f, 
+  0x00060024, 0x00060028, 0x0005002c, 0x00050032, 
+  0x00050036, 0x0006003b, 0x00070041, 0x00040046, 
+  0x0004004e, 0x00020054, 0x0001005d, 0x00000066, 
+  0x00000072, 0x0000007c, 0x0001007f, 0x00020075, 
+  0x0000006a, 0x0001005f, 0x00030059, 0x00020052, 
+  0x00030048, 0x00040043, 0x0004003f, 0x00050037, 
+  0x00050032, 0x0005002c, 0x00070028, 0x00060024, 
+  0x00050021, 0x0005001f, 0x0005001e, 0x0005001f, 
+  0x0000003c, 0x0002011e, 0x0002010e, 0x00000051, 
+  0x00040021, 0x0005001d, 0x0005001e, 0x0005001e, 
+  0x0005001f, 0x00050021, 0x00050026, 0x00060029, 
+  0x0004002e, 0x00040034, 0x00030037, 0x0004003b, 
+  0x00040042, 0x00040047, 0x00030050, 0x00040054, 
+  0x0000005e, 0x00000066, 0x0000006f, 0x0002007c, 
+  0x00000183, 0x00000079, 0x0000006f, 0x00000066, 
+  0x0000005e, 0x00000056, 0x00030050, 0x00040047, 
+  0x00040042, 0x0004003b, 0x00050036, 0x00050032, 
+  0x0005002a, 0x00060028, 0x00050024, 0x00060023, 
+  0x00050021, 0x00050023, 0x00000041, 0x0002011f, 
+  0x0002010e, 0x00000051, 0x00040021, 0x0005001d, 
+  0x0005001e, 0x0005001e, 0x0005001f, 0x00050021, 
+  0x00050026, 0x00060029, 0x0004002e, 0x00040034, 
+  0x00030037, 0x0004003b, 0x00040042, 0x00040047, 
+  0x00030050, 0x00040054, 0x0000005e, 0x00000066, 
+  0x0000006f, 0x0002007c, 0x00000183, 0x00000079, 
+  0x0000006f, 0x00000066, 0x0000005e, 0x00000056, 
+  0x00030050, 0x00040047, 0x00040042, 0x0004003b, 
+  0x00050036, 0x00050032, 0x0005002a, 0x00060028, 
+  0x00050024, 0x00060023, 0x00050021, 0x00050023, 
+  0x00000041, 0x0002011f, 0x0002010e, 0x00000051, 
+  0x00040021, 0x0005001d, 0x0005001e, 0x0005001e, 
+  0x0005001f, 0x00050021, 0x00050026, 0x00060029, 
+  0x0004002e, 0x00040034, 0x00030037, 0x0004003b, 
+  0x00040042, 0x00040047, 0x00030050, 0x00040054, 
+  0x0000005e, 0x00000066, 0x0000006f, 0x0002007c, 
+  0x00000183, 0x00000079, 0x0000006f, 0x00000066, 
+  0x0000005e, 0x00000056, 0x00030050, 0x00040047, 
+  0x00040042, 0x0004003b, 0x00050036, 0x00050032, 
+  0x0005002a, 0x00060028, 0x00050024, 0x00060023, 
+  0x00050021, 0x00050023, 0x00000041, 0x0002011f, 
+  0x0002010e, 0x00030055, 0x00030023, 0x0004001e, 
+  0x0005001f, 0x0005001f, 0x00050021, 0x00050024, 
+  0x00040026, 0x0005002a, 0x0004002e, 0x00030035, 
+  0x00030037, 0x0004003f, 0x00020042, 0x00030047, 
+  0x00010050, 0x00010056, 0x0002005f, 0x00000065, 
+  0x0001006e, 0x0001007a, 0x00010085, 0x00020080, 
+  0x00010078, 0x0000006d, 0x00000064, 0x0000015c, 
+  0x00000055, 0x0001004e, 0x00020046, 0x00030041, 
+  0x0002003a, 0x00050035, 0x00040030, 0x0004002b, 
+  0x00050029, 0x00040026, 0x00050024, 0x00030026, 
+  0x00030048, 0x00030122, 0x0002010e, 0x00030055, 
+  0x00030023, 0x0004001e, 0x0005001f, 0x0005001f, 
+  0x00050021, 0x00050024, 0x00040026, 0x0005002a, 
+  0x0004002e, 0x00030035, 0x00030037, 0x0004003f, 
+  0x00020042, 0x00030047, 0x00010050, 0x00010056, 
+  0x0002005f, 0x00000065, 0x0001006e, 0x0001007a, 
+  0x00010085, 0x00020080, 0x00010078, 0x0000006d, 
+  0x00000064, 0x0000015c, 0x00000055, 0x0001004e, 
+  0x00020046, 0x00030041, 0x0002003a, 0x00050035, 
+  0x00040030, 0x0004002b, 0x00050029, 0x00040026, 
+  0x00050024, 0x00030026, 0x00030048, 0x00030122, 
+  0x0002010e, 0x00030055, 0x00030023, 0x0004001e, 
+  0x0005001f, 0x0005001f, 0x00050021, 0x00050024, 
+  0x00040026, 0x0005002a, 0x0004002e, 0x00030035, 
+  0x00030037, 0x0004003f, 0x00020042, 0x00030047, 
+  0x00010050, 0x00010056, 0x0002005f, 0x00000065, 
+  0x0001006e, 0x0001007a, 0x00010085, 0x00020080, 
+  0x00010078, 0x0000006d, 0x00000064, 0x0000015c, 
+  0x00000055, 0x0001004e, 0x00020046, 0x00030041, 
+  0x0002003a, 0x00050035, 0x00040030, 0x0004002b, 
+  0x00050029, 0x00040026, 0x00050024, 0x00030026, 
+  0x00030048, 0x00030122, 0x0002010f, 0x00030256, 
+  0x00020024, 0x00030021, 0x00030021, 0x00030021, 
+  0x00040023, 0x00040024, 0x00040028, 0x0003002a, 
+  0x00020030, 0x00020035, 0x00010037, 0x0002003f, 
+  0x00020042, 0x00000148, 0x00000050, 0x00000157, 
+  0x0000005d, 0x00010068, 0x00000070, 0x0000007a, 
+  0x00010083, 0x00010086, 0x0000007c, 0x00010073, 
+  0x0000006a, 0x00020064, 0x0000015a, 0x00010053, 
+  0x0000014a, 0x00010043, 0x0002003f, 0x00010037, 
+  0x00020035, 0x00020030, 0x0003002b, 0x0003002a, 
+  0x00030029, 0x0001002a, 0x0002004d, 0x00040121, 
+  0x0002010f, 0x00030256, 0x00020024, 0x00030021, 
+  0x00030021, 0x00030021, 0x00040023, 0x00040024, 
+  0x00040028, 0x0003002a, 0x00020030, 0x00020035, 
+  0x00010037, 0x0002003f, 0x00020042, 0x00000148, 
+  0x00000050, 0x00000157, 0x0000005d, 0x00010068, 
+  0x00000070, 0x0000007a, 0x00010083, 0x00010086, 
+  0x0000007c, 0x00010073, 0x0000006a, 0x00020064, 
+  0x0000015a, 0x00010053, 0x0000014a, 0x00010043, 
+  0x0002003f, 0x00010037, 0x00020035, 0x00020030, 
+  0x0003002b, 0x0003002a, 0x00030029, 0x0001002a, 
+  0x0002004d, 0x00040121, 0x0002010f, 0x00030256, 
+  0x00020024, 0x00030021, 0x00030021, 0x00030021, 
+  0x00040023, 0x00040024, 0x00040028, 0x0003002a, 
+  0x00020030, 0x00020035, 0x00010037, 0x0002003f, 
+  0x00020042, 0x00000148, 0x00000050, 0x00000157, 
+  0x0000005d, 0x00010068, 0x00000070, 0x0000007a, 
+  0x00010083, 0x00010086, 0x0000007c, 0x00010073, 
+  0x0000006a, 0x00020064, 0x0000015a, 0x00010053, 
+  0x0000014a, 0x00010043, 0x0002003f, 0x00010037, 
+  0x00020035, 0x00020030, 0x0003002b, 0x0003002a, 
+  0x00030029, 0x0001002a, 0x0002004d, 0x00040121, 
+  0x00020110, 0x00050756, 0x00000027, 0x00010021, 
+  0x00020021, 0x00030023, 0x00030024, 0x00030026, 
+  0x00030029, 0x0001002b, 0x0001002f, 0x00010035, 
+  0x00010038, 0x00010042, 0x00010044, 0x00020049, 
+  0x00010051, 0x00030057, 0x00010060, 0x00020067, 
+  0x0000006f, 0x00000078, 0x00010087, 0x0001008d, 
+  0x00000084, 0x00000077, 0x00010071, 0x0000006a, 
+  0x00020060, 0x00010058, 0x00010052, 0x0000004a, 
+  0x00030044, 0x0000003e, 0x00010038, 0x00010035, 
+  0x00010032, 0x0000002c, 0x0000002c, 0x0001002f, 
+  0x00020053, 0x00040422, 0x00020110, 0x00050756, 
+  0x00000027, 0x00010021, 0x00020021, 0x00030023, 
+  0x00030024, 0x00030026, 0x00030029, 0x0001002b, 
+  0x0001002f, 0x00010035, 0x00010038, 0x00010042, 
+  0x00010044, 0x00020049, 0x00010051, 0x00030057, 
+  0x00010060, 0x00020067, 0x0000006f, 0x00000078, 
+  0x00010087, 0x0001008d, 0x00000084, 0x00000077, 
+  0x00010071, 0x0000006a, 0x00020060, 0x00010058, 
+  0x00010052, 0x0000004a, 0x00030044, 0x0000003e, 
+  0x00010038, 0x00010035, 0x00010032, 0x0000002c, 
+  0x0000002c, 0x0001002f, 0x00020053, 0x00040422, 
+  0x00020110, 0x00050756, 0x00000027, 0x00010021, 
+  0x00020021, 0x00030023, 0x00030024, 0x00030026, 
+  0x00030029, 0x0001002b, 0x0001002f, 0x00010035, 
+  0x00010038, 0x00010042, 0x00010044, 0x00020049, 
+  0x00010051, 0x00030057, 0x00010060, 0x00020067, 
+  0x0000006f, 0x00000078, 0x00010087, 0x0001008d, 
+  0x00000084, 0x00000077, 0x00010071, 0x0000006a, 
+  0x00020060, 0x00010058, 0x00010052, 0x0000004a, 
+  0x00030044, 0x0000003e, 0x00010038, 0x00010035, 
+  0x00010032, 0x0000002c, 0x0000002c, 0x0001002f, 
+  0x00020053, 0x00040422, 0x00030111, 0x00090756, 
+  0x0000002b, 0x00000023, 0x00000024, 0x00000024, 
+  0x00000024, 0x00010028, 0x00010029, 0x0001002b, 
+  0x00010031, 0x00010037, 0x0002003c, 0x0001003f, 
+  0x00010047, 0x0001004c, 0x00000153, 0x00010058, 
+  0x0000015f, 0x00000067, 0x00000071, 0x0001007b, 
+  0x00010083, 0x0000008c, 0x00010089, 0x00010081, 
+  0x0000007a, 0x00000070, 0x00000067, 0x0000015f, 
+  0x00000059, 0x00000153, 0x00010049, 0x00010047, 
+  0x0000013f, 0x0000003a, 0x00010037, 0x00010035, 
+  0x00000033, 0x00020036, 0x00050258, 0x00050423, 
+  0x00030111, 0x00090756, 0x0000002b, 0x00000023, 
+  0x00000024, 0x00000024, 0x00000024, 0x00010028, 
+  0x00010029, 0x0001002b, 0x00010031, 0x00010037, 
+  0x0002003c, 0x0001003f, 0x00010047, 0x0001004c, 
+  0x00000153, 0x00010058, 0x0000015f, 0x00000067, 
+  0x00000071, 0x0001007b, 0x00010083, 0x0000008c, 
+  0x00010089, 0x00010081, 0x0000007a, 0x00000070, 
+  0x00000067, 0x0000015f, 0x00000059, 0x00000153, 
+  0x00010049, 0x00010047, 0x0000013f, 0x0000003a, 
+  0x00010037, 0x00010035, 0x00000033, 0x00020036, 
+  0x00050258, 0x00050423, 0x00030111, 0x00090756, 
+  0x0000002b, 0x00000023, 0x00000024, 0x00000024, 
+  0x00000024, 0x00010028, 0x00010029, 0x0001002b, 
+  0x00010031, 0x00010037, 0x0002003c, 0x0001003f, 
+  0x00010047, 0x0001004c, 0x00000153, 0x00010058, 
+  0x0000015f, 0x00000067, 0x00000071, 0x0001007b, 
+  0x00010083, 0x0000008c, 0x00010089, 0x00010081, 
+  0x0000007a, 0x00000070, 0x00000067, 0x0000015f, 
+  0x00000059, 0x00000153, 0x00010049, 0x00010047, 
+  0x0000013f, 0x0000003a, 0x00010037, 0x00010035, 
+  0x00000033, 0x00020036, 0x00050258, 0x00050423, 
+  0x00030112, 0x000c0b55, 0x0001002f, 0x00000028, 
+  0x00000025, 0x00000025, 0x00000027, 0x0001002a, 
+  0x0000012b, 0x0001002f, 0x00020033, 0x00020038, 
+  0x0000003f, 0x00010041, 0x00020048, 0x0000014d, 
+  0x00000150, 0x00000059, 0x0001005e, 0x00000169, 
+  0x00000073, 0x00ffffff, 0x00ffffff, 0x0000018c, 
+  0x0000028e, 0x00000087, 0x00000080, 0x00000079, 
+  0x00020071, 0x00000169, 0x0000015e, 0x00000059, 
+  0x0002004f, 0x0000014d, 0x00020048, 0x00010041, 
+  0x0003003f, 0x0000003c, 0x0002003b, 0x0001003d, 
+  0x0005055d, 0x00060424, 0x00030112, 0x000c0b55, 
+  0x0001002f, 0x00000028, 0x00000025, 0x00000025, 
+  0x00000027, 0x0001002a, 0x0000012b, 0x0001002f, 
+  0x00020033, 0x00020038, 0x0000003f, 0x00010041, 
+  0x00020048, 0x0000014d, 0x00000150, 0x00000059, 
+  0x0001005e, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00010084, 0x0000018c, 0x0000028e, 0x00000087, 
+  0x00000080, 0x00000079, 0x00020071, 0x00000169, 
+  0x0000015e, 0x00000059, 0x0002004f, 0x0000014d, 
+  0x00020048, 0x00010041, 0x0003003f, 0x0000003c, 
+  0x0002003b, 0x0001003d, 0x0005055d, 0x00060424, 
+  0x00030112, 0x000c0b55, 0x0001002f, 0x00000028, 
+  0x00000025, 0x00000025, 0x00000027, 0x0001002a, 
+  0x0000012b, 0x0001002f, 0x00020033, 0x00020038, 
+  0x0000003f, 0x00010041, 0x00020048, 0x0000014d, 
+  0x00000150, 0x00000059, 0x0001005e, 0x00000169, 
+  0x00000073, 0x00ffffff, 0x00010084, 0x0000018c, 
+  0x0000028e, 0x00000087, 0x00000080, 0x00000079, 
+  0x00020071, 0x00000169, 0x0000015e, 0x00000059, 
+  0x0002004f, 0x0000014d, 0x00020048, 0x00010041, 
+  0x0003003f, 0x0000003c, 0x0002003b, 0x0001003d, 
+  0x0005055d, 0x00060424, 0x00030112, 0x000f1059, 
+  0x00020031, 0x0002002c, 0x0002002a, 0x0001002a, 
+  0x0000002b, 0x0000002c, 0x0000002e, 0x00020030, 
+  0x00010036, 0x0002003a, 0x0001003e, 0x00010043, 
+  0x0000014a, 0x0000004f, 0x00000052, 0x00010058, 
+  0x0004005f, 0x0000016b, 0x00ffffff, 0x0000007c, 
+  0x00ffffff, 0x0000028b, 0x00000294, 0x0000018e, 
+  0x00000186, 0x00000080, 0x00010078, 0x00000170, 
+  0x0000016b, 0x0004005f, 0x00010058, 0x00000152, 
+  0x0000004f, 0x0000014a, 0x00010047, 0x00010047, 
+  0x00020043, 0x00000244, 0x00080861, 0x00070625, 
+  0x00030112, 0x000f1059, 0x00020031, 0x0002002c, 
+  0x0002002a, 0x0001002a, 0x0000002b, 0x0000002c, 
+  0x0000002e, 0x00020030, 0x00010036, 0x0002003a, 
+  0x0001003e, 0x00010043, 0x0000014a, 0x0000004f, 
+  0x00000052, 0x00010058, 0x00ffffff, 0x0000016b, 
+  0x00000073, 0x0000007c, 0x00ffffff, 0x0000028b, 
+  0x00000294, 0x0000018e, 0x00000186, 0x00000080, 
+  0x00010078, 0x00000170, 0x0000016b, 0x0004005f, 
+  0x00010058, 0x00000152, 0x0000004f, 0x0000014a, 
+  0x00010047, 0x00010047, 0x00020043, 0x00000244, 
+  0x00080861, 0x00070625, 0x00030112, 0x000f1059, 
+  0x00020031, 0x0002002c, 0x0002002a, 0x0001002a, 
+  0x0000002b, 0x0000002c, 0x0000002e, 0x00020030, 
+  0x00010036, 0x0002003a, 0x0001003e, 0x00010043, 
+  0x0000014a, 0x0000004f, 0x00000052, 0x00010058, 
+  0x0004005f, 0x0000016b, 0x00000073, 0x00ffffff, 
+  0x00000085, 0x0000028b, 0x00000294, 0x0000018e, 
+  0x00000186, 0x00000080, 0x00010078, 0x00000170, 
+  0x0000016b, 0x0004005f, 0x00010058, 0x00000152, 
+  0x0000004f, 0x0000014a, 0x00010047, 0x00010047, 
+  0x00020043, 0x00000244, 0x00080861, 0x00070625, 
+  0x00020112, 0x0011125a, 0x00010033, 0x0000002d, 
+  0x0000002d, 0x0003002e, 0x0003002e, 0x00010030, 
+  0x00000031, 0x00030032, 0x00020037, 0x0000003c, 
+  0x0001003f, 0x00020043, 0x0000014b, 0x0000004f, 
+  0x00010056, 0x0004005a, 0x00000062, 0x0000016a, 
+  0x00ffffff, 0x0000017c, 0x00ffffff, 0x0000028b, 
+  0x00000192, 0x00000192, 0x0000038b, 0x00000187, 
+  0x0000017f, 0x00000079, 0x00000071, 0x0000016a, 
+  0x00000062, 0x0004005a, 0x00010056, 0x00020052, 
+  0x0000004f, 0x0000004e, 0x0000004d, 0x00000150, 
+  0x000c0e64, 0x00080724, 0x00020112, 0x0011125a, 
+  0x00010033, 0x0000002d, 0x0000002d, 0x0003002e, 
+  0x0003002e, 0x00010030, 0x00000031, 0x00030032, 
+  0x00020037, 0x0000003c, 0x0001003f, 0x00020043, 
+  0x0000014b, 0x0000004f, 0x00010056, 0x0004005a, 
+  0x00ffffff, 0x0000016a, 0x00000071, 0x0000017c, 
+  0x00ffffff, 0x0000028b, 0x00000192, 0x00000192, 
+  0x0000038b, 0x00000187, 0x0000017f, 0x00000079, 
+  0x00000071, 0x0000016a, 0x00000062, 0x0004005a, 
+  0x00010056, 0x00020052, 0x0000004f, 0x0000004e, 
+  0x0000004d, 0x00000150, 0x000c0e64, 0x00080724, 
+  0x00020112, 0x0011125a, 0x00010033, 0x0000002d, 
+  0x0000002d, 0x0003002e, 0x0003002e, 0x00010030, 
+  0x00000031, 0x00030032, 0x00020037, 0x0000003c, 
+  0x0001003f, 0x00020043, 0x0000014b, 0x0000004f, 
+  0x00010056, 0x0004005a, 0x00000062, 0x0000016a, 
+  0x00000071, 0x00ffffff, 0x00000184, 0x0000028b, 
+  0x00000192, 0x00000192, 0x0000038b, 0x00000187, 
+  0x0000017f, 0x00000079, 0x00000071, 0x0000016a, 
+  0x00000062, 0x0004005a, 0x00010056, 0x00020052, 
+  0x0000004f, 0x0000004e, 0x0000004d, 0x00000150, 
+  0x000c0e64, 0x00080724, 0x00030214, 0x0013145a, 
+  0x00000034, 0x00000130, 0x0003002f, 0x0001002f, 
+  0x00040030, 0x00030030, 0x00000232, 0x00020033, 
+  0x00000138, 0x0000003d, 0x00010040, 0x00000244, 
+  0x0000004d, 0x00000051, 0x00000157, 0x0001005f, 
+  0x00000164, 0x00ffffff, 0x00000071, 0x0000007b, 
+  0x00ffffff, 0x0000018c, 0x00000193, 0x0001009a, 
+  0x00010095, 0x0000018d, 0x00000386, 0x00010080, 
+  0x00010076, 0x00000070, 0x00000069, 0x00000164, 
+  0x00000260, 0x0001005e, 0x00020057, 0x00000256, 
+  0x00000256, 0x00010257, 0x000e1067, 0x00090725, 
+  0x00030214, 0x0013145a, 0x00000034, 0x00000130, 
+  0x0003002f, 0x0001002f, 0x00040030, 0x00030030, 
+  0x00000232, 0x00020033, 0x00000138, 0x0000003d, 
+  0x00010040, 0x00000244, 0x0000004d, 0x00000051, 
+  0x00000157, 0x0001005f, 0x00000164, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00000184, 0x0000018c, 
+  0x00000193, 0x0001009a, 0x00010095, 0x0000018d, 
+  0x00000386, 0x00010080, 0x00010076, 0x00000070, 
+  0x00000069, 0x00000164, 0x00000260, 0x0001005e, 
+  0x00020057, 0x00000256, 0x00000256, 0x00010257, 
+  0x000e1067, 0x00090725, 0x00030214, 0x0013145a, 
+  0x00000034, 0x00000130, 0x0003002f, 0x0001002f, 
+  0x00040030, 0x00030030, 0x00000232, 0x00020033, 
+  0x00000138, 0x0000003d, 0x00010040, 0x00000244, 
+  0x0000004d, 0x00000051, 0x00000157, 0x0001005f, 
+  0x00000164, 0x0000016b, 0x00000071, 0x00ffffff, 
+  0x00000184, 0x0000018c, 0x00000193, 0x0001009a, 
+  0x00010095, 0x0000018d, 0x00000386, 0x00010080, 
+  0x00010076, 0x00000070, 0x00000069, 0x00000164, 
+  0x00000260, 0x0001005e, 0x00020057, 0x00000256, 
+  0x00000256, 0x00010257, 0x000e1067, 0x00090725, 
+  0x00030214, 0x0015155a, 0x00040234, 0x00000131, 
+  0x00000131, 0x00020030, 0x00020031, 0x00000133, 
+  0x00000134, 0x00010037, 0x00000139, 0x0000013f, 
+  0x00000241, 0x00010046, 0x0002004f, 0x00010053, 
+  0x00000058, 0x00030060, 0x00ffffff, 0x0000006a, 
+  0x00000174, 0x0000007a, 0x00ffffff, 0x0005028b, 
+  0x0003058f, 0x00020397, 0x00020397, 0x00020392, 
+  0x0004028d, 0x00030386, 0x0000027d, 0x00000076, 
+  0x00000071, 0x0000006b, 0x00000166, 0x00000063, 
+  0x0001025f, 0x0001025e, 0x0001025e, 0x0001045f, 
+  0x0011106e, 0x000c0b25, 0x00030214, 0x0015155a, 
+  0x00040234, 0x00000131, 0x00000131, 0x00020030, 
+  0x00020031, 0x00000133, 0x00000134, 0x00010037, 
+  0x00000139, 0x0000013f, 0x00000241, 0x00010046, 
+  0x0002004f, 0x00010053, 0x00000058, 0x00030060, 
+  0x00ffffff, 0x0000006a, 0x00000174, 0x0000007a, 
+  0x00ffffff, 0x0005028b, 0x0003058f, 0x00020397, 
+  0x00020397, 0x00020392, 0x0004028d, 0x00030386, 
+  0x0000027d, 0x00000076, 0x00000071, 0x0000006b, 
+  0x00000166, 0x00000063, 0x0001025f, 0x0001025e, 
+  0x0001025e, 0x0001045f, 0x0011106e, 0x000c0b25, 
+  0x00030214, 0x0015155a, 0x00040234, 0x00000131, 
+  0x00000131, 0x00020030, 0x00020031, 0x00000133, 
+  0x00000134, 0x00010037, 0x00000139, 0x0000013f, 
+  0x00000241, 0x00010046, 0x0002004f, 0x00010053, 
+  0x00000058, 0x00030060, 0x00000166, 0x0000006a, 
+  0x00000174, 0x0000007a, 0x00000284, 0x0005028b, 
+  0x0003058f, 0x00020397, 0x00020397, 0x00020392, 
+  0x0004028d, 0x00030386, 0x0000027d, 0x00000076, 
+  0x00000071, 0x0000006b, 0x00000166, 0x00000063, 
+  0x0001025f, 0x0001025e, 0x0001025e, 0x0001045f, 
+  0x0011106e, 0x000c0b25, 0x00030213, 0x001a195b, 
+  0x00050434, 0x00000232, 0x00000031, 0x00000032, 
+  0x00010033, 0x00010033, 0x00000136, 0x00010039, 
+  0x0000023c, 0x00020042, 0x00020047, 0x00040048, 
+  0x0002004f, 0x00020155, 0x00010559, 0x0001045f, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x0005068e, 0x00040594, 
+  0x0005069a, 0x00040595, 0x0004058f, 0x00050588, 
+  0x00050581, 0x0006067b, 0x00030475, 0x00020272, 
+  0x0004056a, 0x00030366, 0x00050465, 0x00050462, 
+  0x00050462, 0x00060565, 0x00141371, 0x000c0c25, 
+  0x00030213, 0x001a195b, 0x00050434, 0x00000232, 
+  0x00000031, 0x00000032, 0x00010033, 0x00010033, 
+  0x00000136, 0x00010039, 0x0000023c, 0x00020042, 
+  0x00020047, 0x00040048, 0x0002004f, 0x00020155, 
+  0x00010559, 0x0001045f, 0x00ffffff, 0x0000026b, 
+  0x00020272, 0x00030378, 0x00ffffff, 0x00050588, 
+  0x0005068e, 0x00040594, 0x0005069a, 0x00040595, 
+  0x0004058f, 0x00050588, 0x00050581, 0x0006067b, 
+  0x00030475, 0x00020272, 0x0004056a, 0x00030366, 
+  0x00050465, 0x00050462, 0x00050462, 0x00060565, 
+  0x00141371, 0x000c0c25, 0x00030213, 0x001a195b, 
+  0x00050434, 0x00000232, 0x00000031, 0x00000032, 
+  0x00010033, 0x00010033, 0x00000136, 0x00010039, 
+  0x0000023c, 0x00020042, 0x00020047, 0x00040048, 
+  0x0002004f, 0x00020155, 0x00010559, 0x0001045f, 
+  0x00010366, 0x0000026b, 0x00020272, 0x00030378, 
+  0x00060680, 0x00050588, 0x0005068e, 0x00040594, 
+  0x0005069a, 0x00040595, 0x0004058f, 0x00050588, 
+  0x00050581, 0x0006067b, 0x00030475, 0x00020272, 
+  0x0004056a, 0x00030366, 0x00050465, 0x00050462, 
+  0x00050462, 0x00060565, 0x00141371, 0x000c0c25, 
+  0x00040214, 0x001d1c5c, 0x000b0934, 0x00020432, 
+  0x00000033, 0x00000033, 0x00000034, 0x00020335, 
+  0x00010236, 0x0000003a, 0x00010040, 0x00020143, 
+  0x00020346, 0x00060449, 0x00040550, 0x00040652, 
+  0x00040558, 0x00050560, 0x00060565, 0x00060669, 
+  0x000a0b70, 0x00080877, 0x00ffffff, 0x00080984, 
+  0x000a0a89, 0x00090a90, 0x00090a99, 0x000a0c95, 
+  0x00080993, 0x000a0a89, 0x00080986, 0x00070880, 
+  0x0007097b, 0x00070974, 0x00080972, 0x00060570, 
+  0x00060669, 0x00080767, 0x00080767, 0x000b0c68, 
+  0x001a1c73, 0x000e0c26, 0x00040214, 0x001d1c5c, 
+  0x000b0934, 0x00020432, 0x00000033, 0x00000033, 
+  0x00000034, 0x00020335, 0x00010236, 0x0000003a, 
+  0x00010040, 0x00020143, 0x00020346, 0x00060449, 
+  0x00040550, 0x00040652, 0x00040558, 0x00050560, 
+  0x00ffffff, 0x00060669, 0x000a0b70, 0x00080877, 
+  0x00ffffff, 0x00080984, 0x000a0a89, 0x00090a90, 
+  0x00090a99, 0x000a0c95, 0x00080993, 0x000a0a89, 
+  0x00080986, 0x00070880, 0x0007097b, 0x00070974, 
+  0x00080972, 0x00060570, 0x00060669, 0x00080767, 
+  0x00080767, 0x000b0c68, 0x001a1c73, 0x000e0c26, 
+  0x00040214, 0x001d1c5c, 0x000b0934, 0x00020432, 
+  0x00000033, 0x00000033, 0x00000034, 0x00020335, 
+  0x00010236, 0x0000003a, 0x00010040, 0x00020143, 
+  0x00020346, 0x00060449, 0x00040550, 0x00040652, 
+  0x00040558, 0x00050560, 0x00060565, 0x00060669, 
+  0x000a0b70, 0x00080877, 0x00070780, 0x00080984, 
+  0x000a0a89, 0x00090a90, 0x00090a99, 0x000a0c95, 
+  0x00080993, 0x000a0a89, 0x00080986, 0x00070880, 
+  0x0007097b, 0x00070974, 0x00080972, 0x00060570, 
+  0x00060669, 0x00080767, 0x00080767, 0x000b0c68, 
+  0x001a1c73, 0x000e0c26, 0x000b0a1a, 0x001f215f, 
+  0x000b0d39, 0x00040234, 0x00040234, 0x00040235, 
+  0x00040235, 0x00040436, 0x0000003b, 0x0002023d, 
+  0x00050141, 0x00060643, 0x00060547, 0x0004054e, 
+  0x00050751, 0x00050556, 0x0005055e, 0x00080861, 
+  0x00080765, 0x000b0c6b, 0x000b0c71, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x000c0b89, 0x000f0f8b, 
+  0x00111094, 0x00101197, 0x00101093, 0x000e0f8f, 
+  0x000c0b89, 0x000c0c83, 0x000a0c7f, 0x000a0a7a, 
+  0x00090976, 0x000c0d72, 0x000c0c6f, 0x000b0b6e, 
+  0x000b0b6e, 0x000e0e6f, 0x001d1e7a, 0x00131229, 
+  0x000b0a1a, 0x001f215f, 0x000b0d39, 0x00040234, 
+  0x00040234, 0x00040235, 0x00040235, 0x00040436, 
+  0x0000003b, 0x0002023d, 0x00050141, 0x00060643, 
+  0x00060547, 0x0004054e, 0x00050751, 0x00050556, 
+  0x0005055e, 0x00080861, 0x00080765, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x000a0c7f, 0x000b0c84, 
+  0x000c0b89, 0x000f0f8b, 0x00111094, 0x00101197, 
+  0x00101093, 0x000e0f8f, 0x000c0b89, 0x000c0c83, 
+  0x000a0c7f, 0x000a0a7a, 0x00090976, 0x000c0d72, 
+  0x000c0c6f, 0x000b0b6e, 0x000b0b6e, 0x000e0e6f, 
+  0x001d1e7a, 0x00131229, 0x000b0a1a, 0x001f215f, 
+  0x000b0d39, 0x00040234, 0x00040234, 0x00040235, 
+  0x00040235, 0x00040436, 0x0000003b, 0x0002023d, 
+  0x00050141, 0x00060643, 0x00060547, 0x0004054e, 
+  0x00050751, 0x00050556, 0x0005055e, 0x00080861, 
+  0x00080765, 0x000b0c6b, 0x000b0c71, 0x000b0b76, 
+  0x000a0c7f, 0x000b0c84, 0x000c0b89, 0x000f0f8b, 
+  0x00111094, 0x00101197, 0x00101093, 0x000e0f8f, 
+  0x000c0b89, 0x000c0c83, 0x000a0c7f, 0x000a0a7a, 
+  0x00090976, 0x000c0d72, 0x000c0c6f, 0x000b0b6e, 
+  0x000b0b6e, 0x000e0e6f, 0x001d1e7a, 0x00131229, 
+  0x000e1925, 0x00242262, 0x00111143, 0x000b0934, 
+  0x00060734, 0x00050535, 0x00050535, 0x00040439, 
+  0x0005023d, 0x00040541, 0x00060641, 0x00060745, 
+  0x0006064d, 0x0006074f, 0x00080954, 0x00080856, 
+  0x00090a5f, 0x00090964, 0x000b0c68, 0x000c0c6f, 
+  0x000d0f72, 0x00101176, 0x000e0e7e, 0x000f1383, 
+  0x00101087, 0x0013138a, 0x00131491, 0x00151693, 
+  0x00151693, 0x0014158e, 0x0013138a, 0x00101087, 
+  0x00121382, 0x0012107f, 0x000f0f7a, 0x000e0e79, 
+  0x000f1075, 0x000f1172, 0x000f1172, 0x00171573, 
+  0x002b297d, 0x00121529, 0x000e1925, 0x00242262, 
+  0x00111143, 0x000b0934, 0x00060734, 0x00050535, 
+  0x00050535, 0x00040439, 0x0005023d, 0x00040541, 
+  0x00060641, 0x00060745, 0x0006064d, 0x0006074f, 
+  0x00080954, 0x00080856, 0x00090a5f, 0x00090964, 
+  0x000b0c68, 0x000c0c6f, 0x000d0f72, 0x00101176, 
+  0x000e0e7e, 0x000f1383, 0x00101087, 0x0013138a, 
+  0x00131491, 0x00151693, 0x00151693, 0x0014158e, 
+  0x0013138a, 0x00101087, 0x00121382, 0x0012107f, 
+  0x000f0f7a, 0x000e0e79, 0x000f1075, 0x000f1172, 
+  0x000f1172, 0x00171573, 0x002b297d, 0x00121529, 
+  0x000e1925, 0x00242262, 0x00111143, 0x000b0934, 
+  0x00060734, 0x00050535, 0x00050535, 0x00040439, 
+  0x0005023d, 0x00040541, 0x00060641, 0x00060745, 
+  0x0006064d, 0x0006074f, 0x00080954, 0x00080856, 
+  0x00090a5f, 0x00090964, 0x000b0c68, 0x000c0c6f, 
+  0x000d0f72, 0x00101176, 0x000e0e7e, 0x000f1383, 
+  0x00101087, 0x0013138a, 0x00131491, 0x00151693, 
+  0x00151693, 0x0014158e, 0x0013138a, 0x00101087, 
+  0x00121382, 0x0012107f, 0x000f0f7a, 0x000e0e79, 
+  0x000f1075, 0x000f1172, 0x000f1172, 0x00171573, 
+  0x002b297d, 0x00121529, 0x000b212b, 0x002a285b, 
+  0x0023255e, 0x00111143, 0x000b0d3b, 0x000b0d39, 
+  0x000b093c, 0x00090a3e, 0x000a0b41, 0x000a0b42, 
+  0x00090c46, 0x000a0b4c, 0x000a0a4f, 0x000e0c53, 
+  0x000c0b55, 0x000e0e5d, 0x000d0f63, 0x000d0e6a, 
+  0x000e0e6f, 0x00101271, 0x00141374, 0x00141477, 
+  0x0017187d, 0x00161681, 0x00161686, 0x00191989, 
+  0x00191a8d, 0x001b1d90, 0x001c1c95, 0x001b1d90, 
+  0x00191a8d, 0x00171789, 0x00181885, 0x00151582, 
+  0x0018197e, 0x0017187d, 0x0014137d, 0x00151778, 
+  0x00191a77, 0x0028297e, 0x00322d68, 0x000c1b25, 
+  0x000b212b, 0x002a285b, 0x0023255e, 0x00111143, 
+  0x000b0d3b, 0x000b0d39, 0x000b093c, 0x00090a3e, 
+  0x000a0b41, 0x000a0b42, 0x00090c46, 0x000a0b4c, 
+  0x000a0a4f, 0x000e0c53, 0x000c0b55, 0x000e0e5d, 
+  0x000d0f63, 0x000d0e6a, 0x000e0e6f, 0x00101271, 
+  0x00141374, 0x00141477, 0x0017187d, 0x00161681, 
+  0x00161686, 0x00191989, 0x00191a8d, 0x001b1d90, 
+  0x001c1c95, 0x001b1d90, 0x00191a8d, 0x00171789, 
+  0x00181885, 0x00151582, 0x0018197e, 0x0017187d, 
+  0x0014137d, 0x00151778, 0x00191a77, 0x0028297e, 
+  0x00322d68, 0x000c1b25, 0x000b212b, 0x002a285b, 
+  0x0023255e, 0x00111143, 0x000b0d3b, 0x000b0d39, 
+  0x000b093c, 0x00090a3e, 0x000a0b41, 0x000a0b42, 
+  0x00090c46, 0x000a0b4c, 0x000a0a4f, 0x000e0c53, 
+  0x000c0b55, 0x000e0e5d, 0x000d0f63, 0x000d0e6a, 
+  0x000e0e6f, 0x00101271, 0x00141374, 0x00141477, 
+  0x0017187d, 0x00161681, 0x00161686, 0x00191989, 
+  0x00191a8d, 0x001b1d90, 0x001c1c95, 0x001b1d90, 
+  0x00191a8d, 0x00171789, 0x00181885, 0x00151582, 
+  0x0018197e, 0x0017187d, 0x0014137d, 0x00151778, 
+  0x00191a77, 0x0028297e, 0x00322d68, 0x000c1b25, 
+  0x000c2d35, 0x00143149, 0x0029275c, 0x002a2868, 
+  0x0020235d, 0x00201f57, 0x001c1c57, 0x001c1c59, 
+  0x001b1b5a, 0x001d1c5c, 0x001c1b5f, 0x001e1f60, 
+  0x001d1d64, 0x001c1e6a, 0x001c1e6d, 0x001e1e6d, 
+  0x001f1e72, 0x001e2076, 0x00202079, 0x0023227b, 
+  0x0023247e, 0x00232480, 0x00272782, 0x00292785, 
+  0x00282889, 0x0028288d, 0x002d2b91, 0x002d2d90, 
+  0x002d2d90, 0x002d2d90, 0x002c2e91, 0x002d2c8d, 
+  0x00282a8b, 0x00282889, 0x00282988, 0x00282785, 
+  0x00272784, 0x00292b81, 0x0032317f, 0x00302e6b, 
+  0x00172d45, 0x000b2a34, 0x000c2d35, 0x00143149, 
+  0x0029275c, 0x002a2868, 0x0020235d, 0x00201f57, 
+  0x001c1c57, 0x001c1c59, 0x001b1b5a, 0x001d1c5c, 
+  0x001c1b5f, 0x001e1f60, 0x001d1d64, 0x001c1e6a, 
+  0x001c1e6d, 0x001e1e6d, 0x001f1e72, 0x001e2076, 
+  0x00202079, 0x0023227b, 0x0023247e, 0x00232480, 
+  0x00272782, 0x00292785, 0x00282889, 0x0028288d, 
+  0x002d2b91, 0x002d2d90, 0x002d2d90, 0x002d2d90, 
+  0x002c2e91, 0x002d2c8d, 0x00282a8b, 0x00282889, 
+  0x00282988, 0x00282785, 0x00272784, 0x00292b81, 
+  0x0032317f, 0x00302e6b, 0x00172d45, 0x000b2a34, 
+  0x000c2d35, 0x00143149, 0x0029275c, 0x002a2868, 
+  0x0020235d, 0x00201f57, 0x001c1c57, 0x001c1c59, 
+  0x001b1b5a, 0x001d1c5c, 0x001c1b5f, 0x001e1f60, 
+  0x001d1d64, 0x001c1e6a, 0x001c1e6d, 0x001e1e6d, 
+  0x001f1e72, 0x001e2076, 0x00202079, 0x0023227b, 
+  0x0023247e, 0x00232480, 0x00272782, 0x00292785, 
+  0x00282889, 0x0028288d, 0x002d2b91, 0x002d2d90, 
+  0x002d2d90, 0x002d2d90, 0x002c2e91, 0x002d2c8d, 
+  0x00282a8b, 0x00282889, 0x00282988, 0x00282785, 
+  0x00272784, 0x00292b81, 0x0032317f, 0x00302e6b, 
+  0x00172d45, 0x000b2a34, 0x000e2a34, 0x000c2c35, 
+  0x000c1d26, 0x00121828, 0x00141328, 0x00110f25, 
+  0x00100f24, 0x00100f24, 0x000f0e24, 0x000f0e24, 
+  0x00100e24, 0x00110f25, 0x00110f25, 0x00110f25, 
+  0x00110f25, 0x00110f26, 0x00110f26, 0x00110f26, 
+  0x00111026, 0x00110f29, 0x00110f29, 0x00121129, 
+  0x00121129, 0x00131229, 0x00131229, 0x0013112b, 
+  0x0013122c, 0x0014122c, 0x0013122d, 0x0013122d, 
+  0x0014122c, 0x0013122c, 0x0013122b, 0x0013112a, 
+  0x0013112a, 0x00131229, 0x00131229, 0x0016152b, 
+  0x0014172a, 0x000c1a25, 0x000c2a33, 0x000f2b34, 
+  0x000e2a34, 0x000c2c35, 0x000c1d26, 0x00121828, 
+  0x00141328, 0x00110f25, 0x00100f24, 0x00100f24, 
+  0x000f0e24, 0x000f0e24, 0x00100e24, 0x00110f25, 
+  0x00110f25, 0x00110f25, 0x00110f25, 0x00110f26, 
+  0x00110f26, 0x00110f26, 0x00111026, 0x00110f29, 
+  0x00110f29, 0x00121129, 0x00121129, 0x00131229, 
+  0x00131229, 0x0013112b, 0x0013122c, 0x0014122c, 
+  0x0013122d, 0x0013122d, 0x0014122c, 0x0013122c, 
+  0x0013122b, 0x0013112a, 0x0013112a, 0x00131229, 
+  0x00131229, 0x0016152b, 0x0014172a, 0x000c1a25, 
+  0x000c2a33, 0x000f2b34, 0x000e2a34, 0x000c2c35, 
+  0x000c1d26, 0x00121828, 0x00141328, 0x00110f25, 
+  0x00100f24, 0x00100f24, 0x000f0e24, 0x000f0e24, 
+  0x00100e24, 0x00110f25, 0x00110f25, 0x00110f25, 
+  0x00110f25, 0x00110f26, 0x00110f26, 0x00110f26, 
+  0x00111026, 0x00110f29, 0x00110f29, 0x00121129, 
+  0x00121129, 0x00131229, 0x00131229, 0x0013112b, 
+  0x0013122c, 0x0014122c, 0x0013122d, 0x0013122d, 
+  0x0014122c, 0x0013122c, 0x0013122b, 0x0013112a, 
+  0x0013112a, 0x00131229, 0x00131229, 0x0016152b, 
+  0x0014172a, 0x000c1a25, 0x000c2a33, 0x000f2b34, 
+  0x000e2a34, 0x000c2c36, 0x00102731, 0x001d282f, 
+  0x0027252b, 0x0028252b, 0x0028262b, 0x0027252b, 
+  0x0027252b, 0x0025242b, 0x00272628, 0x00252329, 
+  0x00252329, 0x00252329, 0x00242328, 0x00242228, 
+  0x00222128, 0x00232228, 0x00232127, 0x00211f27, 
+  0x00201e26, 0x00201e26, 0x00201e26, 0x001f1d26, 
+  0x001e1d26, 0x001f1d25, 0x001e1c26, 0x001c1c24, 
+  0x001c1c23, 0x001c1a23, 0x001c1a22, 0x001a1923, 
+  0x001a1922, 0x001a1922, 0x001a1921, 0x00191821, 
+  0x001a1721, 0x001a1922, 0x00161f29, 0x000e242d, 
+  0x000c2c35, 0x000e2a34, 0x000e2a34, 0x000c2c36, 
+  0x00102731, 0x001d282f, 0x0027252b, 0x0028252b, 
+  0x0028262b, 0x0027252b, 0x0027252b, 0x0025242b, 
+  0x00272628, 0x00252329, 0x00252329, 0x00252329, 
+  0x00242328, 0x00242228, 0x00222128, 0x00232228, 
+  0x00232127, 0x00211f27, 0x00201e26, 0x00201e26, 
+  0x00201e26, 0x001f1d26, 0x001e1d26, 0x001f1d25, 
+  0x001e1c26, 0x001c1c24, 0x001c1c23, 0x001c1a23, 
+  0x001c1a22, 0x001a1923, 0x001a1922, 0x001a1922, 
+  0x001a1921, 0x00191821, 0x001a1721, 0x001a1922, 
+  0x00161f29, 0x000e242d, 0x000c2c35, 0x000e2a34, 
+  0x000e2a34, 0x000c2c36, 0x00102731, 0x001d282f, 
+  0x0027252b, 0x0028252b, 0x0028262b, 0x0027252b, 
+  0x0027252b, 0x0025242b, 0x00272628, 0x00252329, 
+  0x00252329, 0x00252329, 0x00242328, 0x00242228, 
+  0x00222128, 0x00232228, 0x00232127, 0x00211f27, 
+  0x00201e26, 0x00201e26, 0x00201e26, 0x001f1d26, 
+  0x001e1d26, 0x001f1d25, 0x001e1c26, 0x001c1c24, 
+  0x001c1c23, 0x001c1a23, 0x001c1a22, 0x001a1923, 
+  0x001a1922, 0x001a1922, 0x001a1921, 0x00191821, 
+  0x001a1721, 0x001a1922, 0x00161f29, 0x000e242d, 
+  0x000c2c35, 0x000e2a34, 0x000c2d36, 0x002b555d, 
+  0x005a596a, 0x00646279, 0x005f5f7e, 0x005d5e81, 
+  0x00595982, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00555783, 0x00535383, 0x00525284, 0x00535184, 
+  0x004e4e83, 0x004d4d82, 0x004b4c80, 0x00464881, 
+  0x00454780, 0x0044447f, 0x0048457d, 0x0044437b, 
+  0x00434378, 0x00434279, 0x00424178, 0x00414077, 
+  0x003d3e75, 0x003d3e74, 0x003c3d73, 0x003a3b72, 
+  0x0039386f, 0x0039396c, 0x0039396c, 0x003b3c6e, 
+  0x003d3d6d, 0x003c3a63, 0x001f3f4f, 0x000c2d35, 
+  0x000c2d36, 0x002b555d, 0x005a596a, 0x00646279, 
+  0x005f5f7e, 0x005d5e81, 0x00595982, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00555783, 0x00535383, 
+  0x00525284, 0x00535184, 0x004e4e83, 0x004d4d82, 
+  0x004b4c80, 0x00464881, 0x00454780, 0x0044447f, 
+  0x0048457d, 0x0044437b, 0x00434378, 0x00434279, 
+  0x00424178, 0x00414077, 0x003d3e75, 0x003d3e74, 
+  0x003c3d73, 0x003a3b72, 0x0039386f, 0x0039396c, 
+  0x0039396c, 0x003b3c6e, 0x003d3d6d, 0x003c3a63, 
+  0x001f3f4f, 0x000c2d35, 0x000c2d36, 0x002b555d, 
+  0x005a596a, 0x00646279, 0x005f5f7e, 0x005d5e81, 
+  0x00595982, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00555783, 0x00535383, 0x00525284, 0x00535184, 
+  0x004e4e83, 0x004d4d82, 0x004b4c80, 0x00464881, 
+  0x00454780, 0x0044447f, 0x0048457d, 0x0044437b, 
+  0x00434378, 0x00434279, 0x00424178, 0x00414077, 
+  0x003d3e75, 0x003d3e74, 0x003c3d73, 0x003a3b72, 
+  0x0039386f, 0x0039396c, 0x0039396c, 0x003b3c6e, 
+  0x003d3d6d, 0x003c3a63, 0x001f3f4f, 0x000c2d35, 
+  0x0010282f, 0x0057576b, 0x00615e7c, 0x0050517e, 
+  0x0048497f, 0x0047487f, 0x0044447f, 0x00444481, 
+  0x00444481, 0x00434382, 0x00434382, 0x00444385, 
+  0x00434286, 0x00444287, 0x003f4088, 0x00413f86, 
+  0x003d3d84, 0x00393c83, 0x00393980, 0x0038387d, 
+  0x0035367c, 0x0035337a, 0x00343277, 0x00333176, 
+  0x002e2e75, 0x002d2e71, 0x002d2e6f, 0x002c2d6b, 
+  0x002a2969, 0x00292868, 0x00282865, 0x002a2a5d, 
+  0x0028285b, 0x00262858, 0x00252757, 0x00262754, 
+  0x0026264f, 0x0027294f, 0x00292a57, 0x00363669, 
+  0x003b3661, 0x000d2129, 0x0010282f, 0x0057576b, 
+  0x00615e7c, 0x0050517e, 0x0048497f, 0x0047487f, 
+  0x0044447f, 0x00444481, 0x00444481, 0x00434382, 
+  0x00434382, 0x00444385, 0x00434286, 0x00444287, 
+  0x003f4088, 0x00413f86, 0x003d3d84, 0x00393c83, 
+  0x00393980, 0x0038387d, 0x0035367c, 0x0035337a, 
+  0x00343277, 0x00333176, 0x002e2e75, 0x002d2e71, 
+  0x002d2e6f, 0x002c2d6b, 0x002a2969, 0x00292868, 
+  0x00282865, 0x002a2a5d, 0x0028285b, 0x00262858, 
+  0x00252757, 0x00262754, 0x0026264f, 0x0027294f, 
+  0x00292a57, 0x00363669, 0x003b3661, 0x000d2129, 
+  0x0010282f, 0x0057576b, 0x00615e7c, 0x0050517e, 
+  0x0048497f, 0x0047487f, 0x0044447f, 0x00444481, 
+  0x00444481, 0x00434382, 0x00434382, 0x00444385, 
+  0x00434286, 0x00444287, 0x003f4088, 0x00413f86, 
+  0x003d3d84, 0x00393c83, 0x00393980, 0x0038387d, 
+  0x0035367c, 0x00ffffff, 0x00343277, 0x00333176, 
+  0x002e2e75, 0x002d2e71, 0x002d2e6f, 0x002c2d6b, 
+  0x002a2969, 0x00292868, 0x00282865, 0x002a2a5d, 
+  0x0028285b, 0x00262858, 0x00252757, 0x00262754, 
+  0x0026264f, 0x0027294f, 0x00292a57, 0x00363669, 
+  0x003b3661, 0x000d2129, 0x001c262e, 0x005e587b, 
+  0x004d4e7b, 0x0047457a, 0x0040407b, 0x003f3f7c, 
+  0x003f3e7e, 0x003a3c7f, 0x003a3c7f, 0x00393a82, 
+  0x00393c83, 0x00393b85, 0x00383a87, 0x00383a89, 
+  0x0035378e, 0x00373988, 0x00313389, 0x00313387, 
+  0x00333182, 0x00302f7d, 0x002c2e7b, 0x002b2b79, 
+  0x002b2c77, 0x002b2b72, 0x00272670, 0x0026266d, 
+  0x0024246b, 0x00222269, 0x00212166, 0x00212260, 
+  0x0020235d, 0x00242557, 0x00201f56, 0x0021224f, 
+  0x0022204b, 0x00222049, 0x00222048, 0x00212046, 
+  0x00222048, 0x0026264f, 0x0036356c, 0x00141c2a, 
+  0x001c262e, 0x005e587b, 0x004d4e7b, 0x0047457a, 
+  0x0040407b, 0x003f3f7c, 0x003f3e7e, 0x003a3c7f, 
+  0x003a3c7f, 0x00393a82, 0x00393c83, 0x00393b85, 
+  0x00383a87, 0x00383a89, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00302f7d, 
+  0x00ffffff, 0x00ffffff, 0x002b2c77, 0x002b2b72, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00212166, 0x00212260, 0x0020235d, 0x00242557, 
+  0x00201f56, 0x0021224f, 0x0022204b, 0x00222049, 
+  0x00222048, 0x00212046, 0x00222048, 0x0026264f, 
+  0x0036356c, 0x00141c2a, 0x001c262e, 0x005e587b, 
+  0x004d4e7b, 0x0047457a, 0x0040407b, 0x003f3f7c, 
+  0x003f3e7e, 0x003a3c7f, 0x003a3c7f, 0x00393a82, 
+  0x00393c83, 0x00393b85, 0x00383a87, 0x00383a89, 
+  0x0035378e, 0x00373988, 0x00313389, 0x00313387, 
+  0x00333182, 0x00302f7d, 0x002c2e7b, 0x00ffffff, 
+  0x002b2c77, 0x002b2b72, 0x00272670, 0x0026266d, 
+  0x0024246b, 0x00222269, 0x00212166, 0x00212260, 
+  0x0020235d, 0x00242557, 0x00201f56, 0x0021224f, 
+  0x0022204b, 0x00222049, 0x00222048, 0x00212046, 
+  0x00222048, 0x0026264f, 0x0036356c, 0x00141c2a, 
+  0x00222228, 0x0055557e, 0x00434378, 0x003a3b79, 
+  0x003a3b79, 0x0035377a, 0x0035377a, 0x0035367c, 
+  0x0033357f, 0x00323481, 0x00313285, 0x00313387, 
+  0x00303289, 0x0030318b, 0x002f2f90, 0x002e2f8c, 
+  0x002f2d8a, 0x002e2d86, 0x00282985, 0x00282881, 
+  0x0028297e, 0x0023257b, 0x00262473, 0x00222270, 
+  0x0020226e, 0x0020216a, 0x001f2069, 0x001e2063, 
+  0x001e1f60, 0x001d1c5c, 0x001c1c57, 0x00201e51, 
+  0x001c1c4f, 0x001a1c4c, 0x001b1c49, 0x001b1c44, 
+  0x00191a42, 0x00191b41, 0x00191b41, 0x001b1c48, 
+  0x00262861, 0x00171529, 0x00222228, 0x0055557e, 
+  0x00434378, 0x003a3b79, 0x003a3b79, 0x0035377a, 
+  0x0035377a, 0x0035367c, 0x0033357f, 0x00323481, 
+  0x00313285, 0x00313387, 0x00303289, 0x0030318b, 
+  0x00ffffff, 0x002e2f8c, 0x00ffffff, 0x002e2d86, 
+  0x00ffffff, 0x00282881, 0x0028297e, 0x00ffffff, 
+  0x00262473, 0x00222270, 0x0020226e, 0x00ffffff, 
+  0x001f2069, 0x001e2063, 0x00ffffff, 0x001d1c5c, 
+  0x001c1c57, 0x00201e51, 0x001c1c4f, 0x001a1c4c, 
+  0x001b1c49, 0x001b1c44, 0x00191a42, 0x00191b41, 
+  0x00191b41, 0x001b1c48, 0x00262861, 0x00171529, 
+  0x00222228, 0x0055557e, 0x00434378, 0x003a3b79, 
+  0x003a3b79, 0x0035377a, 0x0035377a, 0x0035367c, 
+  0x0033357f, 0x00323481, 0x00313285, 0x00313387, 
+  0x00303289, 0x0030318b, 0x002f2f90, 0x002e2f8c, 
+  0x002f2d8a, 0x002e2d86, 0x00282985, 0x00282881, 
+  0x0028297e, 0x00ffffff, 0x00262473, 0x00222270, 
+  0x0020226e, 0x0020216a, 0x001f2069, 0x001e2063, 
+  0x001e1f60, 0x001d1c5c, 0x001c1c57, 0x00201e51, 
+  0x001c1c4f, 0x001a1c4c, 0x001b1c49, 0x001b1c44, 
+  0x00191a42, 0x00191b41, 0x00191b41, 0x001b1c48, 
+  0x00262861, 0x00171529, 0x00201f26, 0x004e4e7e, 
+  0x00393a78, 0x00363577, 0x00343377, 0x00343277, 
+  0x00313178, 0x0031307a, 0x0031307c, 0x00302f7d, 
+  0x002a2c83, 0x002a2b85, 0x00292a89, 0x00282a8d, 
+  0x0028298e, 0x0028298e, 0x0027298c, 0x0025258a, 
+  0x00222285, 0x00222380, 0x00201f7f, 0x001d1e7a, 
+  0x001d1f75, 0x001e1d71, 0x001c1e6d, 0x001a186c, 
+  0x001a1965, 0x00171860, 0x0015155e, 0x00151659, 
+  0x00141753, 0x0016184e, 0x0016194b, 0x00161749, 
+  0x00171643, 0x0016143f, 0x0017153e, 0x0017153e, 
+  0x0017153d, 0x0017173f, 0x001f205c, 0x00131126, 
+  0x00201f26, 0x004e4e7e, 0x00393a78, 0x00363577, 
+  0x00343377, 0x00343277, 0x00313178, 0x0031307a, 
+  0x0031307c, 0x00302f7d, 0x002a2c83, 0x002a2b85, 
+  0x00292a89, 0x00282a8d, 0x0028298e, 0x0028298e, 
+  0x00ffffff, 0x0025258a, 0x00222285, 0x00222380, 
+  0x00ffffff, 0x001d1e7a, 0x00ffffff, 0x001e1d71, 
+  0x001c1e6d, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x0015155e, 0x00151659, 0x00141753, 0x0016184e, 
+  0x0016194b, 0x00161749, 0x00171643, 0x0016143f, 
+  0x0017153e, 0x0017153e, 0x0017153d, 0x0017173f, 
+  0x001f205c, 0x00131126, 0x00201f26, 0x004e4e7e, 
+  0x00393a78, 0x00363577, 0x00343377, 0x00343277, 
+  0x00313178, 0x0031307a, 0x0031307c, 0x00302f7d, 
+  0x002a2c83, 0x002a2b85, 0x00292a89, 0x00282a8d, 
+  0x0028298e, 0x0028298e, 0x0027298c, 0x0025258a, 
+  0x00222285, 0x00222380, 0x00201f7f, 0x00ffffff, 
+  0x001d1f75, 0x001e1d71, 0x001c1e6d, 0x001a186c, 
+  0x001a1965, 0x00171860, 0x0015155e, 0x00151659, 
+  0x00141753, 0x0016184e, 0x0016194b, 0x00161749, 
+  0x00171643, 0x0016143f, 0x0017153e, 0x0017153e, 
+  0x0017153d, 0x0017173f, 0x001f205c, 0x00131126, 
+  0x001f1d25, 0x0047487c, 0x00353476, 0x00323175, 
+  0x002d2d76, 0x002c2d76, 0x002b2c77, 0x00292978, 
+  0x0029287c, 0x0028297e, 0x0027277f, 0x00272684, 
+  0x00272686, 0x0025258a, 0x0021218e, 0x00202194, 
+  0x001d1e8f, 0x001c1f8c, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0017176f, 
+  0x0018176d, 0x00161665, 0x00131361, 0x0014155e, 
+  0x0011145b, 0x00131553, 0x00121151, 0x0015144c, 
+  0x00111047, 0x00111143, 0x0011123f, 0x000e103e, 
+  0x000f103d, 0x000f103d, 0x000f103a, 0x0012113e, 
+  0x00191958, 0x00110f25, 0x001f1d25, 0x0047487c, 
+  0x00353476, 0x00323175, 0x002d2d76, 0x002c2d76, 
+  0x002b2c77, 0x00292978, 0x0029287c, 0x0028297e, 
+  0x0027277f, 0x00272684, 0x00272686, 0x0025258a, 
+  0x0021218e, 0x00202194, 0x00ffffff, 0x001c1f8c, 
+  0x001a1a89, 0x001c1d82, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x0017176f, 0x0018176d, 0x00ffffff, 
+  0x00131361, 0x0014155e, 0x00ffffff, 0x00131553, 
+  0x00121151, 0x0015144c, 0x00111047, 0x00111143, 
+  0x0011123f, 0x000e103e, 0x000f103d, 0x000f103d, 
+  0x000f103a, 0x0012113e, 0x00191958, 0x00110f25, 
+  0x001f1d25, 0x0047487c, 0x00353476, 0x00323175, 
+  0x002d2d76, 0x002c2d76, 0x002b2c77, 0x00292978, 
+  0x0029287c, 0x0028297e, 0x0027277f, 0x00272684, 
+  0x00272686, 0x0025258a, 0x0021218e, 0x00202194, 
+  0x001d1e8f, 0x001c1f8c, 0x001a1a89, 0x001c1d82, 
+  0x001c1c7d, 0x00ffffff, 0x00191a74, 0x0017176f, 
+  0x0018176d, 0x00161665, 0x00131361, 0x0014155e, 
+  0x0011145b, 0x00131553, 0x00121151, 0x0015144c, 
+  0x00111047, 0x00111143, 0x0011123f, 0x000e103e, 
+  0x000f103d, 0x000f103d, 0x000f103a, 0x0012113e, 
+  0x00191958, 0x00110f25, 0x001c1a23, 0x0044437b, 
+  0x002e2e75, 0x002c2c71, 0x002b2c6f, 0x00272670, 
+  0x00262573, 0x00262573, 0x00242379, 0x0023227b, 
+  0x0023217e, 0x00242181, 0x00202186, 0x001e1d88, 
+  0x001b1d8f, 0x001a1c91, 0x00181892, 0x0018188d, 
+  0x00171889, 0x00151584, 0x0015167f, 0x00151778, 
+  0x00141374, 0x00111271, 0x0010106d, 0x00101164, 
+  0x00101261, 0x000f115d, 0x000f1059, 0x000f0d52, 
+  0x000e0d4f, 0x000b0c4b, 0x000d0e45, 0x000c0d41, 
+  0x000a0f3f, 0x000b0c3e, 0x000c0d39, 0x000c0d39, 
+  0x000c0d39, 0x000f0e3b, 0x00171952, 0x000e0e24, 
+  0x001c1a23, 0x0044437b, 0x002e2e75, 0x002c2c71, 
+  0x002b2c6f, 0x00272670, 0x00262573, 0x00262573, 
+  0x00242379, 0x0023227b, 0x0023217e, 0x00242181, 
+  0x00202186, 0x001e1d88, 0x001b1d8f, 0x001a1c91, 
+  0x00ffffff, 0x0018188d, 0x00171889, 0x00ffffff, 
+  0x0015167f, 0x00151778, 0x00141374, 0x00ffffff, 
+  0x0010106d, 0x00ffffff, 0x00101261, 0x000f115d, 
+  0x00ffffff, 0x000f0d52, 0x000e0d4f, 0x000b0c4b, 
+  0x000d0e45, 0x000c0d41, 0x000a0f3f, 0x000b0c3e, 
+  0x000c0d39, 0x000c0d39, 0x000c0d39, 0x000f0e3b, 
+  0x00171952, 0x000e0e24, 0x001c1a23, 0x0044437b, 
+  0x002e2e75, 0x002c2c71, 0x002b2c6f, 0x00272670, 
+  0x00262573, 0x00262573, 0x00242379, 0x0023227b, 
+  0x0023217e, 0x00242181, 0x00202186, 0x001e1d88, 
+  0x001b1d8f, 0x001a1c91, 0x00181892, 0x0018188d, 
+  0x00171889, 0x00151584, 0x0015167f, 0x00ffffff, 
+  0x00141374, 0x00111271, 0x0010106d, 0x00101164, 
+  0x00101261, 0x000f115d, 0x000f1059, 0x000f0d52, 
+  0x000e0d4f, 0x000b0c4b, 0x000d0e45, 0x000c0d41, 
+  0x000a0f3f, 0x000b0c3e, 0x000c0d39, 0x000c0d39, 
+  0x000c0d39, 0x000f0e3b, 0x00171952, 0x000e0e24, 
+  0x001a1922, 0x003b3e7a, 0x002b2c6f, 0x0029276c, 
+  0x0023246d, 0x0023246d, 0x0020226e, 0x001f1e72, 
+  0x001d1f75, 0x001c1d7a, 0x001c1d7c, 0x001b1d80, 
+  0x00191a83, 0x00181888, 0x0017178c, 0x00151591, 
+  0x00151693, 0x00131592, 0x0012128b, 0x00111285, 
+  0x00101180, 0x000d0d7a, 0x000f1075, 0x000c0e71, 
+  0x000d0e6a, 0x000c0e64, 0x00090962, 0x000b095d, 
+  0x00080856, 0x00080954, 0x00090a4d, 0x00070849, 
+  0x000a0b42, 0x00090840, 0x0009083f, 0x000b083a, 
+  0x00080838, 0x000b0934, 0x000b0934, 0x00090939, 
+  0x00131652, 0x000c0c25, 0x001a1922, 0x003b3e7a, 
+  0x002b2c6f, 0x0029276c, 0x0023246d, 0x0023246d, 
+  0x0020226e, 0x001f1e72, 0x001d1f75, 0x001c1d7a, 
+  0x001c1d7c, 0x001b1d80, 0x00191a83, 0x00181888, 
+  0x0017178c, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x0012128b, 0x00ffffff, 0x00ffffff, 0x000d0d7a, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00080856, 0x00080954, 
+  0x00090a4d, 0x00070849, 0x000a0b42, 0x00090840, 
+  0x0009083f, 0x000b083a, 0x00080838, 0x000b0934, 
+  0x000b0934, 0x00090939, 0x00131652, 0x000c0c25, 
+  0x001a1922, 0x003b3e7a, 0x002b2c6f, 0x0029276c, 
+  0x0023246d, 0x0023246d, 0x0020226e, 0x001f1e72, 
+  0x001d1f75, 0x001c1d7a, 0x001c1d7c, 0x001b1d80, 
+  0x00191a83, 0x00181888, 0x0017178c, 0x00151591, 
+  0x00151693, 0x00131592, 0x0012128b, 0x00111285, 
+  0x00101180, 0x00ffffff, 0x000f1075, 0x000c0e71, 
+  0x000d0e6a, 0x000c0e64, 0x00090962, 0x000b095d, 
+  0x00080856, 0x00080954, 0x00090a4d, 0x00070849, 
+  0x000a0b42, 0x00090840, 0x0009083f, 0x000b083a, 
+  0x00080838, 0x000b0934, 0x000b0934, 0x00090939, 
+  0x00131652, 0x000c0c25, 0x00191721, 0x00393a78, 
+  0x0028266b, 0x0021246b, 0x0020216a, 0x001c1e6b, 
+  0x001c1e6b, 0x001a1b6e, 0x001a1c70, 0x00191a74, 
+  0x00181978, 0x0017187d, 0x00141481, 0x00141584, 
+  0x00121289, 0x0011128f, 0x00100f98, 0x00111094, 
+  0x000c0e90, 0x000c0b89, 0x000b0b84, 0x0008087f, 
+  0x00090976, 0x00080972, 0x000b0c6b, 0x00070764, 
+  0x00050562, 0x0005055d, 0x00050756, 0x00050751, 
+  0x0004054e, 0x00060547, 0x00030442, 0x00010140, 
+  0x0000003b, 0x0005033a, 0x00040436, 0x00040235, 
+  0x00060436, 0x000b083a, 0x00121153, 0x00060621, 
+  0x00191721, 0x00393a78, 0x0028266b, 0x0021246b, 
+  0x0020216a, 0x001c1e6b, 0x001c1e6b, 0x001a1b6e, 
+  0x001a1c70, 0x00191a74, 0x00181978, 0x0017187d, 
+  0x00141481, 0x00141584, 0x00121289, 0x0011128f, 
+  0x00100f98, 0x00111094, 0x000c0e90, 0x000c0b89, 
+  0x000b0b84, 0x0008087f, 0x00090976, 0x00080972, 
+  0x000b0c6b, 0x00070764, 0x00050562, 0x0005055d, 
+  0x00050756, 0x00050751, 0x0004054e, 0x00060547, 
+  0x00030442, 0x00010140, 0x0000003b, 0x0005033a, 
+  0x00040436, 0x00040235, 0x00060436, 0x000b083a, 
+  0x00121153, 0x00060621, 0x00191721, 0x00393a78, 
+  0x0028266b, 0x0021246b, 0x0020216a, 0x001c1e6b, 
+  0x001c1e6b, 0x001a1b6e, 0x001a1c70, 0x00191a74, 
+  0x00181978, 0x0017187d, 0x00141481, 0x00141584, 
+  0x00121289, 0x0011128f, 0x00100f98, 0x00111094, 
+  0x000c0e90, 0x000c0b89, 0x000b0b84, 0x00ffffff, 
+  0x00090976, 0x00080972, 0x000b0c6b, 0x00070764, 
+  0x00050562, 0x0005055d, 0x00050756, 0x00050751, 
+  0x0004054e, 0x00060547, 0x00030442, 0x00010140, 
+  0x0000003b, 0x0005033a, 0x00040436, 0x00040235, 
+  0x00060436, 0x000b083a, 0x00121153, 0x00060621, 
+  0x00161520, 0x00353476, 0x00202069, 0x001e2063, 
+  0x001b1a64, 0x001b1a64, 0x001a1965, 0x0014146d, 
+  0x0014146f, 0x00131370, 0x00141374, 0x00121278, 
+  0x000e0e7e, 0x000c0c83, 0x000c0c86, 0x000a0c8e, 
+  0x00080b94, 0x0007099a, 0x00070993, 0x0006078d, 
+  0x00050588, 0x00060680, 0x00070877, 0x00010273, 
+  0x0003026d, 0x00050465, 0x00020263, 0x00030559, 
+  0x00030256, 0x00020251, 0x0000004e, 0x00020047, 
+  0x00020040, 0x0000023c, 0x00000038, 0x00000136, 
+  0x00000135, 0x00010236, 0x00010033, 0x00010025, 
+  0x00020028, 0x00050111, 0x00161520, 0x00353476, 
+  0x00202069, 0x001e2063, 0x001b1a64, 0x001b1a64, 
+  0x001a1965, 0x0014146d, 0x0014146f, 0x00131370, 
+  0x00141374, 0x00121278, 0x000e0e7e, 0x000c0c83, 
+  0x000c0c86, 0x000a0c8e, 0x00080b94, 0x0007099a, 
+  0x00070993, 0x0006078d, 0x00050588, 0x00060680, 
+  0x00070877, 0x00010273, 0x0003026d, 0x00050465, 
+  0x00020263, 0x00030559, 0x00030256, 0x00020251, 
+  0x0000004e, 0x00020047, 0x00020040, 0x0000023c, 
+  0x00000038, 0x00000136, 0x00000135, 0x00010236, 
+  0x00010033, 0x00010025, 0x00020028, 0x00050111, 
+  0x00161520, 0x00353476, 0x00202069, 0x001e2063, 
+  0x001b1a64, 0x001b1a64, 0x001a1965, 0x0014146d, 
+  0x0014146f, 0x00131370, 0x00141374, 0x00121278, 
+  0x000e0e7e, 0x000c0c83, 0x000c0c86, 0x000a0c8e, 
+  0x00080b94, 0x0007099a, 0x00070993, 0x0006078d, 
+  0x00050588, 0x00ffffff, 0x00070877, 0x00010273, 
+  0x0003026d, 0x00050465, 0x00020263, 0x00030559, 
+  0x00030256, 0x00020251, 0x0000004e, 0x00020047, 
+  0x00020040, 0x0000023c, 0x00000038, 0x00000136, 
+  0x00000135, 0x00010236, 0x00010033, 0x00010025, 
+  0x00020028, 0x00050111, 0x0014111e, 0x002e2e75, 
+  0x001d1e61, 0x00171860, 0x00151661, 0x00131361, 
+  0x00131361, 0x00101164, 0x000f106a, 0x000e0f6e, 
+  0x000d0f72, 0x000b0b76, 0x000a0a7a, 0x00080881, 
+  0x00080785, 0x0005068c, 0x00040594, 0x00040597, 
+  0x00020397, 0x0003058f, 0x00030288, 0x00000283, 
+  0x00000079, 0x00000072, 0x0000006a, 0x00000166, 
+  0x00010060, 0x00020058, 0x00050053, 0x0001004e, 
+  0x00010049, 0x00000241, 0x0002003c, 0x00000138, 
+  0x00000137, 0x00000234, 0x0002002e, 0x00030018, 
+  0x00010007, 0x00000000, 0x00030014, 0x00050111, 
+  0x0014111e, 0x002e2e75, 0x001d1e61, 0x00171860, 
+  0x00151661, 0x00131361, 0x00131361, 0x00101164, 
+  0x000f106a, 0x000e0f6e, 0x000d0f72, 0x000b0b76, 
+  0x000a0a7a, 0x00080881, 0x00080785, 0x0005068c, 
+  0x00040594, 0x00040597, 0x00020397, 0x0003058f, 
+  0x00030288, 0x00000283, 0x00000079, 0x00000072, 
+  0x0000006a, 0x00000166, 0x00010060, 0x00020058, 
+  0x00050053, 0x0001004e, 0x00010049, 0x00000241, 
+  0x0002003c, 0x00000138, 0x00000137, 0x00000234, 
+  0x0002002e, 0x00030018, 0x00010007, 0x00000000, 
+  0x00030014, 0x00050111, 0x0014111e, 0x002e2e75, 
+  0x001d1e61, 0x00171860, 0x00151661, 0x00131361, 
+  0x00131361, 0x00101164, 0x000f106a, 0x000e0f6e, 
+  0x000d0f72, 0x000b0b76, 0x000a0a7a, 0x00080881, 
+  0x00080785, 0x0005068c, 0x00040594, 0x00040597, 
+  0x00020397, 0x0003058f, 0x00030288, 0x00000283, 
+  0x00000079, 0x00000072, 0x0000006a, 0x00000166, 
+  0x00010060, 0x00020058, 0x00050053, 0x0001004e, 
+  0x00010049, 0x00000241, 0x0002003c, 0x00000138, 
+  0x00000137, 0x00000234, 0x0002002e, 0x00030018, 
+  0x00010007, 0x00000000, 0x00030014, 0x00050111, 
+  0x0013111d, 0x002b2c6f, 0x001a185f, 0x0012155c, 
+  0x0011135d, 0x000f115d, 0x000f115d, 0x000e0d61, 
+  0x000c0e64, 0x000c0e65, 0x000a0c6f, 0x00080972, 
+  0x00070877, 0x0006067b, 0x00040582, 0x00030288, 
+  0x00020290, 0x00000096, 0x0001009a, 0x00010093, 
+  0x0000028a, 0x00010081, 0x00000078, 0x00000070, 
+  0x00000168, 0x00000062, 0x00000059, 0x00010054, 
+  0x0000004f, 0x0000004a, 0x00010047, 0x0001003f, 
+  0x0001003c, 0x00020030, 0x00030021, 0x00030012, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00050111, 0x0013111d, 0x002b2c6f, 
+  0x001a185f, 0x0012155c, 0x0011135d, 0x000f115d, 
+  0x000f115d, 0x000e0d61, 0x000c0e64, 0x000c0e65, 
+  0x000a0c6f, 0x00080972, 0x00070877, 0x0006067b, 
+  0x00040582, 0x00030288, 0x00020290, 0x00000096, 
+  0x0001009a, 0x00010093, 0x0000028a, 0x00010081, 
+  0x00000078, 0x00000070, 0x00000168, 0x00000062, 
+  0x00000059, 0x00010054, 0x0000004f, 0x0000004a, 
+  0x00010047, 0x0001003f, 0x0001003c, 0x00020030, 
+  0x00030021, 0x00030012, 0x00000003, 0x00000000, 
+  0x00000000, 0x00000001, 0x00040018, 0x00050111, 
+  0x0013111d, 0x002b2c6f, 0x001a185f, 0x0012155c, 
+  0x0011135d, 0x000f115d, 0x000f115d, 0x000e0d61, 
+  0x000c0e64, 0x000c0e65, 0x000a0c6f, 0x00080972, 
+  0x00070877, 0x0006067b, 0x00040582, 0x00030288, 
+  0x00020290, 0x00000096, 0x0001009a, 0x00010093, 
+  0x0000028a, 0x00010081, 0x00000078, 0x00000070, 
+  0x00000168, 0x00000062, 0x00000059, 0x00010054, 
+  0x0000004f, 0x0000004a, 0x00010047, 0x0001003f, 
+  0x0001003c, 0x00020030, 0x00030021, 0x00030012, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00050111, 0x00100e1c, 0x0029276c, 
+  0x0012135b, 0x00111054, 0x000c0d55, 0x000c0a5b, 
+  0x000b095d, 0x000b095d, 0x00050562, 0x00060565, 
+  0x00040667, 0x00030171, 0x00010275, 0x00000079, 
+  0x0000027d, 0x00000184, 0x0000028a, 0x0000028f, 
+  0x00000195, 0x00000190, 0x00000187, 0x00000080, 
+  0x00010078, 0x0000016f, 0x00000067, 0x0000015e, 
+  0x00000058, 0x00000152, 0x00000050, 0x00000149, 
+  0x00000040, 0x0001002a, 0x0004001b, 0x0002000c, 
+  0x00000003, 0x00000000, 0x00000001, 0x00000001, 
+  0x00000001, 0x00000003, 0x0004001b, 0x00040112, 
+  0x00100e1c, 0x0029276c, 0x0012135b, 0x00111054, 
+  0x000c0d55, 0x000c0a5b, 0x000b095d, 0x000b095d, 
+  0x00050562, 0x00060565, 0x00040667, 0x00030171, 
+  0x00010275, 0x00000079, 0x0000027d, 0x00000184, 
+  0x0000028a, 0x0000028f, 0x00000195, 0x00000190, 
+  0x00000187, 0x00000080, 0x00010078, 0x0000016f, 
+  0x00000067, 0x0000015e, 0x00000058, 0x00000152, 
+  0x00000050, 0x00000149, 0x00000040, 0x0001002a, 
+  0x0004001b, 0x0002000c, 0x00000003, 0x00000000, 
+  0x00000001, 0x00000001, 0x00000001, 0x00000003, 
+  0x0004001b, 0x00040112, 0x00100e1c, 0x0029276c, 
+  0x0012135b, 0x00111054, 0x000c0d55, 0x000c0a5b, 
+  0x000b095d, 0x000b095d, 0x00050562, 0x00060565, 
+  0x00040667, 0x00030171, 0x00010275, 0x00000079, 
+  0x0000027d, 0x00000184, 0x0000028a, 0x0000028f, 
+  0x00000195, 0x00000190, 0x00000187, 0x00000080, 
+  0x00010078, 0x0000016f, 0x00000067, 0x0000015e, 
+  0x00000058, 0x00000152, 0x00000050, 0x00000149, 
+  0x00000040, 0x0001002a, 0x0004001b, 0x0002000c, 
+  0x00000003, 0x00000000, 0x00000001, 0x00000001, 
+  0x00000001, 0x00000003, 0x0004001b, 0x00040112, 
+  0x000f0c1b, 0x0021246b, 0x00111054, 0x000d0c50, 
+  0x000a0a51, 0x00080954, 0x00050754, 0x00040558, 
+  0x0003045e, 0x00020360, 0x00010366, 0x00000168, 
+  0x0000006f, 0x00000072, 0x00000277, 0x0000007e, 
+  0x00000183, 0x00000188, 0x0000038f, 0x0000038f, 
+  0x00000188, 0x00010080, 0x00000079, 0x00020070, 
+  0x00000062, 0x0000005b, 0x00020052, 0x00020041, 
+  0x00050035, 0x00070029, 0x0004001a, 0x0002000f, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010004, 
+  0x00000003, 0x00000003, 0x00000003, 0x00010004, 
+  0x0005001e, 0x00050113, 0x000f0c1b, 0x0021246b, 
+  0x00111054, 0x000d0c50, 0x000a0a51, 0x00080954, 
+  0x00050754, 0x00040558, 0x0003045e, 0x00020360, 
+  0x00010366, 0x00000168, 0x0000006f, 0x00000072, 
+  0x00000277, 0x0000007e, 0x00000183, 0x00000188, 
+  0x0000038f, 0x0000038f, 0x00000188, 0x00010080, 
+  0x00000079, 0x00020070, 0x00000062, 0x0000005b, 
+  0x00020052, 0x00020041, 0x00050035, 0x00070029, 
+  0x0004001a, 0x0002000f, 0x00010009, 0x00010008, 
+  0x00010007, 0x00010004, 0x00000003, 0x00000003, 
+  0x00000003, 0x00010004, 0x0005001e, 0x00050113, 
+  0x000f0c1b, 0x0021246b, 0x00111054, 0x000d0c50, 
+  0x000a0a51, 0x00080954, 0x00050754, 0x00040558, 
+  0x0003045e, 0x00020360, 0x00010366, 0x00000168, 
+  0x0000006f, 0x00000072, 0x00000277, 0x0000007e, 
+  0x00000183, 0x00000188, 0x0000038f, 0x0000038f, 
+  0x00000188, 0x00010080, 0x00000079, 0x00020070, 
+  0x00000062, 0x0000005b, 0x00020052, 0x00020041, 
+  0x00050035, 0x00070029, 0x0004001a, 0x0002000f, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010004, 
+  0x00000003, 0x00000003, 0x00000003, 0x00010004, 
+  0x0005001e, 0x00050113, 0x000c0a19, 0x001c1e6a, 
+  0x000e0d4f, 0x0007084e, 0x0005054e, 0x0004054e, 
+  0x00050250, 0x00020155, 0x00010257, 0x0001005e, 
+  0x00000162, 0x00010062, 0x00000168, 0x0000006f, 
+  0x00000075, 0x00010078, 0x0001007e, 0x00000082, 
+  0x00000088, 0x0002008b, 0x0000007e, 0x0000006e, 
+  0x00000060, 0x00040054, 0x0009004b, 0x000a003f, 
+  0x00080032, 0x00070029, 0x00050020, 0x0005001d, 
+  0x00040017, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010007, 
+  0x00010007, 0x00010008, 0x0005001f, 0x00040113, 
+  0x000c0a19, 0x001c1e6a, 0x000e0d4f, 0x0007084e, 
+  0x0005054e, 0x0004054e, 0x00050250, 0x00020155, 
+  0x00010257, 0x0001005e, 0x00000162, 0x00010062, 
+  0x00000168, 0x0000006f, 0x00000075, 0x00010078, 
+  0x0001007e, 0x00000082, 0x00000088, 0x0002008b, 
+  0x0000007e, 0x0000006e, 0x00000060, 0x00040054, 
+  0x0009004b, 0x000a003f, 0x00080032, 0x00070029, 
+  0x00050020, 0x0005001d, 0x00040017, 0x00030012, 
+  0x0002000f, 0x0002000c, 0x00010009, 0x00010008, 
+  0x00010007, 0x00010007, 0x00010007, 0x00010008, 
+  0x0005001f, 0x00040113, 0x000c0a19, 0x001c1e6a, 
+  0x000e0d4f, 0x0007084e, 0x0005054e, 0x0004054e, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0001005e, 
+  0x00000162, 0x00010062, 0x00000168, 0x0000006f, 
+  0x00000075, 0x00010078, 0x0001007e, 0x00000082, 
+  0x00000088, 0x0002008b, 0x0000007e, 0x0000006e, 
+  0x00000060, 0x00040054, 0x0009004b, 0x000a003f, 
+  0x00080032, 0x00070029, 0x00050020, 0x0005001d, 
+  0x00040017, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010007, 
+  0x00010007, 0x00010008, 0x0005001f, 0x00040113, 
+  0x000b0917, 0x001b1a64, 0x0007084e, 0x00060547, 
+  0x00020247, 0x00040048, 0x0001004a, 0x0002004f, 
+  0x00000053, 0x00050055, 0x00010056, 0x00000056, 
+  0x00000154, 0x00000050, 0x00030051, 0x00050054, 
+  0x0007005d, 0x00090065, 0x000a0070, 0x000b007e, 
+  0x000c0075, 0x000f0067, 0x000f0059, 0x000d004e, 
+  0x000b0043, 0x000a003b, 0x00090034, 0x0007002c, 
+  0x00070028, 0x00060023, 0x0004001b, 0x00040017, 
+  0x00030012, 0x0002000f, 0x00ffffff, 0x0002000a, 
+  0x00010009, 0x00010009, 0x00010008, 0x00010009, 
+  0x00060023, 0x00040114, 0x000b0917, 0x001b1a64, 
+  0x0007084e, 0x00060547, 0x00020247, 0x00040048, 
+  0x0001004a, 0x0002004f, 0x00000053, 0x00050055, 
+  0x00010056, 0x00000056, 0x00000154, 0x00000050, 
+  0x00030051, 0x00050054, 0x0007005d, 0x00090065, 
+  0x000a0070, 0x000b007e, 0x000c0075, 0x000f0067, 
+  0x000f0059, 0x000d004e, 0x000b0043, 0x000a003b, 
+  0x00090034, 0x0007002c, 0x00070028, 0x00060023, 
+  0x0004001b, 0x00040017, 0x00030012, 0x0002000f, 
+  0x0002000c, 0x0002000a, 0x00010009, 0x00010009, 
+  0x00010008, 0x00010009, 0x00060023, 0x00040114, 
+  0x000b0917, 0x001b1a64, 0x0007084e, 0x00060547, 
+  0x00020247, 0x00ffffff, 0x0001004a, 0x0002004f, 
+  0x00000053, 0x00ffffff, 0x00010056, 0x00000056, 
+  0x00000154, 0x00000050, 0x00030051, 0x00050054, 
+  0x0007005d, 0x00090065, 0x000a0070, 0x000b007e, 
+  0x000c0075, 0x000f0067, 0x000f0059, 0x000d004e, 
+  0x000b0043, 0x000a003b, 0x00090034, 0x0007002c, 
+  0x00070028, 0x00060023, 0x0004001b, 0x00040017, 
+  0x00030012, 0x0002000f, 0x0002000c, 0x0002000a, 
+  0x00010009, 0x00010009, 0x00010008, 0x00010009, 
+  0x00060023, 0x00040114, 0x00080618, 0x00171861, 
+  0x00060547, 0x00020143, 0x00020043, 0x00000145, 
+  0x00ffffff, 0x0001003e, 0x00030036, 0x00050032, 
+  0x0006002e, 0x0008002e, 0x00090034, 0x00090039, 
+  0x000b0042, 0x000c004b, 0x000e0053, 0x00100061, 
+  0x000e006c, 0x000c007a, 0x000c007a, 0x000c006c, 
+  0x000c005f, 0x000d0053, 0x000c004b, 0x000b0042, 
+  0x00090037, 0x00080032, 0x0007002b, 0x00060026, 
+  0x00050020, 0x0004001b, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0002000a, 
+  0x0002000a, 0x0002000c, 0x00050024, 0x00040114, 
+  0x00080618, 0x00171861, 0x00060547, 0x00020143, 
+  0x00020043, 0x00000145, 0x00010042, 0x0001003e, 
+  0x00030036, 0x00050032, 0x0006002e, 0x0008002e, 
+  0x00090034, 0x00090039, 0x000b0042, 0x000c004b, 
+  0x000e0053, 0x00100061, 0x000e006c, 0x000c007a, 
+  0x000c007a, 0x000c006c, 0x000c005f, 0x000d0053, 
+  0x000c004b, 0x000b0042, 0x00090037, 0x00080032, 
+  0x0007002b, 0x00060026, 0x00050020, 0x0004001b, 
+  0x00030015, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x0002000c, 0x0002000a, 0x0002000a, 0x0002000c, 
+  0x00050024, 0x00040114, 0x00080618, 0x00171861, 
+  0x00060547, 0x00020143, 0x00020043, 0x00ffffff, 
+  0x00010042, 0x0001003e, 0x00030036, 0x00ffffff, 
+  0x0006002e, 0x0008002e, 0x00090034, 0x00090039, 
+  0x000b0042, 0x000c004b, 0x000e0053, 0x00100061, 
+  0x000e006c, 0x000c007a, 0x000c007a, 0x000c006c, 
+  0x000c005f, 0x000d0053, 0x000c004b, 0x000b0042, 
+  0x00090037, 0x00080032, 0x0007002b, 0x00060026, 
+  0x00050020, 0x0004001b, 0x00030015, 0x00030012, 
+  0x0002000f, 0x00ffffff, 0x00ffffff, 0x0002000a, 
+  0x0002000a, 0x0002000c, 0x00050024, 0x00040114, 
+  0x00070517, 0x00131361, 0x00010044, 0x0001003d, 
+  0x00000032, 0x00030024, 0x00ffffff, 0x00040018, 
+  0x0004001a, 0x0005001d, 0x00060026, 0x0007002b, 
+  0x00080032, 0x000a003a, 0x000b0042, 0x000a004b, 
+  0x000c0053, 0x000b005e, 0x000a0068, 0x000d0075, 
+  0x000b007e, 0x000a0070, 0x00090064, 0x000a0058, 
+  0x000b0050, 0x000a0046, 0x000a0040, 0x00090036, 
+  0x0008002e, 0x0007002a, 0x00060026, 0x0005001e, 
+  0x0004001a, 0x00030015, 0x00ffffff, 0x0002000f, 
+  0x0002000f, 0x0002000e, 0x0002000c, 0x0002000f, 
+  0x00050028, 0x00020115, 0x00070517, 0x00131361, 
+  0x00010044, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00040018, 0x0004001a, 0x0005001d, 
+  0x00060026, 0x0007002b, 0x00080032, 0x000a003a, 
+  0x00ffffff, 0x00ffffff, 0x000c0053, 0x000b005e, 
+  0x000a0068, 0x000d0075, 0x000b007e, 0x000a0070, 
+  0x00090064, 0x000a0058, 0x000b0050, 0x000a0046, 
+  0x000a0040, 0x00090036, 0x0008002e, 0x0007002a, 
+  0x00060026, 0x0005001e, 0x0004001a, 0x00030015, 
+  0x00030012, 0x0002000f, 0x0002000f, 0x0002000e, 
+  0x0002000c, 0x0002000f, 0x00050028, 0x00020115, 
+  0x00070517, 0x00131361, 0x00010044, 0x0001003d, 
+  0x00000032, 0x00ffffff, 0x0005001d, 0x00040018, 
+  0x00ffffff, 0x00ffffff, 0x00060026, 0x0007002b, 
+  0x00080032, 0x000a003a, 0x000b0042, 0x000a004b, 
+  0x000c0053, 0x000b005e, 0x000a0068, 0x000d0075, 
+  0x000b007e, 0x000a0070, 0x00090064, 0x000a0058, 
+  0x000b0050, 0x000a0046, 0x000a0040, 0x00090036, 
+  0x0008002e, 0x0007002a, 0x00060026, 0x0005001e, 
+  0x0004001a, 0x00030015, 0x00ffffff, 0x0002000f, 
+  0x0002000f, 0x00ffffff, 0x0002000c, 0x0002000f, 
+  0x00050028, 0x00020115, 0x00050417, 0x000e0e5d, 
+  0x0004002a, 0x0004001a, 0x00030012, 0x00030010, 
+  0x00ffffff, 0x00040017, 0x0004001b, 0x0005001f, 
+  0x00070028, 0x0007002c, 0x00090034, 0x00090039, 
+  0x000a0042, 0x00090048, 0x000a0052, 0x0009005c, 
+  0x00090067, 0x000a0072, 0x0009007e, 0x00090074, 
+  0x00090068, 0x0009005d, 0x000a0053, 0x0009004b, 
+  0x000b0043, 0x000a003a, 0x00090035, 0x0008002e, 
+  0x00070029, 0x00060023, 0x0005001e, 0x00ffffff, 
+  0x00030015, 0x00ffffff, 0x00030010, 0x0002000f, 
+  0x0002000f, 0x00030010, 0x0004002a, 0x00020116, 
+  0x00050417, 0x000e0e5d, 0x0004002a, 0x0004001a, 
+  0x00ffffff, 0x00030010, 0x00030012, 0x00ffffff, 
+  0x0004001b, 0x0005001f, 0x00070028, 0x0007002c, 
+  0x00090034, 0x00090039, 0x000a0042, 0x00ffffff, 
+  0x000a0052, 0x0009005c, 0x00090067, 0x000a0072, 
+  0x0009007e, 0x00090074, 0x00090068, 0x0009005d, 
+  0x000a0053, 0x0009004b, 0x000b0043, 0x000a003a, 
+  0x00090035, 0x0008002e, 0x00070029, 0x00060023, 
+  0x0005001e, 0x0004001a, 0x00030015, 0x00030012, 
+  0x00030010, 0x0002000f, 0x0002000f, 0x00030010, 
+  0x0004002a, 0x00020116, 0x00050417, 0x000e0e5d, 
+  0x0004002a, 0x0004001a, 0x00030012, 0x00ffffff, 
+  0x00030012, 0x00ffffff, 0x0004001b, 0x00ffffff, 
+  0x00070028, 0x0007002c, 0x00090034, 0x00090039, 
+  0x000a0042, 0x00090048, 0x000a0052, 0x0009005c, 
+  0x00090067, 0x000a0072, 0x0009007e, 0x00090074, 
+  0x00090068, 0x0009005d, 0x000a0053, 0x0009004b, 
+  0x000b0043, 0x000a003a, 0x00090035, 0x0008002e, 
+  0x00070029, 0x00060023, 0x0005001e, 0x0004001a, 
+  0x00030015, 0x00030012, 0x00030010, 0x00ffffff, 
+  0x0002000f, 0x00030010, 0x0004002a, 0x00020116, 
+  0x00020110, 0x00020042, 0x00030015, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00070029, 0x0008002e, 
+  0x00090034, 0x00080039, 0x00090041, 0x00090048, 
+  0x00070051, 0x00090059, 0x00070064, 0x0006006e, 
+  0x0006007a, 0x00060079, 0x0008006d, 0x00080062, 
+  0x00080056, 0x00090050, 0x00090047, 0x00090040, 
+  0x00090037, 0x00080032, 0x0007002c, 0x00070028, 
+  0x00050021, 0x00ffffff, 0x00040018, 0x00ffffff, 
+  0x00030014, 0x00030012, 0x00030012, 0x00030014, 
+  0x0003002b, 0x00020118, 0x00020110, 0x00020042, 
+  0x00030015, 0x00030010, 0x00ffffff, 0x00030014, 
+  0x00040017, 0x00ffffff, 0x0005001e, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00090034, 0x00080039, 
+  0x00090041, 0x00ffffff, 0x00070051, 0x00090059, 
+  0x00070064, 0x0006006e, 0x0006007a, 0x00060079, 
+  0x0008006d, 0x00080062, 0x00080056, 0x00090050, 
+  0x00090047, 0x00090040, 0x00090037, 0x00080032, 
+  0x0007002c, 0x00070028, 0x00050021, 0x0005001d, 
+  0x00040018, 0x00040017, 0x00030014, 0x00030012, 
+  0x00ffffff, 0x00030014, 0x0003002b, 0x00020118, 
+  0x00020110, 0x00020042, 0x00030015, 0x00030010, 
+  0x00030012, 0x00ffffff, 0x00040017, 0x00ffffff, 
+  0x0005001e, 0x00ffffff, 0x00070029, 0x0008002e, 
+  0x00090034, 0x00080039, 0x00090041, 0x00090048, 
+  0x00070051, 0x00090059, 0x00070064, 0x0006006e, 
+  0x0006007a, 0x00060079, 0x0008006d, 0x00080062, 
+  0x00080056, 0x00090050, 0x00090047, 0x00090040, 
+  0x00090037, 0x00080032, 0x0007002c, 0x00070028, 
+  0x00050021, 0x0005001d, 0x00040018, 0x00040017, 
+  0x00ffffff, 0x00030012, 0x00030012, 0x00030014, 
+  0x0003002b, 0x00020118, 0x0004010c, 0x0000013d, 
+  0x00040018, 0x00030015, 0x00030015, 0x00040017, 
+  0x00ffffff, 0x0004001b, 0x0005001e, 0x00060023, 
+  0x0007002a, 0x0008002e, 0x00070035, 0x0007003a, 
+  0x00090041, 0x00080047, 0x00060051, 0x00070058, 
+  0x00060061, 0x0006006d, 0x00050078, 0x0004007d, 
+  0x00030070, 0x00050067, 0x0006005d, 0x00060053, 
+  0x0006004d, 0x00070043, 0x0008003f, 0x00080036, 
+  0x00070032, 0x0007002b, 0x00060024, 0x0005001f, 
+  0x0005001d, 0x0004001a, 0x00040018, 0x00030015, 
+  0x00030015, 0x00040017, 0x0001002f, 0x00030119, 
+  0x0004010c, 0x0000013d, 0x00040018, 0x00030015, 
+  0x00ffffff, 0x00040017, 0x00040018, 0x00ffffff, 
+  0x0005001e, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00070035, 0x0007003a, 0x00090041, 0x00ffffff, 
+  0x00060051, 0x00070058, 0x00060061, 0x0006006d, 
+  0x00050078, 0x0004007d, 0x00030070, 0x00050067, 
+  0x0006005d, 0x00060053, 0x0006004d, 0x00070043, 
+  0x0008003f, 0x00080036, 0x00070032, 0x0007002b, 
+  0x00060024, 0x0005001f, 0x00ffffff, 0x0004001a, 
+  0x00040018, 0x00030015, 0x00ffffff, 0x00040017, 
+  0x0001002f, 0x00030119, 0x0004010c, 0x0000013d, 
+  0x00040018, 0x00030015, 0x00030015, 0x00ffffff, 
+  0x00040018, 0x0004001b, 0x00ffffff, 0x00ffffff, 
+  0x0007002a, 0x0008002e, 0x00070035, 0x0007003a, 
+  0x00090041, 0x00080047, 0x00060051, 0x00070058, 
+  0x00060061, 0x0006006d, 0x00050078, 0x0004007d, 
+  0x00030070, 0x00050067, 0x0006005d, 0x00060053, 
+  0x0006004d, 0x00070043, 0x0008003f, 0x00080036, 
+  0x00070032, 0x0007002b, 0x00060024, 0x0005001f, 
+  0x0005001d, 0x00ffffff, 0x00040018, 0x00030015, 
+  0x00030015, 0x00040017, 0x0001002f, 0x00030119, 
+  0x0003010d, 0x00020042, 0x0004001a, 0x00040018, 
+  0x00040018, 0x00040018, 0x00ffffff, 0x0005001e, 
+  0x00050021, 0x00060024, 0x0006002b, 0x00070030, 
+  0x00070035, 0x0007003a, 0x00070041, 0x00060047, 
+  0x00050050, 0x00050056, 0x0006005f, 0x0002006a, 
+  0x00030074, 0x0002007d, 0x00040074, 0x0003006c, 
+  0x0007005f, 0x00050058, 0x00050051, 0x00060048, 
+  0x00070041, 0x0007003a, 0x00060035, 0x0006002e, 
+  0x0007002a, 0x00060024, 0x0005001f, 0x0005001d, 
+  0x0004001b, 0x0004001a, 0x00040018, 0x0004001a, 
+  0x00040035, 0x0002011b, 0x0003010d, 0x00020042, 
+  0x0004001a, 0x00040018, 0x00ffffff, 0x00040018, 
+  0x0004001b, 0x00ffffff, 0x00050021, 0x00ffffff, 
+  0x0006002b, 0x00070030, 0x00070035, 0x0007003a, 
+  0x00070041, 0x00ffffff, 0x00050050, 0x00050056, 
+  0x0006005f, 0x0002006a, 0x00030074, 0x0002007d, 
+  0x00040074, 0x0003006c, 0x0007005f, 0x00050058, 
+  0x00050051, 0x00060048, 0x00070041, 0x0007003a, 
+  0x00060035, 0x0006002e, 0x0007002a, 0x00ffffff, 
+  0x0005001f, 0x0005001d, 0x0004001b, 0x0004001a, 
+  0x00ffffff, 0x0004001a, 0x00040035, 0x0002011b, 
+  0x0003010d, 0x00020042, 0x0004001a, 0x00040018, 
+  0x00040018, 0x00ffffff, 0x0004001b, 0x0005001e, 
+  0x00050021, 0x00060024, 0x0006002b, 0x00070030, 
+  0x00070035, 0x0007003a, 0x00070041, 0x00060047, 
+  0x00050050, 0x00050056, 0x0006005f, 0x0002006a, 
+  0x00030074, 0x0002007d, 0x00040074, 0x0003006c, 
+  0x0007005f, 0x00050058, 0x00050051, 0x00060048, 
+  0x00070041, 0x0007003a, 0x00060035, 0x0006002e, 
+  0x0007002a, 0x00060024, 0x0005001f, 0x0005001d, 
+  0x0004001b, 0x0004001a, 0x00040018, 0x0004001a, 
+  0x00040035, 0x0002011b, 0x0003010d, 0x00000148, 
+  0x0005001d, 0x0004001a, 0x0004001a, 0x0004001b, 
+  0x00ffffff, 0x0005001e, 0x00060023, 0x00060026, 
+  0x0006002b, 0x00080030, 0x00060036, 0x0007003a, 
+  0x00050041, 0x00040046, 0x00040050, 0x00040056, 
+  0x0003005e, 0x00010068, 0x00000073, 0x0001007d, 
+  0x00010079, 0x0006006e, 0x00020064, 0x0005005d, 
+  0x00040053, 0x0005004e, 0x00050045, 0x00060040, 
+  0x00060039, 0x00060034, 0x0006002e, 0x00070028, 
+  0x00060024, 0x00050021, 0x0005001e, 0x0005001d, 
+  0x0004001b, 0x0005001d, 0x00020037, 0x0002011d, 
+  0x0003010d, 0x00000148, 0x0005001d, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0005001e, 
+  0x00060023, 0x00060026, 0x00ffffff, 0x00ffffff, 
+  0x00060036, 0x0007003a, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00040056, 0x0003005e, 0x00010068, 
+  0x00000073, 0x0001007d, 0x00010079, 0x0006006e, 
+  0x00020064, 0x0005005d, 0x00040053, 0x0005004e, 
+  0x00050045, 0x00060040, 0x00060039, 0x00060034, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0005001d, 
+  0x00020037, 0x0002011d, 0x0003010d, 0x00000148, 
+  0x0005001d, 0x0004001a, 0x0004001a, 0x00ffffff, 
+  0x0005001d, 0x0005001e, 0x00060023, 0x00ffffff, 
+  0x0006002b, 0x00080030, 0x00060036, 0x0007003a, 
+  0x00050041, 0x00040046, 0x00040050, 0x00040056, 
+  0x0003005e, 0x00010068, 0x00000073, 0x0001007d, 
+  0x00010079, 0x0006006e, 0x00020064, 0x0005005d, 
+  0x00040053, 0x0005004e, 0x00050045, 0x00060040, 
+  0x00060039, 0x00060034, 0x0006002e, 0x00070028, 
+  0x00ffffff, 0x00ffffff, 0x0005001e, 0x0005001d, 
+  0x0004001b, 0x0005001d, 0x00020037, 0x0002011d, 
+  0x0003010d, 0x0000014b, 0x0004001e, 0x0004001b, 
+  0x0004001b, 0x0005001d, 0x0005001e, 0x0005001f, 
+  0x00060024, 0x00060028, 0x0005002c, 0x00050032, 
+  0x00050036, 0x0006003b, 0x00070041, 0x00040046, 
+  0x0004004e, 0x00020054, 0x0001005d, 0x00000066, 
+  0x00000072, 0x0000007c, 0x0001007f, 0x00020075, 
+  0x0000006a, 0x0001005f, 0x00030059, 0x00020052, 
+  0x00030048, 0x00040043, 0x0004003f, 0x00050037, 
+  0x00050032, 0x0005002c, 0x00070028, 0x00060024, 
+  0x00050021, 0x0005001f, 0x0005001e, 0x0005001f, 
+  0x0000003c, 0x0002011e, 0x0003010d, 0x0000014b, 
+  0x0004001e, 0x0004001b, 0x0004001b, 0x0005001d, 
+  0x0005001e, 0x0005001f, 0x00060024, 0x00060028, 
+  0x0005002c, 0x00050032, 0x00050036, 0x0006003b, 
+  0x00070041, 0x00040046, 0x0004004e, 0x00020054, 
+  0x0001005d, 0x00000066, 0x00000072, 0x0000007c, 
+  0x0001007f, 0x00020075, 0x0000006a, 0x0001005f, 
+  0x00030059, 0x00020052, 0x00030048, 0x00040043, 
+  0x0004003f, 0x00050037, 0x00050032, 0x00ffffff, 
+  0x00070028, 0x00060024, 0x00050021, 0x0005001f, 
+  0x0005001e, 0x0005001f, 0x0000003c, 0x0002011e, 
+  0x0003010d, 0x0000014b, 0x0004001e, 0x0004001b, 
+  0x0004001b, 0x0005001d, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00060028, 0x0005002c, 0x00050032, 
+  0x00050036, 0x0006003b, 0x00070041, 0x00040046, 
+  0x0004004e, 0x00020054, 0x0001005d, 0x00000066, 
+  0x00000072, 0x0000007c, 0x0001007f, 0x00020075, 
+  0x0000006a, 0x0001005f, 0x00030059, 0x00020052, 
+  0x00030048, 0x00040043, 0x0004003f, 0x00050037, 
+  0x00050032, 0x0005002c, 0x00070028, 0x00060024, 
+  0x00050021, 0x0005001f, 0x0005001e, 0x0005001f, 
+  0x0000003c, 0x0002011e, 0x0002010e, 0x00000051, 
+  0x00040021, 0x0005001d, 0x0005001e, 0x0005001e, 
+  0x0005001f, 0x00050021, 0x00050026, 0x00060029, 
+  0x0004002e, 0x00040034, 0x00030037, 0x0004003b, 
+  0x00040042, 0x00040047, 0x00030050, 0x00040054, 
+  0x0000005e, 0x00000066, 0x0000006f, 0x0002007c, 
+  0x00000183, 0x00000079, 0x0000006f, 0x00000066, 
+  0x0000005e, 0x00000056, 0x00030050, 0x00040047, 
+  0x00040042, 0x0004003b, 0x00050036, 0x00050032, 
+  0x0005002a, 0x00060028, 0x00050024, 0x00060023, 
+  0x00050021, 0x00050023, 0x00000041, 0x0002011f, 
+  0x0002010e, 0x00000051, 0x00040021, 0x0005001d, 
+  0x0005001e, 0x0005001e, 0x0005001f, 0x00050021, 
+  0x00050026, 0x00060029, 0x0004002e, 0x00040034, 
+  0x00030037, 0x0004003b, 0x00040042, 0x00040047, 
+  0x00030050, 0x00040054, 0x0000005e, 0x00000066, 
+  0x0000006f, 0x0002007c, 0x00000183, 0x00000079, 
+  0x0000006f, 0x00000066, 0x0000005e, 0x00000056, 
+  0x00030050, 0x00040047, 0x00040042, 0x0004003b, 
+  0x00050036, 0x00050032, 0x00ffffff, 0x00060028, 
+  0x00050024, 0x00060023, 0x00050021, 0x00050023, 
+  0x00000041, 0x0002011f, 0x0002010e, 0x00000051, 
+  0x00040021, 0x0005001d, 0x0005001e, 0x0005001e, 
+  0x0005001f, 0x00050021, 0x00050026, 0x00060029, 
+  0x0004002e, 0x00040034, 0x00030037, 0x0004003b, 
+  0x00040042, 0x00040047, 0x00030050, 0x00040054, 
+  0x0000005e, 0x00000066, 0x0000006f, 0x0002007c, 
+  0x00000183, 0x00000079, 0x0000006f, 0x00000066, 
+  0x0000005e, 0x00000056, 0x00030050, 0x00040047, 
+  0x00040042, 0x0004003b, 0x00050036, 0x00050032, 
+  0x0005002a, 0x00060028, 0x00050024, 0x00060023, 
+  0x00050021, 0x00050023, 0x00000041, 0x0002011f, 
+  0x0002010e, 0x00030055, 0x00030023, 0x0004001e, 
+  0x0005001f, 0x0005001f, 0x00050021, 0x00050024, 
+  0x00040026, 0x0005002a, 0x0004002e, 0x00030035, 
+  0x00030037, 0x0004003f, 0x00020042, 0x00030047, 
+  0x00010050, 0x00010056, 0x0002005f, 0x00000065, 
+  0x0001006e, 0x0001007a, 0x00010085, 0x00020080, 
+  0x00010078, 0x0000006d, 0x00000064, 0x0000015c, 
+  0x00000055, 0x0001004e, 0x00020046, 0x00030041, 
+  0x0002003a, 0x00050035, 0x00040030, 0x0004002b, 
+  0x00050029, 0x00040026, 0x00050024, 0x00030026, 
+  0x00030048, 0x00030122, 0x0002010e, 0x00030055, 
+  0x00030023, 0x0004001e, 0x0005001f, 0x0005001f, 
+  0x00050021, 0x00050024, 0x00040026, 0x0005002a, 
+  0x0004002e, 0x00030035, 0x00030037, 0x0004003f, 
+  0x00020042, 0x00030047, 0x00010050, 0x00010056, 
+  0x0002005f, 0x00000065, 0x0001006e, 0x0001007a, 
+  0x00010085, 0x00020080, 0x00010078, 0x0000006d, 
+  0x00000064, 0x0000015c, 0x00000055, 0x0001004e, 
+  0x00020046, 0x00030041, 0x0002003a, 0x00050035, 
+  0x00040030, 0x0004002b, 0x00050029, 0x00040026, 
+  0x00050024, 0x00030026, 0x00030048, 0x00030122, 
+  0x0002010e, 0x00030055, 0x00030023, 0x0004001e, 
+  0x0005001f, 0x0005001f, 0x00050021, 0x00050024, 
+  0x00040026, 0x0005002a, 0x0004002e, 0x00030035, 
+  0x00030037, 0x0004003f, 0x00020042, 0x00030047, 
+  0x00010050, 0x00010056, 0x0002005f, 0x00000065, 
+  0x0001006e, 0x0001007a, 0x00010085, 0x00020080, 
+  0x00010078, 0x0000006d, 0x00000064, 0x0000015c, 
+  0x00000055, 0x0001004e, 0x00020046, 0x00030041, 
+  0x0002003a, 0x00050035, 0x00040030, 0x0004002b, 
+  0x00050029, 0x00040026, 0x00050024, 0x00030026, 
+  0x00030048, 0x00030122, 0x0002010f, 0x00030256, 
+  0x00020024, 0x00030021, 0x00030021, 0x00030021, 
+  0x00040023, 0x00040024, 0x00040028, 0x0003002a, 
+  0x00020030, 0x00020035, 0x00010037, 0x0002003f, 
+  0x00020042, 0x00000148, 0x00000050, 0x00000157, 
+  0x0000005d, 0x00010068, 0x00000070, 0x0000007a, 
+  0x00010083, 0x00010086, 0x0000007c, 0x00010073, 
+  0x0000006a, 0x00020064, 0x0000015a, 0x00010053, 
+  0x0000014a, 0x00010043, 0x0002003f, 0x00010037, 
+  0x00020035, 0x00020030, 0x0003002b, 0x0003002a, 
+  0x00030029, 0x0001002a, 0x0002004d, 0x00040121, 
+  0x0002010f, 0x00030256, 0x00020024, 0x00030021, 
+  0x00030021, 0x00030021, 0x00040023, 0x00040024, 
+  0x00040028, 0x0003002a, 0x00020030, 0x00020035, 
+  0x00010037, 0x0002003f, 0x00020042, 0x00000148, 
+  0x00000050, 0x00000157, 0x0000005d, 0x00010068, 
+  0x00000070, 0x0000007a, 0x00010083, 0x00010086, 
+  0x0000007c, 0x00010073, 0x0000006a, 0x00020064, 
+  0x0000015a, 0x00010053, 0x0000014a, 0x00010043, 
+  0x0002003f, 0x00010037, 0x00020035, 0x00020030, 
+  0x0003002b, 0x0003002a, 0x00030029, 0x0001002a, 
+  0x0002004d, 0x00040121, 0x0002010f, 0x00030256, 
+  0x00020024, 0x00030021, 0x00030021, 0x00030021, 
+  0x00040023, 0x00040024, 0x00040028, 0x0003002a, 
+  0x00020030, 0x00020035, 0x00010037, 0x0002003f, 
+  0x00020042, 0x00000148, 0x00000050, 0x00000157, 
+  0x0000005d, 0x00010068, 0x00000070, 0x0000007a, 
+  0x00010083, 0x00010086, 0x0000007c, 0x00010073, 
+  0x0000006a, 0x00020064, 0x0000015a, 0x00010053, 
+  0x0000014a, 0x00010043, 0x0002003f, 0x00010037, 
+  0x00020035, 0x00020030, 0x0003002b, 0x0003002a, 
+  0x00030029, 0x0001002a, 0x0002004d, 0x00040121, 
+  0x00020110, 0x00050756, 0x00000027, 0x00010021, 
+  0x00020021, 0x00030023, 0x00030024, 0x00030026, 
+  0x00030029, 0x0001002b, 0x0001002f, 0x00010035, 
+  0x00010038, 0x00010042, 0x00010044, 0x00020049, 
+  0x00010051, 0x00030057, 0x00010060, 0x00020067, 
+  0x0000006f, 0x00000078, 0x00010087, 0x0001008d, 
+  0x00000084, 0x00000077, 0x00010071, 0x0000006a, 
+  0x00020060, 0x00010058, 0x00010052, 0x0000004a, 
+  0x00030044, 0x0000003e, 0x00010038, 0x00010035, 
+  0x00010032, 0x0000002c, 0x0000002c, 0x0001002f, 
+  0x00020053, 0x00040422, 0x00020110, 0x00050756, 
+  0x00000027, 0x00010021, 0x00020021, 0x00030023, 
+  0x00030024, 0x00030026, 0x00030029, 0x0001002b, 
+  0x0001002f, 0x00010035, 0x00010038, 0x00010042, 
+  0x00010044, 0x00020049, 0x00010051, 0x00030057, 
+  0x00010060, 0x00020067, 0x0000006f, 0x00000078, 
+  0x00010087, 0x0001008d, 0x00000084, 0x00000077, 
+  0x00010071, 0x0000006a, 0x00020060, 0x00010058, 
+  0x00010052, 0x0000004a, 0x00030044, 0x0000003e, 
+  0x00010038, 0x00010035, 0x00010032, 0x0000002c, 
+  0x0000002c, 0x0001002f, 0x00020053, 0x00040422, 
+  0x00020110, 0x00050756, 0x00000027, 0x00010021, 
+  0x00020021, 0x00030023, 0x00030024, 0x00030026, 
+  0x00030029, 0x0001002b, 0x0001002f, 0x00010035, 
+  0x00010038, 0x00010042, 0x00010044, 0x00020049, 
+  0x00010051, 0x00030057, 0x00010060, 0x00020067, 
+  0x0000006f, 0x00000078, 0x00010087, 0x0001008d, 
+  0x00000084, 0x00000077, 0x00010071, 0x0000006a, 
+  0x00020060, 0x00010058, 0x00010052, 0x0000004a, 
+  0x00030044, 0x0000003e, 0x00010038, 0x00010035, 
+  0x00010032, 0x0000002c, 0x0000002c, 0x0001002f, 
+  0x00020053, 0x00040422, 0x00030111, 0x00090756, 
+  0x0000002b, 0x00000023, 0x00000024, 0x00000024, 
+  0x00000024, 0x00010028, 0x00010029, 0x0001002b, 
+  0x00010031, 0x00010037, 0x0002003c, 0x0001003f, 
+  0x00010047, 0x0001004c, 0x00000153, 0x00010058, 
+  0x0000015f, 0x00000067, 0x00000071, 0x0001007b, 
+  0x00010083, 0x0000008c, 0x00010089, 0x00010081, 
+  0x0000007a, 0x00000070, 0x00000067, 0x0000015f, 
+  0x00000059, 0x00000153, 0x00010049, 0x00010047, 
+  0x0000013f, 0x0000003a, 0x00010037, 0x00010035, 
+  0x00000033, 0x00020036, 0x00050258, 0x00050423, 
+  0x00030111, 0x00090756, 0x0000002b, 0x00000023, 
+  0x00000024, 0x00000024, 0x00000024, 0x00010028, 
+  0x00010029, 0x0001002b, 0x00010031, 0x00010037, 
+  0x0002003c, 0x0001003f, 0x00010047, 0x0001004c, 
+  0x00000153, 0x00010058, 0x0000015f, 0x00000067, 
+  0x00000071, 0x0001007b, 0x00010083, 0x0000008c, 
+  0x00010089, 0x00010081, 0x0000007a, 0x00000070, 
+  0x00000067, 0x0000015f, 0x00000059, 0x00000153, 
+  0x00010049, 0x00010047, 0x0000013f, 0x0000003a, 
+  0x00010037, 0x00010035, 0x00000033, 0x00020036, 
+  0x00050258, 0x00050423, 0x00030111, 0x00090756, 
+  0x0000002b, 0x00000023, 0x00000024, 0x00000024, 
+  0x00000024, 0x00010028, 0x00010029, 0x0001002b, 
+  0x00010031, 0x00010037, 0x0002003c, 0x0001003f, 
+  0x00010047, 0x0001004c, 0x00000153, 0x00010058, 
+  0x0000015f, 0x00000067, 0x00000071, 0x0001007b, 
+  0x00010083, 0x0000008c, 0x00010089, 0x00010081, 
+  0x0000007a, 0x00000070, 0x00000067, 0x0000015f, 
+  0x00000059, 0x00000153, 0x00010049, 0x00010047, 
+  0x0000013f, 0x0000003a, 0x00010037, 0x00010035, 
+  0x00000033, 0x00020036, 0x00050258, 0x00050423, 
+  0x00030112, 0x000c0b55, 0x0001002f, 0x00000028, 
+  0x00000025, 0x00000025, 0x00000027, 0x0001002a, 
+  0x0000012b, 0x0001002f, 0x00020033, 0x00020038, 
+  0x0000003f, 0x00010041, 0x00020048, 0x0000014d, 
+  0x00000150, 0x00000059, 0x00ffffff, 0x00000169, 
+  0x00000073, 0x0001007e, 0x00010084, 0x0000018c, 
+  0x0000028e, 0x00000087, 0x00000080, 0x00000079, 
+  0x00020071, 0x00000169, 0x0000015e, 0x00000059, 
+  0x0002004f, 0x0000014d, 0x00020048, 0x00010041, 
+  0x0003003f, 0x0000003c, 0x0002003b, 0x0001003d, 
+  0x0005055d, 0x00060424, 0x00030112, 0x000c0b55, 
+  0x0001002f, 0x00000028, 0x00000025, 0x00000025, 
+  0x00000027, 0x0001002a, 0x0000012b, 0x0001002f, 
+  0x00020033, 0x00020038, 0x0000003f, 0x00010041, 
+  0x00020048, 0x0000014d, 0x00000150, 0x00000059, 
+  0x0001005e, 0x00000169, 0x00000073, 0x0001007e, 
+  0x00010084, 0x0000018c, 0x0000028e, 0x00000087, 
+  0x00000080, 0x00000079, 0x00020071, 0x00000169, 
+  0x0000015e, 0x00000059, 0x0002004f, 0x0000014d, 
+  0x00020048, 0x00010041, 0x0003003f, 0x0000003c, 
+  0x0002003b, 0x0001003d, 0x0005055d, 0x00060424, 
+  0x00030112, 0x000c0b55, 0x0001002f, 0x00000028, 
+  0x00000025, 0x00000025, 0x00000027, 0x0001002a, 
+  0x0000012b, 0x0001002f, 0x00020033, 0x00020038, 
+  0x0000003f, 0x00010041, 0x00020048, 0x0000014d, 
+  0x00000150, 0x00000059, 0x0001005e, 0x00000169, 
+  0x00000073, 0x0001007e, 0x00010084, 0x00ffffff, 
+  0x0000028e, 0x00000087, 0x00000080, 0x00000079, 
+  0x00020071, 0x00000169, 0x0000015e, 0x00000059, 
+  0x0002004f, 0x0000014d, 0x00020048, 0x00010041, 
+  0x0003003f, 0x0000003c, 0x0002003b, 0x0001003d, 
+  0x0005055d, 0x00060424, 0x00030112, 0x000f1059, 
+  0x00020031, 0x0002002c, 0x0002002a, 0x0001002a, 
+  0x0000002b, 0x0000002c, 0x0000002e, 0x00020030, 
+  0x00010036, 0x0002003a, 0x0001003e, 0x00010043, 
+  0x0000014a, 0x0000004f, 0x00000052, 0x00010058, 
+  0x0004005f, 0x00ffffff, 0x00000073, 0x0000007c, 
+  0x00000085, 0x0000028b, 0x00000294, 0x0000018e, 
+  0x00000186, 0x00000080, 0x00010078, 0x00000170, 
+  0x0000016b, 0x0004005f, 0x00010058, 0x00000152, 
+  0x0000004f, 0x0000014a, 0x00010047, 0x00010047, 
+  0x00020043, 0x00000244, 0x00080861, 0x00070625, 
+  0x00030112, 0x000f1059, 0x00020031, 0x0002002c, 
+  0x0002002a, 0x0001002a, 0x0000002b, 0x0000002c, 
+  0x0000002e, 0x00020030, 0x00010036, 0x0002003a, 
+  0x0001003e, 0x00010043, 0x0000014a, 0x0000004f, 
+  0x00000052, 0x00010058, 0x0004005f, 0x0000016b, 
+  0x00000073, 0x0000007c, 0x00000085, 0x0000028b, 
+  0x00000294, 0x0000018e, 0x00000186, 0x00000080, 
+  0x00010078, 0x00000170, 0x0000016b, 0x0004005f, 
+  0x00010058, 0x00000152, 0x0000004f, 0x0000014a, 
+  0x00010047, 0x00010047, 0x00020043, 0x00000244, 
+  0x00080861, 0x00070625, 0x00030112, 0x000f1059, 
+  0x00020031, 0x0002002c, 0x0002002a, 0x0001002a, 
+  0x0000002b, 0x0000002c, 0x0000002e, 0x00020030, 
+  0x00010036, 0x0002003a, 0x0001003e, 0x00010043, 
+  0x0000014a, 0x0000004f, 0x00000052, 0x00010058, 
+  0x0004005f, 0x0000016b, 0x00000073, 0x0000007c, 
+  0x00000085, 0x00ffffff, 0x00000294, 0x0000018e, 
+  0x00000186, 0x00000080, 0x00010078, 0x00000170, 
+  0x0000016b, 0x0004005f, 0x00010058, 0x00000152, 
+  0x0000004f, 0x0000014a, 0x00010047, 0x00010047, 
+  0x00020043, 0x00000244, 0x00080861, 0x00070625, 
+  0x00020112, 0x0011125a, 0x00010033, 0x0000002d, 
+  0x0000002d, 0x0003002e, 0x0003002e, 0x00010030, 
+  0x00000031, 0x00030032, 0x00020037, 0x0000003c, 
+  0x0001003f, 0x00020043, 0x0000014b, 0x0000004f, 
+  0x00010056, 0x0004005a, 0x00000062, 0x00ffffff, 
+  0x00000071, 0x0000017c, 0x00000184, 0x0000028b, 
+  0x00000192, 0x00000192, 0x0000038b, 0x00000187, 
+  0x0000017f, 0x00000079, 0x00000071, 0x0000016a, 
+  0x00000062, 0x0004005a, 0x00010056, 0x00020052, 
+  0x0000004f, 0x0000004e, 0x0000004d, 0x00000150, 
+  0x000c0e64, 0x00080724, 0x00020112, 0x0011125a, 
+  0x00010033, 0x0000002d, 0x0000002d, 0x0003002e, 
+  0x0003002e, 0x00010030, 0x00000031, 0x00030032, 
+  0x00020037, 0x0000003c, 0x0001003f, 0x00020043, 
+  0x0000014b, 0x0000004f, 0x00010056, 0x0004005a, 
+  0x00000062, 0x0000016a, 0x00000071, 0x0000017c, 
+  0x00000184, 0x0000028b, 0x00000192, 0x00000192, 
+  0x0000038b, 0x00000187, 0x0000017f, 0x00000079, 
+  0x00000071, 0x0000016a, 0x00000062, 0x0004005a, 
+  0x00010056, 0x00020052, 0x0000004f, 0x0000004e, 
+  0x0000004d, 0x00000150, 0x000c0e64, 0x00080724, 
+  0x00020112, 0x0011125a, 0x00010033, 0x0000002d, 
+  0x0000002d, 0x0003002e, 0x0003002e, 0x00010030, 
+  0x00000031, 0x00030032, 0x00020037, 0x0000003c, 
+  0x0001003f, 0x00020043, 0x0000014b, 0x0000004f, 
+  0x00010056, 0x0004005a, 0x00000062, 0x0000016a, 
+  0x00000071, 0x0000017c, 0x00ffffff, 0x0000028b, 
+  0x00000192, 0x00000192, 0x0000038b, 0x00000187, 
+  0x0000017f, 0x00000079, 0x00000071, 0x0000016a, 
+  0x00000062, 0x0004005a, 0x00010056, 0x00020052, 
+  0x0000004f, 0x0000004e, 0x0000004d, 0x00000150, 
+  0x000c0e64, 0x00080724, 0x00030214, 0x0013145a, 
+  0x00000034, 0x00000130, 0x0003002f, 0x0001002f, 
+  0x00040030, 0x00030030, 0x00000232, 0x00020033, 
+  0x00000138, 0x0000003d, 0x00010040, 0x00000244, 
+  0x0000004d, 0x00000051, 0x00000157, 0x0001005f, 
+  0x00000164, 0x00ffffff, 0x00000071, 0x0000007b, 
+  0x00000184, 0x0000018c, 0x00000193, 0x0001009a, 
+  0x00010095, 0x0000018d, 0x00000386, 0x00010080, 
+  0x00010076, 0x00000070, 0x00000069, 0x00000164, 
+  0x00000260, 0x0001005e, 0x00020057, 0x00000256, 
+  0x00000256, 0x00010257, 0x000e1067, 0x00090725, 
+  0x00030214, 0x0013145a, 0x00000034, 0x00000130, 
+  0x0003002f, 0x0001002f, 0x00040030, 0x00030030, 
+  0x00000232, 0x00020033, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00000243, 0x0000004b, 0x00000050, 
+  0x00000156, 0x0001005e, 0x00000164, 0x0000016b, 
+  0x00000071, 0x0000007b, 0x00000184, 0x0000018c, 
+  0x00000193, 0x00ffffff, 0x00ffffff, 0x0000018c, 
+  0x00000384, 0x0001007e, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00000162, 0x0000025e, 0x0001005d, 
+  0x00020056, 0x00000255, 0x00000256, 0x00010257, 
+  0x000e1067, 0x00090725, 0x00030214, 0x0013145a, 
+  0x00000034, 0x00000130, 0x0003002f, 0x0001002f, 
+  0x00040030, 0x00030030, 0x00000232, 0x00020033, 
+  0x00000138, 0x0000003d, 0x00010040, 0x00000244, 
+  0x0000004d, 0x00000051, 0x00000157, 0x0001005f, 
+  0x00000164, 0x0000016b, 0x00000071, 0x0000007b, 
+  0x00ffffff, 0x0000018c, 0x00000193, 0x0001009a, 
+  0x00010095, 0x0000018d, 0x00000386, 0x00010080, 
+  0x00010076, 0x00000070, 0x00000069, 0x00000164, 
+  0x00000260, 0x0001005e, 0x00020057, 0x00000256, 
+  0x00000256, 0x00010257, 0x000e1067, 0x00090725, 
+  0x00030214, 0x0015155a, 0x00040234, 0x00000131, 
+  0x00000131, 0x00020030, 0x00020031, 0x00000133, 
+  0x00000134, 0x00010037, 0x00000139, 0x0000013f, 
+  0x00000241, 0x00010046, 0x0002004f, 0x00010053, 
+  0x00000058, 0x00030060, 0x00000166, 0x0000006a, 
+  0x00ffffff, 0x0000007a, 0x00000284, 0x0005028b, 
+  0x0003058f, 0x00020397, 0x00020397, 0x00020392, 
+  0x0004028d, 0x00030386, 0x0000027d, 0x00000076, 
+  0x00000071, 0x0000006b, 0x00000166, 0x00000063, 
+  0x0001025f, 0x0001025e, 0x0001025e, 0x0001045f, 
+  0x0011106e, 0x000c0b25, 0x00030214, 0x0015155a, 
+  0x00040234, 0x00000131, 0x00000131, 0x00020030, 
+  0x00020031, 0x00000133, 0x00000134, 0x00010037, 
+  0x00ffffff, 0x0000013e, 0x00ffffff, 0x00010042, 
+  0x0002004b, 0x00ffffff, 0x00000054, 0x0003005d, 
+  0x00000164, 0x00000069, 0x00000174, 0x0000007a, 
+  0x00000284, 0x0005028b, 0x0003058f, 0x00020396, 
+  0x00ffffff, 0x0002038f, 0x00040289, 0x00030381, 
+  0x00ffffff, 0x00000071, 0x00ffffff, 0x00000065, 
+  0x00000161, 0x0000005e, 0x0001025c, 0x0001025c, 
+  0x0001025d, 0x0001045f, 0x0011106e, 0x000c0b25, 
+  0x00030214, 0x0015155a, 0x00040234, 0x00000131, 
+  0x00000131, 0x00020030, 0x00020031, 0x00000133, 
+  0x00000134, 0x00010037, 0x00000139, 0x0000013f, 
+  0x00000241, 0x00010046, 0x0002004f, 0x00010053, 
+  0x00000058, 0x00030060, 0x00000166, 0x0000006a, 
+  0x00000174, 0x00ffffff, 0x00000284, 0x0005028b, 
+  0x0003058f, 0x00020397, 0x00020397, 0x00020392, 
+  0x0004028d, 0x00030386, 0x0000027d, 0x00000076, 
+  0x00000071, 0x0000006b, 0x00000166, 0x00000063, 
+  0x0001025f, 0x0001025e, 0x0001025e, 0x0001045f, 
+  0x0011106e, 0x000c0b25, 0x00030213, 0x001a195b, 
+  0x00050434, 0x00000232, 0x00000031, 0x00000032, 
+  0x00010033, 0x00010033, 0x00000136, 0x00010039, 
+  0x0000023c, 0x00020042, 0x00020047, 0x00040048, 
+  0x0002004f, 0x00020155, 0x00010559, 0x0001045f, 
+  0x00010366, 0x0000026b, 0x00ffffff, 0x00030378, 
+  0x00060680, 0x00050588, 0x0005068e, 0x00040594, 
+  0x0005069a, 0x00040595, 0x0004058f, 0x00050588, 
+  0x00050581, 0x0006067b, 0x00030475, 0x00020272, 
+  0x0004056a, 0x00030366, 0x00050465, 0x00050462, 
+  0x00050462, 0x00060565, 0x00141371, 0x000c0c25, 
+  0x00030213, 0x001a195b, 0x00050434, 0x00000232, 
+  0x00000031, 0x00000032, 0x00010033, 0x00010033, 
+  0x00000136, 0x00010039, 0x00ffffff, 0x0002003f, 
+  0x00020042, 0x00040042, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00010360, 0x00000266, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x0005068a, 0x0004058e, 0x00ffffff, 0x0004058c, 
+  0x00040585, 0x0005057d, 0x00ffffff, 0x00060671, 
+  0x0003046a, 0x00020267, 0x00040560, 0x0003035d, 
+  0x0005045f, 0x0005045e, 0x00050460, 0x00060564, 
+  0x00141371, 0x000c0c25, 0x00030213, 0x001a195b, 
+  0x00050434, 0x00000232, 0x00000031, 0x00000032, 
+  0x00010033, 0x00010033, 0x00000136, 0x00010039, 
+  0x0000023c, 0x00020042, 0x00020047, 0x00040048, 
+  0x0002004f, 0x00020155, 0x00010559, 0x0001045f, 
+  0x00010366, 0x0000026b, 0x00020272, 0x00ffffff, 
+  0x00060680, 0x00050588, 0x0005068e, 0x00040594, 
+  0x0005069a, 0x00040595, 0x0004058f, 0x00050588, 
+  0x00050581, 0x0006067b, 0x00030475, 0x00020272, 
+  0x0004056a, 0x00030366, 0x00050465, 0x00050462, 
+  0x00050462, 0x00060565, 0x00141371, 0x000c0c25, 
+  0x00040214, 0x001d1c5c, 0x000b0934, 0x00020432, 
+  0x00000033, 0x00000033, 0x00000034, 0x00020335, 
+  0x00010236, 0x0000003a, 0x00010040, 0x00020143, 
+  0x00020346, 0x00060449, 0x00040550, 0x00040652, 
+  0x00040558, 0x00050560, 0x00060565, 0x00060669, 
+  0x000a0b70, 0x00ffffff, 0x00070780, 0x00080984, 
+  0x000a0a89, 0x00090a90, 0x00090a99, 0x000a0c95, 
+  0x00080993, 0x000a0a89, 0x00080986, 0x00070880, 
+  0x0007097b, 0x00070974, 0x00080972, 0x00060570, 
+  0x00060669, 0x00080767, 0x00080767, 0x000b0c68, 
+  0x001a1c73, 0x000e0c26, 0x00040214, 0x001d1c5c, 
+  0x000b0934, 0x00020432, 0x00000033, 0x00000033, 
+  0x00000034, 0x00020335, 0x00010236, 0x00000039, 
+  0x00ffffff, 0x0002013e, 0x0002033f, 0x0005033f, 
+  0x00030444, 0x00ffffff, 0x0003044b, 0x00040454, 
+  0x0005045a, 0x00050560, 0x00090a68, 0x00ffffff, 
+  0x00070778, 0x0008087c, 0x00090980, 0x00080984, 
+  0x00ffffff, 0x00090b85, 0x00070882, 0x00090977, 
+  0x00ffffff, 0x0006076f, 0x0006086a, 0x00060862, 
+  0x00070862, 0x00050462, 0x0005055f, 0x00080761, 
+  0x00080764, 0x000b0c67, 0x001a1c73, 0x000e0c26, 
+  0x00040214, 0x001d1c5c, 0x000b0934, 0x00020432, 
+  0x00000033, 0x00000033, 0x00000034, 0x00020335, 
+  0x00010236, 0x0000003a, 0x00010040, 0x00020143, 
+  0x00020346, 0x00060449, 0x00040550, 0x00040652, 
+  0x00040558, 0x00050560, 0x00060565, 0x00060669, 
+  0x00ffffff, 0x00080877, 0x00070780, 0x00080984, 
+  0x000a0a89, 0x00090a90, 0x00090a99, 0x000a0c95, 
+  0x00080993, 0x000a0a89, 0x00080986, 0x00070880, 
+  0x0007097b, 0x00070974, 0x00080972, 0x00060570, 
+  0x00060669, 0x00080767, 0x00080767, 0x000b0c68, 
+  0x001a1c73, 0x000e0c26, 0x000b0a1a, 0x001f215f, 
+  0x000b0d39, 0x00040234, 0x00040234, 0x00040235, 
+  0x00040235, 0x00040436, 0x0000003b, 0x0002023d, 
+  0x00050141, 0x00060643, 0x00060547, 0x0004054e, 
+  0x00050751, 0x00050556, 0x0005055e, 0x00080861, 
+  0x00080765, 0x000b0c6b, 0x000b0c71, 0x00ffffff, 
+  0x000a0c7f, 0x000b0c84, 0x000c0b89, 0x000f0f8b, 
+  0x00111094, 0x00101197, 0x00101093, 0x000e0f8f, 
+  0x000c0b89, 0x000c0c83, 0x000a0c7f, 0x000a0a7a, 
+  0x00090976, 0x000c0d72, 0x000c0c6f, 0x000b0b6e, 
+  0x000b0b6e, 0x000e0e6f, 0x001d1e7a, 0x00131229, 
+  0x000b0a1a, 0x001f215f, 0x000b0d39, 0x00040234, 
+  0x00040234, 0x00040235, 0x00040235, 0x00040436, 
+  0x0000003b, 0x0002023c, 0x00ffffff, 0x0005053c, 
+  0x0005043d, 0x0003043f, 0x00040540, 0x00ffffff, 
+  0x0004044a, 0x0006064e, 0x00ffffff, 0x00090a5b, 
+  0x000a0a63, 0x00ffffff, 0x00090b72, 0x000a0b77, 
+  0x000b0a79, 0x000d0d78, 0x00ffffff, 0x000d0e7f, 
+  0x000d0d7a, 0x000b0c74, 0x00ffffff, 0x000a0a6a, 
+  0x00080a65, 0x00080860, 0x0007075f, 0x000a0b5e, 
+  0x000a0a61, 0x000a0a65, 0x000b0b6a, 0x000e0e6e, 
+  0x001d1e7a, 0x00131229, 0x000b0a1a, 0x001f215f, 
+  0x000b0d39, 0x00040234, 0x00040234, 0x00040235, 
+  0x00040235, 0x00040436, 0x0000003b, 0x0002023d, 
+  0x00050141, 0x00060643, 0x00060547, 0x0004054e, 
+  0x00050751, 0x00050556, 0x0005055e, 0x00080861, 
+  0x00080765, 0x000b0c6b, 0x00ffffff, 0x000b0b76, 
+  0x000a0c7f, 0x000b0c84, 0x000c0b89, 0x000f0f8b, 
+  0x00111094, 0x00101197, 0x00101093, 0x000e0f8f, 
+  0x000c0b89, 0x000c0c83, 0x000a0c7f, 0x000a0a7a, 
+  0x00090976, 0x000c0d72, 0x000c0c6f, 0x000b0b6e, 
+  0x000b0b6e, 0x000e0e6f, 0x001d1e7a, 0x00131229, 
+  0x000e1925, 0x00242262, 0x00111143, 0x000b0934, 
+  0x00060734, 0x00050535, 0x00050535, 0x00040439, 
+  0x0005023d, 0x00040541, 0x00060641, 0x00060745, 
+  0x0006064d, 0x0006074f, 0x00080954, 0x00080856, 
+  0x00090a5f, 0x00090964, 0x000b0c68, 0x000c0c6f, 
+  0x000d0f72, 0x00ffffff, 0x000e0e7e, 0x000f1383, 
+  0x00101087, 0x0013138a, 0x00131491, 0x00151693, 
+  0x00151693, 0x0014158e, 0x0013138a, 0x00101087, 
+  0x00121382, 0x0012107f, 0x000f0f7a, 0x000e0e79, 
+  0x000f1075, 0x000f1172, 0x000f1172, 0x00171573, 
+  0x002b297d, 0x00121529, 0x000e1925, 0x00242262, 
+  0x00111143, 0x000b0934, 0x00060734, 0x00050535, 
+  0x00050535, 0x00040439, 0x0005023d, 0x0004053f, 
+  0x0006063d, 0x00ffffff, 0x00ffffff, 0x0005053d, 
+  0x0006073f, 0x0006063f, 0x00ffffff, 0x00ffffff, 
+  0x0008094f, 0x00090957, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x000c106c, 0x000d0d6e, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00101173, 0x000f106c, 
+  0x000f0f6b, 0x00ffffff, 0x00ffffff, 0x000d0c5f, 
+  0x000c0c5f, 0x000b0b61, 0x000d0e64, 0x000e0f68, 
+  0x000e106e, 0x00171571, 0x002b297d, 0x00121529, 
+  0x000e1925, 0x00242262, 0x00111143, 0x000b0934, 
+  0x00060734, 0x00050535, 0x00050535, 0x00040439, 
+  0x0005023d, 0x00040541, 0x00060641, 0x00060745, 
+  0x0006064d, 0x0006074f, 0x00080954, 0x00080856, 
+  0x00090a5f, 0x00090964, 0x000b0c68, 0x00ffffff, 
+  0x000d0f72, 0x00101176, 0x000e0e7e, 0x000f1383, 
+  0x00101087, 0x0013138a, 0x00131491, 0x00151693, 
+  0x00151693, 0x0014158e, 0x0013138a, 0x00101087, 
+  0x00121382, 0x0012107f, 0x000f0f7a, 0x000e0e79, 
+  0x000f1075, 0x000f1172, 0x000f1172, 0x00171573, 
+  0x002b297d, 0x00121529, 0x000b212b, 0x002a285b, 
+  0x0023255e, 0x00111143, 0x000b0d3b, 0x000b0d39, 
+  0x000b093c, 0x00090a3e, 0x000a0b41, 0x000a0b42, 
+  0x00090c46, 0x000a0b4c, 0x000a0a4f, 0x000e0c53, 
+  0x000c0b55, 0x000e0e5d, 0x000d0f63, 0x000d0e6a, 
+  0x000e0e6f, 0x00101271, 0x00141374, 0x00141477, 
+  0x0017187d, 0x00161681, 0x00161686, 0x00191989, 
+  0x00191a8d, 0x001b1d90, 0x001c1c95, 0x001b1d90, 
+  0x00191a8d, 0x00171789, 0x00181885, 0x00151582, 
+  0x0018197e, 0x0017187d, 0x0014137d, 0x00151778, 
+  0x00191a77, 0x0028297e, 0x00322d68, 0x000c1b25, 
+  0x000b212b, 0x002a285b, 0x0023255e, 0x00111143, 
+  0x000b0d3b, 0x000b0d39, 0x000b093c, 0x00090a3e, 
+  0x000a0b41, 0x000a0b40, 0x00080b41, 0x00090a43, 
+  0x00080841, 0x000b0940, 0x0009083f, 0x000a0a43, 
+  0x00090b47, 0x00090a4b, 0x000a0a50, 0x000c0d53, 
+  0x000f0e56, 0x000f0f59, 0x0011125f, 0x00111162, 
+  0x00101064, 0x00121265, 0x00121367, 0x0014156b, 
+  0x00151570, 0x0014156a, 0x0013136a, 0x00111167, 
+  0x00121263, 0x000f0f5f, 0x00131462, 0x00131365, 
+  0x0011106b, 0x0013156e, 0x00181973, 0x0028297d, 
+  0x00322d68, 0x000c1b25, 0x000b212b, 0x002a285b, 
+  0x0023255e, 0x00111143, 0x000b0d3b, 0x000b0d39, 
+  0x000b093c, 0x00090a3e, 0x000a0b41, 0x000a0b42, 
+  0x00090c46, 0x000a0b4c, 0x000a0a4f, 0x000e0c53, 
+  0x000c0b55, 0x000e0e5d, 0x000d0f63, 0x000d0e6a, 
+  0x000e0e6f, 0x00101271, 0x00141374, 0x00141477, 
+  0x0017187d, 0x00161681, 0x00161686, 0x00191989, 
+  0x00191a8d, 0x001b1d90, 0x001c1c95, 0x001b1d90, 
+  0x00191a8d, 0x00171789, 0x00181885, 0x00151582, 
+  0x0018197e, 0x0017187d, 0x0014137d, 0x00151778, 
+  0x00191a77, 0x0028297e, 0x00322d68, 0x000c1b25, 
+  0x000c2d35, 0x00143149, 0x0029275c, 0x002a2868, 
+  0x0020235d, 0x00201f57, 0x001c1c57, 0x001c1c59, 
+  0x001b1b5a, 0x001d1c5c, 0x001c1b5f, 0x001e1f60, 
+  0x001d1d64, 0x001c1e6a, 0x001c1e6d, 0x001e1e6d, 
+  0x001f1e72, 0x001e2076, 0x00202079, 0x0023227b, 
+  0x0023247e, 0x00232480, 0x00272782, 0x00292785, 
+  0x00282889, 0x0028288d, 0x002d2b91, 0x002d2d90, 
+  0x002d2d90, 0x002d2d90, 0x002c2e91, 0x002d2c8d, 
+  0x00282a8b, 0x00282889, 0x00282988, 0x00282785, 
+  0x00272784, 0x00292b81, 0x0032317f, 0x00302e6b, 
+  0x00172d45, 0x000b2a34, 0x000c2d35, 0x00143149, 
+  0x0029275c, 0x002a2868, 0x0020235d, 0x00201f57, 
+  0x001c1c57, 0x001c1c59, 0x001b1b5a, 0x001c1b59, 
+  0x001a1959, 0x001b1b55, 0x00181854, 0x00161753, 
+  0x00151752, 0x00161650, 0x00171654, 0x00161755, 
+  0x00171758, 0x001a195b, 0x001a1b5d, 0x001a1b5e, 
+  0x001d1d61, 0x001f1d63, 0x001d1d64, 0x001d1d67, 
+  0x00211f6a, 0x0021216a, 0x0022226b, 0x00212169, 
+  0x0021226d, 0x0022216a, 0x001e1f68, 0x001e1e66, 
+  0x0020206c, 0x0021206d, 0x00222273, 0x00262776, 
+  0x00302f7b, 0x002f2d6a, 0x00172d45, 0x000b2a34, 
+  0x000c2d35, 0x00143149, 0x0029275c, 0x002a2868, 
+  0x0020235d, 0x00201f57, 0x001c1c57, 0x001c1c59, 
+  0x001b1b5a, 0x001d1c5c, 0x001c1b5f, 0x001e1f60, 
+  0x001d1d64, 0x001c1e6a, 0x001c1e6d, 0x001e1e6d, 
+  0x001f1e72, 0x001e2076, 0x00202079, 0x0023227b, 
+  0x0023247e, 0x00232480, 0x00272782, 0x00292785, 
+  0x00282889, 0x0028288d, 0x002d2b91, 0x002d2d90, 
+  0x002d2d90, 0x002d2d90, 0x002c2e91, 0x002d2c8d, 
+  0x00282a8b, 0x00282889, 0x00282988, 0x00282785, 
+  0x00272784, 0x00292b81, 0x0032317f, 0x00302e6b, 
+  0x00172d45, 0x000b2a34, 0x000e2a34, 0x000c2c35, 
+  0x000c1d26, 0x00121828, 0x00141328, 0x00110f25, 
+  0x00100f24, 0x00100f24, 0x000f0e24, 0x000f0e24, 
+  0x00100e24, 0x00110f25, 0x00110f25, 0x00110f25, 
+  0x00110f25, 0x00110f26, 0x00110f26, 0x00110f26, 
+  0x00111026, 0x00110f29, 0x00110f29, 0x00121129, 
+  0x00121129, 0x00131229, 0x00131229, 0x0013112b, 
+  0x0013122c, 0x0014122c, 0x0013122d, 0x0013122d, 
+  0x0014122c, 0x0013122c, 0x0013122b, 0x0013112a, 
+  0x0013112a, 0x00131229, 0x00131229, 0x0016152b, 
+  0x0014172a, 0x000c1a25, 0x000c2a33, 0x000f2b34, 
+  0x000e2a34, 0x000c2c35, 0x000c1d26, 0x00121828, 
+  0x00141328, 0x00110f25, 0x00100f24, 0x00100f24, 
+  0x000f0e24, 0x000f0e23, 0x000f0d22, 0x000f0e21, 
+  0x000f0d20, 0x000e0c1e, 0x000d0c1d, 0x000d0c1d, 
+  0x000d0b1d, 0x000d0b1c, 0x000d0c1c, 0x000d0b1f, 
+  0x000d0b1f, 0x000d0d1e, 0x000d0d1e, 0x000e0d1e, 
+  0x000e0d1e, 0x000e0d20, 0x000e0d21, 0x000f0d21, 
+  0x000e0e22, 0x000e0d22, 0x000f0e22, 0x000f0e22, 
+  0x000f0e21, 0x000f0d20, 0x000f0e22, 0x00100f23, 
+  0x00111024, 0x00141428, 0x00131629, 0x000c1a25, 
+  0x000c2a33, 0x000f2b34, 0x000e2a34, 0x000c2c35, 
+  0x000c1d26, 0x00121828, 0x00141328, 0x00110f25, 
+  0x00100f24, 0x00100f24, 0x000f0e24, 0x000f0e24, 
+  0x00100e24, 0x00110f25, 0x00110f25, 0x00110f25, 
+  0x00110f25, 0x00110f26, 0x00110f26, 0x00110f26, 
+  0x00111026, 0x00110f29, 0x00110f29, 0x00121129, 
+  0x00121129, 0x00131229, 0x00131229, 0x0013112b, 
+  0x0013122c, 0x0014122c, 0x0013122d, 0x0013122d, 
+  0x0014122c, 0x0013122c, 0x0013122b, 0x0013112a, 
+  0x0013112a, 0x00131229, 0x00131229, 0x0016152b, 
+  0x0014172a, 0x000c1a25, 0x000c2a33, 0x000f2b34, 
+  0x000e2a34, 0x000c2c36, 0x00102731, 0x001d282f, 
+  0x0027252b, 0x0028252b, 0x0028262b, 0x0027252b, 
+  0x0027252b, 0x0025242b, 0x00272628, 0x00252329, 
+  0x00252329, 0x00252329, 0x00242328, 0x00242228, 
+  0x00222128, 0x00232228, 0x00232127, 0x00211f27, 
+  0x00201e26, 0x00201e26, 0x00201e26, 0x001f1d26, 
+  0x001e1d26, 0x001f1d25, 0x001e1c26, 0x001c1c24, 
+  0x001c1c23, 0x001c1a23, 0x001c1a22, 0x001a1923, 
+  0x001a1922, 0x001a1922, 0x001a1921, 0x00191821, 
+  0x001a1721, 0x001a1922, 0x00161f29, 0x000e242d, 
+  0x000c2c35, 0x000e2a34, 0x000e2a34, 0x000c2c36, 
+  0x00102731, 0x001d282f, 0x0027252b, 0x0028252b, 
+  0x0028262b, 0x0027252b, 0x0027252b, 0x0024232a, 
+  0x00252526, 0x00222126, 0x00211f25, 0x00201e23, 
+  0x001e1d21, 0x001e1c21, 0x001c1b20, 0x001c1b20, 
+  0x001c1a1f, 0x001a181f, 0x0019171e, 0x0019171d, 
+  0x0019171d, 0x0018161d, 0x0017161d, 0x0018161c, 
+  0x0017161d, 0x0016161c, 0x0016161c, 0x0016141b, 
+  0x0016151b, 0x0015141c, 0x0015141c, 0x0015141c, 
+  0x0016151c, 0x0016151d, 0x0018151e, 0x00181820, 
+  0x00151e28, 0x000e242d, 0x000c2c35, 0x000e2a34, 
+  0x000e2a34, 0x000c2c36, 0x00102731, 0x001d282f, 
+  0x0027252b, 0x0028252b, 0x0028262b, 0x0027252b, 
+  0x0027252b, 0x0025242b, 0x00272628, 0x00252329, 
+  0x00252329, 0x00252329, 0x00242328, 0x00242228, 
+  0x00222128, 0x00232228, 0x00232127, 0x00211f27, 
+  0x00201e26, 0x00201e26, 0x00201e26, 0x001f1d26, 
+  0x001e1d26, 0x001f1d25, 0x001e1c26, 0x001c1c24, 
+  0x001c1c23, 0x001c1a23, 0x001c1a22, 0x001a1923, 
+  0x001a1922, 0x001a1922, 0x001a1921, 0x00191821, 
+  0x001a1721, 0x001a1922, 0x00161f29, 0x000e242d, 
+  0x000c2c35, 0x000e2a34, 0x000c2d36, 0x002b555d, 
+  0x005a596a, 0x00646279, 0x005f5f7e, 0x005d5e81, 
+  0x00595982, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00555783, 0x00535383, 0x00525284, 0x00535184, 
+  0x004e4e83, 0x004d4d82, 0x004b4c80, 0x00464881, 
+  0x00454780, 0x0044447f, 0x0048457d, 0x0044437b, 
+  0x00434378, 0x00434279, 0x00424178, 0x00414077, 
+  0x003d3e75, 0x003d3e74, 0x003c3d73, 0x003a3b72, 
+  0x0039386f, 0x0039396c, 0x0039396c, 0x003b3c6e, 
+  0x003d3d6d, 0x003c3a63, 0x001f3f4f, 0x000c2d35, 
+  0x000c2d36, 0x002b555d, 0x005a596a, 0x00646279, 
+  0x005f5f7e, 0x005d5e81, 0x00595982, 0x00565783, 
+  0x00565783, 0x00555682, 0x00545580, 0x0052537d, 
+  0x0050517a, 0x004e4f77, 0x004c4e75, 0x00494974, 
+  0x00484874, 0x00484773, 0x00434371, 0x00424270, 
+  0x0040406c, 0x003a3c6c, 0x003a3b6b, 0x0039396a, 
+  0x003c3967, 0x00393867, 0x00383865, 0x00393866, 
+  0x00383766, 0x00373665, 0x00343564, 0x00353665, 
+  0x00343565, 0x00333464, 0x00333264, 0x00343463, 
+  0x00353565, 0x00393a6a, 0x003c3c6b, 0x003c3a63, 
+  0x001f3f4f, 0x000c2d35, 0x000c2d36, 0x002b555d, 
+  0x005a596a, 0x00646279, 0x005f5f7e, 0x005d5e81, 
+  0x00595982, 0x00565783, 0x00565783, 0x00565783, 
+  0x00565783, 0x00565783, 0x00565783, 0x00565783, 
+  0x00555783, 0x00535383, 0x00525284, 0x00535184, 
+  0x004e4e83, 0x004d4d82, 0x004b4c80, 0x00464881, 
+  0x00454780, 0x0044447f, 0x0048457d, 0x0044437b, 
+  0x00434378, 0x00434279, 0x00424178, 0x00414077, 
+  0x003d3e75, 0x003d3e74, 0x003c3d73, 0x003a3b72, 
+  0x0039386f, 0x0039396c, 0x0039396c, 0x003b3c6e, 
+  0x003d3d6d, 0x003c3a63, 0x001f3f4f, 0x000c2d35, 
+  0x0010282f, 0x0057576b, 0x00615e7c, 0x0050517e, 
+  0x0048497f, 0x0047487f, 0x0044447f, 0x00444481, 
+  0x00444481, 0x00434382, 0x00434382, 0x00444385, 
+  0x00434286, 0x00444287, 0x003f4088, 0x00413f86, 
+  0x003d3d84, 0x00393c83, 0x00393980, 0x0038387d, 
+  0x0035367c, 0x0035337a, 0x00343277, 0x00333176, 
+  0x002e2e75, 0x002d2e71, 0x002d2e6f, 0x002c2d6b, 
+  0x002a2969, 0x00292868, 0x00282865, 0x002a2a5d, 
+  0x0028285b, 0x00262858, 0x00252757, 0x00262754, 
+  0x0026264f, 0x0027294f, 0x00292a57, 0x00363669, 
+  0x003b3661, 0x000d2129, 0x0010282f, 0x0057576b, 
+  0x00615e7c, 0x0050517e, 0x0048497f, 0x0047487f, 
+  0x0044447f, 0x00444481, 0x00444481, 0x00434381, 
+  0x00424280, 0x00424181, 0x00403f80, 0x00403e80, 
+  0x003b3c7f, 0x003c3b7d, 0x0039397b, 0x00353879, 
+  0x00353576, 0x00343473, 0x00303171, 0x00302e6f, 
+  0x002f2d6b, 0x002e2c6a, 0x00292969, 0x00292966, 
+  0x00292a65, 0x00282961, 0x0026255f, 0x0025245e, 
+  0x0024245c, 0x00262655, 0x00252554, 0x00232551, 
+  0x00232451, 0x0024254f, 0x0024244c, 0x0026284d, 
+  0x00292a56, 0x00363669, 0x003b3661, 0x000d2129, 
+  0x0010282f, 0x0057576b, 0x00615e7c, 0x0050517e, 
+  0x0048497f, 0x0047487f, 0x0044447f, 0x00444481, 
+  0x00444481, 0x00434382, 0x00434382, 0x00444385, 
+  0x00434286, 0x00444287, 0x003f4088, 0x00413f86, 
+  0x003d3d84, 0x00393c83, 0x00393980, 0x0038387d, 
+  0x0035367c, 0x00ffffff, 0x00343277, 0x00333176, 
+  0x002e2e75, 0x002d2e71, 0x002d2e6f, 0x002c2d6b, 
+  0x002a2969, 0x00292868, 0x00282865, 0x002a2a5d, 
+  0x0028285b, 0x00262858, 0x00252757, 0x00262754, 
+  0x0026264f, 0x0027294f, 0x00292a57, 0x00363669, 
+  0x003b3661, 0x000d2129, 0x001c262e, 0x005e587b, 
+  0x004d4e7b, 0x0047457a, 0x0040407b, 0x003f3f7c, 
+  0x003f3e7e, 0x003a3c7f, 0x003a3c7f, 0x00393a82, 
+  0x00393c83, 0x00393b85, 0x00383a87, 0x00383a89, 
+  0x0035378e, 0x00373988, 0x00313389, 0x00313387, 
+  0x00333182, 0x00302f7d, 0x002c2e7b, 0x002b2b79, 
+  0x002b2c77, 0x002b2b72, 0x00272670, 0x0026266d, 
+  0x0024246b, 0x00222269, 0x00212166, 0x00212260, 
+  0x0020235d, 0x00242557, 0x00201f56, 0x0021224f, 
+  0x0022204b, 0x00222049, 0x00222048, 0x00212046, 
+  0x00222048, 0x0026264f, 0x0036356c, 0x00141c2a, 
+  0x001c262e, 0x005e587b, 0x004d4e7b, 0x0047457a, 
+  0x0040407b, 0x003f3f7c, 0x003f3e7e, 0x003a3c7f, 
+  0x003a3c7f, 0x00393a82, 0x00393c82, 0x00383a83, 
+  0x00373984, 0x00363885, 0x00333589, 0x00353783, 
+  0x002f3184, 0x002f3182, 0x00312f7c, 0x002e2d78, 
+  0x002a2c75, 0x00292972, 0x00292a70, 0x0028286b, 
+  0x00252469, 0x00242467, 0x00222265, 0x00202063, 
+  0x001f1f60, 0x001f205b, 0x001e2158, 0x00222353, 
+  0x001f1e52, 0x0020214c, 0x00211f48, 0x00211f47, 
+  0x00211f46, 0x00201f45, 0x00222047, 0x0026264f, 
+  0x0036356c, 0x00141c2a, 0x001c262e, 0x005e587b, 
+  0x004d4e7b, 0x0047457a, 0x0040407b, 0x003f3f7c, 
+  0x003f3e7e, 0x003a3c7f, 0x003a3c7f, 0x00393a82, 
+  0x00393c83, 0x00393b85, 0x00383a87, 0x00383a89, 
+  0x0035378e, 0x00373988, 0x00313389, 0x00313387, 
+  0x00333182, 0x00302f7d, 0x002c2e7b, 0x00ffffff, 
+  0x002b2c77, 0x002b2b72, 0x00272670, 0x0026266d, 
+  0x0024246b, 0x00222269, 0x00212166, 0x00212260, 
+  0x0020235d, 0x00242557, 0x00201f56, 0x0021224f, 
+  0x0022204b, 0x00222049, 0x00222048, 0x00212046, 
+  0x00222048, 0x0026264f, 0x0036356c, 0x00141c2a, 
+  0x00222228, 0x0055557e, 0x00434378, 0x003a3b79, 
+  0x003a3b79, 0x0035377a, 0x0035377a, 0x0035367c, 
+  0x0033357f, 0x00323481, 0x00313285, 0x00313387, 
+  0x00303289, 0x0030318b, 0x002f2f90, 0x002e2f8c, 
+  0x002f2d8a, 0x002e2d86, 0x00282985, 0x00282881, 
+  0x0028297e, 0x0023257b, 0x00262473, 0x00222270, 
+  0x0020226e, 0x0020216a, 0x001f2069, 0x001e2063, 
+  0x001e1f60, 0x001d1c5c, 0x001c1c57, 0x00201e51, 
+  0x001c1c4f, 0x001a1c4c, 0x001b1c49, 0x001b1c44, 
+  0x00191a42, 0x00191b41, 0x00191b41, 0x001b1c48, 
+  0x00262861, 0x00171529, 0x00222228, 0x0055557e, 
+  0x00434378, 0x003a3b79, 0x003a3b79, 0x0035377a, 
+  0x0035377a, 0x0035367c, 0x0033357f, 0x00323481, 
+  0x00313285, 0x00313386, 0x00303288, 0x0030318a, 
+  0x002e2e8e, 0x002d2e8a, 0x002e2c88, 0x002d2c84, 
+  0x00272883, 0x0027277f, 0x0027287c, 0x00222479, 
+  0x00252371, 0x0021216d, 0x001f216b, 0x001f2068, 
+  0x001e1f67, 0x001d1f61, 0x001d1e5e, 0x001c1b5a, 
+  0x001b1b55, 0x001f1e50, 0x001c1c4e, 0x001a1c4b, 
+  0x001b1c48, 0x001b1c43, 0x00191a41, 0x00191b40, 
+  0x00191b41, 0x001b1c48, 0x00262861, 0x00171529, 
+  0x00222228, 0x0055557e, 0x00434378, 0x003a3b79, 
+  0x003a3b79, 0x0035377a, 0x0035377a, 0x0035367c, 
+  0x0033357f, 0x00323481, 0x00313285, 0x00313387, 
+  0x00303289, 0x0030318b, 0x002f2f90, 0x002e2f8c, 
+  0x002f2d8a, 0x002e2d86, 0x00282985, 0x00282881, 
+  0x00ffffff, 0x0023257b, 0x00ffffff, 0x00222270, 
+  0x0020226e, 0x0020216a, 0x001f2069, 0x001e2063, 
+  0x001e1f60, 0x001d1c5c, 0x001c1c57, 0x00201e51, 
+  0x001c1c4f, 0x001a1c4c, 0x001b1c49, 0x001b1c44, 
+  0x00191a42, 0x00191b41, 0x00191b41, 0x001b1c48, 
+  0x00262861, 0x00171529, 0x00201f26, 0x004e4e7e, 
+  0x00393a78, 0x00363577, 0x00343377, 0x00343277, 
+  0x00313178, 0x0031307a, 0x0031307c, 0x00302f7d, 
+  0x002a2c83, 0x002a2b85, 0x00292a89, 0x00282a8d, 
+  0x0028298e, 0x0028298e, 0x0027298c, 0x0025258a, 
+  0x00222285, 0x00222380, 0x00201f7f, 0x001d1e7a, 
+  0x001d1f75, 0x001e1d71, 0x001c1e6d, 0x001a186c, 
+  0x001a1965, 0x00171860, 0x0015155e, 0x00151659, 
+  0x00141753, 0x0016184e, 0x0016194b, 0x00161749, 
+  0x00171643, 0x0016143f, 0x0017153e, 0x0017153e, 
+  0x0017153d, 0x0017173f, 0x001f205c, 0x00131126, 
+  0x00201f26, 0x004e4e7e, 0x00393a78, 0x00363577, 
+  0x00343377, 0x00343277, 0x00313178, 0x0031307a, 
+  0x0031307c, 0x00302f7d, 0x002a2c83, 0x002a2b85, 
+  0x00292a89, 0x00282a8d, 0x0028298e, 0x0028298e, 
+  0x0027298c, 0x0025258a, 0x00222285, 0x00222380, 
+  0x00201f7f, 0x001d1e7a, 0x001d1f75, 0x001e1d71, 
+  0x001c1e6d, 0x001a186c, 0x001a1965, 0x00171860, 
+  0x0015155e, 0x00151659, 0x00141753, 0x0016184e, 
+  0x0016194b, 0x00161749, 0x00171643, 0x0016143f, 
+  0x0017153e, 0x0017153e, 0x0017153d, 0x0017173f, 
+  0x001f205c, 0x00131126, 0x00201f26, 0x004e4e7e, 
+  0x00393a78, 0x00363577, 0x00343377, 0x00343277, 
+  0x00313178, 0x0031307a, 0x0031307c, 0x00302f7d, 
+  0x002a2c83, 0x002a2b85, 0x00292a89, 0x00282a8d, 
+  0x0028298e, 0x0028298e, 0x0027298c, 0x0025258a, 
+  0x00222285, 0x00ffffff, 0x00201f7f, 0x001d1e7a, 
+  0x001d1f75, 0x00ffffff, 0x001c1e6d, 0x001a186c, 
+  0x001a1965, 0x00171860, 0x0015155e, 0x00151659, 
+  0x00141753, 0x0016184e, 0x0016194b, 0x00161749, 
+  0x00171643, 0x0016143f, 0x0017153e, 0x0017153e, 
+  0x0017153d, 0x0017173f, 0x001f205c, 0x00131126, 
+  0x001f1d25, 0x0047487c, 0x00353476, 0x00323175, 
+  0x002d2d76, 0x002c2d76, 0x002b2c77, 0x00292978, 
+  0x0029287c, 0x0028297e, 0x0027277f, 0x00272684, 
+  0x00272686, 0x0025258a, 0x0021218e, 0x00202194, 
+  0x001d1e8f, 0x001c1f8c, 0x001a1a89, 0x00ffffff, 
+  0x001c1c7d, 0x0018187b, 0x00ffffff, 0x0017176f, 
+  0x0018176d, 0x00161665, 0x00131361, 0x0014155e, 
+  0x0011145b, 0x00131553, 0x00121151, 0x0015144c, 
+  0x00111047, 0x00111143, 0x0011123f, 0x000e103e, 
+  0x000f103d, 0x000f103d, 0x000f103a, 0x0012113e, 
+  0x00191958, 0x00110f25, 0x001f1d25, 0x0047487c, 
+  0x00353476, 0x00323175, 0x002d2d76, 0x002c2d76, 
+  0x002b2c77, 0x00292978, 0x0029287c, 0x0028297e, 
+  0x0027277f, 0x00272684, 0x00272686, 0x0025258a, 
+  0x0021218e, 0x00202194, 0x001d1e8f, 0x001c1f8c, 
+  0x001a1a89, 0x001c1d82, 0x001c1c7d, 0x0018187b, 
+  0x00191a74, 0x0017176f, 0x0018176d, 0x00161665, 
+  0x00131361, 0x0014155e, 0x0011145b, 0x00131553, 
+  0x00121151, 0x0015144c, 0x00111047, 0x00111143, 
+  0x0011123f, 0x000e103e, 0x000f103d, 0x000f103d, 
+  0x000f103a, 0x0012113e, 0x00191958, 0x00110f25, 
+  0x001f1d25, 0x0047487c, 0x00353476, 0x00323175, 
+  0x002d2d76, 0x002c2d76, 0x002b2c77, 0x00292978, 
+  0x0029287c, 0x0028297e, 0x0027277f, 0x00272684, 
+  0x00272686, 0x0025258a, 0x0021218e, 0x00202194, 
+  0x001d1e8f, 0x001c1f8c, 0x001a1a89, 0x001c1d82, 
+  0x001c1c7d, 0x0018187b, 0x00191a74, 0x0017176f, 
+  0x0018176d, 0x00161665, 0x00131361, 0x0014155e, 
+  0x0011145b, 0x00131553, 0x00121151, 0x0015144c, 
+  0x00111047, 0x00111143, 0x0011123f, 0x000e103e, 
+  0x000f103d, 0x000f103d, 0x000f103a, 0x0012113e, 
+  0x00191958, 0x00110f25, 0x001c1a23, 0x0044437b, 
+  0x002e2e75, 0x002c2c71, 0x002b2c6f, 0x00272670, 
+  0x00262573, 0x00262573, 0x00242379, 0x0023227b, 
+  0x0023217e, 0x00242181, 0x00202186, 0x001e1d88, 
+  0x001b1d8f, 0x001a1c91, 0x00181892, 0x0018188d, 
+  0x00ffffff, 0x00151584, 0x00ffffff, 0x00ffffff, 
+  0x00141374, 0x00111271, 0x0010106d, 0x00101164, 
+  0x00101261, 0x000f115d, 0x000f1059, 0x000f0d52, 
+  0x000e0d4f, 0x000b0c4b, 0x000d0e45, 0x000c0d41, 
+  0x000a0f3f, 0x000b0c3e, 0x000c0d39, 0x000c0d39, 
+  0x000c0d39, 0x000f0e3b, 0x00171952, 0x000e0e24, 
+  0x001c1a23, 0x0044437b, 0x002e2e75, 0x002c2c71, 
+  0x002b2c6f, 0x00272670, 0x00262573, 0x00262573, 
+  0x00242379, 0x0023227b, 0x0023217e, 0x00242181, 
+  0x00202186, 0x001e1d88, 0x001b1d8f, 0x001a1c91, 
+  0x00181892, 0x0018188d, 0x00171889, 0x00151584, 
+  0x0015167f, 0x00151778, 0x00141374, 0x00111271, 
+  0x0010106d, 0x00101164, 0x00101261, 0x000f115d, 
+  0x000f1059, 0x000f0d52, 0x000e0d4f, 0x000b0c4b, 
+  0x000d0e45, 0x000c0d41, 0x000a0f3f, 0x000b0c3e, 
+  0x000c0d39, 0x000c0d39, 0x000c0d39, 0x000f0e3b, 
+  0x00171952, 0x000e0e24, 0x001c1a23, 0x0044437b, 
+  0x002e2e75, 0x002c2c71, 0x002b2c6f, 0x00272670, 
+  0x00262573, 0x00262573, 0x00242379, 0x0023227b, 
+  0x0023217e, 0x00242181, 0x00202186, 0x001e1d88, 
+  0x001b1d8f, 0x001a1c91, 0x00181892, 0x0018188d, 
+  0x00171889, 0x00151584, 0x0015167f, 0x00151778, 
+  0x00141374, 0x00111271, 0x0010106d, 0x00101164, 
+  0x00101261, 0x000f115d, 0x000f1059, 0x000f0d52, 
+  0x000e0d4f, 0x000b0c4b, 0x000d0e45, 0x000c0d41, 
+  0x000a0f3f, 0x000b0c3e, 0x000c0d39, 0x000c0d39, 
+  0x000c0d39, 0x000f0e3b, 0x00171952, 0x000e0e24, 
+  0x001a1922, 0x003b3e7a, 0x002b2c6f, 0x0029276c, 
+  0x0023246d, 0x0023246d, 0x0020226e, 0x001f1e72, 
+  0x001d1f75, 0x001c1d7a, 0x001c1d7c, 0x001b1d80, 
+  0x00191a83, 0x00181888, 0x0017178c, 0x00151591, 
+  0x00151693, 0x00131592, 0x0012128b, 0x00111285, 
+  0x00101180, 0x000d0d7a, 0x000f1075, 0x000c0e71, 
+  0x000d0e6a, 0x000c0e64, 0x00090962, 0x000b095d, 
+  0x00080856, 0x00080954, 0x00090a4d, 0x00070849, 
+  0x000a0b42, 0x00090840, 0x0009083f, 0x000b083a, 
+  0x00080838, 0x000b0934, 0x000b0934, 0x00090939, 
+  0x00131652, 0x000c0c25, 0x001a1922, 0x003b3e7a, 
+  0x002b2c6f, 0x0029276c, 0x0023246d, 0x0023246d, 
+  0x0020226e, 0x001f1e72, 0x001d1f75, 0x001c1d7a, 
+  0x001c1d7c, 0x001b1d80, 0x00191a83, 0x00181888, 
+  0x0017178c, 0x00151591, 0x00151693, 0x00131592, 
+  0x0012128b, 0x00ffffff, 0x00ffffff, 0x000d0d7a, 
+  0x000f1075, 0x000c0e71, 0x000d0e6a, 0x000c0e64, 
+  0x00090962, 0x000b095d, 0x00080856, 0x00080954, 
+  0x00090a4d, 0x00070849, 0x000a0b42, 0x00090840, 
+  0x0009083f, 0x000b083a, 0x00080838, 0x000b0934, 
+  0x000b0934, 0x00090939, 0x00131652, 0x000c0c25, 
+  0x001a1922, 0x003b3e7a, 0x002b2c6f, 0x0029276c, 
+  0x0023246d, 0x0023246d, 0x0020226e, 0x001f1e72, 
+  0x001d1f75, 0x001c1d7a, 0x001c1d7c, 0x001b1d80, 
+  0x00191a83, 0x00181888, 0x0017178c, 0x00151591, 
+  0x00151693, 0x00131592, 0x0012128b, 0x00111285, 
+  0x00101180, 0x000d0d7a, 0x000f1075, 0x000c0e71, 
+  0x000d0e6a, 0x000c0e64, 0x00090962, 0x000b095d, 
+  0x00080856, 0x00080954, 0x00090a4d, 0x00070849, 
+  0x000a0b42, 0x00090840, 0x0009083f, 0x000b083a, 
+  0x00080838, 0x000b0934, 0x000b0934, 0x00090939, 
+  0x00131652, 0x000c0c25, 0x00191721, 0x00393a78, 
+  0x0028266b, 0x0021246b, 0x0020216a, 0x001c1e6b, 
+  0x001c1e6b, 0x001a1b6e, 0x001a1c70, 0x00191a74, 
+  0x00181978, 0x0017187d, 0x00141481, 0x00141584, 
+  0x00121289, 0x0011128f, 0x00100f98, 0x00111094, 
+  0x000c0e90, 0x000c0b89, 0x000b0b84, 0x0008087f, 
+  0x00090976, 0x00080972, 0x000b0c6b, 0x00070764, 
+  0x00050562, 0x0005055d, 0x00050756, 0x00050751, 
+  0x0004054e, 0x00060547, 0x00030442, 0x00010140, 
+  0x0000003b, 0x0005033a, 0x00040436, 0x00040235, 
+  0x00060436, 0x000b083a, 0x00121153, 0x00060621, 
+  0x00191721, 0x00393a78, 0x0028266b, 0x0021246b, 
+  0x0020216a, 0x001c1e6b, 0x001c1e6b, 0x001a1b6e, 
+  0x001a1c70, 0x00191a74, 0x00181978, 0x0017187d, 
+  0x00141481, 0x00141584, 0x00121289, 0x0011128f, 
+  0x00100f98, 0x00111094, 0x000c0e90, 0x00ffffff, 
+  0x00ffffff, 0x0008087f, 0x00090976, 0x00080972, 
+  0x000b0c6b, 0x00070764, 0x00050562, 0x0005055d, 
+  0x00050756, 0x00050751, 0x0004054e, 0x00060547, 
+  0x00030442, 0x00010140, 0x0000003b, 0x0005033a, 
+  0x00040436, 0x00040235, 0x00060436, 0x000b083a, 
+  0x00121153, 0x00060621, 0x00191721, 0x00393a78, 
+  0x0028266b, 0x0021246b, 0x0020216a, 0x001c1e6b, 
+  0x001c1e6b, 0x001a1b6e, 0x001a1c70, 0x00191a74, 
+  0x00181978, 0x0017187d, 0x00141481, 0x00141584, 
+  0x00121289, 0x0011128f, 0x00100f98, 0x00111094, 
+  0x000c0e90, 0x000c0b89, 0x000b0b84, 0x0008087f, 
+  0x00090976, 0x00080972, 0x000b0c6b, 0x00070764, 
+  0x00050562, 0x0005055d, 0x00050756, 0x00050751, 
+  0x0004054e, 0x00060547, 0x00030442, 0x00010140, 
+  0x0000003b, 0x0005033a, 0x00040436, 0x00040235, 
+  0x00060436, 0x000b083a, 0x00121153, 0x00060621, 
+  0x00161520, 0x00353476, 0x00202069, 0x001e2063, 
+  0x001b1a64, 0x001b1a64, 0x001a1965, 0x0014146d, 
+  0x0014146f, 0x00131370, 0x00141374, 0x00121278, 
+  0x000e0e7e, 0x000c0c83, 0x000c0c86, 0x000a0c8e, 
+  0x00080b94, 0x0007099a, 0x00070993, 0x0006078d, 
+  0x00050588, 0x00060680, 0x00070877, 0x00010273, 
+  0x0003026d, 0x00050465, 0x00020263, 0x00030559, 
+  0x00030256, 0x00020251, 0x0000004e, 0x00020047, 
+  0x00020040, 0x0000023c, 0x00000038, 0x00000136, 
+  0x00000135, 0x00010236, 0x00010033, 0x00010025, 
+  0x00020028, 0x00050111, 0x00161520, 0x00353476, 
+  0x00202069, 0x001e2063, 0x001b1a64, 0x001b1a64, 
+  0x001a1965, 0x0014146d, 0x0014146f, 0x00131370, 
+  0x00141374, 0x00121278, 0x000e0e7e, 0x000c0c83, 
+  0x000c0c86, 0x000a0c8e, 0x00080b94, 0x0007099a, 
+  0x00070993, 0x0006078d, 0x00050588, 0x00060680, 
+  0x00070877, 0x00010273, 0x0003026d, 0x00050465, 
+  0x00020263, 0x00030559, 0x00030256, 0x00020251, 
+  0x0000004e, 0x00020047, 0x00020040, 0x0000023c, 
+  0x00000038, 0x00000136, 0x00000135, 0x00010236, 
+  0x00010033, 0x00010025, 0x00020028, 0x00050111, 
+  0x00161520, 0x00353476, 0x00202069, 0x001e2063, 
+  0x001b1a64, 0x001b1a64, 0x001a1965, 0x0014146d, 
+  0x0014146f, 0x00131370, 0x00141374, 0x00121278, 
+  0x000e0e7e, 0x000c0c83, 0x000c0c86, 0x000a0c8e, 
+  0x00080b94, 0x0007099a, 0x00070993, 0x0006078d, 
+  0x00050588, 0x00060680, 0x00070877, 0x00010273, 
+  0x0003026d, 0x00050465, 0x00020263, 0x00030559, 
+  0x00030256, 0x00020251, 0x0000004e, 0x00020047, 
+  0x00020040, 0x0000023c, 0x00000038, 0x00000136, 
+  0x00000135, 0x00010236, 0x00010033, 0x00010025, 
+  0x00020028, 0x00050111, 0x0014111e, 0x002e2e75, 
+  0x001d1e61, 0x00171860, 0x00151661, 0x00131361, 
+  0x00131361, 0x00101164, 0x000f106a, 0x000e0f6e, 
+  0x000d0f72, 0x000b0b76, 0x000a0a7a, 0x00080881, 
+  0x00080785, 0x0005068c, 0x00040594, 0x00040597, 
+  0x00020397, 0x0003058f, 0x00030288, 0x00000283, 
+  0x00000079, 0x00000072, 0x0000006a, 0x00000166, 
+  0x00010060, 0x00020058, 0x00050053, 0x0001004e, 
+  0x00010049, 0x00000241, 0x0002003c, 0x00000138, 
+  0x00000137, 0x00000234, 0x0002002e, 0x00030018, 
+  0x00010007, 0x00000000, 0x00030014, 0x00050111, 
+  0x0014111e, 0x002e2e75, 0x001d1e61, 0x00171860, 
+  0x00151661, 0x00131361, 0x00131361, 0x00101164, 
+  0x000f106a, 0x000e0f6e, 0x000d0f72, 0x000b0b76, 
+  0x000a0a7a, 0x00080881, 0x00080785, 0x0005068c, 
+  0x00040594, 0x00040597, 0x00020397, 0x0003058f, 
+  0x00030288, 0x00000283, 0x00000079, 0x00000072, 
+  0x0000006a, 0x00000166, 0x00010060, 0x00020058, 
+  0x00050053, 0x0001004e, 0x00010049, 0x00000241, 
+  0x0002003c, 0x00000138, 0x00000137, 0x00000234, 
+  0x0002002e, 0x00030018, 0x00010007, 0x00000000, 
+  0x00030014, 0x00050111, 0x0014111e, 0x002e2e75, 
+  0x001d1e61, 0x00171860, 0x00151661, 0x00131361, 
+  0x00131361, 0x00101164, 0x000f106a, 0x000e0f6e, 
+  0x000d0f72, 0x000b0b76, 0x000a0a7a, 0x00080881, 
+  0x00080785, 0x0005068c, 0x00040594, 0x00040597, 
+  0x00020397, 0x0003058f, 0x00030288, 0x00000283, 
+  0x00000079, 0x00000072, 0x0000006a, 0x00000166, 
+  0x00010060, 0x00020058, 0x00050053, 0x0001004e, 
+  0x00010049, 0x00000241, 0x0002003c, 0x00000138, 
+  0x00000137, 0x00000234, 0x0002002e, 0x00030018, 
+  0x00010007, 0x00000000, 0x00030014, 0x00050111, 
+  0x0013111d, 0x002b2c6f, 0x001a185f, 0x0012155c, 
+  0x0011135d, 0x000f115d, 0x000f115d, 0x000e0d61, 
+  0x000c0e64, 0x000c0e65, 0x000a0c6f, 0x00080972, 
+  0x00070877, 0x0006067b, 0x00040582, 0x00030288, 
+  0x00020290, 0x00000096, 0x0001009a, 0x00010093, 
+  0x0000028a, 0x00010081, 0x00000078, 0x00000070, 
+  0x00000168, 0x00000062, 0x00000059, 0x00010054, 
+  0x0000004f, 0x0000004a, 0x00010047, 0x0001003f, 
+  0x0001003c, 0x00020030, 0x00030021, 0x00030012, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00050111, 0x0013111d, 0x002b2c6f, 
+  0x001a185f, 0x0012155c, 0x0011135d, 0x000f115d, 
+  0x000f115d, 0x000e0d61, 0x000c0e64, 0x000c0e65, 
+  0x000a0c6f, 0x00080972, 0x00070877, 0x0006067b, 
+  0x00040582, 0x00030288, 0x00020290, 0x00000096, 
+  0x0001009a, 0x00010093, 0x0000028a, 0x00010081, 
+  0x00000078, 0x00000070, 0x00000168, 0x00000062, 
+  0x00000059, 0x00010054, 0x0000004f, 0x0000004a, 
+  0x00010047, 0x0001003f, 0x0001003c, 0x00020030, 
+  0x00030021, 0x00030012, 0x00000003, 0x00000000, 
+  0x00000000, 0x00000001, 0x00040018, 0x00050111, 
+  0x0013111d, 0x002b2c6f, 0x001a185f, 0x0012155c, 
+  0x0011135d, 0x000f115d, 0x000f115d, 0x000e0d61, 
+  0x000c0e64, 0x000c0e65, 0x000a0c6f, 0x00080972, 
+  0x00070877, 0x0006067b, 0x00040582, 0x00030288, 
+  0x00020290, 0x00000096, 0x0001009a, 0x00010093, 
+  0x0000028a, 0x00010081, 0x00000078, 0x00000070, 
+  0x00000168, 0x00000062, 0x00000059, 0x00010054, 
+  0x0000004f, 0x0000004a, 0x00010047, 0x0001003f, 
+  0x0001003c, 0x00020030, 0x00030021, 0x00030012, 
+  0x00000003, 0x00000000, 0x00000000, 0x00000001, 
+  0x00040018, 0x00050111, 0x00100e1c, 0x0029276c, 
+  0x0012135b, 0x00111054, 0x000c0d55, 0x000c0a5b, 
+  0x000b095d, 0x000b095d, 0x00050562, 0x00060565, 
+  0x00040667, 0x00030171, 0x00010275, 0x00000079, 
+  0x0000027d, 0x00000184, 0x0000028a, 0x0000028f, 
+  0x00000195, 0x00000190, 0x00000187, 0x00000080, 
+  0x00010078, 0x0000016f, 0x00000067, 0x0000015e, 
+  0x00000058, 0x00000152, 0x00000050, 0x00000149, 
+  0x00000040, 0x0001002a, 0x0004001b, 0x0002000c, 
+  0x00000003, 0x00000000, 0x00000001, 0x00000001, 
+  0x00000001, 0x00000003, 0x0004001b, 0x00040112, 
+  0x00100e1c, 0x0029276c, 0x0012135b, 0x00111054, 
+  0x000c0d55, 0x000c0a5b, 0x000b095d, 0x000b095d, 
+  0x00050562, 0x00060565, 0x00040667, 0x00030171, 
+  0x00010275, 0x00000079, 0x0000027d, 0x00000184, 
+  0x0000028a, 0x0000028f, 0x00000195, 0x00000190, 
+  0x00000187, 0x00000080, 0x00010078, 0x0000016f, 
+  0x00000067, 0x0000015e, 0x00000058, 0x00000152, 
+  0x00000050, 0x00000149, 0x00000040, 0x0001002a, 
+  0x0004001b, 0x0002000c, 0x00000003, 0x00000000, 
+  0x00000001, 0x00000001, 0x00000001, 0x00000003, 
+  0x0004001b, 0x00040112, 0x00100e1c, 0x0029276c, 
+  0x0012135b, 0x00111054, 0x000c0d55, 0x000c0a5b, 
+  0x000b095d, 0x000b095d, 0x00050562, 0x00060565, 
+  0x00040667, 0x00030171, 0x00010275, 0x00000079, 
+  0x0000027d, 0x00000184, 0x0000028a, 0x0000028f, 
+  0x00000195, 0x00000190, 0x00000187, 0x00000080, 
+  0x00010078, 0x0000016f, 0x00000067, 0x0000015e, 
+  0x00000058, 0x00000152, 0x00000050, 0x00000149, 
+  0x00000040, 0x0001002a, 0x0004001b, 0x0002000c, 
+  0x00000003, 0x00000000, 0x00000001, 0x00000001, 
+  0x00000001, 0x00000003, 0x0004001b, 0x00040112, 
+  0x000f0c1b, 0x0021246b, 0x00111054, 0x000d0c50, 
+  0x000a0a51, 0x00080954, 0x00050754, 0x00040558, 
+  0x0003045e, 0x00020360, 0x00010366, 0x00000168, 
+  0x0000006f, 0x00000072, 0x00000277, 0x0000007e, 
+  0x00000183, 0x00000188, 0x0000038f, 0x0000038f, 
+  0x00000188, 0x00010080, 0x00000079, 0x00020070, 
+  0x00000062, 0x0000005b, 0x00020052, 0x00020041, 
+  0x00050035, 0x00070029, 0x0004001a, 0x0002000f, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010004, 
+  0x00000003, 0x00000003, 0x00000003, 0x00010004, 
+  0x0005001e, 0x00050113, 0x000f0c1b, 0x0021246b, 
+  0x00111054, 0x000d0c50, 0x000a0a51, 0x00080954, 
+  0x00050754, 0x00040558, 0x0003045e, 0x00020360, 
+  0x00010366, 0x00000168, 0x0000006f, 0x00000072, 
+  0x00000277, 0x0000007e, 0x00000183, 0x00000188, 
+  0x0000038f, 0x0000038f, 0x00000188, 0x00010080, 
+  0x00000079, 0x00020070, 0x00000062, 0x0000005b, 
+  0x00020052, 0x00020041, 0x00050035, 0x00070029, 
+  0x0004001a, 0x0002000f, 0x00010009, 0x00010008, 
+  0x00010007, 0x00010004, 0x00000003, 0x00000003, 
+  0x00000003, 0x00010004, 0x0005001e, 0x00050113, 
+  0x000f0c1b, 0x0021246b, 0x00111054, 0x000d0c50, 
+  0x000a0a51, 0x00080954, 0x00050754, 0x00040558, 
+  0x0003045e, 0x00020360, 0x00010366, 0x00000168, 
+  0x0000006f, 0x00000072, 0x00000277, 0x0000007e, 
+  0x00000183, 0x00000188, 0x0000038f, 0x0000038f, 
+  0x00000188, 0x00010080, 0x00000079, 0x00020070, 
+  0x00000062, 0x0000005b, 0x00020052, 0x00020041, 
+  0x00050035, 0x00070029, 0x0004001a, 0x0002000f, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010004, 
+  0x00000003, 0x00000003, 0x00000003, 0x00010004, 
+  0x0005001e, 0x00050113, 0x000c0a19, 0x001c1e6a, 
+  0x000e0d4f, 0x0007084e, 0x0005054e, 0x0004054e, 
+  0x00050250, 0x00020155, 0x00010257, 0x0001005e, 
+  0x00000162, 0x00010062, 0x00000168, 0x0000006f, 
+  0x00000075, 0x00010078, 0x0001007e, 0x00000082, 
+  0x00000088, 0x0002008b, 0x0000007e, 0x0000006e, 
+  0x00000060, 0x00040054, 0x0009004b, 0x000a003f, 
+  0x00080032, 0x00070029, 0x00050020, 0x0005001d, 
+  0x00040017, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010007, 
+  0x00010007, 0x00010008, 0x0005001f, 0x00040113, 
+  0x000c0a19, 0x001c1e6a, 0x000e0d4f, 0x0007084e, 
+  0x0005054e, 0x0004054e, 0x00050250, 0x00020155, 
+  0x00010257, 0x0001005e, 0x00000162, 0x00010062, 
+  0x00000168, 0x0000006f, 0x00000075, 0x00010078, 
+  0x0001007e, 0x00000082, 0x00000088, 0x0002008b, 
+  0x0000007e, 0x0000006e, 0x00000060, 0x00040054, 
+  0x0009004b, 0x000a003f, 0x00080032, 0x00070029, 
+  0x00050020, 0x0005001d, 0x00040017, 0x00030012, 
+  0x0002000f, 0x0002000c, 0x00010009, 0x00010008, 
+  0x00010007, 0x00010007, 0x00010007, 0x00010008, 
+  0x0005001f, 0x00040113, 0x000c0a19, 0x001c1e6a, 
+  0x000e0d4f, 0x0007084e, 0x0005054e, 0x0004054e, 
+  0x00050250, 0x00020155, 0x00010257, 0x0001005e, 
+  0x00000162, 0x00010062, 0x00000168, 0x0000006f, 
+  0x00000075, 0x00010078, 0x0001007e, 0x00000082, 
+  0x00000088, 0x0002008b, 0x0000007e, 0x0000006e, 
+  0x00000060, 0x00040054, 0x0009004b, 0x000a003f, 
+  0x00080032, 0x00070029, 0x00050020, 0x0005001d, 
+  0x00040017, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x00010009, 0x00010008, 0x00010007, 0x00010007, 
+  0x00010007, 0x00010008, 0x0005001f, 0x00040113, 
+  0x000b0917, 0x001b1a64, 0x0007084e, 0x00060547, 
+  0x00020247, 0x00040048, 0x00ffffff, 0x0002004f, 
+  0x00ffffff, 0x00050055, 0x00010056, 0x00000056, 
+  0x00000154, 0x00000050, 0x00030051, 0x00050054, 
+  0x0007005d, 0x00090065, 0x000a0070, 0x000b007e, 
+  0x000c0075, 0x000f0067, 0x000f0059, 0x000d004e, 
+  0x000b0043, 0x000a003b, 0x00090034, 0x0007002c, 
+  0x00070028, 0x00060023, 0x0004001b, 0x00040017, 
+  0x00030012, 0x0002000f, 0x00ffffff, 0x0002000a, 
+  0x00010009, 0x00010009, 0x00010008, 0x00010009, 
+  0x00060023, 0x00040114, 0x000b0917, 0x001b1a64, 
+  0x0007084e, 0x00060547, 0x00020247, 0x00040048, 
+  0x0001004a, 0x0002004f, 0x00000053, 0x00050055, 
+  0x00010056, 0x00000056, 0x00000154, 0x00000050, 
+  0x00030051, 0x00050054, 0x0007005d, 0x00090065, 
+  0x000a0070, 0x000b007e, 0x000c0075, 0x000f0067, 
+  0x000f0059, 0x000d004e, 0x000b0043, 0x000a003b, 
+  0x00090034, 0x0007002c, 0x00070028, 0x00060023, 
+  0x0004001b, 0x00040017, 0x00030012, 0x0002000f, 
+  0x0002000c, 0x0002000a, 0x00010009, 0x00010009, 
+  0x00010008, 0x00010009, 0x00060023, 0x00040114, 
+  0x000b0917, 0x001b1a64, 0x0007084e, 0x00060547, 
+  0x00020247, 0x00040048, 0x0001004a, 0x0002004f, 
+  0x00000053, 0x00050055, 0x00010056, 0x00000056, 
+  0x00000154, 0x00000050, 0x00030051, 0x00050054, 
+  0x0007005d, 0x00090065, 0x000a0070, 0x000b007e, 
+  0x000c0075, 0x000f0067, 0x000f0059, 0x000d004e, 
+  0x000b0043, 0x000a003b, 0x00090034, 0x0007002c, 
+  0x00070028, 0x00060023, 0x0004001b, 0x00040017, 
+  0x00030012, 0x0002000f, 0x00ffffff, 0x0002000a, 
+  0x00010009, 0x00010009, 0x00010008, 0x00010009, 
+  0x00060023, 0x00040114, 0x00080618, 0x00171861, 
+  0x00060547, 0x00020143, 0x00020043, 0x00000145, 
+  0x00ffffff, 0x0001003e, 0x00ffffff, 0x00050032, 
+  0x0006002e, 0x0008002e, 0x00090034, 0x00090039, 
+  0x000b0042, 0x000c004b, 0x000e0053, 0x00100061, 
+  0x000e006c, 0x000c007a, 0x000c007a, 0x000c006c, 
+  0x000c005f, 0x000d0053, 0x000c004b, 0x000b0042, 
+  0x00090037, 0x00080032, 0x0007002b, 0x00060026, 
+  0x00050020, 0x0004001b, 0x00030015, 0x00030012, 
+  0x00ffffff, 0x0002000c, 0x0002000c, 0x0002000a, 
+  0x0002000a, 0x0002000c, 0x00050024, 0x00040114, 
+  0x00080618, 0x00171861, 0x00060547, 0x00020143, 
+  0x00020043, 0x00000145, 0x00010042, 0x0001003e, 
+  0x00030036, 0x00050032, 0x0006002e, 0x0008002e, 
+  0x00090034, 0x00090039, 0x000b0042, 0x000c004b, 
+  0x000e0053, 0x00100061, 0x000e006c, 0x000c007a, 
+  0x000c007a, 0x000c006c, 0x000c005f, 0x000d0053, 
+  0x000c004b, 0x000b0042, 0x00090037, 0x00080032, 
+  0x0007002b, 0x00060026, 0x00050020, 0x0004001b, 
+  0x00030015, 0x00030012, 0x0002000f, 0x0002000c, 
+  0x0002000c, 0x0002000a, 0x0002000a, 0x0002000c, 
+  0x00050024, 0x00040114, 0x00080618, 0x00171861, 
+  0x00060547, 0x00020143, 0x00020043, 0x00000145, 
+  0x00010042, 0x0001003e, 0x00030036, 0x00050032, 
+  0x0006002e, 0x0008002e, 0x00090034, 0x00090039, 
+  0x000b0042, 0x000c004b, 0x000e0053, 0x00100061, 
+  0x000e006c, 0x000c007a, 0x000c007a, 0x000c006c, 
+  0x000c005f, 0x000d0053, 0x000c004b, 0x000b0042, 
+  0x00090037, 0x00080032, 0x0007002b, 0x00060026, 
+  0x00050020, 0x0004001b, 0x00030015, 0x00ffffff, 
+  0x0002000f, 0x00ffffff, 0x0002000c, 0x0002000a, 
+  0x0002000a, 0x0002000c, 0x00050024, 0x00040114, 
+  0x00070517, 0x00131361, 0x00010044, 0x0001003d, 
+  0x00000032, 0x00ffffff, 0x0005001d, 0x00ffffff, 
+  0x0004001a, 0x0005001d, 0x00060026, 0x0007002b, 
+  0x00080032, 0x000a003a, 0x000b0042, 0x000a004b, 
+  0x000c0053, 0x000b005e, 0x000a0068, 0x000d0075, 
+  0x000b007e, 0x000a0070, 0x00090064, 0x000a0058, 
+  0x000b0050, 0x000a0046, 0x000a0040, 0x00090036, 
+  0x0008002e, 0x0007002a, 0x00060026, 0x0005001e, 
+  0x0004001a, 0x00030015, 0x00ffffff, 0x0002000f, 
+  0x0002000f, 0x0002000e, 0x0002000c, 0x0002000f, 
+  0x00050028, 0x00020115, 0x00070517, 0x00131361, 
+  0x00010044, 0x0001003d, 0x00000032, 0x00030024, 
+  0x00ffffff, 0x00ffffff, 0x0004001a, 0x0005001d, 
+  0x00060026, 0x0007002b, 0x00080032, 0x000a003a, 
+  0x000b0042, 0x000a004b, 0x000c0053, 0x000b005e, 
+  0x000a0068, 0x000d0075, 0x000b007e, 0x000a0070, 
+  0x00090064, 0x000a0058, 0x000b0050, 0x000a0046, 
+  0x000a0040, 0x00090036, 0x0008002e, 0x0007002a, 
+  0x00060026, 0x0005001e, 0x0004001a, 0x00030015, 
+  0x00ffffff, 0x00ffffff, 0x0002000f, 0x0002000e, 
+  0x0002000c, 0x0002000f, 0x00050028, 0x00020115, 
+  0x00070517, 0x00131361, 0x00010044, 0x0001003d, 
+  0x00000032, 0x00030024, 0x0005001d, 0x00ffffff, 
+  0x00ffffff, 0x0005001d, 0x00060026, 0x0007002b, 
+  0x00080032, 0x000a003a, 0x000b0042, 0x000a004b, 
+  0x000c0053, 0x000b005e, 0x000a0068, 0x000d0075, 
+  0x000b007e, 0x000a0070, 0x00090064, 0x000a0058, 
+  0x000b0050, 0x000a0046, 0x000a0040, 0x00090036, 
+  0x0008002e, 0x0007002a, 0x00060026, 0x0005001e, 
+  0x0004001a, 0x00030015, 0x00ffffff, 0x0002000f, 
+  0x0002000f, 0x0002000e, 0x0002000c, 0x0002000f, 
+  0x00050028, 0x00020115, 0x00050417, 0x000e0e5d, 
+  0x0004002a, 0x0004001a, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x0005001f, 
+  0x00070028, 0x0007002c, 0x00090034, 0x00090039, 
+  0x000a0042, 0x00090048, 0x000a0052, 0x0009005c, 
+  0x00090067, 0x000a0072, 0x0009007e, 0x00090074, 
+  0x00090068, 0x0009005d, 0x000a0053, 0x0009004b, 
+  0x000b0043, 0x000a003a, 0x00090035, 0x0008002e, 
+  0x00070029, 0x00060023, 0x0005001e, 0x0004001a, 
+  0x00ffffff, 0x00030012, 0x00030010, 0x0002000f, 
+  0x0002000f, 0x00030010, 0x0004002a, 0x00020116, 
+  0x00050417, 0x000e0e5d, 0x0004002a, 0x0004001a, 
+  0x00030012, 0x00030010, 0x00ffffff, 0x00ffffff, 
+  0x0004001b, 0x0005001f, 0x00070028, 0x0007002c, 
+  0x00090034, 0x00090039, 0x000a0042, 0x00090048, 
+  0x000a0052, 0x0009005c, 0x00090067, 0x000a0072, 
+  0x0009007e, 0x00090074, 0x00090068, 0x0009005d, 
+  0x000a0053, 0x0009004b, 0x000b0043, 0x000a003a, 
+  0x00090035, 0x0008002e, 0x00070029, 0x00060023, 
+  0x0005001e, 0x0004001a, 0x00ffffff, 0x00ffffff, 
+  0x00030010, 0x0002000f, 0x0002000f, 0x00030010, 
+  0x0004002a, 0x00020116, 0x00050417, 0x000e0e5d, 
+  0x0004002a, 0x0004001a, 0x00030012, 0x00030010, 
+  0x00ffffff, 0x00040017, 0x0004001b, 0x0005001f, 
+  0x00070028, 0x0007002c, 0x00090034, 0x00090039, 
+  0x000a0042, 0x00090048, 0x000a0052, 0x0009005c, 
+  0x00090067, 0x000a0072, 0x0009007e, 0x00090074, 
+  0x00090068, 0x0009005d, 0x000a0053, 0x0009004b, 
+  0x000b0043, 0x000a003a, 0x00090035, 0x0008002e, 
+  0x00070029, 0x00060023, 0x0005001e, 0x0004001a, 
+  0x00030015, 0x00030012, 0x00ffffff, 0x00ffffff, 
+  0x0002000f, 0x00030010, 0x0004002a, 0x00020116, 
+  0x00020110, 0x00020042, 0x00030015, 0x00030010, 
+  0x00030012, 0x00ffffff, 0x00040017, 0x00ffffff, 
+  0x0005001e, 0x00050021, 0x00070029, 0x0008002e, 
+  0x00090034, 0x00080039, 0x00090041, 0x00090048, 
+  0x00070051, 0x00090059, 0x00070064, 0x0006006e, 
+  0x0006007a, 0x00060079, 0x0008006d, 0x00080062, 
+  0x00080056, 0x00090050, 0x00090047, 0x00090040, 
+  0x00090037, 0x00080032, 0x0007002c, 0x00070028, 
+  0x00050021, 0x0005001d, 0x00ffffff, 0x00040017, 
+  0x00030014, 0x00030012, 0x00030012, 0x00030014, 
+  0x0003002b, 0x00020118, 0x00020110, 0x00020042, 
+  0x00030015, 0x00030010, 0x00030012, 0x00030014, 
+  0x00040017, 0x0004001a, 0x0005001e, 0x00050021, 
+  0x00070029, 0x0008002e, 0x00090034, 0x00080039, 
+  0x00090041, 0x00090048, 0x00070051, 0x00090059, 
+  0x00070064, 0x0006006e, 0x0006007a, 0x00060079, 
+  0x0008006d, 0x00080062, 0x00080056, 0x00090050, 
+  0x00090047, 0x00090040, 0x00090037, 0x00080032, 
+  0x0007002c, 0x00070028, 0x00050021, 0x0005001d, 
+  0x00040018, 0x00040017, 0x00030014, 0x00030012, 
+  0x00030012, 0x00030014, 0x0003002b, 0x00020118, 
+  0x00020110, 0x00020042, 0x00030015, 0x00030010, 
+  0x00030012, 0x00030014, 0x00ffffff, 0x0004001a, 
+  0x0005001e, 0x00050021, 0x00070029, 0x0008002e, 
+  0x00090034, 0x00080039, 0x00090041, 0x00090048, 
+  0x00070051, 0x00090059, 0x00070064, 0x0006006e, 
+  0x0006007a, 0x00060079, 0x0008006d, 0x00080062, 
+  0x00080056, 0x00090050, 0x00090047, 0x00090040, 
+  0x00090037, 0x00080032, 0x0007002c, 0x00070028, 
+  0x00050021, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00030014, 0x00030012, 0x00030012, 0x00030014, 
+  0x0003002b, 0x00020118, 0x0004010c, 0x0000013d, 
+  0x00040018, 0x00030015, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00060023, 
+  0x0007002a, 0x0008002e, 0x00070035, 0x0007003a, 
+  0x00090041, 0x00080047, 0x00060051, 0x00070058, 
+  0x00060061, 0x0006006d, 0x00050078, 0x0004007d, 
+  0x00030070, 0x00050067, 0x0006005d, 0x00060053, 
+  0x0006004d, 0x00070043, 0x0008003f, 0x00080036, 
+  0x00070032, 0x0007002b, 0x00060024, 0x0005001f, 
+  0x0005001d, 0x0004001a, 0x00040018, 0x00030015, 
+  0x00030015, 0x00040017, 0x0001002f, 0x00030119, 
+  0x0004010c, 0x0000013d, 0x00040018, 0x00030015, 
+  0x00030015, 0x00040017, 0x00040018, 0x0004001b, 
+  0x0005001e, 0x00060023, 0x0007002a, 0x0008002e, 
+  0x00070035, 0x0007003a, 0x00090041, 0x00080047, 
+  0x00060051, 0x00070058, 0x00060061, 0x0006006d, 
+  0x00050078, 0x0004007d, 0x00030070, 0x00050067, 
+  0x0006005d, 0x00060053, 0x0006004d, 0x00070043, 
+  0x0008003f, 0x00080036, 0x00070032, 0x0007002b, 
+  0x00060024, 0x0005001f, 0x0005001d, 0x0004001a, 
+  0x00040018, 0x00030015, 0x00030015, 0x00040017, 
+  0x0001002f, 0x00030119, 0x0004010c, 0x0000013d, 
+  0x00040018, 0x00030015, 0x00030015, 0x00ffffff, 
+  0x00040018, 0x00ffffff, 0x0005001e, 0x00ffffff, 
+  0x0007002a, 0x0008002e, 0x00070035, 0x0007003a, 
+  0x00090041, 0x00080047, 0x00060051, 0x00070058, 
+  0x00060061, 0x0006006d, 0x00050078, 0x0004007d, 
+  0x00030070, 0x00050067, 0x0006005d, 0x00060053, 
+  0x0006004d, 0x00070043, 0x0008003f, 0x00080036, 
+  0x00070032, 0x0007002b, 0x00060024, 0x0005001f, 
+  0x0005001d, 0x0004001a, 0x00ffffff, 0x00030015, 
+  0x00030015, 0x00040017, 0x0001002f, 0x00030119, 
+  0x0003010d, 0x00020042, 0x0004001a, 0x00040018, 
+  0x00040018, 0x00ffffff, 0x0004001b, 0x00ffffff, 
+  0x00050021, 0x00060024, 0x0006002b, 0x00070030, 
+  0x00070035, 0x0007003a, 0x00070041, 0x00060047, 
+  0x00050050, 0x00050056, 0x0006005f, 0x0002006a, 
+  0x00030074, 0x0002007d, 0x00040074, 0x0003006c, 
+  0x0007005f, 0x00050058, 0x00050051, 0x00060048, 
+  0x00070041, 0x0007003a, 0x00060035, 0x0006002e, 
+  0x0007002a, 0x00060024, 0x0005001f, 0x0005001d, 
+  0x0004001b, 0x0004001a, 0x00040018, 0x0004001a, 
+  0x00040035, 0x0002011b, 0x0003010d, 0x00020042, 
+  0x0004001a, 0x00040018, 0x00040018, 0x00040018, 
+  0x00ffffff, 0x00ffffff, 0x00050021, 0x00060024, 
+  0x0006002b, 0x00070030, 0x00070035, 0x0007003a, 
+  0x00070041, 0x00060047, 0x00050050, 0x00050056, 
+  0x0006005f, 0x0002006a, 0x00030074, 0x0002007d, 
+  0x00040074, 0x0003006c, 0x0007005f, 0x00050058, 
+  0x00050051, 0x00060048, 0x00070041, 0x0007003a, 
+  0x00060035, 0x0006002e, 0x0007002a, 0x00060024, 
+  0x00ffffff, 0x00ffffff, 0x0004001b, 0x0004001a, 
+  0x00040018, 0x0004001a, 0x00040035, 0x0002011b, 
+  0x0003010d, 0x00020042, 0x0004001a, 0x00040018, 
+  0x00040018, 0x00ffffff, 0x0004001b, 0x0005001e, 
+  0x00ffffff, 0x00060024, 0x0006002b, 0x00070030, 
+  0x00070035, 0x0007003a, 0x00070041, 0x00060047, 
+  0x00050050, 0x00050056, 0x0006005f, 0x0002006a, 
+  0x00030074, 0x0002007d, 0x00040074, 0x0003006c, 
+  0x0007005f, 0x00050058, 0x00050051, 0x00060048, 
+  0x00070041, 0x0007003a, 0x00060035, 0x0006002e, 
+  0x0007002a, 0x00060024, 0x0005001f, 0x00ffffff, 
+  0x0004001b, 0x00ffffff, 0x00040018, 0x0004001a, 
+  0x00040035, 0x0002011b, 0x0003010d, 0x00000148, 
+  0x0005001d, 0x0004001a, 0x00ffffff, 0x0004001b, 
+  0x00ffffff, 0x0005001e, 0x00060023, 0x00060026, 
+  0x0006002b, 0x00080030, 0x00060036, 0x0007003a, 
+  0x00050041, 0x00040046, 0x00040050, 0x00040056, 
+  0x0003005e, 0x00010068, 0x00000073, 0x0001007d, 
+  0x00010079, 0x0006006e, 0x00020064, 0x0005005d, 
+  0x00040053, 0x0005004e, 0x00050045, 0x00060040, 
+  0x00060039, 0x00060034, 0x0006002e, 0x00070028, 
+  0x00ffffff, 0x00050021, 0x0005001e, 0x0005001d, 
+  0x0004001b, 0x0005001d, 0x00020037, 0x0002011d, 
+  0x0003010d, 0x00000148, 0x0005001d, 0x0004001a, 
+  0x0004001a, 0x00ffffff, 0x00ffffff, 0x0005001e, 
+  0x00060023, 0x00060026, 0x0006002b, 0x00080030, 
+  0x00060036, 0x0007003a, 0x00050041, 0x00040046, 
+  0x00040050, 0x00040056, 0x0003005e, 0x00010068, 
+  0x00000073, 0x0001007d, 0x00010079, 0x0006006e, 
+  0x00020064, 0x0005005d, 0x00040053, 0x0005004e, 
+  0x00050045, 0x00060040, 0x00060039, 0x00060034, 
+  0x0006002e, 0x00070028, 0x00ffffff, 0x00ffffff, 
+  0x0005001e, 0x0005001d, 0x0004001b, 0x0005001d, 
+  0x00020037, 0x0002011d, 0x0003010d, 0x00000148, 
+  0x0005001d, 0x0004001a, 0x0004001a, 0x0004001b, 
+  0x00ffffff, 0x00ffffff, 0x00060023, 0x00ffffff, 
+  0x0006002b, 0x00080030, 0x00060036, 0x0007003a, 
+  0x00050041, 0x00040046, 0x00040050, 0x00040056, 
+  0x0003005e, 0x00010068, 0x00000073, 0x0001007d, 
+  0x00010079, 0x0006006e, 0x00020064, 0x0005005d, 
+  0x00040053, 0x0005004e, 0x00050045, 0x00060040, 
+  0x00060039, 0x00060034, 0x0006002e, 0x00070028, 
+  0x00060024, 0x00050021, 0x00ffffff, 0x0005001d, 
+  0x0004001b, 0x0005001d, 0x00020037, 0x0002011d, 
+  0x0003010d, 0x0000014b, 0x0004001e, 0x0004001b, 
+  0x00ffffff, 0x0005001d, 0x00ffffff, 0x0005001f, 
+  0x00060024, 0x00060028, 0x0005002c, 0x00050032, 
+  0x00050036, 0x0006003b, 0x00070041, 0x00040046, 
+  0x0004004e, 0x00020054, 0x0001005d, 0x00000066, 
+  0x00000072, 0x0000007c, 0x0001007f, 0x00020075, 
+  0x0000006a, 0x0001005f, 0x00030059, 0x00020052, 
+  0x00030048, 0x00040043, 0x0004003f, 0x00050037, 
+  0x00050032, 0x0005002c, 0x00070028, 0x00060024, 
+  0x00050021, 0x0005001f, 0x0005001e, 0x0005001f, 
+  0x0000003c, 0x0002011e, 0x0003010d, 0x0000014b, 
+  0x0004001e, 0x0004001b, 0x0004001b, 0x00ffffff, 
+  0x0005001e, 0x0005001f, 0x00060024, 0x00060028, 
+  0x0005002c, 0x00050032, 0x00050036, 0x0006003b, 
+  0x00070041, 0x00040046, 0x0004004e, 0x00020054, 
+  0x0001005d, 0x00000066, 0x00000072, 0x0000007c, 
+  0x0001007f, 0x00020075, 0x0000006a, 0x0001005f, 
+  0x00030059, 0x00020052, 0x00030048, 0x00040043, 
+  0x0004003f, 0x00050037, 0x00050032, 0x0005002c, 
+  0x00070028, 0x00060024, 0x00050021, 0x0005001f, 
+  0x0005001e, 0x0005001f, 0x0000003c, 0x0002011e, 
+  0x0003010d, 0x0000014b, 0x0004001e, 0x0004001b, 
+  0x0004001b, 0x0005001d, 0x0005001e, 0x0005001f, 
+  0x00060024, 0x00060028, 0x0005002c, 0x00050032, 
+  0x00050036, 0x0006003b, 0x00070041, 0x00040046, 
+  0x0004004e, 0x00020054, 0x0001005d, 0x00000066, 
+  0x00000072, 0x0000007c, 0x0001007f, 0x00020075, 
+  0x0000006a, 0x0001005f, 0x00030059, 0x00020052, 
+  0x00030048, 0x00040043, 0x0004003f, 0x00050037, 
+  0x00050032, 0x0005002c, 0x00070028, 0x00060024, 
+  0x00050021, 0x0005001f, 0x0005001e, 0x0005001f, 
+  0x0000003c, 0x0002011e, 0x0002010e, 0x00000051, 
+  0x00040021, 0x0005001d, 0x0005001e, 0x0005001e, 
+  0x0005001f, 0x00050021, 0x00050026, 0x00060029, 
+  0x0004002e, 0x00040034, 0x00030037, 0x0004003b, 
+  0x00040042, 0x00040047, 0x00030050, 0x00040054, 
+  0x0000005e, 0x00000066, 0x0000006f, 0x0002007c, 
+  0x00000183, 0x00000079, 0x0000006f, 0x00000066, 
+  0x0000005e, 0x00000056, 0x00030050, 0x00040047, 
+  0x00040042, 0x0004003b, 0x00050036, 0x00050032, 
+  0x0005002a, 0x00060028, 0x00050024, 0x00060023, 
+  0x00050021, 0x00050023, 0x00000041, 0x0002011f, 
+  0x0002010e, 0x00000051, 0x00040021, 0x0005001d, 
+  0x0005001e, 0x0005001e, 0x0005001f, 0x00050021, 
+  0x00050026, 0x00060029, 0x0004002e, 0x00040034, 
+  0x00030037, 0x0004003b, 0x00040042, 0x00040047, 
+  0x00030050, 0x00040054, 0x0000005e, 0x00000066, 
+  0x0000006f, 0x0002007c, 0x00000183, 0x00000079, 
+  0x0000006f, 0x00000066, 0x0000005e, 0x00000056, 
+  0x00030050, 0x00040047, 0x00040042, 0x0004003b, 
+  0x00050036, 0x00050032, 0x0005002a, 0x00060028, 
+  0x00050024, 0x00060023, 0x00050021, 0x00050023, 
+  0x00000041, 0x0002011f, 0x0002010e, 0x00000051, 
+  0x00040021, 0x0005001d, 0x0005001e, 0x0005001e, 
+  0x0005001f, 0x00050021, 0x00050026, 0x00060029, 
+  0x0004002e, 0x00040034, 0x00030037, 0x0004003b, 
+  0x00040042, 0x00040047, 0x00030050, 0x00040054, 
+  0x0000005e, 0x00000066, 0x0000006f, 0x0002007c, 
+  0x00000183, 0x00000079, 0x0000006f, 0x00000066, 
+  0x0000005e, 0x00000056, 0x00030050, 0x00040047, 
+  0x00040042, 0x0004003b, 0x00050036, 0x00050032, 
+  0x0005002a, 0x00060028, 0x00050024, 0x00060023, 
+  0x00050021, 0x00050023, 0x00000041, 0x0002011f, 
+  0x0002010e, 0x00030055, 0x00030023, 0x0004001e, 
+  0x0005001f, 0x0005001f, 0x00050021, 0x00050024, 
+  0x00040026, 0x0005002a, 0x0004002e, 0x00030035, 
+  0x00030037, 0x0004003f, 0x00020042, 0x00030047, 
+  0x00010050, 0x00010056, 0x0002005f, 0x00000065, 
+  0x0001006e, 0x0001007a, 0x00010085, 0x00020080, 
+  0x00010078, 0x0000006d, 0x00000064, 0x0000015c, 
+  0x00000055, 0x0001004e, 0x00020046, 0x00030041, 
+  0x0002003a, 0x00050035, 0x00040030, 0x0004002b, 
+  0x00050029, 0x00040026, 0x00050024, 0x00030026, 
+  0x00030048, 0x00030122, 0x0002010e, 0x00030055, 
+  0x00030023, 0x0004001e, 0x0005001f, 0x0005001f, 
+  0x00050021, 0x00050024, 0x00040026, 0x0005002a, 
+  0x0004002e, 0x00030035, 0x00030037, 0x0004003f, 
+  0x00020042, 0x00030047, 0x00010050, 0x00010056, 
+  0x0002005f, 0x00000065, 0x0001006e, 0x0001007a, 
+  0x00010085, 0x00020080, 0x00010078, 0x0000006d, 
+  0x00000064, 0x0000015c, 0x00000055, 0x0001004e, 
+  0x00020046, 0x00030041, 0x0002003a, 0x00050035, 
+  0x00040030, 0x0004002b, 0x00050029, 0x00040026, 
+  0x00050024, 0x00030026, 0x00030048, 0x00030122, 
+  0x0002010e, 0x00030055, 0x00030023, 0x0004001e, 
+  0x0005001f, 0x0005001f, 0x00050021, 0x00050024, 
+  0x00040026, 0x0005002a, 0x0004002e, 0x00030035, 
+  0x00030037, 0x0004003f, 0x00020042, 0x00030047, 
+  0x00010050, 0x00010056, 0x0002005f, 0x00000065, 
+  0x0001006e, 0x0001007a, 0x00010085, 0x00020080, 
+  0x00010078, 0x0000006d, 0x00000064, 0x0000015c, 
+  0x00000055, 0x0001004e, 0x00020046, 0x00030041, 
+  0x0002003a, 0x00050035, 0x00040030, 0x0004002b, 
+  0x00050029, 0x00040026, 0x00050024, 0x00030026, 
+  0x00030048, 0x00030122, 0x0002010f, 0x00030256, 
+  0x00020024, 0x00030021, 0x00030021, 0x00030021, 
+  0x00040023, 0x00040024, 0x00040028, 0x0003002a, 
+  0x00020030, 0x00020035, 0x00010037, 0x0002003f, 
+  0x00020042, 0x00000148, 0x00000050, 0x00000157, 
+  0x0000005d, 0x00010068, 0x00000070, 0x0000007a, 
+  0x00010083, 0x00010086, 0x0000007c, 0x00010073, 
+  0x0000006a, 0x00020064, 0x0000015a, 0x00010053, 
+  0x0000014a, 0x00010043, 0x0002003f, 0x00010037, 
+  0x00020035, 0x00020030, 0x0003002b, 0x0003002a, 
+  0x00030029, 0x0001002a, 0x0002004d, 0x00040121, 
+  0x0002010f, 0x00030256, 0x00020024, 0x00030021, 
+  0x00030021, 0x00030021, 0x00040023, 0x00040024, 
+  0x00040028, 0x0003002a, 0x00020030, 0x00020035, 
+  0x00010037, 0x0002003f, 0x00020042, 0x00000148, 
+  0x00000050, 0x00000157, 0x0000005d, 0x00010068, 
+  0x00000070, 0x0000007a, 0x00010083, 0x00010086, 
+  0x0000007c, 0x00010073, 0x0000006a, 0x00020064, 
+  0x0000015a, 0x00010053, 0x0000014a, 0x00010043, 
+  0x0002003f, 0x00010037, 0x00020035, 0x00020030, 
+  0x0003002b, 0x0003002a, 0x00030029, 0x0001002a, 
+  0x0002004d, 0x00040121, 0x0002010f, 0x00030256, 
+  0x00020024, 0x00030021, 0x00030021, 0x00030021, 
+  0x00040023, 0x00040024, 0x00040028, 0x0003002a, 
+  0x00020030, 0x00020035, 0x00010037, 0x0002003f, 
+  0x00020042, 0x00000148, 0x00000050, 0x00000157, 
+  0x0000005d, 0x00010068, 0x00000070, 0x0000007a, 
+  0x00010083, 0x00010086, 0x0000007c, 0x00010073, 
+  0x0000006a, 0x00020064, 0x0000015a, 0x00010053, 
+  0x0000014a, 0x00010043, 0x0002003f, 0x00010037, 
+  0x00020035, 0x00020030, 0x0003002b, 0x0003002a, 
+  0x00030029, 0x0001002a, 0x0002004d, 0x00040121, 
+  0x00020110, 0x00050756, 0x00000027, 0x00010021, 
+  0x00020021, 0x00030023, 0x00030024, 0x00030026, 
+  0x00030029, 0x0001002b, 0x0001002f, 0x00010035, 
+  0x00010038, 0x00010042, 0x00010044, 0x00020049, 
+  0x00010051, 0x00030057, 0x00010060, 0x00020067, 
+  0x0000006f, 0x00000078, 0x00010087, 0x0001008d, 
+  0x00000084, 0x00000077, 0x00010071, 0x0000006a, 
+  0x00020060, 0x00010058, 0x00010052, 0x0000004a, 
+  0x00030044, 0x0000003e, 0x00010038, 0x00010035, 
+  0x00010032, 0x0000002c, 0x0000002c, 0x0001002f, 
+  0x00020053, 0x00040422, 0x00020110, 0x00050756, 
+  0x00000027, 0x00010021, 0x00020021, 0x00030023, 
+  0x00030024, 0x00030026, 0x00030029, 0x0001002b, 
+  0x0001002f, 0x00010035, 0x00010038, 0x00010042, 
+  0x00010044, 0x00020049, 0x00010051, 0x00030057, 
+  0x00010060, 0x00020067, 0x0000006f, 0x00000078, 
+  0x00010087, 0x0001008d, 0x00000084, 0x00000077, 
+  0x00010071, 0x0000006a, 0x00020060, 0x00010058, 
+  0x00010052, 0x0000004a, 0x00030044, 0x0000003e, 
+  0x00010038, 0x00010035, 0x00010032, 0x0000002c, 
+  0x0000002c, 0x0001002f, 0x00020053, 0x00040422, 
+  0x00020110, 0x00050756, 0x00000027, 0x00010021, 
+  0x00020021, 0x00030023, 0x00030024, 0x00030026, 
+  0x00030029, 0x0001002b, 0x0001002f, 0x00010035, 
+  0x00010038, 0x00010042, 0x00010044, 0x00020049, 
+  0x00010051, 0x00030057, 0x00010060, 0x00020067, 
+  0x0000006f, 0x00000078, 0x00010087, 0x0001008d, 
+  0x00000084, 0x00000077, 0x00010071, 0x0000006a, 
+  0x00020060, 0x00010058, 0x00010052, 0x0000004a, 
+  0x00030044, 0x0000003e, 0x00010038, 0x00010035, 
+  0x00010032, 0x0000002c, 0x0000002c, 0x0001002f, 
+  0x00020053, 0x00040422, 0x00030111, 0x00090756, 
+  0x0000002b, 0x00000023, 0x00000024, 0x00000024, 
+  0x00000024, 0x00010028, 0x00010029, 0x0001002b, 
+  0x00010031, 0x00010037, 0x0002003c, 0x0001003f, 
+  0x00010047, 0x0001004c, 0x00000153, 0x00010058, 
+  0x0000015f, 0x00000067, 0x00000071, 0x0001007b, 
+  0x00010083, 0x0000008c, 0x00010089, 0x00010081, 
+  0x0000007a, 0x00000070, 0x00000067, 0x0000015f, 
+  0x00000059, 0x00000153, 0x00010049, 0x00010047, 
+  0x0000013f, 0x0000003a, 0x00010037, 0x00010035, 
+  0x00000033, 0x00020036, 0x00050258, 0x00050423, 
+  0x00030111, 0x00090756, 0x0000002b, 0x00000023, 
+  0x00000024, 0x00000024, 0x00000024, 0x00010028, 
+  0x00010029, 0x0001002b, 0x00010031, 0x00010037, 
+  0x0002003c, 0x0001003f, 0x00010047, 0x0001004c, 
+  0x00000153, 0x00010058, 0x0000015f, 0x00000067, 
+  0x00000071, 0x0001007b, 0x00010083, 0x0000008c, 
+  0x00010089, 0x00010081, 0x0000007a, 0x00000070, 
+  0x00000067, 0x0000015f, 0x00000059, 0x00000153, 
+  0x00010049, 0x00010047, 0x0000013f, 0x0000003a, 
+  0x00010037, 0x00010035, 0x00000033, 0x00020036, 
+  0x00050258, 0x00050423, 0x00030111, 0x00090756, 
+  0x0000002b, 0x00000023, 0x00000024, 0x00000024, 
+  0x00000024, 0x00010028, 0x00010029, 0x0001002b, 
+  0x00010031, 0x00010037, 0x0002003c, 0x0001003f, 
+  0x00010047, 0x0001004c, 0x00000153, 0x00010058, 
+  0x0000015f, 0x00000067, 0x00000071, 0x0001007b, 
+  0x00010083, 0x0000008c, 0x00010089, 0x00010081, 
+  0x0000007a, 0x00000070, 0x00000067, 0x0000015f, 
+  0x00000059, 0x00000153, 0x00010049, 0x00010047, 
+  0x0000013f, 0x0000003a, 0x00010037, 0x00010035, 
+  0x00000033, 0x00020036, 0x00050258, 0x00050423, 
+  0x00030112, 0x000c0b55, 0x0001002f, 0x00000028, 
+  0x00000025, 0x00000025, 0x00000027, 0x0001002a, 
+  0x0000012b, 0x0001002f, 0x00020033, 0x00020038, 
+  0x0000003f, 0x00010041, 0x00020048, 0x0000014d, 
+  0x00000150, 0x00000059, 0x0001005e, 0x00000169, 
+  0x00ffffff, 0x0001007e, 0x00010084, 0x0000018c, 
+  0x0000028e, 0x00000087, 0x00000080, 0x00000079, 
+  0x00020071, 0x00000169, 0x0000015e, 0x00000059, 
+  0x0002004f, 0x0000014d, 0x00020048, 0x00010041, 
+  0x0003003f, 0x0000003c, 0x0002003b, 0x0001003d, 
+  0x0005055d, 0x00060424, 0x00030112, 0x000c0b55, 
+  0x0001002f, 0x00000028, 0x00000025, 0x00000025, 
+  0x00000027, 0x0001002a, 0x0000012b, 0x0001002f, 
+  0x00020033, 0x00020038, 0x0000003f, 0x00010041, 
+  0x00020048, 0x0000014d, 0x00000150, 0x00000059, 
+  0x0001005e, 0x00000169, 0x00ffffff, 0x0001007e, 
+  0x00010084, 0x0000018c, 0x0000028e, 0x00000087, 
+  0x00000080, 0x00000079, 0x00020071, 0x00000169, 
+  0x0000015e, 0x00000059, 0x0002004f, 0x0000014d, 
+  0x00020048, 0x00010041, 0x0003003f, 0x0000003c, 
+  0x0002003b, 0x0001003d, 0x0005055d, 0x00060424, 
+  0x00030112, 0x000c0b55, 0x0001002f, 0x00000028, 
+  0x00000025, 0x00000025, 0x00000027, 0x0001002a, 
+  0x0000012b, 0x0001002f, 0x00020033, 0x00020038, 
+  0x0000003f, 0x00010041, 0x00020048, 0x0000014d, 
+  0x00000150, 0x00000059, 0x0001005e, 0x00000169, 
+  0x00000073, 0x0001007e, 0x00010084, 0x0000018c, 
+  0x0000028e, 0x00000087, 0x00000080, 0x00000079, 
+  0x00020071, 0x00000169, 0x0000015e, 0x00000059, 
+  0x0002004f, 0x0000014d, 0x00020048, 0x00010041, 
+  0x0003003f, 0x0000003c, 0x0002003b, 0x0001003d, 
+  0x0005055d, 0x00060424, 0x00030112, 0x000f1059, 
+  0x00020031, 0x0002002c, 0x0002002a, 0x0001002a, 
+  0x0000002b, 0x0000002c, 0x0000002e, 0x00020030, 
+  0x00010036, 0x0002003a, 0x0001003e, 0x00010043, 
+  0x0000014a, 0x0000004f, 0x00000052, 0x00010058, 
+  0x0004005f, 0x0000016b, 0x00000073, 0x00ffffff, 
+  0x00000085, 0x0000028b, 0x00000294, 0x0000018e, 
+  0x00000186, 0x00000080, 0x00010078, 0x00000170, 
+  0x0000016b, 0x0004005f, 0x00010058, 0x00000152, 
+  0x0000004f, 0x0000014a, 0x00010047, 0x00010047, 
+  0x00020043, 0x00000244, 0x00080861, 0x00070625, 
+  0x00030112, 0x000f1059, 0x00020031, 0x0002002c, 
+  0x0002002a, 0x0001002a, 0x0000002b, 0x0000002c, 
+  0x0000002e, 0x00020030, 0x00010036, 0x0002003a, 
+  0x0001003e, 0x00010043, 0x0000014a, 0x0000004f, 
+  0x00000052, 0x00010058, 0x0004005f, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00000085, 0x0000028b, 
+  0x00000294, 0x0000018e, 0x00000186, 0x00000080, 
+  0x00010078, 0x00000170, 0x0000016b, 0x0004005f, 
+  0x00010058, 0x00000152, 0x0000004f, 0x0000014a, 
+  0x00010047, 0x00010047, 0x00020043, 0x00000244, 
+  0x00080861, 0x00070625, 0x00030112, 0x000f1059, 
+  0x00020031, 0x0002002c, 0x0002002a, 0x0001002a, 
+  0x0000002b, 0x0000002c, 0x0000002e, 0x00020030, 
+  0x00010036, 0x0002003a, 0x0001003e, 0x00010043, 
+  0x0000014a, 0x0000004f, 0x00000052, 0x00010058, 
+  0x0004005f, 0x0000016b, 0x00000073, 0x0000007c, 
+  0x00000085, 0x0000028b, 0x00000294, 0x0000018e, 
+  0x00000186, 0x00000080, 0x00010078, 0x00000170, 
+  0x0000016b, 0x0004005f, 0x00010058, 0x00000152, 
+  0x0000004f, 0x0000014a, 0x00010047, 0x00010047, 
+  0x00020043, 0x00000244, 0x00080861, 0x00070625, 
+  0x00020112, 0x0011125a, 0x00010033, 0x0000002d, 
+  0x0000002d, 0x0003002e, 0x0003002e, 0x00010030, 
+  0x00000031, 0x00030032, 0x00020037, 0x0000003c, 
+  0x0001003f, 0x00020043, 0x0000014b, 0x0000004f, 
+  0x00010056, 0x0004005a, 0x00000062, 0x0000016a, 
+  0x00000071, 0x0000017c, 0x00000184, 0x0000028b, 
+  0x00000192, 0x00000192, 0x0000038b, 0x00000187, 
+  0x0000017f, 0x00000079, 0x00000071, 0x0000016a, 
+  0x00000062, 0x0004005a, 0x00010056, 0x00020052, 
+  0x0000004f, 0x0000004e, 0x0000004d, 0x00000150, 
+  0x000c0e64, 0x00080724, 0x00020112, 0x0011125a, 
+  0x00010033, 0x0000002d, 0x0000002d, 0x0003002e, 
+  0x0003002e, 0x00010030, 0x00000031, 0x00030032, 
+  0x00020037, 0x0000003c, 0x0001003f, 0x00020043, 
+  0x0000014b, 0x0000004f, 0x00010056, 0x0004005a, 
+  0x00ffffff, 0x0000016a, 0x00000071, 0x0000017c, 
+  0x00000184, 0x0000028b, 0x00000192, 0x00000192, 
+  0x0000038b, 0x00000187, 0x0000017f, 0x00000079, 
+  0x00000071, 0x0000016a, 0x00000062, 0x0004005a, 
+  0x00010056, 0x00020052, 0x0000004f, 0x0000004e, 
+  0x0000004d, 0x00000150, 0x000c0e64, 0x00080724, 
+  0x00020112, 0x0011125a, 0x00010033, 0x0000002d, 
+  0x0000002d, 0x0003002e, 0x0003002e, 0x00010030, 
+  0x00000031, 0x00030032, 0x00020037, 0x0000003c, 
+  0x0001003f, 0x00020043, 0x0000014b, 0x0000004f, 
+  0x00010056, 0x0004005a, 0x00000062, 0x0000016a, 
+  0x00000071, 0x0000017c, 0x00000184, 0x0000028b, 
+  0x00000192, 0x00000192, 0x0000038b, 0x00000187, 
+  0x0000017f, 0x00000079, 0x00000071, 0x0000016a, 
+  0x00000062, 0x0004005a, 0x00010056, 0x00020052, 
+  0x0000004f, 0x0000004e, 0x0000004d, 0x00000150, 
+  0x000c0e64, 0x00080724, 0x00030214, 0x0013145a, 
+  0x00000034, 0x00000130, 0x0003002f, 0x0001002f, 
+  0x00040030, 0x00030030, 0x00000232, 0x00020033, 
+  0x00000138, 0x0000003d, 0x00010040, 0x00000244, 
+  0x0000004d, 0x00000051, 0x00000157, 0x0001005f, 
+  0x00000164, 0x0000016b, 0x00000071, 0x0000007b, 
+  0x00000184, 0x0000018c, 0x00000193, 0x0001009a, 
+  0x00010095, 0x0000018d, 0x00000386, 0x00010080, 
+  0x00010076, 0x00000070, 0x00000069, 0x00000164, 
+  0x00000260, 0x0001005e, 0x00020057, 0x00000256, 
+  0x00000256, 0x00010257, 0x000e1067, 0x00090725, 
+  0x00030214, 0x0013145a, 0x00000034, 0x00000130, 
+  0x0003002f, 0x0001002f, 0x00040030, 0x00030030, 
+  0x00000232, 0x00020033, 0x00000138, 0x0000003d, 
+  0x00010040, 0x00000244, 0x0000004d, 0x00000051, 
+  0x00000157, 0x0001005f, 0x00ffffff, 0x0000016b, 
+  0x00000071, 0x0000007b, 0x00000184, 0x0000018c, 
+  0x00000193, 0x0001009a, 0x00010095, 0x0000018d, 
+  0x00000386, 0x00010080, 0x00010076, 0x00000070, 
+  0x00000069, 0x00000164, 0x00000260, 0x0001005e, 
+  0x00020057, 0x00000256, 0x00000256, 0x00010257, 
+  0x000e1067, 0x00090725, 0x00030214, 0x0013145a, 
+  0x00000034, 0x00000130, 0x0003002f, 0x0001002f, 
+  0x00040030, 0x00030030, 0x00000232, 0x00020033, 
+  0x00000138, 0x0000003d, 0x00010040, 0x00000244, 
+  0x0000004d, 0x00000051, 0x00000157, 0x0001005f, 
+  0x00000164, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x00000193, 0x0001009a, 
+  0x00010095, 0x0000018d, 0x00000386, 0x00010080, 
+  0x00010076, 0x00000070, 0x00000069, 0x00000164, 
+  0x00000260, 0x0001005e, 0x00020057, 0x00000256, 
+  0x00000256, 0x00010257, 0x000e1067, 0x00090725, 
+  0x00030214, 0x0015155a, 0x00040234, 0x00000131, 
+  0x00000131, 0x00020030, 0x00020031, 0x00000133, 
+  0x00000134, 0x00010037, 0x00000139, 0x0000013f, 
+  0x00000241, 0x00010046, 0x0002004f, 0x00010053, 
+  0x00000058, 0x00030060, 0x00000166, 0x0000006a, 
+  0x00000174, 0x0000007a, 0x00000284, 0x0005028b, 
+  0x0003058f, 0x00020397, 0x00020397, 0x00020392, 
+  0x0004028d, 0x00030386, 0x0000027d, 0x00000076, 
+  0x00000071, 0x0000006b, 0x00000166, 0x00000063, 
+  0x0001025f, 0x0001025e, 0x0001025e, 0x0001045f, 
+  0x0011106e, 0x000c0b25, 0x00030214, 0x0015155a, 
+  0x00040234, 0x00000131, 0x00000131, 0x00020030, 
+  0x00020031, 0x00000133, 0x00000134, 0x00010037, 
+  0x00000139, 0x0000013f, 0x00000241, 0x00010046, 
+  0x0002004f, 0x00010053, 0x00000058, 0x00030060, 
+  0x00000166, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00000284, 0x0005028b, 0x0003058f, 0x00020397, 
+  0x00020397, 0x00020392, 0x0004028d, 0x00030386, 
+  0x0000027d, 0x00000076, 0x00000071, 0x0000006b, 
+  0x00000166, 0x00000063, 0x0001025f, 0x0001025e, 
+  0x0001025e, 0x0001045f, 0x0011106e, 0x000c0b25, 
+  0x00030214, 0x0015155a, 0x00040234, 0x00000131, 
+  0x00000131, 0x00020030, 0x00020031, 0x00000133, 
+  0x00000134, 0x00010037, 0x00000139, 0x0000013f, 
+  0x00000241, 0x00010046, 0x0002004f, 0x00010053, 
+  0x00000058, 0x00030060, 0x00000166, 0x0000006a, 
+  0x00000174, 0x0000007a, 0x00000284, 0x0005028b, 
+  0x0003058f, 0x00020397, 0x00020397, 0x00020392, 
+  0x0004028d, 0x00030386, 0x0000027d, 0x00000076, 
+  0x00000071, 0x0000006b, 0x00000166, 0x00000063, 
+  0x0001025f, 0x0001025e, 0x0001025e, 0x0001045f, 
+  0x0011106e, 0x000c0b25, 0x00030213, 0x001a195b, 
+  0x00050434, 0x00000232, 0x00000031, 0x00000032, 
+  0x00010033, 0x00010033, 0x00000136, 0x00010039, 
+  0x0000023c, 0x00020042, 0x00020047, 0x00040048, 
+  0x0002004f, 0x00020155, 0x00010559, 0x0001045f, 
+  0x00010366, 0x0000026b, 0x00020272, 0x00030378, 
+  0x00060680, 0x00050588, 0x0005068e, 0x00040594, 
+  0x0005069a, 0x00040595, 0x0004058f, 0x00050588, 
+  0x00050581, 0x0006067b, 0x00030475, 0x00020272, 
+  0x0004056a, 0x00030366, 0x00050465, 0x00050462, 
+  0x00050462, 0x00060565, 0x00141371, 0x000c0c25, 
+  0x00030213, 0x001a195b, 0x00050434, 0x00000232, 
+  0x00000031, 0x00000032, 0x00010033, 0x00010033, 
+  0x00000136, 0x00010039, 0x0000023c, 0x00020042, 
+  0x00020047, 0x00040048, 0x0002004f, 0x00020155, 
+  0x00010559, 0x0001045f, 0x00ffffff, 0x0000026b, 
+  0x00020272, 0x00ffffff, 0x00060680, 0x00050588, 
+  0x0005068e, 0x00040594, 0x0005069a, 0x00040595, 
+  0x0004058f, 0x00050588, 0x00050581, 0x0006067b, 
+  0x00030475, 0x00020272, 0x0004056a, 0x00030366, 
+  0x00050465, 0x00050462, 0x00050462, 0x00060565, 
+  0x00141371, 0x000c0c25, 0x00030213, 0x001a195b, 
+  0x00050434, 0x00000232, 0x00000031, 0x00000032, 
+  0x00010033, 0x00010033, 0x00000136, 0x00010039, 
+  0x0000023c, 0x00020042, 0x00020047, 0x00040048, 
+  0x0002004f, 0x00020155, 0x00010559, 0x0001045f, 
+  0x00010366, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
+  0x00ffffff, 0x00ffffff, 0x0005068e, 0x00040594, 
+  0x0005069a, 0x00040595, 0x0004058f, 0x00050588, 
+  0x00050581, 0x0006067b, 0x00030475, 0x00020272, 
+  0x0004056a, 0x00030366, 0x00050465, 0x00050462, 
+  0x00050462, 0x00060565, 0x00141371, 0x000c0c25, 
+  0x00040214, 0x001d1c5c, 0x000b0934, 0x00020432, 
+  0x00000033, 0x00000033, 0x00000034, 0x00020335, 
+  0x00010236, 0x0000003a, 0x00010040, 0x00020143, 
+  0x00020346, 0x00060449, 0x00040550, 0x00040652, 
+  0x00040558, 0x00050560, 0x00060565, 0x00060669, 
+  0x000a0b70, 0x00080877, 0x00070780, 0x00080984, 
+  0x000a0a89, 0x00090a90, 0x00090a99, 0x000a0c95, 
+  0x00080993, 0x000a0a89, 0x00080986, 0x00070880, 
+  0x0007097b, 0x00070974, 0x00080972, 0x00060570, 
+  0x00060669, 0x00080767, 0x00080767, 0x000b0c68, 
+  0x001a1c73, 0x000e0c26, 0x00040214, 0x001d1c5c, 
+  0x000b0934, 0x00020432, 0x00000033, 0x00000033, 
+  0x00000034, 0x00020335, 0x00010236, 0x0000003a, 
+  0x00010040, 0x00020143, 0x00020346, 0x00060449, 
+  0x00040550, 0x00040652, 0x00040558, 0x00050560, 
+  0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00080877, 
+  0x00070780, 0x00080984, 0x000a0a89, 0x00090a90, 
+  0x00090a99, 0x000a0c95, 0x00080993, 0x000a0a89, 
+  0x00080986, 0x00070880, 0x0007097b, 0x00070974, 
+  0x00080972, 0x00060570, 0x00060669, 0x00080767, 
+  0x00080767, 0x000b0c68, 0x001a1c73, 0x000e0c26, 
+  0x00040214, 0x001d1c5c, 0x000b0934, 0x00020432, 
+  0x00000033, 0x00000033, 0x00000034, 0x00020335, 
+  0x00010236, 0x0000003a, 0x00010040, 0x00020143, 
+  0x00020346, 0x00060449, 0x00040550, 0x00040652, 
+  0x00040558, 0x00050560, 0x00060565, 0x00060669, 
+  0x000a0b70, 0x00080877, 0x00070780, 0x00080984, 
+  0x000a0a89, 0x00090a90, 0x00090a99, 0x000a0c95, 
+  0x00080993, 0x000a0a89, 0x00080986, 0x00070880, 
+  0x0007097b, 0x00070974, 0x00080972, 0x00060570, 
+  0x00060669, 0x00080767, 0x00080767, 0x000b0c68, 
+  0x001a1c73, 0x000e0c26, 0x000b0a1a, 0x001f215f, 
+  0x000b0d39, 0x00040234, 0x00040234, 0x00040235, 
+  0x00040235, 0x00040436, 0x0000003b, 0x0002023d, 
+  0x00050141, 0x00060643, 0x00060547, 0x0004054e, 
+  0x00050751, 0x00050556, 0x0005055e, 0x00080861, 
+  0x00080765, 0x000b0c6b, 0x000b0c71, 0x000b0b76, 
+  0x000a0c7f, 0x000b0c84, 0x000c0b89, 0x000f0f8b, 
+  0x00111094, 0x00101197, 0x00101093, 0x000e0f8f, 
+  0x000c0b89, 0x000c0c83, 0x000a0c7f, 0x000a0a7a, 
+  0x00090976, 0x000c0d72, 0x000c0c6f, 0x000b0b6e, 
+  0x000b0b6e, 0x000e0e6f, 0x001d1e7a, 0x00131229, 
+  0x000b0a1a, 0x001f215f, 0x000b0d39, 0x00040234, 
+  0x00040234, 0x00040235, 0x00040235, 0x00040436, 
+  0x0000003b, 0x0002023d, 0x00050141, 0x00060643, 
+  0x00060547, 0x0004054e, 0x00050751, 0x00050556, 
+  0x0005055e, 0x00080861, 0x00080765, 0x000b0c6b, 
+  0x00ffffff, 0x000b0b76, 0x000a0c7f, 0x000b0c84, 
+  0x000c0b89, 0x000f0f8b, 0x00111094, 0x00101197, 
+  0x00101093, 0x000e0f8f, 0x000c0b89, 0x000c0c83, 
+  0x000a0c7f, 0x000a0a7a, 0x00090976, 0x000c0d72, 
+  0x000c0c6f, 0x000b0b6e, 0x000b0b6e, 0x000e0e6f, 
+  0x001d1e7a, 0x00131229, 0x000b0a1a, 0x001f215f, 
+  0x000b0d39, 0x00040234, 0x00040234, 0x00040235, 
+  0x00040235, 0x00040436, 0x0000003b, 0x0002023d, 
+  0x00050141, 0x00060643, 0x00060547, 0x0004054e, 
+  0x00050751, 0x00050556, 0x0005055e, 0x00080861, 
+  0x00080765, 0x000b0c6b, 0x000b0c71, 0x000b0b76, 
+  0x000a0c7f, 0x000b0c84, 0x000c0b89, 0x000f0f8b, 
+  0x00111094, 0x00101197, 0x00101093, 0x000e0f8f, 
+  0x000c0b89, 0x000c0c83, 0x000a0c7f, 0x000a0a7a, 
+  0x00090976, 0x000c0d72, 0x000c0c6f, 0x000b0b6e, 
+  0x000b0b6e, 0x000e0e6f, 0x001d1e7a, 0x00131229, 
+  0x000e1925, 0x00242262, 0x00111143, 0x000b0934, 
+  0x00060734, 0x00050535, 0x00050535, 0x00040439, 
+  0x0005023d, 0x00040541, 0x00060641, 0x00060745, 
+  0x0006064d, 0x0006074f, 0x00080954, 0x00080856, 
+  0x00090a5f, 0x00090964, 0x000b0c68, 0x000c0c6f, 
+  0x000d0f72, 0x00101176, 0x000e0e7e, 0x000f1383, 
+  0x00101087, 0x0013138a, 0x00131491, 0x00151693, 
+  0x00151693, 0x0014158e, 0x0013138a, 0x00101087, 
+  0x00121382, 0x0012107f, 0x000f0f7a, 0x000e0e79, 
+  0x000f1075, 0x000f1172, 0x000f1172, 0x00171573, 
+  0x002b297d, 0x00121529, 0x000e1925, 0x00242262, 
+  0x00111143, 0x000b0934, 0x00060734, 0x00050535, 
+  0x00050535, 0x00040439, 0x0005023d, 0x00040541, 
+  0x00060641, 0x00060745, 0x0006064d, 0x0006074f, 
+  0x00080954, 0x00080856, 0x00090a5f, 0x00090964, 
+  0x000b0c68, 0x000c0c6f, 0x00ffffff, 0x00101176, 
+  0x000e0e7e, 0x000f1383, 0x00101087, 0x0013138a, 
+  0x00131491, 0x00151693, 0x00151693, 0x0014158e, 
+  0x0013138a, 0x00101087, 0x00121382, 0x0012107f, 
+  0x000f0f7a, 0x000e0e79, 0x000f1075, 0x000f1172, 
+  0x000f1172, 0x00171573, 0x002b297d, 0x00121529, 
+  0x000e1925, 0x00242262, 0x00111143, 0x000b0934, 
+  0x00060734, 0x00050535, 0x00050535, 0x00040439, 
+  0x0005023d, 0x00040541, 0x00060641, 0x00060745, 
+  0x0006064d, 0x0006074f, 0x00080954, 0x00080856, 
+  0x00090a5f, 0x00090964, 0x000b0c68, 0x000c0c6f, 
+  0x000d0f72, 0x00101176, 0x000e0e7e, 0x000f1383, 
+  0x00101087, 0x0013138a, 0x00131491, 0x00151693, 
+  0x00151693, 0x0014158e, 0x0013138a, 0x00101087, 
+  0x00121382, 0x0012107f, 0x000f0f7a, 0x000e0e79, 
+  0x000f1075, 0x000f1172, 0x000f1172, 0x00171573, 
+  0x002b297d, 0x00121529, 0x000b212b, 0x002a285b, 
+  0x0023255e, 0x00111143, 0x000b0d3b, 0x000b0d39, 
+  0x000b093c, 0x00090a3e, 0x000a0b41, 0x000a0b42, 
+  0x00090c46, 0x000a0b4c, 0x000a0a4f, 0x000e0c53, 
+  0x000c0b55, 0x000e0e5d, 0x000d0f63, 0x000d0e6a, 
+  0x000e0e6f, 0x00101271, 0x00141374, 0x00141477, 
+  0x0017187d, 0x00161681, 0x00161686, 0x00191989, 
+  0x00191a8d, 0x001b1d90, 0x001c1c95, 0x001b1d90, 
+  0x00191a8d, 0x00171789, 0x00181885, 0x00151582, 
+  0x0018197e, 0x0017187d, 0x0014137d, 0x00151778, 
+  0x00191a77, 0x0028297e, 0x00322d68, 0x000c1b25, 
+  0x000b212b, 0x002a285b, 0x0023255e, 0x00111143, 
+  0x000b0d3b, 0x000b0d39, 0x000b093c, 0x00090a3e, 
+  0x000a0b41, 0x000a0b42, 0x00090c46, 0x000a0b4c, 
+  0x000a0a4f, 0x000e0c53, 0x000c0b55, 0x000e0e5d, 
+  0x000d0f63, 0x000d0e6a, 0x000e0e6f, 0x00101271, 
+  0x00141374, 0x00141477, 0x0017187d, 0x00161681, 
+  0x00161686, 0x00191989, 0x00191a8d, 0x001b1d90, 
+  0x001c1c95, 0x001b1d90, 0x00191a8d, 0x00171789, 
+  0x00181885, 0x00151582, 0x0018197e, 0x0017187d, 
+  0x0014137d, 0x00151778, 0x00191a77, 0x0028297e, 
+  0x00322d68, 0x000c1b25, 0x000b212b, 0x002a285b, 
+  0x0023255e, 0x00111143, 0x000b0d3b, 0x000b0d39, 
+  0x000b093c, 0x00090a3e, 0x000a0b41, 0x000a0b42, 
+  0x00090c46, 0x000a0b4c, 0x000a0a4f, 0x000e0c53, 
+  0x000c0b55, 0x000e0e5d, 0x000d0f63, 0x000d0e6a, 
+  0x000e0e6f, 0x00101271, 0x00141374, 0x00141477, 
+  0x0017187d, 0x00161681, 0x00161686, 0x00191989, 
+  0x00191a8d, 0x001b1d90, 0x001c1c95, 0x001b1d90, 
+  0x00191a8d, 0x00171789, 0x00181885, 0x00151582, 
+  0x0018197e, 0x0017187d, 0x0014137d, 0x00151778, 
+  0x00191a77, 0x0028297e, 0x00322d68, 0x000c1b25, 
+  0x000c2d35, 0x00143149, 0x0029275c, 0x002a2868, 
+  0x0020235d, 0x00201f57, 0x001c1c57, 0x001c1c59, 
+  0x001b1b5a, 0x001d1c5c, 0x001c1b5f, 0x001e1f60, 
+  0x001d1d64, 0x001c1e6a, 0x001c1e6d, 0x001e1e6d, 
+  0x001f1e72, 0x001e2076, 0x00202079, 0x0023227b, 
+  0x0023247e, 0x00232480, 0x00272782, 0x00292785, 
+  0x00282889, 0x0028288d, 0x002d2b91, 0x002d2d90, 
+  0x002d2d90, 0x002d2d90, 0x002c2e91, 0x002d2c8d, 
+  0x00282a8b, 0x00282889, 0x00282988, 0x00282785, 
+  0x00272784, 0x00292b81, 0x0032317f, 0x00302e6b, 
+  0x00172d45, 0x000b2a34, 0x000c2d35, 0x00143149, 
+  0x0029275c, 0x002a2868, 0x0020235d, 0x00201f57, 
+  0x001c1c57, 0x001c1c59, 0x001b1b5a, 0x001d1c5c, 
+  0x001c1b5f, 0x001e1f60, 0x001d1d64, 0x001c1e6a, 
+  0x001c1e6d, 0x001e1e6d, 0x001f1e72, 0x001e2076, 
+  0x00202079, 0x0023227b, 0x0023247e, 0x00232480, 
+  0x00272782, 0x00292785, 0x00282889, 0x0028288d, 
+  0x002d2b91, 0x002d2d90, 0x002d2d90, 0x002d2d90, 
+  0x002c2e91, 0x002d2c8d, 0x00282a8b, 0x00282889, 
+  0x00282988, 0x00282785, 0x00272784, 0x00292b81, 
+  0x0032317f, 0x00302e6b, 0x00172d45, 0x000b2a34, 
+  0x000c2d35, 0x00143149, 0x0029275c, 0x002a2868, 
+  0x0020235d, 0x00201f57, 0x001c1c57, 0x001c1c59, 
+  0x001b1b5a, 0x001d1c5c, 0x001c1b5f, 0x001e1f60, 
+  0x001d1d64, 0x001c1e6a, 0x001c1e6d, 0x001e1e6d, 
+  0x001f1e72, 0x001e2076, 0x00202079, 0x0023227b, 
+  0x0023247e, 0x00232480, 0x00272782, 0x00292785, 
+  0x00282889, 0x0028288d, 0x002d2b91, 0x002d2d90, 
+  0x002d2d90, 0x002d2d90, 0x002c2e91, 0x002d2c8d, 
+  0x00282a8b, 0x00282889, 0x00282988, 0x00282785, 
+  0x00272784, 0x00292b81, 0x0032317f, 0x00302e6b, 
+  0x00172d45, 0x000b2a34, 0x000e2a34, 0x000c2c35, 
+  0x000c1d26, 0x00121828, 0x00141328, 0x00110f25, 
+  0x00100f24, 0x00100f24, 0x000f0e24, 0x000f0e24, 
+  0x00100e24, 0x00110f25, 0x00110f25, 0x00110f25, 
+  0x00110f25, 0x00110f26, 0x00110f26, 0x00110f26, 
+  0x00111026, 0x00110f29, 0x00110f29, 0x00121129, 
+  0x00121129, 0x00131229, 0x00131229, 0x0013112b, 
+  0x0013122c, 0x0014122c, 0x0013122d, 0x0013122d, 
+  0x0014122c, 0x0013122c, 0x0013122b, 0x0013112a, 
+  0x0013112a, 0x00131229, 0x00131229, 0x0016152b, 
+  0x0014172a, 0x000c1a25, 0x000c2a33, 0x000f2b34, 
+  0x000e2a34, 0x000c2c35, 0x000c1d26, 0x00121828, 
+  0x00141328, 0x00110f25, 0x00100f24, 0x00100f24, 
+  0x000f0e24, 0x000f0e24, 0x00100e24, 0x00110f25, 
+  0x00110f25, 0x00110f25, 0x00110f25, 0x00110f26, 
+  0x00110f26, 0x00110f26, 0x00111026, 0x00110f29, 
+  0x00110f29, 0x00121129, 0x00121129, 0x00131229, 
+  0x00131229, 0x0013112b, 0x0013122c, 0x0014122c, 
+  0x0013122d, 0x0013122d, 0x0014122c, 0x0013122c, 
+  0x0013122b, 0x0013112a, 0x0013112a, 0x00131229, 
+  0x00131229, 0x0016152b, 0x0014172a, 0x000c1a25, 
+  0x000c2a33, 0x000f2b34, 0x000e2a34, 0x000c2c35, 
+  0x000c1d26, 0x00121828, 0x00141328, 0x00110f25, 
+  0x00100f24, 0x00100f24, 0x000f0e24, 0x000f0e24, 
+  0x00100e24, 0x00110f25, 0x00110f25, 0x00110f25, 
+  0x00110f25, 0x00110f26, 0x00110f26, 0x00110f26, 
+  0x00111026, 0x00110f29, 0x00110f29, 0x00121129, 
+  0x00121129, 0x00131229, 0x00131229, 0x0013112b, 
+  0x0013122c, 0x0014122c, 0x0013122d, 0x0013122d, 
+  0x0014122c, 0x0013122c, 0x0013122b, 0x0013112a, 
+  0x0013112a, 0x00131229, 0x00131229, 0x0016152b, 
+  0x0014172a, 0x000c1a25, 0x000c2a33, 0x000f2b34, 
+  
+  // End of bitmap
+};
+
+OskImgData s_imgNumActive =
+{
+  .width = 126,
+  .height = 126,
+  .bitmap = s_bitmapNumActive,
+};
+
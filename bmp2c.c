@@ -4,6 +4,8 @@
  *---------------------------------------------------------------------------*/
 #include <unistd.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "oskimg.h"
 
 
@@ -22,7 +24,7 @@
 static char * getTag(char * tagName_, const char * bmpName_);
 static BOOL readBitmap(FILE * file_, OskImgData * imgData_);
 static BOOL writeRc(FILE * file_, const char * tagName_, const OskImgData * imgData_);
-static inline unsigned long convertPixel(unsigned long c_);
+static inline unsigned int convertPixel(unsigned int c_);
 
 
 /*-----------------------------------------------------------------------------
@@ -103,8 +105,8 @@ static BOOL readBitmap(FILE * file_, OskImgData * imgData_)
   BITMAPINFOHEADER infoHeader;
   int i, j;
   int skipLen;
-  unsigned long * line;
-  unsigned long pixel;
+  unsigned int * line;
+  unsigned int pixel = 0;
 
   if ( fread( &fileHeader, 14 /*sizeof( fileHeader )*/, 1, file_ ) != 1 )
   {
@@ -159,9 +161,9 @@ static BOOL readBitmap(FILE * file_, OskImgData * imgData_)
   imgData_->width = infoHeader.biWidth;
   imgData_->height = infoHeader.biHeight;
 
-  imgData_->bitmap = (unsigned long *)malloc( infoHeader.biWidth *
-                                              infoHeader.biHeight *
-                                              sizeof( unsigned long ) );
+  imgData_->bitmap = (unsigned int *)malloc( infoHeader.biWidth *
+                                             infoHeader.biHeight *
+                                             sizeof( unsigned int ) );
   if ( imgData_->bitmap == NULL )
   {
     printf( "Failed to allocate buffer for storing bitmap bits\n" );
@@ -212,7 +214,7 @@ static BOOL writeRc
            "// This file is auto-generated. DO NOT edit.\n"
            "#include \"oskimg.h\"\n"
            "\n"
-           "static unsigned long s_bitmap%s[ %d ] =\n"
+           "static unsigned int s_bitmap%s[ %d ] =\n"
            "{\n  ",
            tagName_, size );
 
@@ -244,7 +246,7 @@ static BOOL writeRc
   return TRUE;
 }
 /*---------------------------------------------------------------------------*/
-static inline unsigned long convertPixel(unsigned long c_)
+static inline unsigned int convertPixel(unsigned int c_)
 {
   return ( ( c_ & 0x0000ff ) << 16 ) |
            ( c_ & 0x00ff00 ) |
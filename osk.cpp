@@ -4,7 +4,11 @@
  *---------------------------------------------------------------------------*/
 #include "osk.h"
 #include <unistd.h>
+#include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <sys/time.h>
 
 
 //-----------------------------------------------------------------------------
@@ -19,10 +23,30 @@ typedef struct
 //-----------------------------------------------------------------------------
 // Constants
 //-----------------------------------------------------------------------------
-static const unsigned long AnalogPosLowerThreshold = 0x3;
-static const unsigned long AnalogPosUpperThreshold = 0xc;
 static const int DefaultNumVirtualTerminals = 4;
+static const unsigned long DefaultImageCacheLimit = 1024 * 1024;
 static const char PowerOffCommand[] = "/sbin/poweroff";
+static const char c_repeatEnv[] = "OSK_REPEAT";
+static const unsigned long DefaultRepeatDelay = 400000;     // in us
+static const unsigned long DefaultRepeatInterval = 80000;   // in us
+static const unsigned long DefaultRepeatFastest = 30000;    // in us
+static const int DefaultRepeatPercent = 90;
+static const char c_analogEnv[] = "OSK_ANALOG";
+static const int DefaultAnalogDeadzone = 62;      // in %
+static const int DefaultAnalogMargin = 12;        // in %
+static const int DefaultAnalogAngleMargin = 8;    // in degrees
+static const char c_layoutEnv[] = "OSK_LAYOUT";
+static const int ModifierBarHeight = 4;
+static const int TransitionLoopLimit = 8;   // State changes on one input
+
+
+// One bar per modifier, dim while one-shot and bright while locked
+static const unsigned long c_modifierColors[ 3 ][ 2 ] =
+{
+  { 0x00000080, 0x000000ff },   // Ctrl, red
+  { 0x00008000, 0x0000ff00 },   // Alt, green
+  { 0x00800000, 0x00ff0000 },   // Meta, blue
+};
 
 
 //-----------------------------------------------------------------------------
@@ -83,17 +107,286 @@ static OskImageSectionOffset s_sectionOffset[ KSID_Count ] =
   { 2, 2 },   // KSID_BottomRight
 };
 
-static unsigned char s_screenshotHeader[ 0x36 ] = {
-	0x42, 0x4D, 0x38, 0xF8, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00,
-	0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0xFE,
-  0xFF, 0xFF, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0B,
-  0x00, 0x00, 0x12, 0x0B, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+
+// 4x4 Bayer matrix for ordered dithering
+static const unsigned char s_ditherMatrix[ 4 ][ 4 ] =
+{
+  {  0,  8,  2, 10 },
+  { 12,  4, 14,  6 },
+  {  3, 11,  1,  9 },
+  { 15,  7, 13,  5 },
 };
 
-static char s_screenshotFileName[] = "/usr/screenshots/screenshot%04d.bmp";
+// OskClock, when driven by hand
+static bool s_clockManual = false;
+static volatile unsigned long s_clockTime = 0;
+static unsigned long s_clockStep = 0;
+static unsigned long s_clockSkipped = 0;   // By replay, on top of the real one
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+// Comma separated numbers into values_; a field left empty or out keeps
+// what is there
+static void readNumberList
+(
+  const char * text_,
+  unsigned long * values_,
+  int count_
+)
+{
+  for ( int i = 0; text_ != NULL && *text_ != 0 && i < count_; i++ )
+  {
+    char * end;
+    const unsigned long value = strtoul( text_, &end, 10 );
+    if ( end != text_ )
+    {
+      values_[ i ] = value;
+    }
+    text_ = ( *end == ',' ) ? end + 1 : NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+// Cuts the first rectangle down to where it overlaps the second; false if
+// nothing is left
+static bool clipRect
+(
+  int & x_,
+  int & y_,
+  int & width_,
+  int & height_,
+  int clipX_,
+  int clipY_,
+  int clipWidth_,
+  int clipHeight_
+)
+{
+  const int right = ( x_ + width_ < clipX_ + clipWidth_ )
+                      ? x_ + width_ : clipX_ + clipWidth_;
+  const int bottom = ( y_ + height_ < clipY_ + clipHeight_ )
+                       ? y_ + height_ : clipY_ + clipHeight_;
+  if ( x_ < clipX_ )  x_ = clipX_;
+  if ( y_ < clipY_ )  y_ = clipY_;
+  width_ = right - x_;
+  height_ = bottom - y_;
+  return ( width_ > 0 && height_ > 0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskPixelFormat
+//-----------------------------------------------------------------------------
+OskPixelFormat::OskPixelFormat()
+{
+  (void)SetDefault( 32 );
+}
+//-----------------------------------------------------------------------------
+bool OskPixelFormat::Set
+(
+  int bitsPerPixel_,
+  int redOffset_,
+  int redLength_,
+  int greenOffset_,
+  int greenLength_,
+  int blueOffset_,
+  int blueLength_
+)
+{
+  // Some drivers leave the bitfields empty
+  if ( redLength_ == 0 && greenLength_ == 0 && blueLength_ == 0 )
+    return SetDefault( bitsPerPixel_ );
+
+  if ( ( bitsPerPixel_ != 16 && bitsPerPixel_ != 24 && bitsPerPixel_ != 32 ) ||
+       redLength_ <= 0 || redLength_ > 8 ||
+       greenLength_ <= 0 || greenLength_ > 8 ||
+       blueLength_ <= 0 || blueLength_ > 8 )
+  {
+    DBG(( "OSK: Unsupported pixel format, bpp=%d\n", bitsPerPixel_ ));
+    return false;
+  }
+
+  m_bitsPerPixel = bitsPerPixel_;
+  m_redOffset = redOffset_;
+  m_redLength = redLength_;
+  m_greenOffset = greenOffset_;
+  m_greenLength = greenLength_;
+  m_blueOffset = blueOffset_;
+  m_blueLength = blueLength_;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskPixelFormat::SetDefault(int bitsPerPixel_)
+{
+  switch ( bitsPerPixel_ )
+  {
+  case 32:
+  case 24:
+    return Set( bitsPerPixel_, 0, 8, 8, 8, 16, 8 );
+
+  case 16:
+    // The PSP's 5650 mode, red in the low bits
+    return Set( bitsPerPixel_, 0, 5, 5, 6, 11, 5 );
+
+  default:
+    DBG(( "OSK: Unsupported pixel format, bpp=%d\n", bitsPerPixel_ ));
+    return false;
+  }
+}
+//-----------------------------------------------------------------------------
+unsigned long OskPixelFormat::Pack
+(
+  unsigned long color_,
+  int x_,
+  int y_,
+  bool dither_
+) const
+{
+  const int bias = dither_ ? s_ditherMatrix[ y_ & 3 ][ x_ & 3 ] : 0;
+
+  return ( packChannel( color_ & 0xff, m_redLength, bias ) << m_redOffset ) |
+         ( packChannel( ( color_ >> 8 ) & 0xff, m_greenLength, bias )
+             << m_greenOffset ) |
+         ( packChannel( ( color_ >> 16 ) & 0xff, m_blueLength, bias )
+             << m_blueOffset );
+}
+//-----------------------------------------------------------------------------
+unsigned long OskPixelFormat::Unpack(unsigned long pixel_) const
+{
+  return ( unpackChannel( pixel_, m_redOffset, m_redLength ) << 16 ) |
+         ( unpackChannel( pixel_, m_greenOffset, m_greenLength ) << 8 ) |
+           unpackChannel( pixel_, m_blueOffset, m_blueLength );
+}
+//-----------------------------------------------------------------------------
+void OskPixelFormat::UnpackRow
+(
+  OskPixel32 * dest_,
+  const void * sour_,
+  int count_
+) const
+{
+  if ( IsImageNative() )
+  {
+    // Only red and blue trade places, so do it a whole word at a time:
+    // mask both out together and rotate them by 16 bits in one go
+    const OskPixel32 * sour = (const OskPixel32 *)sour_;
+    int x = 0;
+
+    for ( ; x + 4 <= count_; x += 4 )
+    {
+      const OskPixel32 p0 = sour[ x ];
+      const OskPixel32 p1 = sour[ x + 1 ];
+      const OskPixel32 p2 = sour[ x + 2 ];
+      const OskPixel32 p3 = sour[ x + 3 ];
+      const OskPixel32 t0 = p0 & 0x00ff00ff;
+      const OskPixel32 t1 = p1 & 0x00ff00ff;
+      const OskPixel32 t2 = p2 & 0x00ff00ff;
+      const OskPixel32 t3 = p3 & 0x00ff00ff;
+
+      dest_[ x ]     = ( p0 & 0x0000ff00 ) | ( t0 << 16 ) | ( t0 >> 16 );
+      dest_[ x + 1 ] = ( p1 & 0x0000ff00 ) | ( t1 << 16 ) | ( t1 >> 16 );
+      dest_[ x + 2 ] = ( p2 & 0x0000ff00 ) | ( t2 << 16 ) | ( t2 >> 16 );
+      dest_[ x + 3 ] = ( p3 & 0x0000ff00 ) | ( t3 << 16 ) | ( t3 >> 16 );
+    }
+
+    for ( ; x < count_; x++ )
+    {
+      const OskPixel32 t = sour[ x ] & 0x00ff00ff;
+      dest_[ x ] = ( sour[ x ] & 0x0000ff00 ) | ( t << 16 ) | ( t >> 16 );
+    }
+
+    return;
+  }
+
+  const unsigned char * sour = (const unsigned char *)sour_;
+  const int bytesPerPixel = GetBytesPerPixel();
+
+  for ( int x = 0; x < count_; x++ )
+  {
+    unsigned long pixel = 0;
+    for ( int i = bytesPerPixel - 1; i >= 0; i-- )
+      pixel = ( pixel << 8 ) | sour[ i ];
+
+    dest_[ x ] = (OskPixel32)Unpack( pixel );
+    sour += bytesPerPixel;
+  }
+}
+//-----------------------------------------------------------------------------
+void OskPixelFormat::PackRow
+(
+  void * dest_,
+  const OskPixel32 * sour_,
+  int count_,
+  int y_,
+  bool dither_
+) const
+{
+  unsigned char * dest = (unsigned char *)dest_;
+  const int bytesPerPixel = GetBytesPerPixel();
+
+  for ( int x = 0; x < count_; x++ )
+  {
+    unsigned long pixel = Pack( sour_[ x ], x, y_, dither_ );
+
+    // Framebuffer memory is little endian on the PSP
+    for ( int i = 0; i < bytesPerPixel; i++ )
+    {
+      *dest++ = (unsigned char)( pixel & 0xff );
+      pixel >>= 8;
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskPixelFormat::IsImageNative() const
+{
+  return ( m_bitsPerPixel == 32 &&
+           m_redOffset == 0 && m_redLength == 8 &&
+           m_greenOffset == 8 && m_greenLength == 8 &&
+           m_blueOffset == 16 && m_blueLength == 8 );
+}
+//-----------------------------------------------------------------------------
+unsigned long OskPixelFormat::packChannel
+(
+  unsigned long value_,
+  int length_,
+  int bias_
+)
+{
+  const int shift = 8 - length_;
+  if ( shift <= 0 )
+    return value_;
+
+  // Spread the dither threshold over one output step
+  value_ += (unsigned long)( ( bias_ << shift ) >> 4 );
+  if ( value_ > 0xff )
+    value_ = 0xff;
+
+  return value_ >> shift;
+}
+//-----------------------------------------------------------------------------
+unsigned long OskPixelFormat::unpackChannel
+(
+  unsigned long pixel_,
+  int offset_,
+  int length_
+)
+{
+  unsigned long value = ( pixel_ >> offset_ ) & ( ( 1UL << length_ ) - 1 );
+  const int shift = 8 - length_;
+
+  if ( shift <= 0 )
+    return value;
+
+  // Replicate the high bits so that full scale maps to 0xff; a channel of
+  // under 4 bits takes more than one copy to fill the byte
+  value <<= shift;
+  for ( int filled = length_; filled < 8; filled *= 2 )
+  {
+    value |= value >> filled;
+  }
+
+  return value;
+}
 
 
 //-----------------------------------------------------------------------------
@@ -102,7 +395,8 @@ static char s_screenshotFileName[] = "/usr/screenshots/screenshot%04d.bmp";
 OskImage::OskImage(ImageId imgId_)
   : m_imgId( imgId_ ),
     m_width( 0 ),
-    m_height( 0 )
+    m_height( 0 ),
+    m_bytesPerPixel( 4 )
 {
 }
 
@@ -112,51 +406,663 @@ OskImage::OskImage(ImageId imgId_)
 //-----------------------------------------------------------------------------
 OskCanvas::OskCanvas()
   : m_width( 0 ),
-    m_height( 0 )
+    m_height( 0 ),
+    m_frameDepth( 0 ),
+    m_frameDirty( false ),
+    m_numFlushes( 0 ),
+    m_numFrames( 0 ),
+    m_frameFlushes( 0 ),
+    m_lastFrameFlushes( 0 ),
+    m_underValid( false ),
+    m_underX( 0 ),
+    m_underY( 0 ),
+    m_underWidth( 0 ),
+    m_underHeight( 0 ),
+    m_underTime( 0 ),
+    m_underStale( false ),
+    m_consoleDrawn( true )
+{
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas::BeginFrame()
 {
+  if ( m_frameDepth++ == 0 )
+  {
+    m_frameDirty = false;
+    m_frameFlushes = 0;
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas::CommitFrame()
+{
+  if ( m_frameDepth <= 0 )
+  {
+    DBG(( "OSK: CommitFrame() without BeginFrame()\n" ));
+    return false;
+  }
+
+  if ( --m_frameDepth > 0 )
+    return true;
+
+  bool rt = true;
+  if ( m_frameDirty )
+  {
+    m_frameDirty = false;
+    rt = present();
+  }
+
+  m_numFrames++;
+  m_lastFrameFlushes = m_frameFlushes;
+  return rt;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas::damage()
+{
+  if ( m_frameDepth > 0 )
+  {
+    // Deferred to CommitFrame()
+    m_frameDirty = true;
+    return true;
+  }
+
+  return doFlush();
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas::doFlush()
+{
+  m_numFlushes++;
+  m_frameFlushes++;
+  return flush();
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskClock
+//-----------------------------------------------------------------------------
+unsigned long OskClock::Now()
+{
+  if ( s_clockManual )
+    return s_clockTime;
+
+  struct timeval tv;
+  (void)gettimeofday( &tv, NULL );
+  return (unsigned long)tv.tv_sec * 1000000UL + (unsigned long)tv.tv_usec +
+         s_clockSkipped;
+}
+//-----------------------------------------------------------------------------
+void OskClock::SetManual(bool manual_, unsigned long step_)
+{
+  s_clockManual = manual_;
+  s_clockTime = 0;
+  s_clockStep = manual_ ? step_ : 0;
+}
+//-----------------------------------------------------------------------------
+void OskClock::Step()
+{
+  s_clockTime += s_clockStep;
+}
+//-----------------------------------------------------------------------------
+void OskClock::Skip(unsigned long us_)
+{
+  if ( s_clockManual )
+  {
+    s_clockTime += us_;
+  }
+  else
+  {
+    s_clockSkipped += us_;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskCompositor
+//-----------------------------------------------------------------------------
+OskCompositor::OskCompositor()
+  : m_canvas( NULL ),
+    m_images( NULL ),
+    m_cache( NULL ),
+    m_frameValid( false ),
+    m_frameX( 0 ),
+    m_frameY( 0 ),
+    m_frameBase( OskImage::IMGID_Count ),
+    m_frameActive( OskImage::IMGID_Count ),
+    m_frameSection( KSID_Count ),
+    m_damageX( 0 ),
+    m_damageY( 0 ),
+    m_damageWidth( 0 ),
+    m_damageHeight( 0 ),
+    m_numBlits( 0 ),
+    m_numPixels( 0 ),
+    m_numPixelsSaved( 0 ),
+    m_numFullRepaints( 0 ),
+    m_numPartialRepaints( 0 ),
+    m_fullRepaintTime( 0 ),
+    m_numRestores( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+void OskCompositor::Attach
+(
+  OskCanvas * canvas_,
+  OskImage * const * images_,
+  OskImageCache * cache_
+)
+{
+  m_canvas = canvas_;
+  m_images = images_;
+  m_cache = cache_;
+  Invalidate();
+}
+//-----------------------------------------------------------------------------
+void OskCompositor::Invalidate()
+{
+  m_frameValid = false;
+  m_frameSection = KSID_Count;
+  m_damageWidth = 0;
+  m_damageHeight = 0;
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::Clear
+(
+  int x_,
+  int y_,
+  int width_,
+  int height_
+)
+{
+  if ( m_canvas == NULL )
+    return false;
+
+  // Anything drawn outside DrawKeyboard() ruins the damage tracking
+  Invalidate();
+
+  m_numPixels += (unsigned long)( width_ * height_ );
+  return m_canvas->Clear( x_, y_, width_, height_ );
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::Fill
+(
+  int x_,
+  int y_,
+  int width_,
+  int height_,
+  unsigned long color_
+)
+{
+  if ( m_canvas == NULL )
+    return false;
+
+  // Small marks over the keyboard, such as the modifier bars; the frame
+  // stays valid and only this rectangle is repainted next time
+  damage( x_, y_, width_, height_ );
+
+  m_numPixels += (unsigned long)( width_ * height_ );
+  return m_canvas->Fill( x_, y_, width_, height_, color_ );
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::DrawImage
+(
+  int destX_,
+  int destY_,
+  OskImage::ImageId imgId_,
+  int sourX_,
+  int sourY_,
+  int width_,
+  int height_
+)
+{
+  Invalidate();
+  return blit( destX_, destY_, ( m_images != NULL ) ? m_images[ imgId_ ] : NULL,
+               sourX_, sourY_, width_, height_ );
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::RestoreUnder
+(
+  int x_,
+  int y_,
+  int width_,
+  int height_
+)
+{
+  if ( m_canvas == NULL )
+    return false;
+
+  Invalidate();
+
+  if ( !m_canvas->RestoreUnder( x_, y_, width_, height_ ) )
+    return false;
+
+  m_numRestores++;
+  m_numPixels += (unsigned long)( width_ * height_ );
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::DrawKeyboard
+(
+  int x_,
+  int y_,
+  OskImage::ImageId baseId_,
+  OskImage::ImageId activeId_,
+  OskKeySectionId sectionId_
+)
+{
+  if ( m_canvas == NULL || m_images == NULL )
+    return false;
+
+  const OskImage * const base = m_images[ baseId_ ];
+  const OskImage * const active = m_images[ activeId_ ];
+  if ( base == NULL || active == NULL )
+    return false;
+
+  int secX, secY, secWidth, secHeight;
+  GetSectionRect( *active, sectionId_, secX, secY, secWidth, secHeight );
+
+  const unsigned long fullCost =
+      (unsigned long)( base->GetWidth() * base->GetHeight() +
+                       secWidth * secHeight );
+
+  if ( m_frameValid &&
+       m_frameX == x_ && m_frameY == y_ &&
+       m_frameBase == baseId_ && m_frameActive == activeId_ )
+  {
+    if ( m_frameSection == sectionId_ )
+    {
+      // Nothing changed but what was drawn over the frame
+      m_numPixelsSaved += fullCost -
+                          (unsigned long)( m_damageWidth * m_damageHeight );
+      return repaintDamage( *base, *active,
+                            secX, secY, secWidth, secHeight );
+    }
+
+    // Restore the old highlighted cell from the base image
+    int oldX, oldY, oldWidth, oldHeight;
+    GetSectionRect( *base, m_frameSection, oldX, oldY, oldWidth, oldHeight );
+
+    m_frameValid = false;
+    if ( !blit( x_ + oldX, y_ + oldY, base,
+                oldX, oldY, oldWidth, oldHeight ) )
+      return false;
+
+    // Paint the new one
+    if ( !blit( x_ + secX, y_ + secY, active,
+                secX, secY, secWidth, secHeight ) )
+      return false;
+
+    m_numPixelsSaved += fullCost -
+                        (unsigned long)( oldWidth * oldHeight +
+                                         secWidth * secHeight );
+    m_numPartialRepaints++;
+
+    if ( !repaintDamage( *base, *active, secX, secY, secWidth, secHeight ) )
+      return false;
+  }
+  else
+  {
+    const unsigned long start = OskClock::Now();
+    const OskImage * const composed =
+        ( m_cache != NULL ) ? m_cache->Lookup( baseId_, activeId_, sectionId_ )
+                            : NULL;
+
+    m_frameValid = false;
+    if ( composed != NULL )
+    {
+      // One contiguous copy of the pre-composed frame
+      if ( !blit( x_, y_, composed,
+                  0, 0, composed->GetWidth(), composed->GetHeight() ) )
+        return false;
+
+      m_numPixelsSaved += (unsigned long)( secWidth * secHeight );
+    }
+    else
+    {
+      if ( !blit( x_, y_, base,
+                  0, 0, base->GetWidth(), base->GetHeight() ) )
+        return false;
+
+      if ( !blit( x_ + secX, y_ + secY, active,
+                  secX, secY, secWidth, secHeight ) )
+        return false;
+    }
+
+    m_fullRepaintTime += OskClock::Now() - start;
+    m_numFullRepaints++;
+    m_damageWidth = 0;
+    m_damageHeight = 0;
+  }
+
+  m_frameValid = true;
+  m_frameX = x_;
+  m_frameY = y_;
+  m_frameBase = baseId_;
+  m_frameActive = activeId_;
+  m_frameSection = sectionId_;
+  return true;
+}
+//-----------------------------------------------------------------------------
+void OskCompositor::GetSectionRect
+(
+  const OskImage & img_,
+  OskKeySectionId sectionId_,
+  int & x_,
+  int & y_,
+  int & width_,
+  int & height_
+)
+{
+  width_ = img_.GetWidth() / 3;
+  height_ = img_.GetHeight() / 3;
+  x_ = width_ * s_sectionOffset[ sectionId_ ].xoff;
+  y_ = height_ * s_sectionOffset[ sectionId_ ].yoff;
+}
+//-----------------------------------------------------------------------------
+void OskCompositor::Report(FILE * file_) const
+{
+  fprintf( file_,
+           "compositor: blits=%lu pixels=%lu bytes=%lu saved=%lu full=%lu "
+           "partial=%lu restores=%lu full-avg-us=%lu\n",
+           m_numBlits,
+           m_numPixels,
+           ( m_canvas != NULL )
+               ? m_numPixels * m_canvas->GetPixelFormat().GetBytesPerPixel()
+               : 0,
+           m_numPixelsSaved,
+           m_numFullRepaints,
+           m_numPartialRepaints,
+           m_numRestores,
+           ( m_numFullRepaints != 0 ) ? m_fullRepaintTime / m_numFullRepaints
+                                      : 0 );
+
+  if ( m_cache != NULL )
+  {
+    m_cache->Report( file_ );
+  }
+}
+//-----------------------------------------------------------------------------
+void OskCompositor::damage(int x_, int y_, int width_, int height_)
+{
+  // Drawn with no keyboard frame on screen, the next one is full anyway
+  if ( !m_frameValid || width_ <= 0 || height_ <= 0 )
+    return;
+
+  if ( m_damageWidth <= 0 || m_damageHeight <= 0 )
+  {
+    m_damageX = x_;
+    m_damageY = y_;
+    m_damageWidth = width_;
+    m_damageHeight = height_;
+    return;
+  }
+
+  const int right = ( x_ + width_ > m_damageX + m_damageWidth )
+                      ? x_ + width_ : m_damageX + m_damageWidth;
+  const int bottom = ( y_ + height_ > m_damageY + m_damageHeight )
+                       ? y_ + height_ : m_damageY + m_damageHeight;
+  if ( x_ < m_damageX )  m_damageX = x_;
+  if ( y_ < m_damageY )  m_damageY = y_;
+  m_damageWidth = right - m_damageX;
+  m_damageHeight = bottom - m_damageY;
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::repaintDamage
+(
+  const OskImage & base_,
+  const OskImage & active_,
+  int secX_,
+  int secY_,
+  int secWidth_,
+  int secHeight_
+)
+{
+  if ( m_damageWidth <= 0 || m_damageHeight <= 0 )
+    return true;
+
+  // The keyboard under the damage, then the highlighted cell over it
+  int x = m_damageX;
+  int y = m_damageY;
+  int width = m_damageWidth;
+  int height = m_damageHeight;
+  m_damageWidth = 0;
+  m_damageHeight = 0;
+
+  if ( !clipRect( x, y, width, height,
+                  m_frameX, m_frameY, base_.GetWidth(), base_.GetHeight() ) )
+    return true;
+
+  if ( !blit( x, y, &base_, x - m_frameX, y - m_frameY, width, height ) )
+    return false;
+
+  if ( !clipRect( x, y, width, height,
+                  m_frameX + secX_, m_frameY + secY_, secWidth_, secHeight_ ) )
+    return true;
+
+  return blit( x, y, &active_, x - m_frameX, y - m_frameY, width, height );
+}
+//-----------------------------------------------------------------------------
+bool OskCompositor::blit
+(
+  int destX_,
+  int destY_,
+  const OskImage * img_,
+  int sourX_,
+  int sourY_,
+  int width_,
+  int height_
+)
+{
+  if ( m_canvas == NULL || img_ == NULL )
+    return false;
+
+  m_numBlits++;
+  m_numPixels += (unsigned long)( width_ * height_ );
+
+  return m_canvas->DrawImage( destX_, destY_, *img_,
+                              sourX_, sourY_, width_, height_ );
 }
 
 
 //-----------------------------------------------------------------------------
 // Class: OskInput
 //-----------------------------------------------------------------------------
+bool OskInput::WaitForKeys(int timeout_)
+{
+  const int fd = GetFd();
+  if ( fd < 0 )
+    return true;
+
+  struct pollfd pfd;
+  pfd.fd = fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+
+  const int rt = poll( &pfd, 1, timeout_ );
+  if ( rt < 0 && errno != EINTR )
+  {
+    // Let ReadKeys() run into the same error and report it
+    DBG(( "OSK: Failed to poll the input, err=%d\n", errno ));
+    return true;
+  }
+
+  return ( rt > 0 );
+}
 
 
 //-----------------------------------------------------------------------------
 // Class: OskConsole
 //-----------------------------------------------------------------------------
+OskConsole::OskConsole()
+  : m_queueLen( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+bool OskConsole::SendKey(int key_)
+{
+  bool rt = true;
+  if ( m_queueLen + (int)sizeof( key_ ) > QueueSize )
+  {
+    rt = Flush();
+  }
+
+  OskMetrics::Count( OskMetrics::MET_KeysSent );
+
+  // A key is up to 4 bytes packed in an int, sent in memory order
+  const char * c = (const char *)&key_;
+  for ( int i = 0; i < (int)sizeof( key_ ); i++ )
+  {
+    if ( c[ i ] != 0 )
+    {
+      m_queue[ m_queueLen++ ] = c[ i ];
+    }
+  } // end for
+
+  return rt;
+}
+//-----------------------------------------------------------------------------
+bool OskConsole::Flush()
+{
+  if ( m_queueLen == 0 )
+    return true;
+
+  const bool rt = write( m_queue, m_queueLen );
+  m_queueLen = 0;
+  return rt;
+}
 
 
 //-----------------------------------------------------------------------------
 // Class: OskFactory
 //-----------------------------------------------------------------------------
+OskInput * OskFactory::CreateInput()
+{
+  OskInput * input = OskReplay::IsReplaying() ? OskReplay::CreateInput()
+                                              : createPlatformInput();
+
+  if ( input != NULL && OskReplay::IsRecording() )
+  {
+    input = OskReplay::CreateRecorder( input );
+  }
+
+  return input;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskCore::KeyRepeat
+//-----------------------------------------------------------------------------
+OskCore::KeyRepeat::KeyRepeat(OskCore & core_)
+  : OskTimer(),
+    m_core( core_ ),
+    m_button( 0 ),
+    m_key( 0 ),
+    m_mods( 0 ),
+    m_interval( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+void OskCore::KeyRepeat::Start
+(
+  unsigned long button_,
+  int key_,
+  unsigned int mods_
+)
+{
+  if ( m_core.c_settings.repeatDelay == 0 )
+    return;
+
+  m_button = button_;
+  m_key = key_;
+  m_mods = mods_;
+  m_interval = m_core.c_settings.repeatInterval;
+  m_core.m_timers.Schedule( *this, m_core.c_settings.repeatDelay );
+}
+//-----------------------------------------------------------------------------
+void OskCore::KeyRepeat::Stop()
+{
+  m_core.m_timers.Cancel( *this );
+}
+//-----------------------------------------------------------------------------
+void OskCore::KeyRepeat::OnTimer()
+{
+  // Released since the last read
+  if ( ( m_core.m_heldKeys & m_button ) == 0 )
+    return;
+
+  OskMetrics::Count( OskMetrics::MET_KeyRepeats );
+  (void)m_core.sendKey( m_key, m_mods );
+
+  m_core.m_timers.Schedule( *this, m_interval );
+
+  // Accelerates towards the fastest rate
+  m_interval = m_interval * m_core.c_settings.repeatPercent / 100;
+  if ( m_interval < m_core.c_settings.repeatFastest )
+  {
+    m_interval = m_core.c_settings.repeatFastest;
+  }
+}
 
 
 //-----------------------------------------------------------------------------
 // Class: OskCore
 //-----------------------------------------------------------------------------
-OskCore::OskCore(const OskFlags flags_, const int numVts_)
+OskCore::OskCore(const OskFlags flags_, const OskSettings & settings_)
   : c_flags( flags_ ),
-    c_numVts( numVts_ ),
+    c_settings( settings_ ),
+    c_numVts( settings_.numVts ),
     m_initialized( false ),
     m_canvas( NULL ),
     m_input( NULL ),
     m_console( NULL ),
+    m_inputStage( NULL ),
+    m_consoleStage( NULL ),
+    m_layout(),
+    m_imageCache(),
+    m_compositor(),
+    m_screenshot(),
+    m_stats(),
+    m_eventTime( 0 ),
+    m_drawTime( 0 ),
     m_currentState( &m_failedState ),
     m_keys( 0 ),
+    m_heldKeys( 0 ),
+    m_pressedKeys( 0 ),
+    m_keyRepeat( *this ),
+    m_analog(),
+    m_chords( *this ),
+    m_launcher( m_timers ),
+    m_lockedLayer( -1 ),
+    m_oneShotMods( 0 ),
+    m_lockedMods( 0 ),
+    m_modsChanged( false ),
     m_activeConsole( 0 ),
+    m_numConsoleUpdates( 0 ),
     // Internal states
     m_failedState( *this ),
     m_idleState( *this ),
-    m_activeEngState( *this ),
-    m_activeCapState( *this ),
-    m_activeNumState( *this ),
     m_mouseState( *this )
 {
+  for ( int layer = 0; layer < OskLayout::MaxLayers; layer++ )
+  {
+    m_activeStates[ layer ] = NULL;
+  }
+
+  m_analog.Configure( settings_.analogDeadzone,
+                      settings_.analogMargin,
+                      settings_.analogAngleMargin );
 }
 //-----------------------------------------------------------------------------
 OskCore::~OskCore()
 {
+  for ( int layer = 0; layer < OskLayout::MaxLayers; layer++ )
+  {
+    if ( m_activeStates[ layer ] != NULL )
+    {
+      delete m_activeStates[ layer ];
+      m_activeStates[ layer ] = NULL;
+    }
+  }
+
   for ( int id = OskImage::IMGID_First; id < OskImage::IMGID_Count; id++ )
   {
     if ( m_images[ id ] != NULL )
@@ -189,7 +1095,7 @@ bool OskCore::ParseFlags
 (
   const char * cmdline_,
   OskFlags & flags_,
-  int & numVts_
+  OskSettings & settings_
 )
 {
   if ( cmdline_ == NULL || strcmp( cmdline_, "--help" ) == 0 )
@@ -205,21 +1111,75 @@ bool OskCore::ParseFlags
 
   unsigned long flags = (unsigned long)FLAGS_USE_ANALOG;
   int numVts = DefaultNumVirtualTerminals;
+  OskImageCache::Mode cacheMode = OskImageCache::MODE_OFF;
+  unsigned long cacheLimit = DefaultImageCacheLimit;
+  int screenshotSlots = 0;
+  OskScreenshot::Encoder screenshotEncoder = OskScreenshot::ENC_Bmp;
 
   for ( const char * c = cmdline_; *c != 0; c++ )
   {
     if ( *c == '-' || *c == 's' )
     {
-      continue;
+      continue;
+    }
+    else if ( *c == 'd' )
+    {
+      flags &= ~(unsigned long)FLAGS_USE_ANALOG;
+      flags |= (unsigned long)FLAGS_USE_DPAD;
+    }
+    else if ( *c == 'D' )
+    {
+      flags |= ( (unsigned long)FLAGS_USE_DPAD | (unsigned long)FLAGS_USE_ANALOG );
+    }
+    else if ( *c == 'c' || *c == 'C' )
+    {
+      cacheMode = ( *c == 'c' ) ? OskImageCache::MODE_LAZY
+                                : OskImageCache::MODE_EAGER;
+
+      // Optional limit in KB
+      if ( '0' <= c[ 1 ] && c[ 1 ] <= '9' )
+      {
+        cacheLimit = 0;
+        while ( '0' <= c[ 1 ] && c[ 1 ] <= '9' )
+        {
+          c++;
+          cacheLimit = cacheLimit * 10 + (unsigned long)( *c - '0' );
+        }
+        cacheLimit *= 1024;
+      }
+    }
+    else if ( *c == 'a' )
+    {
+      screenshotSlots = 1;
+      if ( '1' <= c[ 1 ] && c[ 1 ] <= '0' + OskScreenshot::MaxSlots )
+      {
+        c++;
+        screenshotSlots = (int)( *c - '0' );
+      }
+    }
+    else if ( *c == 'e' )
+    {
+      if ( '0' <= c[ 1 ] && c[ 1 ] < '0' + OskScreenshot::ENC_Count )
+      {
+        c++;
+        screenshotEncoder = (OskScreenshot::Encoder)( *c - '0' );
+      }
+    }
+    else if ( *c == 'f' )
+    {
+      flags |= (unsigned long)FLAGS_PAGE_FLIP;
     }
-    else if ( *c == 'd' )
+    else if ( *c == 'o' )
     {
-      flags &= ~(unsigned long)FLAGS_USE_ANALOG;
-      flags |= (unsigned long)FLAGS_USE_DPAD;
+      flags |= (unsigned long)FLAGS_DITHER;
     }
-    else if ( *c == 'D' )
+    else if ( *c == 't' )
     {
-      flags |= ( (unsigned long)FLAGS_USE_DPAD | (unsigned long)FLAGS_USE_ANALOG );
+      flags |= (unsigned long)FLAGS_STATS;
+    }
+    else if ( *c == 'p' )
+    {
+      flags |= (unsigned long)FLAGS_PIPELINE;
     }
     else if ( *c == 'v' )
     {
@@ -232,7 +1192,37 @@ bool OskCore::ParseFlags
   }
 
   flags_ = (OskFlags)flags;
-  numVts_ = numVts;
+  settings_.numVts = numVts;
+  settings_.cacheMode = cacheMode;
+  settings_.cacheLimit = cacheLimit;
+  settings_.screenshotSlots = screenshotSlots;
+  settings_.screenshotEncoder = screenshotEncoder;
+
+  // OSK_REPEAT=<delay>,<interval>,<fastest>,<percent>, times in ms; any
+  // field left out keeps its default, and a delay of 0 turns repeat off
+  unsigned long repeat[ 4 ] = { DefaultRepeatDelay / 1000,
+                                DefaultRepeatInterval / 1000,
+                                DefaultRepeatFastest / 1000,
+                                (unsigned long)DefaultRepeatPercent };
+  readNumberList( getenv( c_repeatEnv ), repeat, 4 );
+
+  settings_.repeatDelay = repeat[ 0 ] * 1000;
+  settings_.repeatInterval = ( repeat[ 1 ] != 0 ) ? repeat[ 1 ] * 1000 : 1000;
+  settings_.repeatFastest = ( repeat[ 2 ] != 0 ) ? repeat[ 2 ] * 1000 : 1000;
+  settings_.repeatPercent = ( repeat[ 3 ] <= 100 ) ? (int)repeat[ 3 ] : 100;
+
+  // OSK_ANALOG=<deadzone>,<margin>,<angle margin>, the first two in % of
+  // full travel and the last in degrees
+  unsigned long analog[ 3 ] = { (unsigned long)DefaultAnalogDeadzone,
+                                (unsigned long)DefaultAnalogMargin,
+                                (unsigned long)DefaultAnalogAngleMargin };
+  readNumberList( getenv( c_analogEnv ), analog, 3 );
+
+  settings_.analogDeadzone = ( analog[ 0 ] <= 100 ) ? (int)analog[ 0 ] : 100;
+  settings_.analogMargin = ( analog[ 1 ] <= 100 ) ? (int)analog[ 1 ] : 100;
+  settings_.analogAngleMargin = ( analog[ 2 ] <= 45 ) ? (int)analog[ 2 ] : 45;
+
+  settings_.layoutFile = getenv( c_layoutEnv );
 
   return true;
 }
@@ -268,6 +1258,24 @@ bool OskCore::Initialize(void * param1_, void * param2_)
     return false;
   }
 
+  if ( ( c_flags & FLAGS_PAGE_FLIP ) && !m_canvas->EnablePageFlip( true ) )
+  {
+    DBG(( "OSK: Page flipping is not available, drawing in place\n" ));
+  }
+
+  // Bring the images to the framebuffer format once, so that every blit
+  // is a plain row copy
+  for ( int id = OskImage::IMGID_First; id < OskImage::IMGID_Count; id++ )
+  {
+    if ( !m_images[ id ]->Convert( m_canvas->GetPixelFormat(),
+                                   ( c_flags & FLAGS_DITHER ) != 0 ) )
+    {
+      DBG(( "OSK: Failed to convert image %d to %d bpp\n",
+            id, m_canvas->GetPixelFormat().GetBitsPerPixel() ));
+      return false;
+    }
+  }
+
   m_input = OskFactory::CreateInput();
   if ( m_input == NULL )
   {
@@ -275,6 +1283,19 @@ bool OskCore::Initialize(void * param1_, void * param2_)
     return false;
   }
 
+  // Joypad reads and console writes get a thread each; the state machine
+  // and the drawing stay on this one
+  if ( c_flags & FLAGS_PIPELINE )
+  {
+    m_inputStage = new OskInputStage( m_input );
+    if ( m_inputStage == NULL )
+    {
+      DBG(( "OSK: Failed to create agent: input stage\n" ));
+      return false;
+    }
+    m_input = m_inputStage;
+  }
+
   if ( !m_input->Initialize( param2_ ) )
   {
     DBG(( "OSK: Failed to initialize agent: input\n" ));
@@ -288,12 +1309,79 @@ bool OskCore::Initialize(void * param1_, void * param2_)
     return false;
   }
 
+  if ( c_flags & FLAGS_PIPELINE )
+  {
+    m_consoleStage = new OskConsoleStage( m_console, m_stats );
+    if ( m_consoleStage == NULL )
+    {
+      DBG(( "OSK: Failed to create agent: console stage\n" ));
+      return false;
+    }
+    m_console = m_consoleStage;
+  }
+
   if ( !m_console->Initialize( param1_ ) )
   {
     DBG(( "OSK: Failed to initialize agent: console\n" ));
     return false;
   }
 
+  // A broken layout file leaves the built-in layers, rather than no
+  // keyboard at all
+  if ( c_settings.layoutFile != NULL && !m_layout.Load( c_settings.layoutFile ) )
+  {
+    DBG(( "OSK: Using the built-in layout\n" ));
+  }
+
+  for ( int layer = 0; layer < m_layout.GetNumLayers(); layer++ )
+  {
+    m_activeStates[ layer ] = new ActiveState( *this, layer );
+    if ( m_activeStates[ layer ] == NULL )
+    {
+      DBG(( "OSK: Failed to create the state of layer %d\n", layer ));
+      return false;
+    }
+  }
+
+  m_chords.Compile( m_layout );
+
+  m_imageCache.Configure( c_settings.cacheMode, c_settings.cacheLimit );
+  m_imageCache.Attach( m_images );
+  if ( c_settings.cacheMode == OskImageCache::MODE_EAGER )
+  {
+    for ( int layer = 0; layer < m_layout.GetNumLayers(); layer++ )
+    {
+      (void)m_imageCache.Prepare( m_layout.GetImage( layer ),
+                                  m_layout.GetActiveImage( layer ) );
+    }
+  }
+
+  if ( !m_screenshot.Initialize( m_canvas->GetWidth(),
+                                 m_canvas->GetHeight(),
+                                 m_canvas->GetPixelFormat(),
+                                 c_settings.screenshotSlots,
+                                 c_settings.screenshotEncoder ) )
+  {
+    DBG(( "OSK: Failed to allocate the screenshot buffers\n" ));
+    return false;
+  }
+
+  if ( !OskMetrics::Enable() )
+  {
+    DBG(( "OSK: Failed to install the metrics snapshot handler\n" ));
+  }
+
+  if ( ( c_flags & FLAGS_STATS ) != 0 && !m_stats.Enable() )
+  {
+    DBG(( "OSK: Failed to enable the latency stats\n" ));
+    return false;
+  }
+
+  m_compositor.Attach( m_canvas,
+                       m_images,
+                       ( c_settings.cacheMode != OskImageCache::MODE_OFF )
+                           ? &m_imageCache : NULL );
+
   // Get the initial console index
   m_activeConsole = m_console->ChangeConsole( -1 );
 
@@ -309,21 +1397,150 @@ void OskCore::Main()
   // Starts from the Idle state
   changeState( &m_idleState );
 
-  while ( !m_currentState->IsTerminated() )
+  while ( !m_currentState->IsTerminated() && !m_input->IsEnd() )
   {
+    // A timer, or a signal
+    if ( !waitForInput() )
+      continue;
+
+    const unsigned long readTime = m_stats.Start();
     m_keys = m_input->ReadKeys();
+    if ( !m_input->IsEnd() )
+    {
+      OskClock::Step();
+    }
+    m_pressedKeys = m_keys & ~m_heldKeys;
+    m_heldKeys = m_keys;
+    if ( c_flags & FLAGS_USE_ANALOG )
+    {
+      (void)m_analog.Update( m_keys );
+    }
+    OskMetrics::Count( OskMetrics::MET_InputEvents );
+    m_eventTime = m_stats.Start();
+    m_stats.Add( OskStats::STAGE_Read, m_eventTime - readTime );
+
+    // Through the pipeline the word came off the joypad earlier, on the
+    // input thread, and the time it then spent queued counts as latency
+    if ( m_inputStage != NULL && m_eventTime != 0 )
+    {
+      m_eventTime = m_inputStage->GetReadTime();
+    }
+
     changeState( m_currentState->processKeys() );
+    (void)redrawModifiers();
+    (void)flushKeys();
+    m_stats.AddSince( OskStats::STAGE_Event, m_eventTime );
+  }
+
+}
+//-----------------------------------------------------------------------------
+bool OskCore::waitForInput()
+{
+  // Whatever happens until the next joypad word is not part of an event
+  m_eventTime = 0;
+
+  // Sleeps until the joypad or the next timer, so an idle keyboard costs
+  // nothing at all
+  const bool ready = m_input->WaitForKeys( m_timers.GetTimeout() );
+
+  OskMetrics::Count( OskMetrics::MET_Wakeups );
+
+  // Timers may type or draw, whatever woke us up
+  if ( m_timers.Expire() > 0 )
+  {
+    (void)flushKeys();
+  }
+
+  return ready;
+}
+//-----------------------------------------------------------------------------
+void OskCore::Report(FILE * file_)
+{
+  if ( !m_initialized )
+    return;
+
+  m_compositor.Report( file_ );
+  fprintf( file_,
+           "canvas: frames=%lu flushes=%lu last-frame-flushes=%lu "
+           "console-updates=%lu\n",
+           m_canvas->GetFrameCount(),
+           m_canvas->GetFlushCount(),
+           m_canvas->GetLastFrameFlushCount(),
+           m_numConsoleUpdates );
+  m_input->Report( file_ );
+  if ( m_consoleStage != NULL )
+  {
+    m_consoleStage->Report( file_ );
   }
+  m_stats.Report( file_ );
+  OskMetrics::Report( file_ );
 }
 //-----------------------------------------------------------------------------
 void OskCore::changeState(BaseState * newState_)
 {
-  while ( m_currentState != newState_ )
+  for ( int depth = 0; m_currentState != newState_; depth++ )
   {
+    // Two states keep handing over to each other, redrawing every time;
+    // stay in the last one and let the next input sort it out
+    if ( depth == TransitionLoopLimit )
+    {
+      OskMetrics::Count( OskMetrics::MET_TransitionLoops );
+      DBG(( "OSK: %d state changes on one input, see %s\n",
+            depth, OskTrace::TraceFileName ));
+      OskTrace::Write();
+      break;
+    }
+
+    // Whatever was repeating belonged to the old keyboard
+    m_keyRepeat.Stop();
+
+    const unsigned long start = OskClock::Now();
+    const unsigned long pixels = m_compositor.GetPixelCount();
+    const int from = m_currentState->GetTraceId();
+
     m_currentState->exitState();
     m_currentState = newState_;
+    OskMetrics::Count( OskMetrics::MET_StateChanges );
     newState_ = m_currentState->enterState();
+
+    OskTrace::Record( start, from, m_currentState->GetTraceId(), m_keys, depth,
+                      OskClock::Now() - start,
+                      m_compositor.GetPixelCount() - pixels );
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskCore::beginFrame()
+{
+  if ( m_canvas == NULL )
+    return false;
+
+  // Nested frames are timed as part of the outermost one
+  if ( !m_canvas->IsInFrame() )
+  {
+    m_drawTime = m_stats.Start();
+  }
+
+  return m_canvas->BeginFrame();
+}
+//-----------------------------------------------------------------------------
+bool OskCore::commitFrame()
+{
+  if ( m_canvas == NULL )
+    return false;
+
+  const bool rt = m_canvas->CommitFrame();
+  if ( !m_canvas->IsInFrame() )
+  {
+    m_stats.AddSince( OskStats::STAGE_Draw, m_drawTime );
+
+    // The first frame is drawn before there is any event
+    if ( m_eventTime != 0 )
+    {
+      m_stats.AddSince( OskStats::STAGE_ToDraw, m_eventTime );
+    }
   }
+
+  return rt;
 }
 //-----------------------------------------------------------------------------
 bool OskCore::clear(OskImage::ImageId imgId_)
@@ -338,12 +1555,33 @@ bool OskCore::clear(OskImage::ImageId imgId_)
   const int width = img->GetWidth();
   const int height = img->GetHeight();
 
-  if ( !m_canvas->Clear( x, y, width, height ) )
+  // Put back what was under the overlay if we still trust the snapshot
+  if ( m_canvas->IsUnderValid( x, y, width, height ) &&
+       OskClock::Now() - m_canvas->GetUnderTime() < OskCanvas::SnapshotMaxAge &&
+       m_compositor.RestoreUnder( x, y, width, height ) )
+  {
+    return true;
+  }
+
+  // Otherwise have the console repaint itself and take a fresh snapshot
+  if ( !m_compositor.Clear( x, y, width, height ) )
     return false;
 
+  // Whatever was typed goes in before the console repaints
+  (void)flushKeys();
   if ( !m_console->Update() )
     return false;
 
+  m_numConsoleUpdates++;
+
+  // Drawing in place, the console has just repainted what we draw into;
+  // only a back page needs the fresh snapshot put in
+  if ( m_canvas->SaveUnder( x, y, width, height ) &&
+       m_canvas->IsDrawingOffscreen() )
+  {
+    (void)m_compositor.RestoreUnder( x, y, width, height );
+  }
+
   return true;
 }
 //-----------------------------------------------------------------------------
@@ -364,30 +1602,25 @@ bool OskCore::drawImage(OskImage::ImageId imgId_)
   const int width = img->GetWidth();
   const int height = img->GetHeight();
 
-  return m_canvas->DrawImage( x, y, *img, 0, 0, width, height );
+  return m_compositor.DrawImage( x, y, imgId_, 0, 0, width, height );
 }
 //-----------------------------------------------------------------------------
-bool OskCore::drawImageSection
+bool OskCore::drawKeyboard
 (
-  OskImage::ImageId imgId_,
+  OskImage::ImageId baseId_,
+  OskImage::ImageId activeId_,
   OskKeySectionId sectionId_
 )
 {
-  const OskImage * const img = m_images[ imgId_ ];
+  const OskImage * const img = m_images[ baseId_ ];
 
   if ( m_canvas == NULL || img == NULL )
     return false;
 
   const int x = m_canvas->GetWidth() - img->GetWidth();
   const int y = 0;
-  const int sourWidth = img->GetWidth() / 3;
-  const int sourHeight = img->GetHeight() / 3;
-  const int sourX = sourWidth * s_sectionOffset[ sectionId_ ].xoff;
-  const int sourY = sourHeight * s_sectionOffset[ sectionId_ ].yoff;
 
-  return m_canvas->DrawImage( x + sourX, y + sourY,
-                              *img, 
-                              sourX, sourY, sourWidth, sourHeight );
+  return m_compositor.DrawKeyboard( x, y, baseId_, activeId_, sectionId_ );
 }
 //-----------------------------------------------------------------------------
 bool OskCore::drawImageSectionSingle
@@ -401,16 +1634,14 @@ bool OskCore::drawImageSectionSingle
   if ( m_canvas == NULL || img == NULL )
     return false;
 
-  const int sourWidth = img->GetWidth() / 3;
-  const int sourHeight = img->GetHeight() / 3;
-  const int sourX = sourWidth * s_sectionOffset[ sectionId_ ].xoff;
-  const int sourY = sourHeight * s_sectionOffset[ sectionId_ ].yoff;
+  int sourX, sourY, sourWidth, sourHeight;
+  OskCompositor::GetSectionRect( *img, sectionId_,
+                                 sourX, sourY, sourWidth, sourHeight );
   const int x = m_canvas->GetWidth() - sourWidth;
   const int y = 0;
 
-  return m_canvas->DrawImage( x, y,
-                              *img,
-                              sourX, sourY, sourWidth, sourHeight );
+  return m_compositor.DrawImage( x, y, imgId_,
+                                 sourX, sourY, sourWidth, sourHeight );
 }
 //-----------------------------------------------------------------------------
 bool OskCore::sendKey(int key_)
@@ -420,192 +1651,313 @@ bool OskCore::sendKey(int key_)
     return false;
   }
 
+  // The console may draw under the overlay
+  if ( m_canvas != NULL )
+  {
+    m_canvas->InvalidateUnder();
+  }
+
   return m_console->SendKey( key_ );
 }
 //-----------------------------------------------------------------------------
-bool OskCore::changeConsole(int gain_)
+bool OskCore::sendKey(int key_, unsigned int mods_)
 {
-  if ( m_console == NULL )
+  if ( mods_ == 0 || key_ == 0 )
   {
-    return false;
+    return sendKey( key_ );
   }
 
-  m_activeConsole += gain_;
-  if ( m_activeConsole < 0 )
+  OskMetrics::Count( OskMetrics::MET_KeysModified );
+
+  // Alt on a 4-byte key does not fit in one int; the ESC goes in first,
+  // into the same batch
+  if ( ( mods_ & MOD_Alt ) != 0 && ( key_ & 0xff000000 ) != 0 )
   {
-    m_activeConsole = c_numVts - 1;
+    return sendKey( KEY_ESCAPE ) &&
+           sendKey( ApplyModifiers( key_, mods_ & ~MOD_Alt ) );
   }
-  else if ( m_activeConsole >= c_numVts )
+
+  return sendKey( ApplyModifiers( key_, mods_ ) );
+}
+//-----------------------------------------------------------------------------
+int OskCore::ApplyModifiers(int key_, unsigned int mods_)
+{
+  // Only a single byte has a control or meta form; escape sequences and
+  // the like go as they are
+  if ( ( key_ & ~0xff ) == 0 )
   {
-    m_activeConsole = 0;
+    if ( mods_ & MOD_Ctrl )
+    {
+      // ^@ would be NUL, which the console drops, so '@' stays as it is
+      if ( ( 'a' <= key_ && key_ <= 'z' ) || ( 'A' <= key_ && key_ <= '_' ) )
+      {
+        key_ &= 0x1f;
+      }
+      else if ( key_ == '?' || key_ == '8' )
+      {
+        key_ = KEY_BACKSPACE;
+      }
+      else if ( '3' <= key_ && key_ <= '7' )
+      {
+        // As xterm does, ^3 is ESC and so on up to ^7 for ^_
+        key_ = key_ - '3' + KEY_ESCAPE;
+      }
+    }
+
+    if ( mods_ & MOD_Meta )
+    {
+      key_ |= 0x80;
+    }
   }
 
-  m_activeConsole = m_console->ChangeConsole( m_activeConsole );
-  return ( m_activeConsole >= 0 );
+  // Sent low byte first, so the ESC goes in the low byte
+  if ( ( mods_ & MOD_Alt ) != 0 && ( key_ & 0xff000000 ) == 0 )
+  {
+    key_ = ( key_ << 8 ) | KEY_ESCAPE;
+  }
+
+  return key_;
 }
 //-----------------------------------------------------------------------------
-int OskCore::normalizePos(unsigned long p_)
+bool OskCore::typeKey(unsigned long button_, int key_)
 {
-  if ( p_ < AnalogPosLowerThreshold )
+  // Held from an earlier read, the repeat timer takes care of it
+  if ( ( m_pressedKeys & button_ ) == 0 )
   {
-    return -1;
+    return true;
   }
-  else if ( AnalogPosLowerThreshold <= p_ && p_ <= AnalogPosUpperThreshold )
+
+  m_pressedKeys &= ~button_;
+
+  if ( key_ == KEY_MOD_CTRL || key_ == KEY_MOD_ALT || key_ == KEY_MOD_META )
   {
-    return 0;
+    toggleModifier( (unsigned int)key_ >> 8 );
+    return true;
   }
-  else
+
+  // A one-shot modifier is used up by the first key after it, and the
+  // key keeps it while repeating
+  const unsigned int mods = m_oneShotMods | m_lockedMods;
+  if ( m_oneShotMods != 0 )
   {
-    return 1;
+    m_oneShotMods = 0;
+    m_modsChanged = true;
   }
+
+  m_keyRepeat.Start( button_, key_, mods );
+  return sendKey( key_, mods );
 }
 //-----------------------------------------------------------------------------
-OskCore::OskAnalogPos OskCore::getAnalogPos()
+void OskCore::toggleModifier(unsigned int mod_)
 {
-  int x = normalizePos( ( m_keys >> 24 ) & 0xf );
-  int y = normalizePos( ( m_keys >> 28 ) & 0xf );
+  // A key still repeating would go on with the old modifiers
+  m_keyRepeat.Stop();
 
-  if ( x < 0 && y == 0 )
+  // Off, then for the next key, then locked, then off again
+  if ( m_lockedMods & mod_ )
   {
-    return ANALOG_POS_LEFT;
+    m_lockedMods &= ~mod_;
   }
-
-  if ( x < 0 && y < 0 )
+  else if ( m_oneShotMods & mod_ )
   {
-    return ANALOG_POS_UPLEFT;
+    m_oneShotMods &= ~mod_;
+    m_lockedMods |= mod_;
   }
-
-  if ( x == 0 && y < 0 )
+  else
   {
-    return ANALOG_POS_UP;
+    m_oneShotMods |= mod_;
   }
 
-  if ( x > 0 && y < 0 )
-  {
-    return ANALOG_POS_UPRIGHT;
-  }
+  m_modsChanged = true;
+}
+//-----------------------------------------------------------------------------
+bool OskCore::drawModifiers()
+{
+  const unsigned int mods = m_oneShotMods | m_lockedMods;
+  const OskImage * const img = m_images[ m_layout.GetImage( 0 ) ];
+
+  if ( mods == 0 )
+    return true;
 
-  if ( x > 0 && y == 0 )
+  if ( m_canvas == NULL || img == NULL )
+    return false;
+
+  // Along the top of the top right section, which every keyboard overlay
+  // covers, the idle one included
+  int sourX, sourY, sourWidth, sourHeight;
+  OskCompositor::GetSectionRect( *img, KSID_TopRight,
+                                 sourX, sourY, sourWidth, sourHeight );
+  const int width = sourWidth / 3;
+  int x = m_canvas->GetWidth() - 3 * width;
+  bool rt = true;
+  for ( int i = 0; i < 3; i++, x += width )
   {
-    return ANALOG_POS_RIGHT;
+    const unsigned int mod = 1U << i;
+    if ( ( mods & mod ) != 0 )
+    {
+      const int locked = ( m_lockedMods & mod ) ? 1 : 0;
+      rt = m_compositor.Fill( x, 0, width, ModifierBarHeight,
+                              c_modifierColors[ i ][ locked ] ) && rt;
+    }
   }
 
-  if ( x > 0 && y > 0 )
+  return rt;
+}
+//-----------------------------------------------------------------------------
+bool OskCore::redrawModifiers()
+{
+  if ( !m_modsChanged )
+    return true;
+
+  m_modsChanged = false;
+
+  // The compositor repaints the old bars from the keyboard, so the ones of
+  // the modifiers now off go
+  return m_currentState->Redraw();
+}
+//-----------------------------------------------------------------------------
+bool OskCore::flushKeys()
+{
+  if ( m_console == NULL || !m_console->IsQueued() )
   {
-    return ANALOG_POS_DOWNRIGHT;
+    return true;
   }
 
-  if ( x == 0 && y > 0 )
+  // The console stage times the delivery itself, on its own thread
+  if ( m_consoleStage != NULL )
   {
-    return ANALOG_POS_DOWN;
+    m_consoleStage->SetEventTime( m_eventTime );
+    return m_console->Flush();
   }
 
-  if ( x < 0 && y > 0 )
+  const unsigned long sendTime = m_stats.Start();
+  const bool rt = m_console->Flush();
+  m_stats.AddSince( OskStats::STAGE_Send, sendTime );
+  if ( m_eventTime != 0 )
   {
-    return ANALOG_POS_DOWNLEFT;
+    m_stats.AddSince( OskStats::STAGE_ToSend, m_eventTime );
   }
 
-  return ANALOG_POS_CENTER;
+  return rt;
 }
 //-----------------------------------------------------------------------------
-bool OskCore::takeScreenshot()
+bool OskCore::changeConsole(int gain_)
 {
-  if ( m_canvas == NULL )
+  if ( m_console == NULL )
   {
     return false;
   }
 
-  const int screenSize = m_canvas->GetWidth() * m_canvas->GetHeight();
-  unsigned long * buf = new unsigned long[ screenSize ];
-  if ( buf == NULL )
+  m_activeConsole += gain_;
+  if ( m_activeConsole < 0 )
   {
-    return false;
+    m_activeConsole = c_numVts - 1;
+  }
+  else if ( m_activeConsole >= c_numVts )
+  {
+    m_activeConsole = 0;
   }
 
-  int bufSize = screenSize * sizeof( unsigned long );
-  if ( !m_canvas->GetBits( buf, bufSize ) )
+  if ( m_canvas != NULL )
   {
-    delete[] buf;
-    return false;
+    m_canvas->InvalidateConsole();
   }
 
-  FILE * newFile = createNewFile();
-  if ( newFile == NULL )
+  // Keys typed so far belong to the old console
+  (void)flushKeys();
+  m_activeConsole = m_console->ChangeConsole( m_activeConsole );
+  return ( m_activeConsole >= 0 );
+}
+//-----------------------------------------------------------------------------
+OskCore::OskAnalogPos OskCore::getAnalogPos()
+{
+  return m_analog.GetPos();
+}
+//-----------------------------------------------------------------------------
+bool OskCore::takeScreenshot()
+{
+  if ( m_canvas == NULL )
   {
-    delete[] buf;
     return false;
   }
 
-  bool rt;
-  do {
-    // Write the header first
-    if ( sizeof( s_screenshotHeader ) !=
-         fwrite( s_screenshotHeader, 1, sizeof( s_screenshotHeader ), newFile ) )
-    {
-      rt = false;
-      break;
-    }
-
-    // Write the buffer
-    if ( bufSize != fwrite( buf, 1, bufSize, newFile ) )
-    {
-      rt = false;
-      break;
-    }
-
-    // Write the ending
-    unsigned short ending = 0;
-    if ( sizeof( ending ) != fwrite( &ending, 1, sizeof( ending ), newFile ) )
-    {
-      rt = false;
-      break;
-    }
-
-    // Succeed if it gets here
-    rt = true;
-  } while ( false );
+  OskMetrics::Count( OskMetrics::MET_Screenshots );
+  const bool rt = m_screenshot.Capture( *m_canvas );
 
-  delete[] buf;
-  (void)fclose( newFile );
+#ifdef DEBUG
+  m_screenshot.Report( stdout );
+#endif
 
   return rt;
 }
 //-----------------------------------------------------------------------------
-FILE * OskCore::createNewFile()
+bool OskCore::runChord(const OskLayout::Chord & chord_)
 {
-  for ( int i = 1; i < 10000; i++ )
+  switch ( chord_.action )
   {
-    const size_t fileNameLen = 80;
-    char fileName[ fileNameLen + 1 ];
+  case OskLayout::ACT_ConsoleNext:
+    return changeConsole( 1 );
 
-    (void)snprintf( fileName, fileNameLen, s_screenshotFileName, i );
-    fileName[ fileNameLen ] = 0;
+  case OskLayout::ACT_ConsolePrev:
+    return changeConsole( -1 );
 
-    // See if the file already exists
-    FILE * newFile = fopen( fileName, "rb" );
-    if ( newFile != NULL )
+  case OskLayout::ACT_Console:
+    return ( chord_.arg < c_numVts ) &&
+           changeConsole( chord_.arg - m_activeConsole );
+
+  case OskLayout::ACT_Screenshot:
+    if ( !takeScreenshot() )
     {
-      (void)fclose( newFile );
-      continue;
+      DBG(( "OSK: Failed to take screenshot\n" ));
+      return false;
     }
+    return true;
 
-    // The file does not exist
-    newFile = fopen( fileName, "wb" );
-    if ( newFile != NULL )
+  case OskLayout::ACT_PowerOff:
     {
-      return newFile;
+      const char * const argv[] = { PowerOffCommand, NULL };
+      return ( m_launcher.Run( argv ) > 0 );
     }
-  }
 
-  return NULL;
-}
-//-----------------------------------------------------------------------------
-void OskCore::shutdown()
-{
-  if ( fork() == 0 )
-  {
-    // In the child process
-    _exit( execl( PowerOffCommand, PowerOffCommand, NULL ) );
+  case OskLayout::ACT_Type:
+    {
+      bool rt = true;
+      for ( const char * c = chord_.text; *c != 0; c++ )
+      {
+        rt = sendKey( (unsigned char)*c ) && rt;
+      }
+      return rt;
+    }
+
+  case OskLayout::ACT_LockLayer:
+    // The same chord again unlocks it; the keyboard follows on the next
+    // pass through KbdState::processKeys()
+    m_lockedLayer = ( m_lockedLayer == chord_.arg ) ? -1 : chord_.arg;
+    return true;
+
+  case OskLayout::ACT_Modifier:
+    toggleModifier( (unsigned int)chord_.arg >> 8 );
+    return true;
+
+  case OskLayout::ACT_Trace:
+    OskTrace::Write();
+    return true;
+
+  case OskLayout::ACT_Run:
+    {
+      const char * argv[ OskLayout::MaxCommandArgs + 1 ];
+      const char * arg = chord_.text;
+      for ( int i = 0; i < chord_.arg; i++ )
+      {
+        argv[ i ] = arg;
+        arg += strlen( arg ) + 1;
+      }
+      argv[ chord_.arg ] = NULL;
+      return ( m_launcher.Run( argv ) > 0 );
+    }
+
+  default:
+    return false;
   }
 }
 //-----------------------------------------------------------------------------
@@ -617,13 +1969,30 @@ void OskCore::showVersion()
 void OskCore::showHelp()
 {
   showVersion();
-  printf( "Usage: psposk2 [--help|--version|-dDv<num>s]\n"
+  printf( "Usage: psposk2 [--help|--version|-dDfotpv<num>c<kb>C<kb>a<num>e<num>s]\n"
           "  --help     Print this help\n"
           "  --version  Print version info\n"
           "  -d         Use only dpad in keyboard mode\n"
           "  -D         Use both dpad and analog in keyboard mode\n"
+          "  -f         Compose in the back page and flip (needs 2 pages of VRAM)\n"
+          "  -o         Ordered dithering when the framebuffer has under 8 bits per colour\n"
+          "  -t         Time every event, SIGUSR1 writes the histograms to /tmp/psposk2.stats\n"
+          "  -p         Read the joypad and write the console on threads of their own\n"
           "  -v<num>    Specify the number (1-6) of virtual terminals you want to have\n"
-          "  -s         Silent mode\n" );
+          "  -c<kb>     Cache composed keyboards on first use, LRU within <kb> KB\n"
+          "  -C<kb>     Compose keyboards at startup until <kb> KB are used\n"
+          "  -a<num>    Write screenshots in the background, <num> (1-4) frames queued\n"
+          "  -e<num>    Screenshot format: 0 BMP, 1 RLE8 BMP, 2 PNG, 3 QOI\n"
+          "  -s         Silent mode\n"
+          "Hold-to-repeat is set by OSK_REPEAT=<delay>,<interval>,<fastest>,<percent>,\n"
+          "  in ms, default 400,80,30,90; a delay of 0 turns it off\n"
+          "The stick is set by OSK_ANALOG=<deadzone>,<margin>,<angle margin>,\n"
+          "  in %% of full travel and degrees, default 62,12,8\n"
+          "OSK_LAYOUT=<file> loads the keyboard layers, see psposk2.layout\n"
+          "SELECT and START are sticky Ctrl and Alt: once for the next key, twice\n"
+          "  to lock, a third time to release\n"
+          "SIGUSR2 writes the counters to /tmp/psposk2.metrics and the last state\n"
+          "  changes to /tmp/psposk2.trace\n" );
 }
 
 
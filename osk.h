@@ -6,6 +6,8 @@
 #define OSK_H
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <pthread.h>
+#include <sys/types.h>
 
 
 //-----------------------------------------------------------------------------
@@ -64,6 +66,9 @@ typedef enum
   KBID_Count  
 } OskKeyboardId;
 
+// One 32-bit pixel, whatever the width of long is on the host
+typedef unsigned int OskPixel32;
+
 typedef struct
 {
   int keys[ KDID_Count ];
@@ -85,7 +90,13 @@ typedef enum
   KEY_UP        = 0x415b1b,
   KEY_DOWN      = 0x425b1b,
   KEY_RIGHT     = 0x435b1b,
-  KEY_LEFT      = 0x445b1b
+  KEY_LEFT      = 0x445b1b,
+
+  // Sticky modifiers, never sent themselves; the low byte stays zero so
+  // that no console byte can be mistaken for one
+  KEY_MOD_CTRL  = 0x100,
+  KEY_MOD_ALT   = 0x200,
+  KEY_MOD_META  = 0x400
 } OskSepcialKey;
 
 
@@ -98,14 +109,102 @@ extern OskKeyboard s_OskKeyboards[ KBID_Count ];
 //-----------------------------------------------------------------------------
 // Classes
 //-----------------------------------------------------------------------------
+class OskPixelFormat;
 class OskImage;
 class OskCanvas;
 class OskInput;
 class OskConsole;
 class OskFactory;
+class OskReplay;
+class OskClock;
+class OskTimer;
+class OskTimerWheel;
+class OskLauncher;
+class OskImageCache;
+class OskLayout;
+class OskCompositor;
+class OskScreenshot;
+class OskStats;
+class OskMetrics;
+class OskTrace;
+class OskQueue;
+class OskInputStage;
+class OskConsoleStage;
 class OskCore;
 
 
+//-----------------------------------------------------------------------------
+// Class: OskPixelFormat
+//
+// Layout of one framebuffer pixel. Colours come in the layout of the
+// built-in images, 0x00BBGGRR, which is also the native 32-bit layout.
+//-----------------------------------------------------------------------------
+class OskPixelFormat
+{
+public:
+  OskPixelFormat();
+
+  bool Set
+  (
+    int bitsPerPixel_,
+    int redOffset_,
+    int redLength_,
+    int greenOffset_,
+    int greenLength_,
+    int blueOffset_,
+    int blueLength_
+  );
+  bool SetDefault(int bitsPerPixel_);
+
+  // Converts one 0x00BBGGRR colour, optionally with 4x4 ordered dithering
+  // keyed on the pixel position
+  unsigned long Pack(unsigned long color_, int x_, int y_, bool dither_) const;
+
+  // Back to 0x00RRGGBB, the order of a 32-bit BMP
+  unsigned long Unpack(unsigned long pixel_) const;
+
+  void UnpackRow
+  (
+    OskPixel32 * dest_,
+    const void * sour_,
+    int count_
+  ) const;
+
+  void PackRow
+  (
+    void * dest_,
+    const OskPixel32 * sour_,
+    int count_,
+    int y_,
+    bool dither_
+  ) const;
+
+  bool IsImageNative() const;
+
+  int GetBitsPerPixel() const
+  {
+    return m_bitsPerPixel;
+  }
+
+  int GetBytesPerPixel() const
+  {
+    return m_bitsPerPixel >> 3;
+  }
+
+protected:
+  static unsigned long packChannel(unsigned long value_, int length_, int bias_);
+  static unsigned long unpackChannel(unsigned long pixel_, int offset_, int length_);
+
+  int m_bitsPerPixel;
+  int m_redOffset;
+  int m_redLength;
+  int m_greenOffset;
+  int m_greenLength;
+  int m_blueOffset;
+  int m_blueLength;
+};
+
+
 //-----------------------------------------------------------------------------
 // Class: OskImage
 //-----------------------------------------------------------------------------
@@ -132,11 +231,22 @@ public:
 
   virtual const void * GetData() const = 0;
 
+  // Converts the image to the framebuffer's pixel format, once, at load
+  virtual bool Convert(const OskPixelFormat & format_, bool dither_)
+  {
+    return format_.IsImageNative();
+  }
+
   int GetId() const
   {
     return m_imgId;
   }
 
+  int GetBytesPerPixel() const
+  {
+    return m_bytesPerPixel;
+  }
+
   int GetWidth() const
   {
     return m_width;
@@ -151,6 +261,7 @@ protected:
   const ImageId m_imgId;
   int m_width;
   int m_height;
+  int m_bytesPerPixel;
 
 private:
   // Not implemented
@@ -179,6 +290,19 @@ public:
     int height_
   ) = 0;
 
+  // Solid 0x00BBGGRR colour; false if the canvas can not do it
+  virtual bool Fill
+  (
+    int x_,
+    int y_,
+    int width_,
+    int height_,
+    unsigned long color_
+  )
+  {
+    return false;
+  }
+
   virtual bool DrawImage
   (
     int destX_,
@@ -192,6 +316,72 @@ public:
 
   virtual bool GetBits(void * buf_, int & size_) = 0;
 
+  // One visible row as 0x00RRGGBB pixels, for streaming screenshots
+  virtual bool GetRow(int y_, OskPixel32 * buf_) = 0;
+
+  // Raw copy of the visible page in the native pixel format, packed rows
+  virtual bool CopyVisible(void * buf_, int size_) = 0;
+
+  // Everything drawn between BeginFrame() and the matching CommitFrame()
+  // is flushed to the display once, at commit time. Frames may nest; only
+  // the outermost commit flushes. Drawing outside a frame flushes at once.
+  virtual bool BeginFrame();
+  virtual bool CommitFrame();
+
+  // Compose frames off-screen and present them with a page flip. Returns
+  // false if the canvas can not do it, in which case drawing stays in the
+  // visible page.
+  virtual bool EnablePageFlip(bool enable_)
+  {
+    return !enable_;
+  }
+
+  // True while drawing goes to a page that is not the console's
+  virtual bool IsDrawingOffscreen() const
+  {
+    return false;
+  }
+
+  // Save-under: SaveUnder() snapshots what is on screen in a rectangle
+  // before the overlay covers it, RestoreUnder() puts it back. Restoring
+  // fails unless the same rectangle was saved and has not been invalidated.
+  virtual bool SaveUnder(int x_, int y_, int width_, int height_)
+  {
+    return false;
+  }
+
+  virtual bool RestoreUnder(int x_, int y_, int width_, int height_)
+  {
+    return false;
+  }
+
+  // The console may have drawn under the overlay, as it does when a key
+  // is typed into it
+  void InvalidateUnder()
+  {
+    m_underValid = false;
+    m_underStale = true;
+  }
+
+  // The console may have drawn anywhere in its page, as when it switches
+  void InvalidateConsole()
+  {
+    m_underValid = false;
+    m_consoleDrawn = true;
+  }
+
+  bool IsUnderValid(int x_, int y_, int width_, int height_) const
+  {
+    return ( m_underValid &&
+             m_underX == x_ && m_underY == y_ &&
+             m_underWidth == width_ && m_underHeight == height_ );
+  }
+
+  unsigned long GetUnderTime() const
+  {
+    return m_underTime;
+  }
+
   int GetWidth() const
   {
     return m_width;
@@ -202,9 +392,64 @@ public:
     return m_height;
   }
 
+  const OskPixelFormat & GetPixelFormat() const
+  {
+    return m_format;
+  }
+
+  unsigned long GetFlushCount() const
+  {
+    return m_numFlushes;
+  }
+
+  unsigned long GetFrameCount() const
+  {
+    return m_numFrames;
+  }
+
+  unsigned long GetLastFrameFlushCount() const
+  {
+    return m_lastFrameFlushes;
+  }
+
+  bool IsInFrame() const
+  {
+    return ( m_frameDepth > 0 );
+  }
+
+  // Longest a copy of the console's pixels is trusted, since other
+  // programs may draw into it without us knowing
+  static const unsigned long SnapshotMaxAge = 2000000;   // in us
+
 protected:
+  virtual bool flush() = 0;
+
+  // Puts a finished frame on the display, with exactly one flush
+  virtual bool present()
+  {
+    return doFlush();
+  }
+
+  bool damage();
+  bool doFlush();
+
   int m_width;
   int m_height;
+  OskPixelFormat m_format;
+  int m_frameDepth;
+  bool m_frameDirty;
+  unsigned long m_numFlushes;
+  unsigned long m_numFrames;
+  unsigned long m_frameFlushes;
+  unsigned long m_lastFrameFlushes;
+  bool m_underValid;
+  int m_underX;
+  int m_underY;
+  int m_underWidth;
+  int m_underHeight;
+  unsigned long m_underTime;
+  bool m_underStale;        // The console drew under the overlay
+  bool m_consoleDrawn;      // The console drew anywhere
 
 private:
   // Not implemented
@@ -252,6 +497,26 @@ public:
   virtual bool Initialize(void * param_) = 0;
   virtual unsigned long ReadKeys() = 0;
 
+  // True once a finite source, such as a recorded file, has run out
+  virtual bool IsEnd()
+  {
+    return false;
+  }
+
+  // A descriptor that polls readable when ReadKeys() would not block, or
+  // -1 if ReadKeys() does its own waiting
+  virtual int GetFd()
+  {
+    return -1;
+  }
+
+  // Waits until ReadKeys() has a word, for at most timeout_ ms unless it
+  // is -1; false if the time ran out first. Polls GetFd(), and an input
+  // without one is always ready.
+  virtual bool WaitForKeys(int timeout_);
+
+  virtual void Report(FILE * file_) { }
+
 protected:
 
 private:
@@ -267,20 +532,38 @@ private:
 class OskConsole
 {
 public:
-  OskConsole() { }
+  OskConsole();
   virtual ~OskConsole() { }
 
   virtual bool Initialize(void * param_) = 0;
-  virtual bool SendKey(int key_) = 0;
   virtual int ChangeConsole(int con_) = 0;
   virtual bool Update() = 0;
 
+  // Keys are queued as the bytes the console receives, and only handed
+  // over on Flush(), so a whole pass of the state machine costs one batch
+  bool SendKey(int key_);
+  bool Flush();
+
+  bool IsQueued() const
+  {
+    return ( m_queueLen != 0 );
+  }
+
+  static const int QueueSize = 64;
+
 protected:
+  // Delivers queued bytes in order, in as few calls as the device allows
+  virtual bool write(const char * bytes_, int count_) = 0;
+
+  char m_queue[ QueueSize ];
+  int m_queueLen;
 
 private:
   // Not implemented
   OskConsole(const OskConsole &);
   OskConsole & operator = (const OskConsole &);
+
+  friend class OskConsoleStage;
 };
 
 
@@ -296,6 +579,10 @@ public:
   static OskConsole * CreateConsole();
 
 protected:
+  // The joypad of whichever of osk_pspio.o and osk_sim.o is linked in,
+  // which also brings its CreateConsole()
+  static OskInput * createPlatformInput();
+
 private:
   OskFactory();
   OskFactory(const OskFactory &);
@@ -304,80 +591,1426 @@ private:
 
 
 //-----------------------------------------------------------------------------
-// Class: OskCore
+// Class: OskReplay
+//
+// Recording and replaying of joypad streams, for repeatable sessions.
+//
+//   OSK_RECORD        File every joypad word is written to, with the time
+//                     since the previous one
+//   OSK_REPLAY        Recorded file to read the joypad from instead
+//   OSK_REPLAY_SPEED  "real" (default) keeps the recorded timing, "max"
+//                     feeds the words as fast as they are taken
 //-----------------------------------------------------------------------------
-class OskCore
+class OskReplay
 {
 public:
-  typedef enum
+  static bool IsRecording();
+  static bool IsReplaying();
+  static OskInput * CreateRecorder(OskInput * input_);
+  static OskInput * CreateInput();
+
+  static const unsigned int FileMagic = 0x524b534f;   // "OSKR"
+  static const unsigned int FileVersion = 1;
+
+private:
+  // Not implemented
+  OskReplay();
+  OskReplay(const OskReplay &);
+  OskReplay & operator = (const OskReplay &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskClock
+//-----------------------------------------------------------------------------
+class OskClock
+{
+public:
+  // Microseconds from an arbitrary origin; wraps around, so only the
+  // difference of two readings is meaningful
+  static unsigned long Now();
+
+  // A manual clock starts from 0 and moves step_ for every joypad word
+  // OskCore takes, on its own thread even when another one reads them
+  static void SetManual(bool manual_, unsigned long step_);
+  static void Step();
+
+  // Moves the clock ahead as if us_ had passed, for a replay that does
+  // not wait out the recorded gaps; OskCore's thread only
+  static void Skip(unsigned long us_);
+
+private:
+  // Not implemented
+  OskClock();
+  OskClock(const OskClock &);
+  OskClock & operator = (const OskClock &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskTimer
+//
+// Something to run later from the main loop, armed through OskTimerWheel.
+//-----------------------------------------------------------------------------
+class OskTimer
+{
+public:
+  OskTimer();
+  virtual ~OskTimer() { }
+
+  virtual void OnTimer() = 0;
+
+  bool IsArmed() const
   {
-    FLAGS_USE_DPAD    = 0x00000001,
-    FLAGS_USE_ANALOG  = 0x00000002,
-    FLAGS_EXIT        = 0xffffffff,
-  } OskFlags;
+    return m_armed;
+  }
 
-  typedef enum
+protected:
+  friend class OskTimerWheel;
+
+  OskTimer *      m_next;
+  unsigned long   m_due;
+  bool            m_armed;
+
+private:
+  // Not implemented
+  OskTimer(const OskTimer &);
+  OskTimer & operator = (const OskTimer &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskTimerWheel
+//
+// Pending timers hashed by due tick into a ring of slots, so expiring only
+// looks at the slots the clock has passed since the last time. A timer
+// further out than the ring stays in its slot until its round comes.
+//-----------------------------------------------------------------------------
+class OskTimerWheel
+{
+public:
+  OskTimerWheel();
+
+  void Schedule(OskTimer & timer_, unsigned long delay_);   // in us
+  void Cancel(OskTimer & timer_);
+
+  // ms until the earliest timer is due, 0 if one already is, -1 if none
+  int GetTimeout() const;
+
+  // Runs every timer that is due, returns how many ran
+  int Expire();
+
+  static const int NumSlots = 64;
+  static const unsigned long TickUs = 10000;
+
+protected:
+  static int slotOf(unsigned long due_)
   {
-    ANALOG_POS_CENTER,
-    ANALOG_POS_LEFT,
-    ANALOG_POS_UPLEFT,
-    ANALOG_POS_UP,
-    ANALOG_POS_UPRIGHT,
-    ANALOG_POS_RIGHT,
-    ANALOG_POS_DOWNRIGHT,
-    ANALOG_POS_DOWN,
-    ANALOG_POS_DOWNLEFT,
-  } OskAnalogPos;
+    return (int)( ( due_ / TickUs ) % NumSlots );
+  }
 
-  OskCore(const OskFlags flags_, const int numVts_);
-  virtual ~OskCore();
+  OskTimer *      m_slots[ NumSlots ];
+  unsigned long   m_cursor;     // Tick of the last Expire()
+  int             m_numArmed;
+
+private:
+  // Not implemented
+  OskTimerWheel(const OskTimerWheel &);
+  OskTimerWheel & operator = (const OskTimerWheel &);
+};
 
-  static bool ParseFlags(const char * cmdline_, OskFlags & flags_, int & numVts_);
 
-  bool Initialize(void * param1_, void * param2_);
-  void Main();
+//-----------------------------------------------------------------------------
+// Class: OskLauncher
+//
+// Starts commands with vfork() and execv(), which works without an MMU,
+// up to MaxChildren at a time. While any is running a timer reaps the
+// ones that exited, so the input loop never waits on a child.
+//-----------------------------------------------------------------------------
+class OskLauncher : public OskTimer
+{
+public:
+  OskLauncher(OskTimerWheel & timers_);
+
+  // The child's pid, or -1 if it was refused. A command that can not be
+  // executed still starts, and exits with ExecFailedStatus
+  pid_t Run(const char * const * argv_);
+  virtual void OnTimer();
+
+  int GetNumChildren() const
+  {
+    return m_numChildren;
+  }
+
+  static const int MaxChildren = 4;
+  static const int ExecFailedStatus = 127;
 
 protected:
-  // Internal states
-  class BaseState;
-    class FailedState;
-    class KbdState;
-      class IdleState;
-      class ActiveState;
-        class ActiveEngState;
-        class ActiveCapState;
-        class ActiveNumState;
-    class MouseState;
-  
-  #define OSK_STATES_H
-  #include "oskstates.h"
-  #undef  OSK_STATES_H
+  void reap();
 
-  void changeState(BaseState * newState_);
-  bool clear(OskImage::ImageId imgId_);
-  bool clear();
-  bool drawImage(OskImage::ImageId imgId_);
-  bool drawImageSection
+  OskTimerWheel & m_timers;
+  pid_t           m_children[ MaxChildren ];
+  int             m_numChildren;
+
+private:
+  // Not implemented
+  OskLauncher();
+  OskLauncher(const OskLauncher &);
+  OskLauncher & operator = (const OskLauncher &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskImageCache
+//
+// Fully composed keyboard frames, one per (keyboard image, section), so a
+// full keyboard repaint is a single blit. Bounded by a byte limit: the lazy
+// mode evicts the least recently used frame, the eager mode builds frames
+// at startup until the limit is hit and keeps exactly those.
+//-----------------------------------------------------------------------------
+class OskImageCache
+{
+public:
+  typedef enum
+  {
+    MODE_OFF = 0,
+    MODE_LAZY,
+    MODE_EAGER,
+  } Mode;
+
+  OskImageCache();
+  ~OskImageCache();
+
+  void Configure(Mode mode_, unsigned long limit_);
+  void Attach(OskImage * const * images_);
+  bool Prepare(OskImage::ImageId baseId_, OskImage::ImageId activeId_);
+
+  const OskImage * Lookup
   (
-    OskImage::ImageId imgId_,
+    OskImage::ImageId baseId_,
+    OskImage::ImageId activeId_,
     OskKeySectionId sectionId_
   );
-  bool drawImageSectionSingle
+
+  void Report(FILE * file_) const;
+
+  Mode GetMode() const
+  {
+    return m_mode;
+  }
+
+protected:
+  class Frame;
+
+  Frame * compose
   (
-    OskImage::ImageId imgId_,
+    OskImage::ImageId baseId_,
+    OskImage::ImageId activeId_,
     OskKeySectionId sectionId_
   );
-  bool sendKey(int key_);
-  bool changeConsole(int gain_);
-  static int normalizePos(unsigned long p_);
-  OskAnalogPos getAnalogPos();
-  bool takeScreenshot();
-  static FILE * createNewFile();
-  static void shutdown();
-  static void showVersion();
-  static void showHelp();
+  bool makeRoom(unsigned long size_);
+
+  Mode                m_mode;
+  unsigned long       m_limit;
+  unsigned long       m_used;
+  unsigned long       m_useTick;
+  OskImage * const *  m_images;
+  Frame *             m_frames[ OskImage::IMGID_Count ][ KSID_Count ];
+
+  // Statistics
+  unsigned long       m_numHits;
+  unsigned long       m_numMisses;
+  unsigned long       m_numEvictions;
+  unsigned long       m_numRejects;
+  unsigned long       m_buildTime;
+
+private:
+  // Not implemented
+  OskImageCache(const OskImageCache &);
+  OskImageCache & operator = (const OskImageCache &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskLayout
+//
+// The keyboard layers, packed into one table of key codes indexed by
+// (layer, section, direction), with the image pair each layer is drawn
+// with and the shoulder buttons that bring it up. The built-in layers are
+// s_OskKeyboards; a layout file replaces them, see Load() for the format.
+//-----------------------------------------------------------------------------
+class OskLayout
+{
+public:
+  typedef enum
+  {
+    TRIG_None = 0,
+    TRIG_L,
+    TRIG_R,
+    TRIG_LR,
+
+    TRIG_Count
+  } Trigger;
+
+  typedef enum
+  {
+    ACT_ConsoleNext = 0,
+    ACT_ConsolePrev,
+    ACT_Console,        // arg is the console
+    ACT_Screenshot,
+    ACT_PowerOff,
+    ACT_Type,           // text is typed
+    ACT_LockLayer,      // arg is the layer, locked or unlocked
+    ACT_Modifier,       // arg is the KEY_MOD_x key, as if typed
+    ACT_Trace,          // Writes the state trace
+    ACT_Run,            // arg is the argument count, text the arguments,
+                        // each ending in a 0
+
+    ACT_Count
+  } Action;
+
+  static const int MaxLayers = 8;
+  static const int MaxNameLength = 15;
+  static const int MaxChords = 16;
+  static const int MaxTextLength = 63;
+  static const int MaxCommandArgs = 8;
+
+  // Buttons held together, for at least holdTime us, to run an action
+  typedef struct
+  {
+    unsigned long     buttons;
+    unsigned long     holdTime;
+    Action            action;
+    int               arg;
+    char              text[ MaxTextLength + 1 ];
+  } Chord;
+
+  OskLayout();
+
+  void SetDefault();
+  bool Load(const char * fileName_);
+
+  int GetNumLayers() const
+  {
+    return m_numLayers;
+  }
+
+  // The four keys of a section, in OskKeyDirectionId order
+  const int * GetKeys(int layer_, OskKeySectionId sectionId_) const
+  {
+    return &m_keys[ ( layer_ * KSID_Count + sectionId_ ) * KDID_Count ];
+  }
+
+  OskImage::ImageId GetImage(int layer_) const
+  {
+    return m_layers[ layer_ ].imgId;
+  }
+
+  OskImage::ImageId GetActiveImage(int layer_) const
+  {
+    return m_layers[ layer_ ].activeImgId;
+  }
+
+  const char * GetName(int layer_) const
+  {
+    return m_layers[ layer_ ].name;
+  }
+
+  // The layer a combination of the shoulder buttons brings up, -1 if none
+  int GetTriggerLayer(Trigger trigger_) const
+  {
+    return m_triggers[ trigger_ ];
+  }
+
+  static Trigger GetTrigger(unsigned long keys_)
+  {
+    return (Trigger)( ( ( keys_ & OskInput::KEY_LTRG ) ? TRIG_L : 0 ) |
+                      ( ( keys_ & OskInput::KEY_RTRG ) ? TRIG_R : 0 ) );
+  }
+
+  int GetNumChords() const
+  {
+    return m_numChords;
+  }
+
+  const Chord & GetChord(int index_) const
+  {
+    return m_chords[ index_ ];
+  }
+
+protected:
+  typedef struct
+  {
+    char              name[ MaxNameLength + 1 ];
+    OskImage::ImageId imgId;
+    OskImage::ImageId activeImgId;
+  } Layer;
+
+  bool parseLine(char * line_, int lineNo_, unsigned int & sectionsSeen_);
+  void setDefaultChords();
+  bool parseChord(const char * const * tokens_, int numTokens_, int lineNo_);
+  bool checkChords() const;
+  int findLayer(const char * name_) const;
+  static bool parseKey(const char * token_, int & key_);
+  static bool parseButtons(const char * token_, unsigned long & buttons_);
+  static bool parseText(const char * token_, char * text_, int maxLength_);
+
+  int       m_numLayers;
+  Layer     m_layers[ MaxLayers ];
+  int       m_triggers[ TRIG_Count ];
+  int       m_keys[ MaxLayers * KSID_Count * KDID_Count ];
+  int       m_numChords;
+  Chord     m_chords[ MaxChords ];
+
+private:
+  // Not implemented
+  OskLayout(const OskLayout &);
+  OskLayout & operator = (const OskLayout &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskCompositor
+//
+// Sits between OskCore and OskCanvas and remembers what the last keyboard
+// frame looked like, so a section change only repaints the two cells that
+// actually differ instead of the whole keyboard.
+//-----------------------------------------------------------------------------
+class OskCompositor
+{
+public:
+  OskCompositor();
+
+  void Attach
+  (
+    OskCanvas * canvas_,
+    OskImage * const * images_,
+    OskImageCache * cache_
+  );
+  void Invalidate();
+
+  bool Clear
+  (
+    int x_,
+    int y_,
+    int width_,
+    int height_
+  );
+
+  bool Fill
+  (
+    int x_,
+    int y_,
+    int width_,
+    int height_,
+    unsigned long color_
+  );
+
+  bool DrawImage
+  (
+    int destX_,
+    int destY_,
+    OskImage::ImageId imgId_,
+    int sourX_,
+    int sourY_,
+    int width_,
+    int height_
+  );
+
+  bool RestoreUnder
+  (
+    int x_,
+    int y_,
+    int width_,
+    int height_
+  );
+
+  bool DrawKeyboard
+  (
+    int x_,
+    int y_,
+    OskImage::ImageId baseId_,
+    OskImage::ImageId activeId_,
+    OskKeySectionId sectionId_
+  );
+
+  static void GetSectionRect
+  (
+    const OskImage & img_,
+    OskKeySectionId sectionId_,
+    int & x_,
+    int & y_,
+    int & width_,
+    int & height_
+  );
+
+  void Report(FILE * file_) const;
+
+  unsigned long GetBlitCount() const
+  {
+    return m_numBlits;
+  }
+
+  unsigned long GetPixelCount() const
+  {
+    return m_numPixels;
+  }
+
+  unsigned long GetPixelsSaved() const
+  {
+    return m_numPixelsSaved;
+  }
+
+  unsigned long GetFullRepaintCount() const
+  {
+    return m_numFullRepaints;
+  }
+
+  unsigned long GetPartialRepaintCount() const
+  {
+    return m_numPartialRepaints;
+  }
+
+  unsigned long GetRestoreCount() const
+  {
+    return m_numRestores;
+  }
+
+protected:
+  bool blit
+  (
+    int destX_,
+    int destY_,
+    const OskImage * img_,
+    int sourX_,
+    int sourY_,
+    int width_,
+    int height_
+  );
+  void damage(int x_, int y_, int width_, int height_);
+  bool repaintDamage
+  (
+    const OskImage & base_,
+    const OskImage & active_,
+    int secX_,
+    int secY_,
+    int secWidth_,
+    int secHeight_
+  );
+
+  OskCanvas *         m_canvas;
+  OskImage * const *  m_images;
+  OskImageCache *     m_cache;
+
+  // The keyboard frame currently on screen
+  bool                m_frameValid;
+  int                 m_frameX;
+  int                 m_frameY;
+  OskImage::ImageId   m_frameBase;
+  OskImage::ImageId   m_frameActive;
+  OskKeySectionId     m_frameSection;
+
+  // Drawn over the frame since it was painted, in screen coordinates
+  int                 m_damageX;
+  int                 m_damageY;
+  int                 m_damageWidth;
+  int                 m_damageHeight;
+
+  // Pixel traffic counters
+  unsigned long       m_numBlits;
+  unsigned long       m_numPixels;
+  unsigned long       m_numPixelsSaved;
+  unsigned long       m_numFullRepaints;
+  unsigned long       m_numPartialRepaints;
+  unsigned long       m_fullRepaintTime;
+  unsigned long       m_numRestores;
+
+private:
+  // Not implemented
+  OskCompositor(const OskCompositor &);
+  OskCompositor & operator = (const OskCompositor &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskScreenshot
+//
+// Streams the canvas into a file one row at a time through a single
+// preallocated row buffer, so taking a shot needs no full-screen buffer.
+// The encoder picks the file format: raw 32-bit BMP, 8-bit RLE BMP (when
+// the screen has no more than 256 colours), PNG or QOI.
+//
+// With capture slots, a shot is split in two: Capture() only copies the
+// visible page into a free slot, and a worker thread encodes and writes it
+// later, off the input path. When every slot is taken, a shot that has
+// not started writing yet is replaced by the newer one; failing that, the
+// new shot is dropped.
+//-----------------------------------------------------------------------------
+class OskScreenshot
+{
+public:
+  typedef enum
+  {
+    ENC_First = 0,
+
+    ENC_Bmp = ENC_First,
+    ENC_Rle8,
+    ENC_Png,
+    ENC_Qoi,
+
+    ENC_Count
+  } Encoder;
+
+  OskScreenshot();
+  ~OskScreenshot();
+
+  bool Initialize
+  (
+    int width_,
+    int height_,
+    const OskPixelFormat & format_,
+    int numSlots_,
+    Encoder encoder_
+  );
+  bool Capture(OskCanvas & canvas_);
+  void Report(FILE * file_);
+
+  // Runs every encoder over the visible screen without writing any file,
+  // and reports the size and time of each
+  bool Benchmark(OskCanvas & canvas_, FILE * file_);
+
+  static const char * GetEncoderName(Encoder encoder_);
+  static const char * GetEncoderExtension(Encoder encoder_);
+
+  static void MakeBmpHeader
+  (
+    unsigned char * header_,
+    int width_,
+    int height_
+  );
+
+  static const int BmpHeaderSize = 0x36;
+  static const int MaxSlots = 4;
+
+protected:
+  static const int MaxFileRetries = 100;
+
+  class Sink;
+  class Palette;
+  class Deflater;
+
+  typedef bool (* RowReader)(void * context_, int y_, OskPixel32 * buf_);
+
+  typedef enum
+  {
+    SLOT_FREE = 0,
+    SLOT_PENDING,
+    SLOT_WRITING,
+  } SlotState;
+
+  typedef struct
+  {
+    SlotState       state;
+    unsigned long   seq;
+    unsigned char * bits;
+  } Slot;
+
+  typedef struct
+  {
+    const OskScreenshot * shot;
+    const unsigned char * bits;
+  } SlotReader;
+
+  bool write
+  (
+    FILE * file_,
+    RowReader reader_,
+    void * context_,
+    OskPixel32 * rowBuf_
+  );
+  bool encode
+  (
+    Encoder encoder_,
+    Sink & sink_,
+    RowReader reader_,
+    void * context_,
+    OskPixel32 * rowBuf_
+  ) const;
+  bool encodeBmp(Sink & sink_, RowReader reader_, void * context_, OskPixel32 * rowBuf_) const;
+  bool encodeRle8(Sink & sink_, RowReader reader_, void * context_, OskPixel32 * rowBuf_) const;
+  bool encodePng(Sink & sink_, RowReader reader_, void * context_, OskPixel32 * rowBuf_) const;
+  bool encodeQoi(Sink & sink_, RowReader reader_, void * context_, OskPixel32 * rowBuf_) const;
+  bool writePngChunk
+  (
+    Sink & sink_,
+    const char * type_,
+    const unsigned char * data_,
+    int size_
+  ) const;
+  void release();
+  void worker();
+  static void * workerMain(void * self_);
+  static bool readCanvasRow(void * context_, int y_, OskPixel32 * buf_);
+  static bool readSlotRow(void * context_, int y_, OskPixel32 * buf_);
+  FILE * createNewFile(const char * extension_);
+  static int scanLastFileIndex();
+
+  int             m_width;
+  int             m_height;
+  OskPixelFormat  m_format;
+  OskPixel32 *    m_rowBuf;
+  Encoder         m_encoder;
+  unsigned long   m_crcTable[ 256 ];
+
+  // Next screenshot number, 0 until the directory has been scanned
+  int             m_nextFileIndex;
+
+  // Asynchronous capture
+  int             m_numSlots;
+  Slot            m_slots[ MaxSlots ];
+  unsigned long   m_seq;
+  OskPixel32 *    m_workerRowBuf;
+  bool            m_workerRunning;
+  bool            m_stopWorker;
+  pthread_t       m_worker;
+  pthread_mutex_t m_mutex;
+  pthread_cond_t  m_cond;
+
+  // Statistics
+  unsigned long   m_numShots;
+  unsigned long   m_numBytes;
+  unsigned long   m_totalTime;
+  unsigned long   m_numCaptures;
+  unsigned long   m_captureTime;
+  unsigned long   m_numCoalesced;
+  unsigned long   m_numDropped;
+
+private:
+  // Not implemented
+  OskScreenshot(const OskScreenshot &);
+  OskScreenshot & operator = (const OskScreenshot &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskStats
+//
+// Per-event latency, one histogram per stage, with power-of-two buckets in
+// microseconds. Only the main loop writes the counters and nothing locks
+// them; a dump taken meanwhile may be off by the event in flight. When
+// disabled, every hook is a single test of m_enabled.
+//
+// SIGUSR1 writes the histograms to StatsFileName. The handler formats into
+// a fixed buffer and uses nothing but open/write/close.
+//-----------------------------------------------------------------------------
+class OskStats
+{
+public:
+  typedef enum
+  {
+    STAGE_First = 0,
+
+    STAGE_Read = STAGE_First,   // In ReadKeys()
+    STAGE_Event,                // Input return to the state change done
+    STAGE_Draw,                 // Outermost frame, begin to commit
+    STAGE_ToDraw,               // Input return to a frame committed
+    STAGE_Send,                 // Flushing the queued keys
+    STAGE_ToSend,               // Input return to the keys flushed
+
+    STAGE_Count
+  } Stage;
+
+  OskStats();
+  ~OskStats();
+
+  bool Enable();
+
+  bool IsEnabled() const
+  {
+    return m_enabled;
+  }
+
+  // 0 when disabled, so a disabled run never reads the clock
+  unsigned long Start() const
+  {
+    return m_enabled ? OskClock::Now() : 0;
+  }
+
+  void Add(Stage stage_, unsigned long us_)
+  {
+    if ( !m_enabled )
+      return;
+
+    Histogram & h = m_histograms[ stage_ ];
+    h.buckets[ bucketOf( us_ ) ]++;
+    h.count++;
+    h.total += us_;
+    if ( us_ > h.max )
+      h.max = us_;
+  }
+
+  void AddSince(Stage stage_, unsigned long start_)
+  {
+    if ( m_enabled )
+      Add( stage_, OskClock::Now() - start_ );
+  }
+
+  void Report(FILE * file_);
+
+  static const int NumBuckets = 32;
+  static const char StatsFileName[];
+
+protected:
+  typedef struct
+  {
+    unsigned long count;
+    unsigned long total;
+    unsigned long max;
+    unsigned long buckets[ NumBuckets ];
+  } Histogram;
+
+  // Bucket 0 holds 0 us, bucket n holds [2^(n-1), 2^n)
+  static int bucketOf(unsigned long us_)
+  {
+    int n = 0;
+    while ( us_ != 0 && n < NumBuckets - 1 )
+    {
+      us_ >>= 1;
+      n++;
+    }
+    return n;
+  }
+
+  int format();
+  static void onSignal(int signal_);
+
+  bool            m_enabled;
+  Histogram       m_histograms[ STAGE_Count ];
+  char            m_text[ 4096 ];
+  int             m_textLen;
+
+  static OskStats * s_instance;
+
+private:
+  // Not implemented
+  OskStats(const OskStats &);
+  OskStats & operator = (const OskStats &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskMetrics
+//
+// Running totals of what the keyboard costs the system: calls, bytes moved,
+// syscalls and wakeups. Always on; a hook is one increment of a plain
+// counter, owned by the main loop.
+//
+// SIGUSR2 writes a snapshot to SnapshotFileName, with each total and its
+// rate per second since the previous snapshot, and the state trace to
+// OskTrace::TraceFileName.
+//-----------------------------------------------------------------------------
+class OskMetrics
+{
+public:
+  typedef enum
+  {
+    MET_First = 0,
+
+    MET_Wakeups = MET_First,    // Returns from waiting for input or a timer
+    MET_InputEvents,            // Joypad words taken by the main loop
+    MET_TimersFired,
+    MET_StateChanges,
+    MET_TransitionLoops,
+    MET_AnalogMoves,            // Stick position changes taken
+    MET_AnalogSuppressed,       // Changes held back by the margins
+    MET_ChordScans,             // Chord table scans, one per chord button change
+    MET_ChordsFired,
+    MET_Blits,
+    MET_BlitBytes,
+    MET_Clears,
+    MET_ClearBytes,
+    MET_Flushes,
+    MET_PageFlips,
+    MET_FbSyscalls,
+    MET_KeysSent,
+    MET_KeyRepeats,
+    MET_KeysModified,
+    MET_ConsoleBytes,
+    MET_ConsoleSwitches,
+    MET_ConsoleUpdates,
+    MET_ConsoleSyscalls,
+    MET_Screenshots,
+    MET_CommandsRun,
+    MET_CommandsRefused,        // Too many still running, or the fork failed
+
+    MET_Count
+  } Metric;
+
+  static bool Enable();
+
+  static void Count(Metric metric_)
+  {
+    s_counters[ metric_ ]++;
+  }
+
+  static void Count(Metric metric_, unsigned long n_)
+  {
+    s_counters[ metric_ ] += n_;
+  }
+
+  static unsigned long Get(Metric metric_)
+  {
+    return s_counters[ metric_ ];
+  }
+
+  static void Report(FILE * file_);
+
+  static const char SnapshotFileName[];
+
+protected:
+  static void writeTo(int fd_);
+  static void onSignal(int signal_);
+
+  static unsigned long s_counters[ MET_Count ];
+  static unsigned long s_lastCounters[ MET_Count ];
+  static unsigned long s_lastTime;
+
+private:
+  // Not implemented
+  OskMetrics();
+  OskMetrics(const OskMetrics &);
+  OskMetrics & operator = (const OskMetrics &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskTrace
+//
+// The last state changes of OskCore, each with what caused it and what its
+// redraw cost, so a burst of transitions and redraws on one input can be
+// told apart after the fact. Always on; written by the main loop only, and
+// read by the signal handler without locking: an entry is complete before
+// the write index moves past it, and the slot about to be reused is never
+// dumped.
+//-----------------------------------------------------------------------------
+class OskTrace
+{
+public:
+  // States, as recorded; the layers of OskLayout follow STATE_Layer
+  typedef enum
+  {
+    STATE_Failed = 0,
+    STATE_Idle,
+    STATE_Mouse,
+    STATE_Layer
+  } State;
+
+  typedef struct
+  {
+    unsigned long   time;     // When the transition started, in us
+    unsigned long   keys;     // The joypad word that led to it
+    unsigned long   us;       // Spent leaving one state and entering the other
+    unsigned long   pixels;   // Drawn meanwhile
+    unsigned char   from;
+    unsigned char   to;
+    unsigned char   depth;    // Transitions before it on the same input
+  } Entry;
+
+  static void Record
+  (
+    unsigned long time_,
+    int from_,
+    int to_,
+    unsigned long keys_,
+    int depth_,
+    unsigned long us_,
+    unsigned long pixels_
+  )
+  {
+    Entry & entry = s_entries[ s_next & ( NumEntries - 1 ) ];
+    entry.time = time_;
+    entry.keys = keys_;
+    entry.us = us_;
+    entry.pixels = pixels_;
+    entry.from = (unsigned char)from_;
+    entry.to = (unsigned char)to_;
+    entry.depth = (unsigned char)depth_;
+    s_next++;
+  }
+
+  // Safe from a signal handler
+  static void Write();
+  static void Report(FILE * file_);
+
+  static const int NumEntries = 64;   // A power of 2
+  static const char TraceFileName[];
+
+protected:
+  static void writeTo(int fd_);
+
+  static Entry                    s_entries[ NumEntries ];
+  static volatile unsigned long   s_next;     // Entries ever recorded
+
+private:
+  // Not implemented
+  OskTrace();
+  OskTrace(const OskTrace &);
+  OskTrace & operator = (const OskTrace &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskQueue
+//
+// Bounded queue of fixed-size items from exactly one producer thread to
+// exactly one consumer thread, with no lock: each side only writes its own
+// index, and an item is copied in before the head moves past it. Every
+// item pushed also puts one byte in a pipe and every item popped takes one
+// out, so the consumer can sleep in poll() or read() until there is an
+// item, and is never woken for one already taken.
+//-----------------------------------------------------------------------------
+class OskQueue
+{
+public:
+  OskQueue();
+  ~OskQueue();
+
+  // numItems_ is a power of 2, at most MaxItems
+  bool Initialize(int itemSize_, int numItems_);
+
+  // Producer side; false if the queue is full
+  bool Push(const void * item_);
+
+  // Consumer side; blocks until there is an item
+  bool Pop(void * item_);
+
+  // Readable while there is an item to pop
+  int GetFd() const
+  {
+    return m_pipe[ 0 ];
+  }
+
+  // Well within what a pipe buffers, so pushing never blocks
+  static const int MaxItems = 256;
+
+protected:
+  unsigned char *         m_items;
+  int                     m_itemSize;
+  unsigned long           m_mask;
+  volatile unsigned long  m_head;     // Written by the producer only
+  volatile unsigned long  m_tail;     // Written by the consumer only
+  int                     m_pipe[ 2 ];
+
+private:
+  // Not implemented
+  OskQueue(const OskQueue &);
+  OskQueue & operator = (const OskQueue &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInputStage
+//
+// Reads another input on a thread of its own and hands the words over
+// through an OskQueue, so a slow pass of the state machine never holds up
+// the next joypad read. Takes over the input it is given.
+//-----------------------------------------------------------------------------
+class OskInputStage : public OskInput
+{
+public:
+  OskInputStage(OskInput * input_);
+  virtual ~OskInputStage();
+
+  virtual bool Initialize(void * param_);
+  virtual unsigned long ReadKeys();
+
+  virtual bool IsEnd()
+  {
+    return m_end;
+  }
+
+  virtual int GetFd()
+  {
+    return m_queue.GetFd();
+  }
+
+  virtual void Report(FILE * file_);
+
+  // When the word ReadKeys() last returned came off the joypad
+  unsigned long GetReadTime() const
+  {
+    return m_readTime;
+  }
+
+  static const int QueueItems = 64;
+
+protected:
+  typedef struct
+  {
+    unsigned long keys;
+    unsigned long time;
+    int           end;
+  } Event;
+
+  static void * threadMain(void * param_);
+  void run();
+
+  OskInput *      m_input;
+  OskQueue        m_queue;
+  pthread_t       m_thread;
+  bool            m_running;
+  bool            m_end;
+  unsigned long   m_readTime;
+  unsigned long   m_numEvents;
+  unsigned long   m_numStalls;  // Input thread only
+
+private:
+  // Not implemented
+  OskInputStage(const OskInputStage &);
+  OskInputStage & operator = (const OskInputStage &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskConsoleStage
+//
+// Writes the flushed batches of another console on a thread of its own,
+// so a slow console device never holds up drawing or the next read.
+// Switching and repainting the console wait until every batch before them
+// is written. Takes over the console it is given.
+//-----------------------------------------------------------------------------
+class OskConsoleStage : public OskConsole
+{
+public:
+  OskConsoleStage(OskConsole * console_, OskStats & stats_);
+  virtual ~OskConsoleStage();
+
+  virtual bool Initialize(void * param_);
+  virtual int ChangeConsole(int con_);
+  virtual bool Update();
+
+  // The input the next flushed batch answers, for the latency stats
+  void SetEventTime(unsigned long time_)
+  {
+    m_eventTime = time_;
+  }
+
+  void Report(FILE * file_);
+
+  static const int QueueItems = 16;
+
+protected:
+  static const int BatchStop = -1;  // Stops the thread
+  static const int BatchAck = -2;   // Answered with a byte on m_ackPipe
+
+  typedef struct
+  {
+    unsigned long eventTime;
+    int           count;        // Or one of the Batch* markers below
+    char          bytes[ QueueSize ];
+  } Batch;
+
+  virtual bool write(const char * bytes_, int count_);
+  bool post(const Batch & batch_);
+  void drain();
+  static void * threadMain(void * param_);
+  void run();
+
+  OskConsole *            m_console;
+  OskStats &              m_stats;
+  OskQueue                m_queue;
+  pthread_t               m_thread;
+  bool                    m_running;
+  unsigned long           m_eventTime;
+  unsigned long           m_numPosted;
+  unsigned long           m_numStalls;
+  unsigned long           m_numDrains;
+  volatile unsigned long  m_numWritten; // Console thread only
+  volatile bool           m_failed;     // Console thread only
+  int                     m_ackPipe[ 2 ];
+
+private:
+  // Not implemented
+  OskConsoleStage(const OskConsoleStage &);
+  OskConsoleStage & operator = (const OskConsoleStage &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskCore
+//-----------------------------------------------------------------------------
+class OskCore
+{
+public:
+  typedef enum
+  {
+    FLAGS_USE_DPAD    = 0x00000001,
+    FLAGS_USE_ANALOG  = 0x00000002,
+    FLAGS_PAGE_FLIP   = 0x00000004,
+    FLAGS_DITHER      = 0x00000008,
+    FLAGS_STATS       = 0x00000010,
+    FLAGS_PIPELINE    = 0x00000020,
+    FLAGS_EXIT        = 0xffffffff,
+  } OskFlags;
+
+  typedef enum
+  {
+    ANALOG_POS_CENTER,
+    ANALOG_POS_LEFT,
+    ANALOG_POS_UPLEFT,
+    ANALOG_POS_UP,
+    ANALOG_POS_UPRIGHT,
+    ANALOG_POS_RIGHT,
+    ANALOG_POS_DOWNRIGHT,
+    ANALOG_POS_DOWN,
+    ANALOG_POS_DOWNLEFT,
+
+    ANALOG_POS_Count
+  } OskAnalogPos;
+
+  typedef struct
+  {
+    int                   numVts;
+    OskImageCache::Mode   cacheMode;
+    unsigned long         cacheLimit;
+    int                   screenshotSlots;
+    OskScreenshot::Encoder screenshotEncoder;
+    unsigned long         repeatDelay;        // in us, 0 for no repeat
+    unsigned long         repeatInterval;     // in us
+    unsigned long         repeatFastest;      // in us
+    int                   repeatPercent;      // Next interval, in %
+    int                   analogDeadzone;     // In % of full travel
+    int                   analogMargin;       // In % of full travel
+    int                   analogAngleMargin;  // In degrees
+    const char *          layoutFile;         // NULL for the built-in one
+  } OskSettings;
+
+  OskCore(const OskFlags flags_, const OskSettings & settings_);
+  virtual ~OskCore();
+
+  static bool ParseFlags
+  (
+    const char * cmdline_,
+    OskFlags & flags_,
+    OskSettings & settings_
+  );
+
+  bool Initialize(void * param1_, void * param2_);
+  void Main();
+  void Report(FILE * file_);
+
+  // The keyboard section the d-pad and the stick select, in one lookup of
+  // a table of every (flags, stick, d-pad) combination. The d-pad bits the
+  // section used are cleared from keys_.
+  static OskKeySectionId ResolveSection
+  (
+    OskFlags flags_,
+    OskAnalogPos pos_,
+    unsigned long & keys_
+  )
+  {
+    const unsigned char entry =
+        s_sectionTable[ ( ( flags_ & SectionFlagsMask ) * ANALOG_POS_Count +
+                          pos_ ) * 16 + ( keys_ & SectionDpadMask ) ];
+
+    keys_ &= ~(unsigned long)( entry & SectionDpadMask );
+    return (OskKeySectionId)( entry >> 4 );
+  }
+
+  static const unsigned long SectionFlagsMask = FLAGS_USE_DPAD | FLAGS_USE_ANALOG;
+  static const unsigned long SectionDpadMask = 0xf;
+  static const int SectionTableSize = 4 * ANALOG_POS_Count * 16;
+
+  // Sticky modifiers, as bits; KEY_MOD_x is MOD_x shifted by 8
+  typedef enum
+  {
+    MOD_Ctrl  = 0x1,
+    MOD_Alt   = 0x2,
+    MOD_Meta  = 0x4,
+
+    MOD_All   = 0x7
+  } OskModifier;
+
+  // The key as the console should get it with mods_ applied: a control
+  // byte for Ctrl, the high bit set for Meta, ESC in front for Alt
+  static int ApplyModifiers(int key_, unsigned int mods_);
+
+protected:
+  // Internal states
+  class BaseState;
+    class FailedState;
+    class KbdState;
+      class IdleState;
+      class ActiveState;
+    class MouseState;
+  
+  #define OSK_STATES_H
+  #include "oskstates.h"
+  #undef  OSK_STATES_H
+
+  //---------------------------------------------------------------------------
+  // Class: OskCore::KeyRepeat
+  //
+  // Sends the key of the last button pressed again while it stays down:
+  // first after the delay, then at an interval that shrinks by a percentage
+  // each time, down to the fastest.
+  //---------------------------------------------------------------------------
+  class KeyRepeat : public OskTimer
+  {
+  public:
+    KeyRepeat(OskCore & core_);
+
+    void Start(unsigned long button_, int key_, unsigned int mods_);
+    void Stop();
+    virtual void OnTimer();
+
+  protected:
+    OskCore &       m_core;
+    unsigned long   m_button;
+    int             m_key;
+    unsigned int    m_mods;     // As they were when the key was pressed
+    unsigned long   m_interval;
+
+  private:
+    // Not implemented
+    KeyRepeat();
+    KeyRepeat(const KeyRepeat &);
+    KeyRepeat & operator = (const KeyRepeat &);
+  };
+
+  //---------------------------------------------------------------------------
+  // Class: OskCore::AnalogStick
+  //
+  // Turns the two stick nibbles of a joypad word into a position. The
+  // centre and its noise are measured over the first resting reads, the
+  // direction comes from an integer atan, and a position only changes once
+  // the stick is a margin past the boundary, so a stick sitting on one does
+  // not flicker between two sections.
+  //---------------------------------------------------------------------------
+  class AnalogStick
+  {
+  public:
+    AnalogStick();
+
+    void Configure(int deadzone_, int margin_, int angleMargin_);
+    OskAnalogPos Update(unsigned long keys_);
+
+    OskAnalogPos GetPos() const
+    {
+      return m_pos;
+    }
+
+    static const int CalibrationSamples = 16;
+
+  protected:
+    void calibrate(int x_, int y_);
+    static int angleOf(int dx_, int dy_);
+
+    // In 1/16 of a stick step, and 1/256 of a turn for the angle
+    int             m_deadzone;
+    int             m_margin;
+    int             m_angleMargin;
+    int             m_centreX;
+    int             m_centreY;
+
+    // Calibration
+    int             m_numSamples;
+    int             m_sumX;
+    int             m_sumY;
+    int             m_minX;
+    int             m_maxX;
+    int             m_minY;
+    int             m_maxY;
+
+    OskAnalogPos    m_pos;
+    OskAnalogPos    m_rawPos;     // Without the margins
+
+  private:
+    // Not implemented
+    AnalogStick(const AnalogStick &);
+    AnalogStick & operator = (const AnalogStick &);
+  };
+
+  //---------------------------------------------------------------------------
+  // Class: OskCore::ChordMatcher
+  //
+  // The chords of the layout as a table of button masks, most buttons
+  // first, so a chord wins over any chord made of a part of its buttons.
+  // The table is only scanned when a button that is part of some chord
+  // changes; every other read costs one mask and compare. The buttons of
+  // a matched chord are taken out of the keys for as long as it is held.
+  // An action runs once per press, after the hold time if there is one.
+  //---------------------------------------------------------------------------
+  class ChordMatcher : public OskTimer
+  {
+  public:
+    ChordMatcher(OskCore & core_);
+
+    void Compile(const OskLayout & layout_);
+    void Match(unsigned long & keys_);
+    virtual void OnTimer();
+
+  protected:
+    void scan(unsigned long keys_);
+    void schedule();
+
+    OskCore &                 m_core;
+    int                       m_numChords;
+    unsigned long             m_masks[ OskLayout::MaxChords ];
+    const OskLayout::Chord *  m_chords[ OskLayout::MaxChords ];
+    unsigned long             m_due[ OskLayout::MaxChords ];
+    unsigned long             m_allButtons;
+    unsigned long             m_lastKeys;
+
+    // Bit n for the chord at m_masks[ n ]
+    unsigned long             m_matched;
+    unsigned long             m_pending;    // Matched, waiting to be held
+    unsigned long             m_consumed;   // Buttons of the matched chords
+
+  private:
+    // Not implemented
+    ChordMatcher();
+    ChordMatcher(const ChordMatcher &);
+    ChordMatcher & operator = (const ChordMatcher &);
+  };
+
+  void changeState(BaseState * newState_);
+  bool beginFrame();
+  bool commitFrame();
+  bool clear(OskImage::ImageId imgId_);
+  bool clear();
+  bool drawImage(OskImage::ImageId imgId_);
+  bool drawKeyboard
+  (
+    OskImage::ImageId baseId_,
+    OskImage::ImageId activeId_,
+    OskKeySectionId sectionId_
+  );
+  bool drawImageSectionSingle
+  (
+    OskImage::ImageId imgId_,
+    OskKeySectionId sectionId_
+  );
+  bool sendKey(int key_);
+  bool sendKey(int key_, unsigned int mods_);
+  bool typeKey(unsigned long button_, int key_);
+  void toggleModifier(unsigned int mod_);
+  bool drawModifiers();
+  bool redrawModifiers();
+  bool flushKeys();
+  bool waitForInput();
+  bool changeConsole(int gain_);
+  OskAnalogPos getAnalogPos();
+  bool takeScreenshot();
+  bool runChord(const OskLayout::Chord & chord_);
+  static void showVersion();
+  static void showHelp();
+
+  // Section in the high nibble, the d-pad bits it takes in the low one
+  static const unsigned char s_sectionTable[ SectionTableSize ];
   
   const OskFlags  c_flags;
+  const OskSettings c_settings;
   const int       c_numVts;
 
   bool            m_initialized;
@@ -385,15 +2018,34 @@ protected:
   OskCanvas *     m_canvas;
   OskInput *      m_input;
   OskConsole *    m_console;
+  OskInputStage * m_inputStage;     // m_input, when it has its own thread
+  OskConsoleStage * m_consoleStage; // m_console, likewise
+  OskLayout       m_layout;
+  OskImageCache   m_imageCache;
+  OskCompositor   m_compositor;
+  OskScreenshot   m_screenshot;
+  OskTimerWheel   m_timers;
+  OskStats        m_stats;
+  unsigned long   m_eventTime;
+  unsigned long   m_drawTime;
   BaseState *     m_currentState;
   unsigned long   m_keys;
+  unsigned long   m_heldKeys;     // As read, before the states eat any
+  unsigned long   m_pressedKeys;  // Down now but not in the previous read
+  KeyRepeat       m_keyRepeat;
+  AnalogStick     m_analog;
+  ChordMatcher    m_chords;
+  OskLauncher     m_launcher;
+  int             m_lockedLayer;  // Shown with no trigger held, or -1
+  unsigned int    m_oneShotMods;  // For the next key only
+  unsigned int    m_lockedMods;   // Until toggled off
+  bool            m_modsChanged;  // The indicator is out of date
   int             m_activeConsole;
+  unsigned long   m_numConsoleUpdates;
 
   FailedState     m_failedState;
   IdleState       m_idleState;
-  ActiveEngState  m_activeEngState;
-  ActiveCapState  m_activeCapState;
-  ActiveNumState  m_activeNumState;
+  ActiveState *   m_activeStates[ OskLayout::MaxLayers ];
   MouseState      m_mouseState;
 
 private:
@@ -406,10 +2058,9 @@ private:
   friend class FailedState;
   friend class IdleState;
   friend class ActiveState;
-  friend class ActiveEngState;
-  friend class ActiveCapState;
-  friend class ActiveNumState;
   friend class MouseState;
+  friend class KeyRepeat;
+  friend class ChordMatcher;
 };
 
 
@@ -5,11 +5,13 @@
 #include "osk.h"
 #include "oskimg.h"
 #include <unistd.h>
+#include <stdlib.h>
 #include <string.h>
 #include <fcntl.h>
 #include <linux/fb.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 
 
 //-----------------------------------------------------------------------------
@@ -17,19 +19,17 @@
 //-----------------------------------------------------------------------------
 class OskImage_Psp;
 class OskCanvas_Psp;
-class OskInput_Psp;
-class OskConsole_Psp;
 
 
 //-----------------------------------------------------------------------------
 // Constants
 //-----------------------------------------------------------------------------
 static const char c_fbDevName[]             = "/dev/fb0";
-static const char c_joypadDevName[]         = "/dev/joypad";
-static const char c_vcsDevName[]            = "/dev/vcs";
-static const int PSP_VCS_IOCTL_PUTCHAR      = 101;
-static const int PSP_VCS_IOCTL_CHANGE_CON   = 107;
-static const int PSP_VCS_IOCTL_UPDATE_SCR   = 108;
+static const char c_fbDevEnv[]              = "OSK_FBDEV";
+static const char c_fbGeometryEnv[]         = "OSK_FBGEOMETRY";
+static const int c_fileFbWidth              = 480;
+static const int c_fileFbHeight             = 272;
+static const int c_fileFbBitsPerPixel       = 32;
 
 
 //-----------------------------------------------------------------------------
@@ -62,15 +62,19 @@ class OskImage_Psp : public OskImage
 {
 public:
   OskImage_Psp(ImageId imgId_);
-  //virtual ~OskImage_Psp();
+  virtual ~OskImage_Psp();
 
   virtual const void * GetData() const
   {
-    return m_imgData.bitmap;
+    return ( m_bits != NULL ) ? (const void *)m_bits
+                              : (const void *)m_imgData.bitmap;
   }
 
+  virtual bool Convert(const OskPixelFormat & format_, bool dither_);
+
 protected:
   const OskImgData & m_imgData;
+  unsigned char * m_bits;
 
 private:
   // Not implemented
@@ -99,6 +103,15 @@ public:
     int height_
   );
 
+  virtual bool Fill
+  (
+    int x_,
+    int y_,
+    int width_,
+    int height_,
+    unsigned long color_
+  );
+
   virtual bool DrawImage
   (
     int destX_,
@@ -111,16 +124,58 @@ public:
   );
 
   virtual bool GetBits(void * buf_, int & size_);
+  virtual bool GetRow(int y_, OskPixel32 * buf_);
+  virtual bool CopyVisible(void * buf_, int size_);
+
+  virtual bool BeginFrame();
+  virtual bool CommitFrame();
+  virtual bool EnablePageFlip(bool enable_);
+  virtual bool IsDrawingOffscreen() const
+  {
+    return ( m_drawBase != m_vramBase );
+  }
+  virtual bool SaveUnder(int x_, int y_, int width_, int height_);
+  virtual bool RestoreUnder(int x_, int y_, int width_, int height_);
 
 protected:
-  static unsigned long convertPixel(unsigned long color_);
-  bool flush();
+  virtual bool flush();
+  virtual bool present();
+  bool initFileGeometry(struct fb_var_screeninfo & vinfo_);
+  void addDirtyRect(int x_, int y_, int width_, int height_);
+  void copyRect
+  (
+    unsigned char * dest_,
+    const unsigned char * sour_,
+    int x_,
+    int y_,
+    int width_,
+    int height_
+  );
+  bool panTo(int page_);
+  void syncBackPage(int x_, int y_, int width_, int height_);
   
-  unsigned long * m_vramBase;
+  unsigned char * m_vramBase;
+  unsigned char * m_drawBase;
   unsigned long m_vramSize;
   int m_virtualWidth;
   int m_virtualHeight;
+  int m_bytesPerPixel;
+  int m_pitch;
   int m_fbFd;
+  bool m_fileBacked;
+  bool m_pageFlip;
+  int m_displayPage;
+  unsigned long m_numPageFlips;
+  unsigned long m_backSyncTime;   // When the back page last matched the front
+  struct fb_var_screeninfo m_vinfo;
+  unsigned char * m_underBuf;
+  int m_underBufSize;
+
+  // Bounding box of what has been drawn into the back page this frame
+  int m_dirtyLeft;
+  int m_dirtyTop;
+  int m_dirtyRight;
+  int m_dirtyBottom;
 
 private:
   // Not implemented
@@ -130,60 +185,55 @@ private:
 
 
 //-----------------------------------------------------------------------------
-// Class: OskInput_Psp
+// Class: OskImage_Psp
 //-----------------------------------------------------------------------------
-class OskInput_Psp : public OskInput
+OskImage_Psp::OskImage_Psp(ImageId imgId_)
+  : OskImage( imgId_ ),
+    m_imgData( *s_imgDataList[ imgId_ ] ),
+    m_bits( NULL )
 {
-public:
-  OskInput_Psp();
-  virtual ~OskInput_Psp();
-
-  virtual bool Initialize(void * param_);
-  virtual unsigned long ReadKeys();
-
-protected:
-  int m_joypadFd;
-
-private:
-  // Not implemented
-  OskInput_Psp(const OskInput_Psp &);
-  OskInput_Psp & operator = (const OskInput_Psp &);
-};
-
-
+  m_width = m_imgData.width;
+  m_height = m_imgData.height;
+}
 //-----------------------------------------------------------------------------
-// Class: OskConsole_Psp
+OskImage_Psp::~OskImage_Psp()
+{
+  if ( m_bits != NULL )
+  {
+    delete[] m_bits;
+    m_bits = NULL;
+  }
+}
 //-----------------------------------------------------------------------------
-class OskConsole_Psp : public OskConsole
+bool OskImage_Psp::Convert(const OskPixelFormat & format_, bool dither_)
 {
-public:
-  OskConsole_Psp();
-  virtual ~OskConsole_Psp();
+  if ( m_bits != NULL )
+  {
+    delete[] m_bits;
+    m_bits = NULL;
+  }
 
-  virtual bool Initialize(void * param_);
-  virtual bool SendKey(int key_);
-  virtual int ChangeConsole(int con_);
-  virtual bool Update();
+  m_bytesPerPixel = format_.GetBytesPerPixel();
 
-protected:
-  int m_vcsFd;
+  // Compiled-in bits are already in the native 32-bit layout
+  if ( format_.IsImageNative() )
+    return true;
 
-private:
-  // Not implemented
-  OskConsole_Psp(const OskConsole_Psp &);
-  OskConsole_Psp & operator = (const OskConsole_Psp &);
-};
+  const int pitch = m_width * m_bytesPerPixel;
+  m_bits = new unsigned char[ pitch * m_height ];
+  if ( m_bits == NULL )
+    return false;
 
+  for ( int y = 0; y < m_height; y++ )
+  {
+    format_.PackRow( m_bits + y * pitch,
+                     m_imgData.bitmap + y * m_width,
+                     m_width,
+                     y,
+                     dither_ );
+  }
 
-//-----------------------------------------------------------------------------
-// Class: OskImage_Psp
-//-----------------------------------------------------------------------------
-OskImage_Psp::OskImage_Psp(ImageId imgId_)
-  : OskImage( imgId_ ),
-    m_imgData( *s_imgDataList[ imgId_ ] )
-{
-  m_width = m_imgData.width;
-  m_height = m_imgData.height;
+  return true;
 }
 
 
@@ -193,15 +243,37 @@ OskImage_Psp::OskImage_Psp(ImageId imgId_)
 OskCanvas_Psp::OskCanvas_Psp()
   : OskCanvas(),
     m_vramBase( NULL ),
+    m_drawBase( NULL ),
     m_vramSize( 0 ),
     m_virtualWidth( 0 ),
     m_virtualHeight( 0 ),
-    m_fbFd( -1 )
+    m_bytesPerPixel( 0 ),
+    m_pitch( 0 ),
+    m_fbFd( -1 ),
+    m_fileBacked( false ),
+    m_pageFlip( false ),
+    m_displayPage( 0 ),
+    m_numPageFlips( 0 ),
+    m_backSyncTime( 0 ),
+    m_underBuf( NULL ),
+    m_underBufSize( 0 ),
+    m_dirtyLeft( 0 ),
+    m_dirtyTop( 0 ),
+    m_dirtyRight( 0 ),
+    m_dirtyBottom( 0 )
 {
+  memset( &m_vinfo, 0, sizeof( m_vinfo ) );
 }
 //-----------------------------------------------------------------------------
 OskCanvas_Psp::~OskCanvas_Psp()
 {
+  if ( m_underBuf != NULL )
+  {
+    delete[] m_underBuf;
+    m_underBuf = NULL;
+    m_underBufSize = 0;
+  }
+
   if ( m_fbFd >= 0 )
   {
     if ( m_vramBase != NULL && m_vramSize != 0 )
@@ -218,10 +290,17 @@ OskCanvas_Psp::~OskCanvas_Psp()
 //-----------------------------------------------------------------------------
 bool OskCanvas_Psp::Initialize(void * param_)
 {
-  struct fb_var_screeninfo vinfo;
+  struct fb_var_screeninfo & vinfo = m_vinfo;
   int rt;
 
-  m_fbFd = open( c_fbDevName, O_RDWR );
+  // A regular file may stand in for the framebuffer device
+  const char * devName = getenv( c_fbDevEnv );
+  if ( devName == NULL || *devName == 0 )
+  {
+    devName = c_fbDevName;
+  }
+
+  m_fbFd = open( devName, O_RDWR );
   if ( m_fbFd < 0 )
   {
     DBG(( "OSK: Failed to open framebuffer device for canvas, err=%d\n", m_fbFd ));
@@ -231,7 +310,18 @@ bool OskCanvas_Psp::Initialize(void * param_)
   rt = ioctl( m_fbFd, FBIOGET_VSCREENINFO, &vinfo );
   if ( rt < 0 )
   {
-    DBG(( "OSK: Failed to obtain framebuffer info, err=%d\n", rt ));
+    if ( !initFileGeometry( vinfo ) )
+    {
+      DBG(( "OSK: Failed to obtain framebuffer info, err=%d\n", rt ));
+      return false;
+    }
+  }
+
+  if ( !m_format.Set( vinfo.bits_per_pixel,
+                      vinfo.red.offset, vinfo.red.length,
+                      vinfo.green.offset, vinfo.green.length,
+                      vinfo.blue.offset, vinfo.blue.length ) )
+  {
     return false;
   }
 
@@ -242,8 +332,10 @@ bool OskCanvas_Psp::Initialize(void * param_)
   m_height = vinfo.yres;
   m_virtualWidth = vinfo.xres_virtual;
   m_virtualHeight = vinfo.yres_virtual;
+  m_bytesPerPixel = vinfo.bits_per_pixel >> 3;
+  m_pitch = m_virtualWidth * m_bytesPerPixel;
 
-  m_vramBase = (unsigned long *)mmap( NULL,
+  m_vramBase = (unsigned char *)mmap( NULL,
                                       m_vramSize,
                                       PROT_READ | PROT_WRITE,
                                       MAP_SHARED,
@@ -257,6 +349,172 @@ bool OskCanvas_Psp::Initialize(void * param_)
     return false;
   }
 
+  m_drawBase = m_vramBase;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::initFileGeometry(struct fb_var_screeninfo & vinfo_)
+{
+  struct stat st;
+  if ( fstat( m_fbFd, &st ) < 0 || !S_ISREG( st.st_mode ) )
+    return false;
+
+  int width = c_fileFbWidth;
+  int height = c_fileFbHeight;
+  int bpp = c_fileFbBitsPerPixel;
+
+  // "<width>x<height>x<bpp>"
+  const char * geometry = getenv( c_fbGeometryEnv );
+  if ( geometry != NULL &&
+       sscanf( geometry, "%dx%dx%d", &width, &height, &bpp ) < 2 )
+  {
+    DBG(( "OSK: Bad %s, expecting WxH[xBPP]\n", c_fbGeometryEnv ));
+    return false;
+  }
+
+  const long pageSize = (long)width * height * ( bpp >> 3 );
+  if ( width <= 0 || height <= 0 || pageSize <= 0 || st.st_size < pageSize )
+  {
+    DBG(( "OSK: Framebuffer file is too small for %dx%dx%d\n",
+          width, height, bpp ));
+    return false;
+  }
+
+  memset( &vinfo_, 0, sizeof( vinfo_ ) );
+  vinfo_.xres = width;
+  vinfo_.yres = height;
+  vinfo_.xres_virtual = width;
+  vinfo_.yres_virtual = st.st_size / ( (long)width * ( bpp >> 3 ) );
+  vinfo_.bits_per_pixel = bpp;
+
+  m_fileBacked = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::EnablePageFlip(bool enable_)
+{
+  if ( !enable_ )
+  {
+    m_pageFlip = false;
+    return true;
+  }
+
+  if ( m_vramBase == NULL || m_virtualHeight < ( m_height << 1 ) )
+  {
+    DBG(( "OSK: Virtual height %d is too small for page flipping\n",
+          m_virtualHeight ));
+    m_pageFlip = false;
+    return false;
+  }
+
+  // The back page has not been kept up to date meanwhile
+  m_pageFlip = true;
+  m_consoleDrawn = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::BeginFrame()
+{
+  if ( m_frameDepth == 0 && m_pageFlip )
+  {
+    // The back page is shown in full while presenting, so it has to match
+    // the front page. present() leaves the two equal, so only console
+    // output since then needs copying: all of the page after a switch or
+    // once the copy is too old, just the overlay after a key.
+    m_drawBase = m_vramBase + m_height * m_pitch;
+    if ( m_consoleDrawn ||
+         OskClock::Now() - m_backSyncTime >= SnapshotMaxAge ||
+         ( m_underStale && m_underWidth == 0 ) )
+    {
+      syncBackPage( 0, 0, m_width, m_height );
+      m_consoleDrawn = false;
+      m_backSyncTime = OskClock::Now();
+    }
+    else if ( m_underStale )
+    {
+      syncBackPage( m_underX, m_underY, m_underWidth, m_underHeight );
+    }
+
+    m_underStale = false;
+
+    m_dirtyLeft = m_dirtyTop = m_dirtyRight = m_dirtyBottom = 0;
+  }
+
+  return OskCanvas::BeginFrame();
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::CommitFrame()
+{
+  // The frame is presented from the back page; drawing outside a frame
+  // goes straight to the front one
+  const bool rt = OskCanvas::CommitFrame();
+  if ( m_frameDepth == 0 )
+  {
+    m_drawBase = m_vramBase;
+  }
+
+  return rt;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::SaveUnder(int x_, int y_, int width_, int height_)
+{
+  m_underValid = false;
+
+  if ( m_vramBase == NULL || width_ <= 0 || height_ <= 0 )
+    return false;
+
+  const int rowSize = width_ * m_bytesPerPixel;
+  if ( m_underBufSize < rowSize * height_ )
+  {
+    if ( m_underBuf != NULL )
+      delete[] m_underBuf;
+
+    m_underBufSize = rowSize * height_;
+    m_underBuf = new unsigned char[ m_underBufSize ];
+    if ( m_underBuf == NULL )
+    {
+      m_underBufSize = 0;
+      return false;
+    }
+  }
+
+  // Always from the page the console draws into
+  unsigned char * dest = m_underBuf;
+  const unsigned char * sour = m_vramBase + y_ * m_pitch + x_ * m_bytesPerPixel;
+  for ( int i = 0; i < height_; i++ )
+  {
+    memcpy( dest, sour, rowSize );
+    dest += rowSize;
+    sour += m_pitch;
+  }
+
+  m_underValid = true;
+  m_underX = x_;
+  m_underY = y_;
+  m_underWidth = width_;
+  m_underHeight = height_;
+  m_underTime = OskClock::Now();
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::RestoreUnder(int x_, int y_, int width_, int height_)
+{
+  if ( m_underBuf == NULL || !IsUnderValid( x_, y_, width_, height_ ) )
+    return false;
+
+  addDirtyRect( x_, y_, width_, height_ );
+
+  const int rowSize = width_ * m_bytesPerPixel;
+  unsigned char * dest = m_drawBase + y_ * m_pitch + x_ * m_bytesPerPixel;
+  const unsigned char * sour = m_underBuf;
+  for ( int i = 0; i < height_; i++ )
+  {
+    memcpy( dest, sour, rowSize );
+    dest += m_pitch;
+    sour += rowSize;
+  }
+
+  (void)damage();
   return true;
 }
 //-----------------------------------------------------------------------------
@@ -268,15 +526,56 @@ bool OskCanvas_Psp::Clear
   int height_
 )
 {
+  addDirtyRect( x_, y_, width_, height_ );
+
   // Clear the drawing area first
-  unsigned long * dest = m_vramBase + y_ * m_virtualWidth + x_;
+  const int rowSize = width_ * m_bytesPerPixel;
+  unsigned char * dest = m_drawBase + y_ * m_pitch + x_ * m_bytesPerPixel;
+  for ( int i = 0; i < height_; i++ )
+  {
+    memset( dest, 0x0, rowSize );
+    dest += m_pitch;
+  }
+
+  OskMetrics::Count( OskMetrics::MET_Clears );
+  OskMetrics::Count( OskMetrics::MET_ClearBytes, rowSize * height_ );
+  (void)damage();
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskCanvas_Psp::Fill
+(
+  int x_,
+  int y_,
+  int width_,
+  int height_,
+  unsigned long color_
+)
+{
+  addDirtyRect( x_, y_, width_, height_ );
+
+  // A solid colour is never dithered, so one pixel serves the whole rect
+  const unsigned long pixel = m_format.Pack( color_, x_, y_, false );
+  unsigned char bytes[ 4 ];
+  for ( int b = 0; b < m_bytesPerPixel; b++ )
+  {
+    bytes[ b ] = (unsigned char)( pixel >> ( b * 8 ) );
+  }
+
+  const int rowSize = width_ * m_bytesPerPixel;
+  unsigned char * dest = m_drawBase + y_ * m_pitch + x_ * m_bytesPerPixel;
   for ( int i = 0; i < height_; i++ )
   {
-    memset( dest, 0x0, width_ << 2 );
-    dest += m_virtualWidth;
+    for ( int j = 0; j < rowSize; j += m_bytesPerPixel )
+    {
+      memcpy( dest + j, bytes, m_bytesPerPixel );
+    }
+    dest += m_pitch;
   }
 
-  (void)flush();
+  OskMetrics::Count( OskMetrics::MET_Clears );
+  OskMetrics::Count( OskMetrics::MET_ClearBytes, rowSize * height_ );
+  (void)damage();
   return true;
 }
 //-----------------------------------------------------------------------------
@@ -291,196 +590,195 @@ bool OskCanvas_Psp::DrawImage
   int height_
 )
 {
-  const int imgWidth = img_.GetWidth();
-  unsigned long * dest = m_vramBase + destY_ * m_virtualWidth + destX_;
-  const unsigned long * sour = (const unsigned long *)img_.GetData() +
-                               sourY_ * imgWidth + sourX_;
+  if ( img_.GetBytesPerPixel() != m_bytesPerPixel )
+  {
+    DBG(( "OSK: Image %d is not in the framebuffer format\n", img_.GetId() ));
+    return false;
+  }
+
+  addDirtyRect( destX_, destY_, width_, height_ );
+
+  const int rowSize = width_ * m_bytesPerPixel;
+  const int imgPitch = img_.GetWidth() * m_bytesPerPixel;
+  unsigned char * dest = m_drawBase + destY_ * m_pitch +
+                         destX_ * m_bytesPerPixel;
+  const unsigned char * sour = (const unsigned char *)img_.GetData() +
+                               sourY_ * imgPitch + sourX_ * m_bytesPerPixel;
 
   for ( int i = 0; i < height_; i++ )
   {
-    memcpy( dest, sour, width_ << 2 );
-    dest += m_virtualWidth;
-    sour += imgWidth;
+    memcpy( dest, sour, rowSize );
+    dest += m_pitch;
+    sour += imgPitch;
   }
 
-  (void)flush();
+  OskMetrics::Count( OskMetrics::MET_Blits );
+  OskMetrics::Count( OskMetrics::MET_BlitBytes, rowSize * height_ );
+  (void)damage();
   return true;
 }
 //-----------------------------------------------------------------------------
 bool OskCanvas_Psp::GetBits(void * buf_, int & size_)
 {
-  const int size = m_width * m_height * sizeof( unsigned long );
+  const int size = m_width * m_height * sizeof( OskPixel32 );
 
   if ( m_vramBase == NULL || buf_ == NULL || size_ < size )
     return false;
 
-  unsigned long * dest = (unsigned long *)buf_;
-  unsigned long * sour = m_vramBase;
-
+  OskPixel32 * dest = (OskPixel32 *)buf_;
   for ( int i = 0; i < m_height; i++ )
   {
-    for ( int j = 0; j < m_width; j++ )
-      dest[ j ] = convertPixel( sour[ j ] );
-
+    (void)GetRow( i, dest );
     dest += m_width;
-    sour += m_virtualWidth;
   }
 
   size_ = size;
   return true;
 }
 //-----------------------------------------------------------------------------
-unsigned long OskCanvas_Psp::convertPixel(unsigned long color_)
+bool OskCanvas_Psp::GetRow(int y_, OskPixel32 * buf_)
 {
-  return ( ( color_ & 0xff000000 ) |
-         ( ( color_ & 0x00ff0000 ) >> 16 ) |
-           ( color_ & 0x0000ff00 ) |
-         ( ( color_ & 0x000000ff ) << 16 ) );
-}
-//-----------------------------------------------------------------------------
-bool OskCanvas_Psp::flush()
-{
-  if ( m_fbFd < 0 )
-  {
+  if ( m_vramBase == NULL || buf_ == NULL || y_ < 0 || y_ >= m_height )
     return false;
-  }
-
-  return ( fsync( m_fbFd ) == 0 );
-}
 
-
-//-----------------------------------------------------------------------------
-// Class: OskInput_Psp
-//-----------------------------------------------------------------------------
-OskInput_Psp::OskInput_Psp()
-  : OskInput(),
-    m_joypadFd( -1 )
-{
+  // Always the page the console draws into
+  m_format.UnpackRow( buf_, m_vramBase + y_ * m_pitch, m_width );
+  return true;
 }
 //-----------------------------------------------------------------------------
-OskInput_Psp::~OskInput_Psp()
+bool OskCanvas_Psp::CopyVisible(void * buf_, int size_)
 {
-  if ( m_joypadFd >= 0 )
+  const int rowSize = m_width * m_bytesPerPixel;
+
+  if ( m_vramBase == NULL || buf_ == NULL || size_ < rowSize * m_height )
+    return false;
+
+  // Raw pixels, packed; converting them is left to whoever reads them
+  unsigned char * dest = (unsigned char *)buf_;
+  const unsigned char * sour = m_vramBase;
+  for ( int i = 0; i < m_height; i++ )
   {
-    (void)close( m_joypadFd );
-    m_joypadFd = -1;
+    memcpy( dest, sour, rowSize );
+    dest += rowSize;
+    sour += m_pitch;
   }
+
+  return true;
 }
 //-----------------------------------------------------------------------------
-bool OskInput_Psp::Initialize(void * param_)
+bool OskCanvas_Psp::flush()
 {
-  m_joypadFd = open( c_joypadDevName, O_RDONLY );
-  if ( m_joypadFd < 0 )
+  if ( m_fbFd < 0 )
   {
-    DBG(( "OSK: Failed to open device for input, err=%d\n", m_joypadFd ));
     return false;
   }
 
-  return true;
+  OskMetrics::Count( OskMetrics::MET_Flushes );
+  OskMetrics::Count( OskMetrics::MET_FbSyscalls );
+  return ( fsync( m_fbFd ) == 0 );
 }
 //-----------------------------------------------------------------------------
-unsigned long OskInput_Psp::ReadKeys()
+void OskCanvas_Psp::addDirtyRect(int x_, int y_, int width_, int height_)
 {
-  if ( m_joypadFd < 0 )
-  {
-    DBG(( "OSK: Invalid device to read\n" ));
-    return 0;
-  }
+  if ( m_drawBase == m_vramBase || width_ <= 0 || height_ <= 0 )
+    return;
 
-  unsigned long keys;
-  int rt = read( m_joypadFd, &keys, sizeof( keys ) );
-  if ( rt < sizeof( keys ) )
+  if ( m_dirtyRight <= m_dirtyLeft || m_dirtyBottom <= m_dirtyTop )
   {
-    DBG(( "OSK: Failed to read device, err=%d\n", rt ));
-    return 0;
+    m_dirtyLeft = x_;
+    m_dirtyTop = y_;
+    m_dirtyRight = x_ + width_;
+    m_dirtyBottom = y_ + height_;
+    return;
   }
 
-  return keys;
-}
-
-
-//-----------------------------------------------------------------------------
-// Class: OskConsole_Psp
-//-----------------------------------------------------------------------------
-OskConsole_Psp::OskConsole_Psp()
-  : m_vcsFd( -1 )
-{
+  if ( x_ < m_dirtyLeft )                m_dirtyLeft = x_;
+  if ( y_ < m_dirtyTop )                 m_dirtyTop = y_;
+  if ( x_ + width_ > m_dirtyRight )      m_dirtyRight = x_ + width_;
+  if ( y_ + height_ > m_dirtyBottom )    m_dirtyBottom = y_ + height_;
 }
 //-----------------------------------------------------------------------------
-OskConsole_Psp::~OskConsole_Psp()
+void OskCanvas_Psp::copyRect
+(
+  unsigned char * dest_,
+  const unsigned char * sour_,
+  int x_,
+  int y_,
+  int width_,
+  int height_
+)
 {
-  if ( m_vcsFd >= 0 )
+  const int offset = y_ * m_pitch + x_ * m_bytesPerPixel;
+  const int rowSize = width_ * m_bytesPerPixel;
+  dest_ += offset;
+  sour_ += offset;
+
+  for ( int i = 0; i < height_; i++ )
   {
-    (void)close( m_vcsFd );
-    m_vcsFd = -1;
+    memcpy( dest_, sour_, rowSize );
+    dest_ += m_pitch;
+    sour_ += m_pitch;
   }
 }
 //-----------------------------------------------------------------------------
-bool OskConsole_Psp::Initialize(void * param_)
+void OskCanvas_Psp::syncBackPage(int x_, int y_, int width_, int height_)
 {
-  m_vcsFd = open( c_vcsDevName, O_RDONLY );
-  if ( m_vcsFd < 0 )
-  {
-    DBG(( "OSK: Failed to open device for console, err=%d\n", m_vcsFd ));
-    return false;
-  }
-
-  return true;
+  copyRect( m_drawBase, m_vramBase, x_, y_, width_, height_ );
+  OskMetrics::Count( OskMetrics::MET_Blits );
+  OskMetrics::Count( OskMetrics::MET_BlitBytes,
+                     width_ * height_ * m_bytesPerPixel );
 }
 //-----------------------------------------------------------------------------
-bool OskConsole_Psp::SendKey(int key_)
+bool OskCanvas_Psp::panTo(int page_)
 {
-  if ( m_vcsFd < 0 )
-  {
-    DBG(( "OSK: Invalid device to send key\n" ));
-    return false;
-  }
+  if ( m_displayPage == page_ )
+    return true;
 
-  char * c = (char *)&key_;
-  for ( int i = 0; i < sizeof( key_ ); i++ )
+  if ( !m_fileBacked )
   {
-    if ( c[ i ] == 0 )
-      continue;
-
-    int rt = ioctl( m_vcsFd, PSP_VCS_IOCTL_PUTCHAR, (int)( c[ i ] ) );
+    m_vinfo.yoffset = page_ * m_height;
+    OskMetrics::Count( OskMetrics::MET_FbSyscalls );
+    int rt = ioctl( m_fbFd, FBIOPAN_DISPLAY, &m_vinfo );
     if ( rt < 0 )
     {
-      DBG(( "OSK: Failed to send key %08x, err=%d\n", key_, rt ));
+      DBG(( "OSK: Failed to pan display to page %d, err=%d\n", page_, rt ));
       return false;
     }
-  } // end for
+  }
 
+  m_displayPage = page_;
+  m_numPageFlips++;
+  OskMetrics::Count( OskMetrics::MET_PageFlips );
   return true;
 }
 //-----------------------------------------------------------------------------
-int OskConsole_Psp::ChangeConsole(int con_)
+bool OskCanvas_Psp::present()
 {
-  if ( m_vcsFd < 0 )
-  {
-    DBG(( "OSK: Invalid device to change console\n" ));
-    return -1;
-  }
+  if ( m_drawBase == m_vramBase )
+    return OskCanvas::present();
 
-  int rt = ioctl( m_vcsFd, PSP_VCS_IOCTL_CHANGE_CON, con_ );
-  if ( rt < 0 )
-  {
-    DBG(( "OSK: Failed to change console to %d, err=%d\n", con_, rt ));
-    return rt;
-  }
+  if ( m_dirtyRight <= m_dirtyLeft || m_dirtyBottom <= m_dirtyTop )
+    return true;
 
-  return rt;
-}
-//-----------------------------------------------------------------------------
-bool OskConsole_Psp::Update()
-{
-  int rt = ioctl( m_vcsFd, PSP_VCS_IOCTL_UPDATE_SCR );
-  if ( rt < 0 )
+  // Show the finished frame, then bring the front page up to date behind
+  // it and switch back. The console only ever draws into the front page,
+  // so that is where the display has to rest between frames.
+  if ( !panTo( 1 ) )
   {
-    DBG(( "OSK: Failed to update screen, err=%d\n", rt ));
-    return false;
+    // Fall back to drawing in place from now on
+    m_pageFlip = false;
   }
 
-  return true;
+  const int width = m_dirtyRight - m_dirtyLeft;
+  const int height = m_dirtyBottom - m_dirtyTop;
+  copyRect( m_vramBase, m_drawBase, m_dirtyLeft, m_dirtyTop, width, height );
+  OskMetrics::Count( OskMetrics::MET_Blits );
+  OskMetrics::Count( OskMetrics::MET_BlitBytes,
+                     width * height * m_bytesPerPixel );
+
+  // One flush for both pages, before the front page is shown again
+  const bool rt = doFlush();
+  return panTo( 0 ) && rt;
 }
 
 
@@ -496,16 +794,6 @@ OskCanvas * OskFactory::CreateCanvas()
 {
   return new OskCanvas_Psp();
 }
-//-----------------------------------------------------------------------------
-OskInput * OskFactory::CreateInput()
-{
-  return new OskInput_Psp();
-}
-//-----------------------------------------------------------------------------
-OskConsole * OskFactory::CreateConsole()
-{
-  return new OskConsole_Psp();
-}
 
 
 //-----------------------------------------------------------------------------
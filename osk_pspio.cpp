@@ -0,0 +1,318 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+
+
+//-----------------------------------------------------------------------------
+// Classes
+//-----------------------------------------------------------------------------
+class OskInput_Psp;
+class OskConsole_Psp;
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const char c_joypadDevName[]         = "/dev/joypad";
+static const char c_vcsDevName[]            = "/dev/vcs";
+static const int PSP_VCS_IOCTL_PUTCHAR      = 101;
+static const int PSP_VCS_IOCTL_CHANGE_CON   = 107;
+static const int PSP_VCS_IOCTL_UPDATE_SCR   = 108;
+
+// How often a joypad driver without poll support is read for a new word
+static const unsigned long JoypadRetryInterval = 10000;   // in us
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Psp
+//-----------------------------------------------------------------------------
+class OskInput_Psp : public OskInput
+{
+public:
+  OskInput_Psp();
+  virtual ~OskInput_Psp();
+
+  virtual bool Initialize(void * param_);
+  virtual unsigned long ReadKeys();
+
+  // Not once the driver turned out not to support poll
+  virtual int GetFd()
+  {
+    return m_pollable ? m_joypadFd : -1;
+  }
+
+  virtual bool WaitForKeys(int timeout_);
+
+protected:
+  bool readWord();
+
+  int m_joypadFd;
+  bool m_pollable;
+  bool m_pending;           // m_keys is read but not yet handed out
+  unsigned long m_keys;
+
+private:
+  // Not implemented
+  OskInput_Psp(const OskInput_Psp &);
+  OskInput_Psp & operator = (const OskInput_Psp &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskConsole_Psp
+//-----------------------------------------------------------------------------
+class OskConsole_Psp : public OskConsole
+{
+public:
+  OskConsole_Psp();
+  virtual ~OskConsole_Psp();
+
+  virtual bool Initialize(void * param_);
+  virtual int ChangeConsole(int con_);
+  virtual bool Update();
+
+protected:
+  virtual bool write(const char * bytes_, int count_);
+
+  int m_vcsFd;
+
+private:
+  // Not implemented
+  OskConsole_Psp(const OskConsole_Psp &);
+  OskConsole_Psp & operator = (const OskConsole_Psp &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Psp
+//-----------------------------------------------------------------------------
+OskInput_Psp::OskInput_Psp()
+  : OskInput(),
+    m_joypadFd( -1 ),
+    m_pollable( true ),
+    m_pending( false ),
+    m_keys( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+OskInput_Psp::~OskInput_Psp()
+{
+  if ( m_joypadFd >= 0 )
+  {
+    (void)close( m_joypadFd );
+    m_joypadFd = -1;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Psp::Initialize(void * param_)
+{
+  // Never blocks, so a driver that polls as always readable can be told
+  // from one that has a word
+  m_joypadFd = open( c_joypadDevName, O_RDONLY | O_NONBLOCK );
+  if ( m_joypadFd < 0 )
+  {
+    DBG(( "OSK: Failed to open device for input, err=%d\n", m_joypadFd ));
+    return false;
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+unsigned long OskInput_Psp::ReadKeys()
+{
+  if ( m_joypadFd < 0 )
+  {
+    DBG(( "OSK: Invalid device to read\n" ));
+    return 0;
+  }
+
+  // Blocks as the plain read() did for a caller that did not wait first
+  while ( !m_pending )
+  {
+    (void)WaitForKeys( -1 );
+  }
+
+  m_pending = false;
+  return m_keys;
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Psp::WaitForKeys(int timeout_)
+{
+  if ( m_pending || m_joypadFd < 0 )
+    return true;
+
+  if ( m_pollable )
+  {
+    if ( !OskInput::WaitForKeys( timeout_ ) )
+      return false;
+
+    if ( readWord() )
+      return true;
+
+    // Readable with nothing to read: the driver has no poll support and
+    // has to be asked over and over instead
+    DBG(( "OSK: The joypad can not be polled, reading it every %lu us\n",
+          JoypadRetryInterval ));
+    m_pollable = false;
+  }
+
+  // Never past the timeout, so the timers still run on time
+  const unsigned long start = OskClock::Now();
+  for ( ;; )
+  {
+    if ( readWord() )
+      return true;
+
+    unsigned long wait = JoypadRetryInterval;
+    if ( timeout_ >= 0 )
+    {
+      const unsigned long elapsed = OskClock::Now() - start;
+      const unsigned long limit = (unsigned long)timeout_ * 1000;
+      if ( elapsed >= limit )
+        return false;
+
+      if ( limit - elapsed < wait )
+        wait = limit - elapsed;
+    }
+
+    (void)usleep( wait );
+  } // end for
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Psp::readWord()
+{
+  // The driver hands out 32-bit words, whatever the size of a long
+  unsigned int keys;
+  const int rt = read( m_joypadFd, &keys, sizeof( keys ) );
+  if ( rt < 0 && ( errno == EAGAIN || errno == EINTR ) )
+    return false;
+
+  if ( rt < (int)sizeof( keys ) )
+  {
+    // Handed out as a release, as the blocking read did
+    DBG(( "OSK: Failed to read device, err=%d\n", rt ));
+    keys = 0;
+  }
+
+  m_keys = keys;
+  m_pending = true;
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskConsole_Psp
+//-----------------------------------------------------------------------------
+OskConsole_Psp::OskConsole_Psp()
+  : OskConsole(),
+    m_vcsFd( -1 )
+{
+}
+//-----------------------------------------------------------------------------
+OskConsole_Psp::~OskConsole_Psp()
+{
+  if ( m_vcsFd >= 0 )
+  {
+    (void)close( m_vcsFd );
+    m_vcsFd = -1;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskConsole_Psp::Initialize(void * param_)
+{
+  m_vcsFd = open( c_vcsDevName, O_RDONLY );
+  if ( m_vcsFd < 0 )
+  {
+    DBG(( "OSK: Failed to open device for console, err=%d\n", m_vcsFd ));
+    return false;
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskConsole_Psp::write(const char * bytes_, int count_)
+{
+  if ( m_vcsFd < 0 )
+  {
+    DBG(( "OSK: Invalid device to send key\n" ));
+    return false;
+  }
+
+  // The VCS driver only takes a byte at a time
+  for ( int i = 0; i < count_; i++ )
+  {
+    OskMetrics::Count( OskMetrics::MET_ConsoleBytes );
+    OskMetrics::Count( OskMetrics::MET_ConsoleSyscalls );
+    int rt = ioctl( m_vcsFd, PSP_VCS_IOCTL_PUTCHAR, (int)( bytes_[ i ] ) );
+    if ( rt < 0 )
+    {
+      DBG(( "OSK: Failed to send key byte %02x, err=%d\n",
+            (unsigned char)bytes_[ i ], rt ));
+      return false;
+    }
+  } // end for
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+int OskConsole_Psp::ChangeConsole(int con_)
+{
+  if ( m_vcsFd < 0 )
+  {
+    DBG(( "OSK: Invalid device to change console\n" ));
+    return -1;
+  }
+
+  OskMetrics::Count( OskMetrics::MET_ConsoleSwitches );
+  OskMetrics::Count( OskMetrics::MET_ConsoleSyscalls );
+  int rt = ioctl( m_vcsFd, PSP_VCS_IOCTL_CHANGE_CON, con_ );
+  if ( rt < 0 )
+  {
+    DBG(( "OSK: Failed to change console to %d, err=%d\n", con_, rt ));
+    return rt;
+  }
+
+  return rt;
+}
+//-----------------------------------------------------------------------------
+bool OskConsole_Psp::Update()
+{
+  OskMetrics::Count( OskMetrics::MET_ConsoleUpdates );
+  OskMetrics::Count( OskMetrics::MET_ConsoleSyscalls );
+  int rt = ioctl( m_vcsFd, PSP_VCS_IOCTL_UPDATE_SCR );
+  if ( rt < 0 )
+  {
+    DBG(( "OSK: Failed to update screen, err=%d\n", rt ));
+    return false;
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskFactory
+//-----------------------------------------------------------------------------
+OskInput * OskFactory::createPlatformInput()
+{
+  return new OskInput_Psp();
+}
+//-----------------------------------------------------------------------------
+OskConsole * OskFactory::CreateConsole()
+{
+  return new OskConsole_Psp();
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,280 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+// Host stand-ins for the PSP joypad and console devices, linked instead of
+// osk_pspio.o so OSK can run and be measured on an ordinary Linux box. The
+// framebuffer side needs nothing extra, OSK_FBDEV already points the canvas
+// at a plain file.
+//
+//   OSK_SIM_INPUT    File or FIFO of 32-bit joypad words
+//   OSK_SIM_CONSOLE  File the typed characters are appended to, or "pty"
+//                    for a pseudo terminal; unset or "-" discards them
+//   OSK_SIM_TICK     Microseconds the clock moves per joypad word; the
+//                    clock is manual when set, so runs are repeatable
+//-----------------------------------------------------------------------------
+#include "osk.h"
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+
+
+//-----------------------------------------------------------------------------
+// Classes
+//-----------------------------------------------------------------------------
+class OskInput_Sim;
+class OskConsole_Sim;
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const char c_simInputEnv[]           = "OSK_SIM_INPUT";
+static const char c_simConsoleEnv[]         = "OSK_SIM_CONSOLE";
+static const char c_simTickEnv[]            = "OSK_SIM_TICK";
+static const char c_simConsolePty[]         = "pty";
+static const char c_simConsoleNone[]        = "-";
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Sim
+//
+// Joypad words from a file or FIFO, in the same native 32-bit layout the
+// PSP driver hands out. The end of the file ends the run.
+//-----------------------------------------------------------------------------
+class OskInput_Sim : public OskInput
+{
+public:
+  OskInput_Sim();
+  virtual ~OskInput_Sim();
+
+  virtual bool Initialize(void * param_);
+  virtual unsigned long ReadKeys();
+
+  virtual bool IsEnd()
+  {
+    return m_end;
+  }
+
+  virtual int GetFd()
+  {
+    return m_inputFd;
+  }
+
+protected:
+  int m_inputFd;
+  bool m_end;
+
+private:
+  // Not implemented
+  OskInput_Sim(const OskInput_Sim &);
+  OskInput_Sim & operator = (const OskInput_Sim &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskConsole_Sim
+//
+// Typed characters go to a capture file or a pseudo terminal, each batch
+// OskConsole::Flush() hands over in one write.
+//-----------------------------------------------------------------------------
+class OskConsole_Sim : public OskConsole
+{
+public:
+  OskConsole_Sim();
+  virtual ~OskConsole_Sim();
+
+  virtual bool Initialize(void * param_);
+  virtual int ChangeConsole(int con_);
+  virtual bool Update();
+
+protected:
+  virtual bool write(const char * bytes_, int count_);
+
+  int m_outputFd;
+
+private:
+  // Not implemented
+  OskConsole_Sim(const OskConsole_Sim &);
+  OskConsole_Sim & operator = (const OskConsole_Sim &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Sim
+//-----------------------------------------------------------------------------
+OskInput_Sim::OskInput_Sim()
+  : OskInput(),
+    m_inputFd( -1 ),
+    m_end( false )
+{
+}
+//-----------------------------------------------------------------------------
+OskInput_Sim::~OskInput_Sim()
+{
+  if ( m_inputFd >= 0 )
+  {
+    (void)close( m_inputFd );
+    m_inputFd = -1;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Sim::Initialize(void * param_)
+{
+  const char * inputName = getenv( c_simInputEnv );
+  if ( inputName == NULL || *inputName == 0 )
+  {
+    DBG(( "OSK: %s is not set\n", c_simInputEnv ));
+    return false;
+  }
+
+  // Opening a FIFO blocks here until the other side is there
+  m_inputFd = open( inputName, O_RDONLY );
+  if ( m_inputFd < 0 )
+  {
+    DBG(( "OSK: Failed to open %s for input, err=%d\n", inputName, m_inputFd ));
+    return false;
+  }
+
+  const char * tick = getenv( c_simTickEnv );
+  if ( tick != NULL && *tick != 0 )
+  {
+    OskClock::SetManual( true, strtoul( tick, NULL, 0 ) );
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+unsigned long OskInput_Sim::ReadKeys()
+{
+  if ( m_inputFd < 0 || m_end )
+  {
+    return 0;
+  }
+
+  unsigned int keys;
+  int rt = read( m_inputFd, &keys, sizeof( keys ) );
+  if ( rt < (int)sizeof( keys ) )
+  {
+    // End of file, or the writer of the FIFO went away
+    m_end = true;
+    return 0;
+  }
+
+  return keys;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskConsole_Sim
+//-----------------------------------------------------------------------------
+OskConsole_Sim::OskConsole_Sim()
+  : OskConsole(),
+    m_outputFd( -1 )
+{
+}
+//-----------------------------------------------------------------------------
+OskConsole_Sim::~OskConsole_Sim()
+{
+  if ( m_outputFd >= 0 )
+  {
+    (void)close( m_outputFd );
+    m_outputFd = -1;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskConsole_Sim::Initialize(void * param_)
+{
+  const char * outputName = getenv( c_simConsoleEnv );
+  if ( outputName == NULL || *outputName == 0 ||
+       strcmp( outputName, c_simConsoleNone ) == 0 )
+  {
+    return true;
+  }
+
+  if ( strcmp( outputName, c_simConsolePty ) == 0 )
+  {
+    m_outputFd = posix_openpt( O_RDWR | O_NOCTTY );
+    if ( m_outputFd < 0 ||
+         grantpt( m_outputFd ) < 0 ||
+         unlockpt( m_outputFd ) < 0 )
+    {
+      DBG(( "OSK: Failed to open a pseudo terminal for console\n" ));
+      return false;
+    }
+
+    // Whoever attaches to the slave side sees what is typed
+    fprintf( stderr, "OSK: Console is %s\n", ptsname( m_outputFd ) );
+    return true;
+  }
+
+  m_outputFd = open( outputName, O_WRONLY | O_CREAT | O_APPEND, 0644 );
+  if ( m_outputFd < 0 )
+  {
+    DBG(( "OSK: Failed to open %s for console, err=%d\n", outputName, m_outputFd ));
+    return false;
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskConsole_Sim::write(const char * bytes_, int count_)
+{
+  if ( m_outputFd < 0 )
+  {
+    return true;
+  }
+
+  // The whole batch in one call, as a tty or pipe would take it
+  while ( count_ > 0 )
+  {
+    OskMetrics::Count( OskMetrics::MET_ConsoleSyscalls );
+    int rt = ::write( m_outputFd, bytes_, count_ );
+    if ( rt <= 0 )
+    {
+      DBG(( "OSK: Failed to send %d key bytes, err=%d\n", count_, rt ));
+      return false;
+    }
+
+    OskMetrics::Count( OskMetrics::MET_ConsoleBytes, rt );
+    bytes_ += rt;
+    count_ -= rt;
+  } // end while
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+int OskConsole_Sim::ChangeConsole(int con_)
+{
+  OskMetrics::Count( OskMetrics::MET_ConsoleSwitches );
+  return con_;
+}
+//-----------------------------------------------------------------------------
+bool OskConsole_Sim::Update()
+{
+  OskMetrics::Count( OskMetrics::MET_ConsoleUpdates );
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskFactory
+//-----------------------------------------------------------------------------
+OskInput * OskFactory::createPlatformInput()
+{
+  return new OskInput_Sim();
+}
+//-----------------------------------------------------------------------------
+OskConsole * OskFactory::CreateConsole()
+{
+  return new OskConsole_Sim();
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,244 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+// A stick nibble n is taken as the middle of its step, n * 16 + 8, so the
+// nominal centre is 128 and full travel is 128 either way
+static const int NominalCentre = 128;
+static const int FullTravel = 128;
+
+// Past this, the stick was not resting while we calibrated
+static const int MaxCentreOffset = 48;
+
+// Angles are in 1/256 of a turn, starting from left and going clockwise
+// on screen, so that sector n is centred on n * SectorWidth
+static const int SectorWidth = 32;
+
+// atan( i / 32 ), in 1/256 of a turn
+static const unsigned char s_atanTable[ 33 ] =
+{
+   0,  1,  3,  4,  5,  6,  8,  9, 10, 11, 12, 13, 15, 16, 17, 18,
+  19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 29, 29, 30, 31, 31,
+  32,
+};
+
+// Sector to position, in the order of the angles
+static const OskCore::OskAnalogPos s_sectorPos[ 8 ] =
+{
+  OskCore::ANALOG_POS_LEFT,
+  OskCore::ANALOG_POS_UPLEFT,
+  OskCore::ANALOG_POS_UP,
+  OskCore::ANALOG_POS_UPRIGHT,
+  OskCore::ANALOG_POS_RIGHT,
+  OskCore::ANALOG_POS_DOWNRIGHT,
+  OskCore::ANALOG_POS_DOWN,
+  OskCore::ANALOG_POS_DOWNLEFT,
+};
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+static int absInt(int value_)
+{
+  return ( value_ < 0 ) ? -value_ : value_;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskCore::AnalogStick
+//-----------------------------------------------------------------------------
+OskCore::AnalogStick::AnalogStick()
+  : m_deadzone( 0 ),
+    m_margin( 0 ),
+    m_angleMargin( 0 ),
+    m_centreX( NominalCentre ),
+    m_centreY( NominalCentre ),
+    m_numSamples( 0 ),
+    m_sumX( 0 ),
+    m_sumY( 0 ),
+    m_minX( 0 ),
+    m_maxX( 0 ),
+    m_minY( 0 ),
+    m_maxY( 0 ),
+    m_pos( ANALOG_POS_CENTER ),
+    m_rawPos( ANALOG_POS_CENTER )
+{
+}
+//-----------------------------------------------------------------------------
+void OskCore::AnalogStick::Configure
+(
+  int deadzone_,
+  int margin_,
+  int angleMargin_
+)
+{
+  m_deadzone = deadzone_ * FullTravel / 100;
+  m_margin = margin_ * FullTravel / 100;
+  if ( m_margin > m_deadzone )
+  {
+    m_margin = m_deadzone;
+  }
+
+  // Never so wide that a sector can not be left
+  m_angleMargin = angleMargin_ * 256 / 360;
+  if ( m_angleMargin > SectorWidth / 2 )
+  {
+    m_angleMargin = SectorWidth / 2;
+  }
+}
+//-----------------------------------------------------------------------------
+OskCore::OskAnalogPos OskCore::AnalogStick::Update(unsigned long keys_)
+{
+  const int x = (int)( ( keys_ >> 24 ) & 0xf ) * 16 + 8;
+  const int y = (int)( ( keys_ >> 28 ) & 0xf ) * 16 + 8;
+
+  if ( m_numSamples < CalibrationSamples )
+  {
+    calibrate( x, y );
+  }
+
+  const int dx = x - m_centreX;
+  const int dy = y - m_centreY;
+  const int r2 = dx * dx + dy * dy;
+  const int angle = angleOf( dx, dy );
+  const int sector = ( ( angle + SectorWidth / 2 ) / SectorWidth ) & 7;
+
+  // Where the stick is, as the fixed thresholds would see it
+  const OskAnalogPos rawPos = ( r2 >= m_deadzone * m_deadzone )
+                                ? s_sectorPos[ sector ]
+                                : ANALOG_POS_CENTER;
+
+  // Where we say it is: out of the centre at the deadzone, back only once
+  // inside it by the margin, and into another sector only once the margin
+  // past the boundary of the current one
+  OskAnalogPos pos = m_pos;
+  if ( m_pos == ANALOG_POS_CENTER )
+  {
+    pos = rawPos;
+  }
+  else
+  {
+    const int inner = m_deadzone - m_margin;
+    if ( r2 < inner * inner )
+    {
+      pos = ANALOG_POS_CENTER;
+    }
+    else
+    {
+      const int centre = ( (int)m_pos - (int)ANALOG_POS_LEFT ) * SectorWidth;
+      const int offset = ( ( angle - centre + 128 ) & 0xff ) - 128;
+      if ( absInt( offset ) > SectorWidth / 2 + m_angleMargin )
+      {
+        pos = s_sectorPos[ sector ];
+      }
+    }
+  }
+
+  // Each of these would have been a section change, and a redraw
+  if ( rawPos != m_rawPos && pos == m_pos )
+  {
+    OskMetrics::Count( OskMetrics::MET_AnalogSuppressed );
+  }
+
+  if ( pos != m_pos )
+  {
+    OskMetrics::Count( OskMetrics::MET_AnalogMoves );
+  }
+
+  m_rawPos = rawPos;
+  m_pos = pos;
+  return m_pos;
+}
+//-----------------------------------------------------------------------------
+void OskCore::AnalogStick::calibrate(int x_, int y_)
+{
+  // Only what looks like a resting stick counts; the stick works off the
+  // nominal centre meanwhile, so nothing waits for calibration
+  if ( absInt( x_ - NominalCentre ) >= m_deadzone ||
+       absInt( y_ - NominalCentre ) >= m_deadzone )
+    return;
+
+  if ( m_numSamples == 0 )
+  {
+    m_minX = m_maxX = x_;
+    m_minY = m_maxY = y_;
+  }
+
+  m_sumX += x_;
+  m_sumY += y_;
+  if ( x_ < m_minX ) m_minX = x_;
+  if ( x_ > m_maxX ) m_maxX = x_;
+  if ( y_ < m_minY ) m_minY = y_;
+  if ( y_ > m_maxY ) m_maxY = y_;
+
+  if ( ++m_numSamples < CalibrationSamples )
+    return;
+
+  const int centreX = m_sumX / CalibrationSamples;
+  const int centreY = m_sumY / CalibrationSamples;
+  if ( absInt( centreX - NominalCentre ) > MaxCentreOffset ||
+       absInt( centreY - NominalCentre ) > MaxCentreOffset )
+  {
+    DBG(( "OSK: Analog stick not at rest, keeping the nominal centre\n" ));
+    return;
+  }
+
+  m_centreX = centreX;
+  m_centreY = centreY;
+
+  // A noisy stick gets a deadzone wide enough to hide its noise
+  int noise = m_maxX - m_minX;
+  if ( m_maxY - m_minY > noise )
+  {
+    noise = m_maxY - m_minY;
+  }
+
+  if ( noise + m_margin > m_deadzone )
+  {
+    m_deadzone = noise + m_margin;
+  }
+
+  DBG(( "OSK: Analog centre %d,%d, noise %d, deadzone %d\n",
+        m_centreX, m_centreY, noise, m_deadzone ));
+}
+//-----------------------------------------------------------------------------
+int OskCore::AnalogStick::angleOf(int dx_, int dy_)
+{
+  if ( dx_ == 0 && dy_ == 0 )
+    return 0;
+
+  // Within the first octant from the table, then mirrored out of it
+  const int ax = absInt( dx_ );
+  const int ay = absInt( dy_ );
+  int angle = ( ay <= ax )
+                ? s_atanTable[ ( ay * 32 + ax / 2 ) / ax ]
+                : 64 - s_atanTable[ ( ax * 32 + ay / 2 ) / ay ];
+
+  // Measured from left, clockwise on screen, where y grows downwards
+  if ( dx_ > 0 )
+  {
+    angle = 128 - angle;
+  }
+
+  if ( dy_ > 0 )
+  {
+    angle = 256 - angle;
+  }
+
+  return angle & 0xff;
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
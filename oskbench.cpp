@@ -0,0 +1,550 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include <unistd.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include "osk.h"
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const char c_benchFbName[]           = "/tmp/oskbench.fb";
+static const char c_benchFbGeometry[]       = "480x272x32";
+static const char c_benchLayoutName[]       = "/tmp/oskbench.layout";
+static const char c_benchRecordingName[]    = "/tmp/oskbench.rec";
+static const long c_benchFbSize             = 480 * 272 * 4 * 2;
+static const int c_sectionRounds            = 20000;
+static const int c_maxFlagsLength           = 64;
+static const int c_reapWait                 = 10000;    // in us
+static const int c_reapTries                = 200;
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+// The if-cascade OskCore::ResolveSection() replaced, kept as the reference
+static OskKeySectionId resolveByCascade
+(
+  unsigned long flags_,
+  OskCore::OskAnalogPos pos_,
+  unsigned long & keys_
+)
+{
+  static const struct
+  {
+    unsigned long         dpad;
+    OskCore::OskAnalogPos pos;
+    OskKeySectionId       section;
+  } c_rules[] =
+  {
+    { OskInput::KEY_ARROW_UP | OskInput::KEY_ARROW_LT,
+      OskCore::ANALOG_POS_UPLEFT,    KSID_TopLeft },
+    { OskInput::KEY_ARROW_UP | OskInput::KEY_ARROW_RT,
+      OskCore::ANALOG_POS_UPRIGHT,   KSID_TopRight },
+    { OskInput::KEY_ARROW_DN | OskInput::KEY_ARROW_LT,
+      OskCore::ANALOG_POS_DOWNLEFT,  KSID_BottomLeft },
+    { OskInput::KEY_ARROW_DN | OskInput::KEY_ARROW_RT,
+      OskCore::ANALOG_POS_DOWNRIGHT, KSID_BottomRight },
+    { OskInput::KEY_ARROW_UP, OskCore::ANALOG_POS_UP,    KSID_Top },
+    { OskInput::KEY_ARROW_DN, OskCore::ANALOG_POS_DOWN,  KSID_Bottom },
+    { OskInput::KEY_ARROW_LT, OskCore::ANALOG_POS_LEFT,  KSID_Left },
+    { OskInput::KEY_ARROW_RT, OskCore::ANALOG_POS_RIGHT, KSID_Right },
+  };
+
+  for ( unsigned int i = 0; i < sizeof( c_rules ) / sizeof( c_rules[ 0 ] ); i++ )
+  {
+    if ( ( ( flags_ & OskCore::FLAGS_USE_DPAD ) &&
+           ( keys_ & c_rules[ i ].dpad ) == c_rules[ i ].dpad ) ||
+         ( ( flags_ & OskCore::FLAGS_USE_ANALOG ) &&
+           pos_ == c_rules[ i ].pos ) )
+    {
+      keys_ &= ~c_rules[ i ].dpad;
+      return c_rules[ i ].section;
+    }
+  }
+
+  return KSID_Center;
+}
+//-----------------------------------------------------------------------------
+// Checks the section table against the cascade on every input, then times
+// both
+static int benchSections()
+{
+  // Face buttons and the stick nibbles ride along, and must be left alone
+  static const unsigned long c_otherKeys[] =
+  {
+    0,
+    OskInput::KEY_CIRCLE | OskInput::KEY_RTRG,
+    0xf8f000f0,
+  };
+
+  unsigned long numChecked = 0;
+  for ( unsigned long flags = 0; flags < 4; flags++ )
+  {
+    for ( int pos = 0; pos < OskCore::ANALOG_POS_Count; pos++ )
+    {
+      for ( unsigned long dpad = 0; dpad < 16; dpad++ )
+      {
+        for ( unsigned int k = 0; k < sizeof( c_otherKeys ) / sizeof( c_otherKeys[ 0 ] ); k++ )
+        {
+          unsigned long tableKeys = dpad | c_otherKeys[ k ];
+          unsigned long cascadeKeys = tableKeys;
+          const OskKeySectionId tableSection =
+              OskCore::ResolveSection( (OskCore::OskFlags)flags,
+                                       (OskCore::OskAnalogPos)pos,
+                                       tableKeys );
+          const OskKeySectionId cascadeSection =
+              resolveByCascade( flags, (OskCore::OskAnalogPos)pos, cascadeKeys );
+
+          if ( tableSection != cascadeSection || tableKeys != cascadeKeys )
+          {
+            printf( "sections: MISMATCH flags=%lu pos=%d keys=%08lx "
+                    "table=%d/%08lx cascade=%d/%08lx\n",
+                    flags, pos, dpad | c_otherKeys[ k ],
+                    tableSection, tableKeys, cascadeSection, cascadeKeys );
+            return -1;
+          }
+          numChecked++;
+        }
+      }
+    }
+  }
+
+  printf( "sections: %lu inputs identical\n", numChecked );
+
+  // Summed into a volatile so the compiler can not drop the lookups
+  volatile unsigned long sink = 0;
+  unsigned long elapsed[ 2 ];
+  for ( int method = 0; method < 2; method++ )
+  {
+    const unsigned long start = OskClock::Now();
+    for ( int round = 0; round < c_sectionRounds; round++ )
+    {
+      for ( int i = 0; i < OskCore::SectionTableSize; i++ )
+      {
+        const OskCore::OskFlags flags =
+            (OskCore::OskFlags)( i / ( OskCore::ANALOG_POS_Count * 16 ) );
+        const OskCore::OskAnalogPos pos =
+            (OskCore::OskAnalogPos)( ( i / 16 ) % OskCore::ANALOG_POS_Count );
+        unsigned long keys = (unsigned long)( i & 0xf );
+
+        sink += ( method == 0 ) ? OskCore::ResolveSection( flags, pos, keys )
+                                : resolveByCascade( flags, pos, keys );
+        sink += keys;
+      }
+    }
+    elapsed[ method ] = OskClock::Now() - start;
+  }
+
+  const double numLookups = (double)c_sectionRounds * OskCore::SectionTableSize;
+  printf( "sections: table=%.2f ns cascade=%.2f ns per lookup\n",
+          elapsed[ 0 ] * 1000.0 / numLookups,
+          elapsed[ 1 ] * 1000.0 / numLookups );
+  return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Loads a layout of one layer and the given chord line
+static bool loadChord(OskLayout & layout_, const char * chord_)
+{
+  static const char * const c_sections[ KSID_Count ] =
+  {
+    "TL", "T", "TR", "L", "C", "R", "BL", "B", "BR",
+  };
+
+  FILE * const file = fopen( c_benchLayoutName, "w" );
+  if ( file == NULL )
+  {
+    printf( "Can not create %s\n", c_benchLayoutName );
+    return false;
+  }
+
+  fprintf( file, "layer eng eng\n" );
+  for ( int i = 0; i < KSID_Count; i++ )
+  {
+    fprintf( file, "%s a b c d\n", c_sections[ i ] );
+  }
+  fprintf( file, "chord SELECT+START %s\n", chord_ );
+  (void)fclose( file );
+
+  return layout_.Load( c_benchLayoutName );
+}
+//-----------------------------------------------------------------------------
+// Checks which run chords a layout takes, and what they leave in the chord
+static int checkRunChords()
+{
+  // Up to the limits, one past them, and the last word overrunning
+  // chord.text once the ones before it have filled it
+  char path63[ 64 ];
+  char path64[ 65 ];
+  char path61y[ 80 ];
+  char path62y[ 80 ];
+  char path63y[ 80 ];
+  snprintf( path63, sizeof( path63 ), "/%062d", 0 );
+  snprintf( path64, sizeof( path64 ), "/%063d", 0 );
+  snprintf( path61y, sizeof( path61y ), "/%060d y", 0 );
+  snprintf( path62y, sizeof( path62y ), "/%061d y", 0 );
+  snprintf( path63y, sizeof( path63y ), "/%062d y", 0 );
+
+  static const char c_echoText[] = "/bin/echo\0a b\0c";
+
+  const struct
+  {
+    const char *  args;
+    int           numArgs;    // -1 if the layout is rejected
+  } c_cases[] =
+  {
+    { "/bin/echo a\\sb c",            3 },
+    { "/bin/echo 1 2 3 4 5 6 7",      8 },
+    { "/bin/echo 1 2 3 4 5 6 7 8",    -1 },
+    { "bin/echo",                     -1 },
+    { "/bin/echo \\q",                -1 },
+    { "",                             -1 },
+    { path63,                         1 },
+    { path64,                         -1 },
+    { path61y,                        2 },
+    { path62y,                        -1 },
+    { path63y,                        -1 },
+  };
+
+  for ( unsigned int i = 0; i < sizeof( c_cases ) / sizeof( c_cases[ 0 ] ); i++ )
+  {
+    char line[ 128 ];
+    snprintf( line, sizeof( line ), "run %s", c_cases[ i ].args );
+
+    OskLayout layout;
+    const bool loaded = loadChord( layout, line );
+    if ( loaded != ( c_cases[ i ].numArgs >= 0 ) ||
+         ( loaded && layout.GetChord( 0 ).arg != c_cases[ i ].numArgs ) )
+    {
+      printf( "run: MISMATCH \"%s\" loaded=%d args=%d expected=%d\n",
+              line, loaded, loaded ? layout.GetChord( 0 ).arg : -1,
+              c_cases[ i ].numArgs );
+      return -1;
+    }
+
+    if ( i == 0 &&
+         memcmp( layout.GetChord( 0 ).text, c_echoText, sizeof( c_echoText ) ) != 0 )
+    {
+      printf( "run: MISMATCH \"%s\" text\n", line );
+      return -1;
+    }
+  }
+
+  printf( "run: %u chord lines parsed as expected\n",
+          (unsigned int)( sizeof( c_cases ) / sizeof( c_cases[ 0 ] ) ) );
+  return 0;
+}
+//-----------------------------------------------------------------------------
+// Calls the reaping timer until no child is left, or gives up
+static bool reapAll(OskLauncher & launcher_)
+{
+  for ( int i = 0; i < c_reapTries && launcher_.GetNumChildren() > 0; i++ )
+  {
+    (void)usleep( c_reapWait );
+    launcher_.OnTimer();
+  }
+
+  return ( launcher_.GetNumChildren() == 0 );
+}
+//-----------------------------------------------------------------------------
+// Fills the launcher, checks the next command is refused and the children
+// are reaped once they exit, then runs a command that is not there
+static int checkLauncher()
+{
+  OskTimerWheel timers;
+  OskLauncher launcher( timers );
+
+  static const char * const c_sleepArgv[] = { "/bin/sleep", "10", NULL };
+  static const char * const c_missingArgv[] = { "/nonexistent/oskbench", NULL };
+
+  pid_t pids[ OskLauncher::MaxChildren ];
+  for ( int i = 0; i < OskLauncher::MaxChildren; i++ )
+  {
+    pids[ i ] = launcher.Run( c_sleepArgv );
+    if ( pids[ i ] <= 0 )
+    {
+      printf( "launcher: FAILED to start child %d\n", i );
+      return -1;
+    }
+  }
+
+  const unsigned long refused =
+      OskMetrics::Get( OskMetrics::MET_CommandsRefused );
+  if ( launcher.Run( c_sleepArgv ) > 0 ||
+       OskMetrics::Get( OskMetrics::MET_CommandsRefused ) != refused + 1 )
+  {
+    printf( "launcher: FAILED to refuse child %d\n", OskLauncher::MaxChildren );
+    return -1;
+  }
+
+  for ( int i = 0; i < OskLauncher::MaxChildren; i++ )
+  {
+    (void)kill( pids[ i ], SIGTERM );
+  }
+
+  if ( !reapAll( launcher ) )
+  {
+    printf( "launcher: FAILED to reap %d children\n", launcher.GetNumChildren() );
+    return -1;
+  }
+
+  // Waited for here, so the launcher finds it gone and drops it
+  const pid_t pid = launcher.Run( c_missingArgv );
+  int status = 0;
+  if ( pid <= 0 || waitpid( pid, &status, 0 ) != pid ||
+       !WIFEXITED( status ) ||
+       WEXITSTATUS( status ) != OskLauncher::ExecFailedStatus ||
+       !reapAll( launcher ) )
+  {
+    printf( "launcher: FAILED on a missing command, status=%d\n", status );
+    return -1;
+  }
+
+  printf( "launcher: refused past %d children, reaped them, "
+          "a missing command exits %d\n",
+          OskLauncher::MaxChildren, OskLauncher::ExecFailedStatus );
+  return 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// Replays a recording once with the given psposk2 flags
+static int replay(const char * recording_, const char * flags_)
+{
+  // Anything already set wins, so the same run can be pointed elsewhere
+  (void)setenv( "OSK_REPLAY", recording_, 1 );
+  (void)setenv( "OSK_REPLAY_SPEED", "max", 0 );
+  (void)setenv( "OSK_SIM_CONSOLE", "-", 0 );
+
+  if ( getenv( "OSK_FBDEV" ) == NULL )
+  {
+    // Two pages, so -f works too
+    const int fd = open( c_benchFbName, O_RDWR | O_CREAT | O_TRUNC, 0644 );
+    if ( fd < 0 || ftruncate( fd, c_benchFbSize ) < 0 )
+    {
+      printf( "Can not create %s\n", c_benchFbName );
+      return -1;
+    }
+    (void)close( fd );
+
+    (void)setenv( "OSK_FBDEV", c_benchFbName, 1 );
+    (void)setenv( "OSK_FBGEOMETRY", c_benchFbGeometry, 1 );
+  }
+
+  OskCore::OskFlags flags;
+  OskCore::OskSettings settings;
+  if ( !OskCore::ParseFlags( flags_, flags, settings ) )
+  {
+    return 0;
+  }
+
+  OskCore core( flags, settings );
+  if ( !core.Initialize( NULL, NULL ) )
+  {
+    return -1;
+  }
+
+  core.Main();
+  core.Report( stdout );
+
+  return 0;
+}
+//-----------------------------------------------------------------------------
+// Holds a key through several repeats in a recording of its own, then
+// replays it at the recorded pace and at full speed: the timers have to
+// fire the same number of times in both
+static int checkReplayTimers()
+{
+  // Stick centred, then R, CIRCLE with it for 1050 ms, and both released;
+  // the repeats at 400 ms and every 100 ms after stay 50 ms clear of it
+  static const unsigned int c_words[][ 2 ] =
+  {
+    // us since the last word, joypad word
+    { 0,       0x88000000 },
+    { 100000,  0x88000000 | OskInput::KEY_RTRG },
+    { 100000,  0x88000000 | OskInput::KEY_RTRG | OskInput::KEY_CIRCLE },
+    { 1050000, 0x88000000 | OskInput::KEY_RTRG },
+    { 100000,  0x88000000 },
+  };
+
+  // The layout of a recording OskInput_Record writes
+  FILE * const file = fopen( c_benchRecordingName, "wb" );
+  const unsigned int header[ 2 ] = { OskReplay::FileMagic,
+                                      OskReplay::FileVersion };
+  if ( file == NULL ||
+       fwrite( header, sizeof( header ), 1, file ) != 1 ||
+       fwrite( c_words, sizeof( c_words ), 1, file ) != 1 ||
+       fclose( file ) != 0 )
+  {
+    printf( "Can not write %s\n", c_benchRecordingName );
+    return -1;
+  }
+
+  (void)setenv( "OSK_REPEAT", "400,100,100,100", 1 );
+
+  static const char * const c_speeds[ 2 ] = { "real", "max" };
+  unsigned long repeats[ 2 ];
+  for ( int i = 0; i < 2; i++ )
+  {
+    (void)setenv( "OSK_REPLAY_SPEED", c_speeds[ i ], 1 );
+
+    const unsigned long before = OskMetrics::Get( OskMetrics::MET_KeyRepeats );
+    const int rt = replay( c_benchRecordingName, "" );
+    if ( rt != 0 )
+      return rt;
+
+    repeats[ i ] = OskMetrics::Get( OskMetrics::MET_KeyRepeats ) - before;
+  }
+
+  if ( repeats[ 0 ] != repeats[ 1 ] || repeats[ 0 ] == 0 )
+  {
+    printf( "timers: MISMATCH repeats real=%lu max=%lu\n",
+            repeats[ 0 ], repeats[ 1 ] );
+    return -1;
+  }
+
+  printf( "timers: %lu repeats of a held key at both speeds\n", repeats[ 0 ] );
+  return 0;
+}
+//-----------------------------------------------------------------------------
+// The same recording through the serial loop and then the pipeline, with
+// the latency stats on, at the recorded pace unless told otherwise: as
+// fast as possible, the pipeline would only measure its own queue
+static int benchPipeline(const char * recording_, const char * flags_)
+{
+  if ( strlen( flags_ ) + 3 > (size_t)c_maxFlagsLength )
+  {
+    printf( "Flags too long: %s\n", flags_ );
+    return -1;
+  }
+
+  (void)setenv( "OSK_REPLAY_SPEED", "real", 0 );
+
+  char flags[ c_maxFlagsLength ];
+  for ( int pipelined = 0; pipelined < 2; pipelined++ )
+  {
+    snprintf( flags, sizeof( flags ), "%st%s", flags_, pipelined ? "p" : "" );
+    printf( "pipeline: %s, flags %s\n", pipelined ? "pipelined" : "serial", flags );
+    fflush( stdout );
+
+    const int rt = replay( recording_, flags );
+    if ( rt != 0 )
+      return rt;
+  }
+
+  return 0;
+}
+//-----------------------------------------------------------------------------
+// Replays a recording, then runs every screenshot encoder over the frame
+// it left in the framebuffer
+static int benchScreenshot(const char * recording_, const char * flags_)
+{
+  const int rt = replay( recording_, flags_ );
+  if ( rt != 0 )
+    return rt;
+
+  OskCanvas * const canvas = OskFactory::CreateCanvas();
+  if ( canvas == NULL || !canvas->Initialize( NULL ) )
+  {
+    printf( "Can not open the framebuffer again\n" );
+    delete canvas;
+    return -1;
+  }
+
+  OskScreenshot screenshot;
+  const bool ok = ( screenshot.Initialize( canvas->GetWidth(),
+                                           canvas->GetHeight(),
+                                           canvas->GetPixelFormat(),
+                                           0,
+                                           OskScreenshot::ENC_Bmp ) &&
+                    screenshot.Benchmark( *canvas, stdout ) );
+  delete canvas;
+  return ok ? 0 : -1;
+}
+
+
+//-----------------------------------------------------------------------------
+// Implementations
+//-----------------------------------------------------------------------------
+int main(int argc_, char * argv_[])
+{
+  if ( argc_ < 2 )
+  {
+    printf( "Usage: oskbench <recording> [-flags]\n"
+            "       oskbench --pipeline <recording> [-flags]\n"
+            "       oskbench --screenshot <recording> [-flags]\n"
+            "       oskbench --sections\n"
+            "       oskbench --run\n"
+            "       oskbench --timers\n"
+            "  Replays a joypad recording made with OSK_RECORD as fast as\n"
+            "  possible and reports the timings. The flags are psposk2's.\n"
+            "  --pipeline replays it at the recorded pace through the serial\n"
+            "  loop and then the -p pipeline, with the latency stats on.\n"
+            "  --screenshot replays it, then times every screenshot encoder\n"
+            "  on the last frame without writing files.\n"
+            "  --sections checks the section table against the if-cascade\n"
+            "  it replaced on every input, and times both.\n"
+            "  --run checks the parsing of run chords, and that the launcher\n"
+            "  refuses commands past its limit, reaps the ones that exit, and\n"
+            "  that a command that is not there exits with 127.\n"
+            "  --timers replays a held key at the recorded pace and at full\n"
+            "  speed, and checks both repeat it as often.\n" );
+    return 0;
+  }
+
+  if ( strcmp( argv_[ 1 ], "--sections" ) == 0 )
+  {
+    return benchSections();
+  }
+
+  if ( strcmp( argv_[ 1 ], "--run" ) == 0 )
+  {
+    return ( checkRunChords() == 0 ) ? checkLauncher() : -1;
+  }
+
+  if ( strcmp( argv_[ 1 ], "--timers" ) == 0 )
+  {
+    return checkReplayTimers();
+  }
+
+  if ( strcmp( argv_[ 1 ], "--pipeline" ) == 0 )
+  {
+    if ( argc_ < 3 )
+    {
+      printf( "oskbench --pipeline needs a recording\n" );
+      return -1;
+    }
+
+    return benchPipeline( argv_[ 2 ], ( argc_ >= 4 ) ? argv_[ 3 ] : "" );
+  }
+
+  if ( strcmp( argv_[ 1 ], "--screenshot" ) == 0 )
+  {
+    if ( argc_ < 3 )
+    {
+      printf( "oskbench --screenshot needs a recording\n" );
+      return -1;
+    }
+
+    return benchScreenshot( argv_[ 2 ], ( argc_ >= 4 ) ? argv_[ 3 ] : "" );
+  }
+
+  return replay( argv_[ 1 ], ( argc_ >= 3 ) ? argv_[ 2 ] : "" );
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
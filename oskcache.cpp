@@ -0,0 +1,321 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------
+// Class: OskImageCache::Frame
+//-----------------------------------------------------------------------------
+class OskImageCache::Frame : public OskImage
+{
+public:
+  Frame
+  (
+    ImageId baseId_,
+    ImageId activeId_,
+    int width_,
+    int height_,
+    int bytesPerPixel_
+  );
+  virtual ~Frame();
+
+  virtual const void * GetData() const
+  {
+    return m_bits;
+  }
+
+  unsigned char * GetBits()
+  {
+    return m_bits;
+  }
+
+  unsigned long GetSize() const
+  {
+    return (unsigned long)( m_width * m_height * m_bytesPerPixel );
+  }
+
+  const ImageId   c_activeId;
+  unsigned long   m_lastUse;
+
+protected:
+  unsigned char * m_bits;
+
+private:
+  // Not implemented
+  Frame();
+  Frame(const Frame &);
+  Frame & operator = (const Frame &);
+};
+//-----------------------------------------------------------------------------
+OskImageCache::Frame::Frame
+(
+  ImageId baseId_,
+  ImageId activeId_,
+  int width_,
+  int height_,
+  int bytesPerPixel_
+)
+  : OskImage( baseId_ ),
+    c_activeId( activeId_ ),
+    m_lastUse( 0 ),
+    m_bits( NULL )
+{
+  m_width = width_;
+  m_height = height_;
+  m_bytesPerPixel = bytesPerPixel_;
+  m_bits = new unsigned char[ width_ * height_ * bytesPerPixel_ ];
+}
+//-----------------------------------------------------------------------------
+OskImageCache::Frame::~Frame()
+{
+  if ( m_bits != NULL )
+  {
+    delete[] m_bits;
+    m_bits = NULL;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskImageCache
+//-----------------------------------------------------------------------------
+OskImageCache::OskImageCache()
+  : m_mode( MODE_OFF ),
+    m_limit( 0 ),
+    m_used( 0 ),
+    m_useTick( 0 ),
+    m_images( NULL ),
+    m_numHits( 0 ),
+    m_numMisses( 0 ),
+    m_numEvictions( 0 ),
+    m_numRejects( 0 ),
+    m_buildTime( 0 )
+{
+  memset( m_frames, 0, sizeof( m_frames ) );
+}
+//-----------------------------------------------------------------------------
+OskImageCache::~OskImageCache()
+{
+  for ( int img = 0; img < OskImage::IMGID_Count; img++ )
+  {
+    for ( int sec = 0; sec < KSID_Count; sec++ )
+    {
+      if ( m_frames[ img ][ sec ] != NULL )
+      {
+        delete m_frames[ img ][ sec ];
+        m_frames[ img ][ sec ] = NULL;
+      }
+    }
+  }
+}
+//-----------------------------------------------------------------------------
+void OskImageCache::Configure(Mode mode_, unsigned long limit_)
+{
+  m_mode = mode_;
+  m_limit = limit_;
+}
+//-----------------------------------------------------------------------------
+void OskImageCache::Attach(OskImage * const * images_)
+{
+  m_images = images_;
+}
+//-----------------------------------------------------------------------------
+bool OskImageCache::Prepare
+(
+  OskImage::ImageId baseId_,
+  OskImage::ImageId activeId_
+)
+{
+  if ( m_mode == MODE_OFF || m_images == NULL )
+    return false;
+
+  const unsigned long start = OskClock::Now();
+  bool rt = true;
+
+  for ( int sec = 0; sec < KSID_Count; sec++ )
+  {
+    if ( m_frames[ baseId_ ][ sec ] != NULL )
+      continue;
+
+    if ( compose( baseId_, activeId_, (OskKeySectionId)sec ) == NULL )
+    {
+      rt = false;
+      break;
+    }
+  }
+
+  m_buildTime += OskClock::Now() - start;
+  return rt;
+}
+//-----------------------------------------------------------------------------
+const OskImage * OskImageCache::Lookup
+(
+  OskImage::ImageId baseId_,
+  OskImage::ImageId activeId_,
+  OskKeySectionId sectionId_
+)
+{
+  if ( m_mode == MODE_OFF || m_images == NULL )
+    return NULL;
+
+  Frame * frame = m_frames[ baseId_ ][ sectionId_ ];
+  if ( frame != NULL && frame->c_activeId == activeId_ )
+  {
+    m_numHits++;
+    frame->m_lastUse = ++m_useTick;
+    return frame;
+  }
+
+  m_numMisses++;
+
+  // In eager mode the set of cached frames is fixed at startup
+  if ( m_mode != MODE_LAZY )
+    return NULL;
+
+  return compose( baseId_, activeId_, sectionId_ );
+}
+//-----------------------------------------------------------------------------
+void OskImageCache::Report(FILE * file_) const
+{
+  int numFrames = 0;
+  for ( int img = 0; img < OskImage::IMGID_Count; img++ )
+  {
+    for ( int sec = 0; sec < KSID_Count; sec++ )
+    {
+      if ( m_frames[ img ][ sec ] != NULL )
+        numFrames++;
+    }
+  }
+
+  fprintf( file_,
+           "image cache: mode=%s frames=%d used=%lu limit=%lu hits=%lu "
+           "misses=%lu evictions=%lu rejects=%lu build-us=%lu\n",
+           ( m_mode == MODE_EAGER ) ? "eager" :
+           ( m_mode == MODE_LAZY ) ? "lazy" : "off",
+           numFrames,
+           m_used,
+           m_limit,
+           m_numHits,
+           m_numMisses,
+           m_numEvictions,
+           m_numRejects,
+           m_buildTime );
+}
+//-----------------------------------------------------------------------------
+OskImageCache::Frame * OskImageCache::compose
+(
+  OskImage::ImageId baseId_,
+  OskImage::ImageId activeId_,
+  OskKeySectionId sectionId_
+)
+{
+  const OskImage * const base = m_images[ baseId_ ];
+  const OskImage * const active = m_images[ activeId_ ];
+  if ( base == NULL || active == NULL )
+    return NULL;
+
+  const int width = base->GetWidth();
+  const int height = base->GetHeight();
+  const int bytesPerPixel = base->GetBytesPerPixel();
+  const unsigned long size = (unsigned long)( width * height * bytesPerPixel );
+
+  if ( active->GetBytesPerPixel() != bytesPerPixel )
+    return NULL;
+
+  if ( !makeRoom( size ) )
+  {
+    m_numRejects++;
+    return NULL;
+  }
+
+  Frame * frame = new Frame( baseId_, activeId_, width, height, bytesPerPixel );
+  if ( frame == NULL || frame->GetBits() == NULL )
+  {
+    DBG(( "OSK: Failed to allocate a composed keyboard frame\n" ));
+    delete frame;
+    return NULL;
+  }
+
+  // The whole base keyboard ...
+  unsigned char * dest = frame->GetBits();
+  memcpy( dest, base->GetData(), size );
+
+  // ... with the active section laid over it
+  int secX, secY, secWidth, secHeight;
+  OskCompositor::GetSectionRect( *active, sectionId_,
+                                 secX, secY, secWidth, secHeight );
+
+  const int destPitch = width * bytesPerPixel;
+  const int sourPitch = active->GetWidth() * bytesPerPixel;
+  const unsigned char * sour = (const unsigned char *)active->GetData() +
+                               secY * sourPitch + secX * bytesPerPixel;
+  dest += secY * destPitch + secX * bytesPerPixel;
+
+  for ( int i = 0; i < secHeight; i++ )
+  {
+    memcpy( dest, sour, secWidth * bytesPerPixel );
+    dest += destPitch;
+    sour += sourPitch;
+  }
+
+  if ( m_frames[ baseId_ ][ sectionId_ ] != NULL )
+  {
+    // Stale frame composed against a different active image
+    m_used -= m_frames[ baseId_ ][ sectionId_ ]->GetSize();
+    delete m_frames[ baseId_ ][ sectionId_ ];
+  }
+
+  frame->m_lastUse = ++m_useTick;
+  m_frames[ baseId_ ][ sectionId_ ] = frame;
+  m_used += size;
+
+  return frame;
+}
+//-----------------------------------------------------------------------------
+bool OskImageCache::makeRoom(unsigned long size_)
+{
+  if ( size_ > m_limit )
+    return false;
+
+  while ( m_used + size_ > m_limit )
+  {
+    if ( m_mode != MODE_LAZY )
+      return false;
+
+    // Evict the least recently used frame
+    Frame ** victim = NULL;
+    for ( int img = 0; img < OskImage::IMGID_Count; img++ )
+    {
+      for ( int sec = 0; sec < KSID_Count; sec++ )
+      {
+        Frame ** frame = &m_frames[ img ][ sec ];
+        if ( *frame != NULL &&
+             ( victim == NULL || (*frame)->m_lastUse < (*victim)->m_lastUse ) )
+        {
+          victim = frame;
+        }
+      }
+    }
+
+    if ( victim == NULL )
+      return false;
+
+    m_used -= (*victim)->GetSize();
+    delete *victim;
+    *victim = NULL;
+    m_numEvictions++;
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
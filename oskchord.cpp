@@ -0,0 +1,176 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+static int countBits(unsigned long bits_)
+{
+  int n = 0;
+  for ( ; bits_ != 0; bits_ &= bits_ - 1 )
+  {
+    n++;
+  }
+  return n;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskCore::ChordMatcher
+//-----------------------------------------------------------------------------
+OskCore::ChordMatcher::ChordMatcher(OskCore & core_)
+  : OskTimer(),
+    m_core( core_ ),
+    m_numChords( 0 ),
+    m_allButtons( 0 ),
+    m_lastKeys( 0 ),
+    m_matched( 0 ),
+    m_pending( 0 ),
+    m_consumed( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+void OskCore::ChordMatcher::Compile(const OskLayout & layout_)
+{
+  m_numChords = 0;
+  m_allButtons = 0;
+  m_lastKeys = 0;
+  m_matched = 0;
+  m_pending = 0;
+  m_consumed = 0;
+
+  // Insertion sort on the number of buttons, keeping the layout order
+  // among chords of the same size
+  for ( int i = 0; i < layout_.GetNumChords(); i++ )
+  {
+    const OskLayout::Chord & chord = layout_.GetChord( i );
+    const int numButtons = countBits( chord.buttons );
+
+    int pos = m_numChords;
+    while ( pos > 0 && countBits( m_masks[ pos - 1 ] ) < numButtons )
+    {
+      m_masks[ pos ] = m_masks[ pos - 1 ];
+      m_chords[ pos ] = m_chords[ pos - 1 ];
+      pos--;
+    }
+
+    m_masks[ pos ] = chord.buttons;
+    m_chords[ pos ] = &chord;
+    m_allButtons |= chord.buttons;
+    m_numChords++;
+  } // end for
+}
+//-----------------------------------------------------------------------------
+void OskCore::ChordMatcher::Match(unsigned long & keys_)
+{
+  const unsigned long keys = keys_ & m_allButtons;
+  if ( keys != m_lastKeys )
+  {
+    m_lastKeys = keys;
+    scan( keys );
+  }
+
+  keys_ &= ~m_consumed;
+}
+//-----------------------------------------------------------------------------
+void OskCore::ChordMatcher::OnTimer()
+{
+  const unsigned long now = OskClock::Now();
+
+  for ( int i = 0; i < m_numChords; i++ )
+  {
+    const unsigned long bit = 1UL << i;
+    if ( ( m_pending & bit ) != 0 && (long)( now - m_due[ i ] ) >= 0 )
+    {
+      m_pending &= ~bit;
+      OskMetrics::Count( OskMetrics::MET_ChordsFired );
+      (void)m_core.runChord( *m_chords[ i ] );
+    }
+  } // end for
+
+  schedule();
+}
+//-----------------------------------------------------------------------------
+void OskCore::ChordMatcher::scan(unsigned long keys_)
+{
+  OskMetrics::Count( OskMetrics::MET_ChordScans );
+
+  // One pass, bigger chords first; a chord only matches if no bigger one
+  // has taken any of its buttons
+  unsigned long matched = 0;
+  unsigned long consumed = 0;
+  for ( int i = 0; i < m_numChords; i++ )
+  {
+    const unsigned long mask = m_masks[ i ];
+    if ( ( keys_ & mask ) == mask && ( consumed & mask ) == 0 )
+    {
+      matched |= 1UL << i;
+      consumed |= mask;
+    }
+  } // end for
+
+  const unsigned long pressed = matched & ~m_matched;
+  m_pending &= matched;
+  m_matched = matched;
+  m_consumed = consumed;
+
+  const unsigned long now = OskClock::Now();
+  for ( int i = 0; i < m_numChords && ( pressed >> i ) != 0; i++ )
+  {
+    if ( ( pressed & ( 1UL << i ) ) == 0 )
+      continue;
+
+    if ( m_chords[ i ]->holdTime == 0 )
+    {
+      OskMetrics::Count( OskMetrics::MET_ChordsFired );
+      (void)m_core.runChord( *m_chords[ i ] );
+    }
+    else
+    {
+      m_due[ i ] = now + m_chords[ i ]->holdTime;
+      m_pending |= 1UL << i;
+    }
+  } // end for
+
+  schedule();
+}
+//-----------------------------------------------------------------------------
+void OskCore::ChordMatcher::schedule()
+{
+  if ( m_pending == 0 )
+  {
+    m_core.m_timers.Cancel( *this );
+    return;
+  }
+
+  const unsigned long now = OskClock::Now();
+  unsigned long earliest = 0;
+  bool found = false;
+  for ( int i = 0; i < m_numChords; i++ )
+  {
+    if ( ( m_pending & ( 1UL << i ) ) == 0 )
+      continue;
+
+    const unsigned long left = ( (long)( m_due[ i ] - now ) > 0 )
+                                 ? m_due[ i ] - now : 0;
+    if ( !found || left < earliest )
+    {
+      earliest = left;
+      found = true;
+    }
+  } // end for
+
+  m_core.m_timers.Schedule( *this, earliest );
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -8,35 +8,37 @@
 //-----------------------------------------------------------------------------
 // Type definitions
 //-----------------------------------------------------------------------------
+// All the 32-bit fields are unsigned int, so the layouts also hold on
+// 64-bit hosts where unsigned long is 8 bytes
 typedef struct
 { 
   unsigned short  bfType; 
-  unsigned long   bfSize; 
+  unsigned int    bfSize; 
   unsigned short  bfReserved1; 
   unsigned short  bfReserved2; 
-  unsigned long   bfOffBits; 
+  unsigned int    bfOffBits; 
 } BITMAPFILEHEADER, *PBITMAPFILEHEADER; 
 
 typedef struct
 {
-  unsigned long   biSize; 
+  unsigned int    biSize; 
   int             biWidth; 
   int             biHeight; 
   unsigned short  biPlanes; 
   unsigned short  biBitCount; 
-  unsigned long   biCompression; 
-  unsigned long   biSizeImage; 
+  unsigned int    biCompression; 
+  unsigned int    biSizeImage; 
   int             biXPelsPerMeter; 
   int             biYPelsPerMeter; 
-  unsigned long   biClrUsed; 
-  unsigned long   biClrImportant; 
+  unsigned int    biClrUsed; 
+  unsigned int    biClrImportant; 
 } BITMAPINFOHEADER, *PBITMAPINFOHEADER;
 
 typedef struct
 {
   int width;
   int height;
-  unsigned long * bitmap;
+  unsigned int * bitmap;
 } OskImgData;
 
 
@@ -48,7 +50,7 @@ typedef struct
 
 #inlcude "oskimg.h"
 
-static unsigned long s_bitmapXXXX[ %d * %d ] =
+static unsigned int s_bitmapXXXX[ %d * %d ] =
 {
   0x12345678, 0x12345678, 0x12345678, 0x12345678, 
   0x12345678, 0x12345678, 0x12345678, 0x12345678, 
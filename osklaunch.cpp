@@ -0,0 +1,106 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <unistd.h>
+#include <errno.h>
+#include <sys/wait.h>
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+// How often the children are checked on while any is running
+static const unsigned long ReapInterval = 250000;   // in us
+
+
+//-----------------------------------------------------------------------------
+// Class: OskLauncher
+//-----------------------------------------------------------------------------
+OskLauncher::OskLauncher(OskTimerWheel & timers_)
+  : OskTimer(),
+    m_timers( timers_ ),
+    m_numChildren( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+pid_t OskLauncher::Run(const char * const * argv_)
+{
+  // Make room from the ones that are done before giving up
+  reap();
+  if ( m_numChildren == MaxChildren )
+  {
+    DBG(( "OSK: %d commands still running, not running %s\n",
+          m_numChildren, argv_[ 0 ] ));
+    OskMetrics::Count( OskMetrics::MET_CommandsRefused );
+    return -1;
+  }
+
+  // Without an MMU fork() is not there; the vfork() child borrows our
+  // memory and stack until it execs, so it does nothing else
+  const pid_t pid = vfork();
+  if ( pid == 0 )
+  {
+    (void)execv( argv_[ 0 ], (char * const *)argv_ );
+    _exit( ExecFailedStatus );
+  }
+
+  if ( pid < 0 )
+  {
+    DBG(( "OSK: Failed to run %s, err=%d\n", argv_[ 0 ], errno ));
+    OskMetrics::Count( OskMetrics::MET_CommandsRefused );
+    return -1;
+  }
+
+  m_children[ m_numChildren++ ] = pid;
+  OskMetrics::Count( OskMetrics::MET_CommandsRun );
+
+  if ( !IsArmed() )
+  {
+    m_timers.Schedule( *this, ReapInterval );
+  }
+
+  return pid;
+}
+//-----------------------------------------------------------------------------
+void OskLauncher::OnTimer()
+{
+  reap();
+  if ( m_numChildren > 0 )
+  {
+    m_timers.Schedule( *this, ReapInterval );
+  }
+}
+//-----------------------------------------------------------------------------
+void OskLauncher::reap()
+{
+  int i = 0;
+  while ( i < m_numChildren )
+  {
+    int status;
+    const pid_t rt = waitpid( m_children[ i ], &status, WNOHANG );
+    if ( rt == 0 || ( rt < 0 && errno == EINTR ) )
+    {
+      i++;
+      continue;
+    }
+
+    if ( rt > 0 && WIFEXITED( status ) && WEXITSTATUS( status ) != 0 )
+    {
+      DBG(( "OSK: Command %d exited with %d\n",
+            (int)rt, WEXITSTATUS( status ) ));
+    }
+
+    // Done, or not ours to wait for any more
+    m_children[ i ] = m_children[ --m_numChildren ];
+  } // end while
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,731 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------
+// Type definitions
+//-----------------------------------------------------------------------------
+typedef struct
+{
+  const char *  name;
+  int           key;
+} OskKeyName;
+
+typedef struct
+{
+  const char *  name;
+  unsigned long button;
+} OskButtonName;
+
+typedef struct
+{
+  const char *      name;
+  OskImage::ImageId imgId;
+  OskImage::ImageId activeImgId;
+} OskImageName;
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const int MaxLineLength = 256;
+static const unsigned int AllSections = ( 1 << KSID_Count ) - 1;
+
+static const char * const c_sectionNames[ KSID_Count ] =
+{
+  "TL", "T", "TR",
+  "L",  "C", "R",
+  "BL", "B", "BR",
+};
+
+static const char * const c_triggerNames[ OskLayout::TRIG_Count ] =
+{
+  NULL,
+  "L",
+  "R",
+  "LR",
+};
+
+static const OskKeyName c_keyNames[] =
+{
+  { "NONE",   0 },
+  { "SPACE",  ' ' },
+  { "BS",     KEY_BACKSPACE },
+  { "ENTER",  KEY_ENTER },
+  { "TAB",    KEY_TAB },
+  { "ESC",    KEY_ESCAPE },
+  { "DEL",    KEY_DEL },
+  { "UP",     KEY_UP },
+  { "DOWN",   KEY_DOWN },
+  { "RIGHT",  KEY_RIGHT },
+  { "LEFT",   KEY_LEFT },
+  { "CTRL",   KEY_MOD_CTRL },
+  { "ALT",    KEY_MOD_ALT },
+  { "META",   KEY_MOD_META },
+};
+
+static const OskButtonName c_buttonNames[] =
+{
+  { "UP",         OskInput::KEY_ARROW_UP },
+  { "RIGHT",      OskInput::KEY_ARROW_RT },
+  { "DOWN",       OskInput::KEY_ARROW_DN },
+  { "LEFT",       OskInput::KEY_ARROW_LT },
+  { "TRIANGLE",   OskInput::KEY_TRIANGLE },
+  { "CIRCLE",     OskInput::KEY_CIRCLE },
+  { "CROSS",      OskInput::KEY_CROSS },
+  { "RECTANGLE",  OskInput::KEY_RECTANGLE },
+  { "SELECT",     OskInput::KEY_SELECT },
+  { "L",          OskInput::KEY_LTRG },
+  { "R",          OskInput::KEY_RTRG },
+  { "START",      OskInput::KEY_START },
+  { "HOME",       OskInput::KEY_HOME },
+  { "VOL_UP",     OskInput::KEY_VOL_UP },
+  { "VOL_DN",     OskInput::KEY_VOL_DN },
+  { "LCD",        OskInput::KEY_LCD },
+  { "NOTE",       OskInput::KEY_NOTE },
+};
+
+static const char * const c_actionNames[ OskLayout::ACT_Count ] =
+{
+  NULL,             // ACT_ConsoleNext, "console next"
+  NULL,             // ACT_ConsolePrev, "console prev"
+  "console",
+  "screenshot",
+  "poweroff",
+  "type",
+  "lock",
+  "mod",
+  "trace",
+  "run",
+};
+
+static const OskKeyName c_modifierNames[] =
+{
+  { "ctrl",   KEY_MOD_CTRL },
+  { "alt",    KEY_MOD_ALT },
+  { "meta",   KEY_MOD_META },
+};
+
+static const OskImageName c_imageNames[] =
+{
+  { "eng",  OskImage::IMGID_Eng,  OskImage::IMGID_EngActive },
+  { "cap",  OskImage::IMGID_Cap,  OskImage::IMGID_CapActive },
+  { "num",  OskImage::IMGID_Num,  OskImage::IMGID_NumActive },
+};
+
+// The built-in layers, in OskKeyboardId order
+static const char * const c_defaultLayerNames[ KBID_Count ] =
+{
+  "eng",
+  "cap",
+  "num",
+};
+
+static const int c_defaultTriggers[ OskLayout::TRIG_Count ] =
+{
+  -1,         // TRIG_None
+  KBID_Num,   // TRIG_L
+  KBID_Eng,   // TRIG_R
+  KBID_Cap,   // TRIG_LR
+};
+
+static const OskLayout::Chord c_defaultChords[] =
+{
+  { OskInput::KEY_VOL_UP, 0, OskLayout::ACT_ConsoleNext, 0, "" },
+  { OskInput::KEY_VOL_DN, 0, OskLayout::ACT_ConsolePrev, 0, "" },
+  { OskInput::KEY_LCD,    0, OskLayout::ACT_Screenshot,  0, "" },
+  { OskInput::KEY_HOME | OskInput::KEY_CIRCLE | OskInput::KEY_CROSS,
+                          0, OskLayout::ACT_PowerOff,    0, "" },
+  { OskInput::KEY_SELECT, 0, OskLayout::ACT_Modifier,    KEY_MOD_CTRL, "" },
+  { OskInput::KEY_START,  0, OskLayout::ACT_Modifier,    KEY_MOD_ALT,  "" },
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskLayout
+//-----------------------------------------------------------------------------
+OskLayout::OskLayout()
+{
+  SetDefault();
+}
+//-----------------------------------------------------------------------------
+void OskLayout::SetDefault()
+{
+  m_numLayers = KBID_Count;
+  for ( int layer = 0; layer < KBID_Count; layer++ )
+  {
+    strcpy( m_layers[ layer ].name, c_defaultLayerNames[ layer ] );
+    m_layers[ layer ].imgId = c_imageNames[ layer ].imgId;
+    m_layers[ layer ].activeImgId = c_imageNames[ layer ].activeImgId;
+
+    for ( int sec = 0; sec < KSID_Count; sec++ )
+    {
+      memcpy( &m_keys[ ( layer * KSID_Count + sec ) * KDID_Count ],
+              s_OskKeyboards[ layer ].sections[ sec ].keys,
+              sizeof( int ) * KDID_Count );
+    }
+  }
+
+  for ( int trig = 0; trig < TRIG_Count; trig++ )
+  {
+    m_triggers[ trig ] = c_defaultTriggers[ trig ];
+  }
+
+  setDefaultChords();
+}
+//-----------------------------------------------------------------------------
+// One statement per line, '#' starts a comment line:
+//
+//   layer <name> <eng|cap|num>         Starts a layer drawn with that image
+//   <section> <left> <top> <right> <bottom>
+//                                      Keys of a section, TL T TR L C R BL
+//                                      B or BR; each layer needs all nine
+//   trigger <L|R|LR> <name>            Shoulder buttons that bring it up
+//   chord <buttons> [<ms>ms] <action>  Buttons joined by '+', held for at
+//                                      least <ms> if given, run one of:
+//       console next|prev|<n>          Switch the virtual terminal
+//       screenshot
+//       poweroff
+//       type <text>                    With \s \t \n \e \\ for space, tab,
+//                                      newline, escape and backslash
+//       lock <name>                    Show a layer with no trigger held,
+//                                      until the chord comes again
+//       mod ctrl|alt|meta              Same as the key of that modifier
+//       trace                          Write the last state changes to
+//                                      the trace file
+//       run </path> [<arg>...]         Start a command, up to 8 words
+//                                      with the escapes of type
+//
+// A key is one character, a name (SPACE BS ENTER TAB ESC DEL UP DOWN RIGHT
+// LEFT NONE), ^<char> for a control character or a 0x number of up to 4
+// bytes sent low byte first. Without any trigger line the first three
+// layers take R, L+R and L like the built-in ones, and without any chord
+// line the built-in chords apply. The first layer is also the one of the
+// idle keyboard. Triggers and chords name layers defined above them. On
+// any error the built-in layers are kept.
+//-----------------------------------------------------------------------------
+bool OskLayout::Load(const char * fileName_)
+{
+  FILE * file = fopen( fileName_, "r" );
+  if ( file == NULL )
+  {
+    DBG(( "OSK: Can not open layout %s\n", fileName_ ));
+    return false;
+  }
+
+  m_numLayers = 0;
+  m_numChords = 0;
+  for ( int trig = 0; trig < TRIG_Count; trig++ )
+  {
+    m_triggers[ trig ] = -1;
+  }
+
+  char line[ MaxLineLength ];
+  int lineNo = 0;
+  unsigned int sectionsSeen = AllSections;
+  bool rt = true;
+
+  while ( rt && fgets( line, sizeof( line ), file ) != NULL )
+  {
+    lineNo++;
+    rt = parseLine( line, lineNo, sectionsSeen );
+  }
+
+  (void)fclose( file );
+
+  if ( rt && sectionsSeen != AllSections )
+  {
+    DBG(( "OSK: Layout %s: layer %s misses sections\n",
+          fileName_, m_layers[ m_numLayers - 1 ].name ));
+    rt = false;
+  }
+
+  if ( rt && m_numLayers == 0 )
+  {
+    DBG(( "OSK: Layout %s has no layers\n", fileName_ ));
+    rt = false;
+  }
+
+  if ( !rt )
+  {
+    DBG(( "OSK: Layout %s rejected at line %d\n", fileName_, lineNo ));
+    SetDefault();
+    return false;
+  }
+
+  bool hasTriggers = false;
+  for ( int trig = 0; trig < TRIG_Count; trig++ )
+  {
+    hasTriggers = hasTriggers || ( m_triggers[ trig ] >= 0 );
+  }
+
+  if ( !hasTriggers )
+  {
+    for ( int trig = 0; trig < TRIG_Count; trig++ )
+    {
+      if ( c_defaultTriggers[ trig ] < m_numLayers )
+      {
+        m_triggers[ trig ] = c_defaultTriggers[ trig ];
+      }
+    }
+  }
+
+  if ( m_numChords == 0 )
+  {
+    setDefaultChords();
+  }
+
+  if ( !checkChords() )
+  {
+    DBG(( "OSK: Layout %s rejected for conflicting chords\n", fileName_ ));
+    SetDefault();
+    return false;
+  }
+
+  DBG(( "OSK: Loaded %d layers from %s\n", m_numLayers, fileName_ ));
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskLayout::parseLine
+(
+  char * line_,
+  int lineNo_,
+  unsigned int & sectionsSeen_
+)
+{
+  static const char c_blanks[] = " \t\r\n";
+
+  // The longest line is a chord with a hold time running a command
+  const char * tokens[ 4 + MaxCommandArgs ];
+  int numTokens = 0;
+  for ( char * token = strtok( line_, c_blanks );
+        token != NULL;
+        token = strtok( NULL, c_blanks ) )
+  {
+    if ( numTokens == 0 && token[ 0 ] == '#' )
+      return true;
+
+    if ( numTokens == (int)( sizeof( tokens ) / sizeof( tokens[ 0 ] ) ) )
+    {
+      DBG(( "OSK: Layout line %d: too many fields\n", lineNo_ ));
+      return false;
+    }
+
+    tokens[ numTokens++ ] = token;
+  } // end for
+
+  if ( numTokens == 0 )
+    return true;
+
+  if ( strcmp( tokens[ 0 ], "layer" ) == 0 )
+  {
+    if ( sectionsSeen_ != AllSections )
+    {
+      DBG(( "OSK: Layout line %d: layer %s misses sections\n",
+            lineNo_, m_layers[ m_numLayers - 1 ].name ));
+      return false;
+    }
+
+    if ( numTokens != 3 ||
+         strlen( tokens[ 1 ] ) > (size_t)MaxNameLength ||
+         findLayer( tokens[ 1 ] ) >= 0 ||
+         m_numLayers == MaxLayers )
+    {
+      DBG(( "OSK: Layout line %d: bad, duplicate or too many layers\n",
+            lineNo_ ));
+      return false;
+    }
+
+    const OskImageName * image = NULL;
+    for ( unsigned int i = 0; i < sizeof( c_imageNames ) / sizeof( c_imageNames[ 0 ] ); i++ )
+    {
+      if ( strcmp( tokens[ 2 ], c_imageNames[ i ].name ) == 0 )
+      {
+        image = &c_imageNames[ i ];
+      }
+    }
+
+    if ( image == NULL )
+    {
+      DBG(( "OSK: Layout line %d: unknown image %s\n", lineNo_, tokens[ 2 ] ));
+      return false;
+    }
+
+    Layer & layer = m_layers[ m_numLayers++ ];
+    strcpy( layer.name, tokens[ 1 ] );
+    layer.imgId = image->imgId;
+    layer.activeImgId = image->activeImgId;
+    sectionsSeen_ = 0;
+    return true;
+  }
+
+  if ( strcmp( tokens[ 0 ], "trigger" ) == 0 )
+  {
+    int trig = TRIG_Count;
+    for ( int i = TRIG_None + 1; i < TRIG_Count && numTokens == 3; i++ )
+    {
+      if ( strcmp( tokens[ 1 ], c_triggerNames[ i ] ) == 0 )
+      {
+        trig = i;
+      }
+    }
+
+    // The layer has to be defined already, so triggers go last
+    const int layer = ( trig != TRIG_Count ) ? findLayer( tokens[ 2 ] ) : -1;
+    if ( layer < 0 || m_triggers[ trig ] >= 0 )
+    {
+      DBG(( "OSK: Layout line %d: bad or duplicate trigger\n", lineNo_ ));
+      return false;
+    }
+
+    m_triggers[ trig ] = layer;
+    return true;
+  }
+
+  if ( strcmp( tokens[ 0 ], "chord" ) == 0 )
+  {
+    return parseChord( tokens, numTokens, lineNo_ );
+  }
+
+  int sec = KSID_Count;
+  for ( int i = 0; i < KSID_Count; i++ )
+  {
+    if ( strcmp( tokens[ 0 ], c_sectionNames[ i ] ) == 0 )
+    {
+      sec = i;
+    }
+  }
+
+  if ( sec == KSID_Count || m_numLayers == 0 ||
+       ( sectionsSeen_ & ( 1 << sec ) ) != 0 ||
+       numTokens != 1 + KDID_Count )
+  {
+    DBG(( "OSK: Layout line %d: bad or duplicate section\n", lineNo_ ));
+    return false;
+  }
+
+  int * const keys = &m_keys[ ( ( m_numLayers - 1 ) * KSID_Count + sec ) *
+                              KDID_Count ];
+  for ( int dir = 0; dir < KDID_Count; dir++ )
+  {
+    if ( !parseKey( tokens[ 1 + dir ], keys[ dir ] ) )
+    {
+      DBG(( "OSK: Layout line %d: bad key %s\n", lineNo_, tokens[ 1 + dir ] ));
+      return false;
+    }
+  }
+
+  sectionsSeen_ |= 1 << sec;
+  return true;
+}
+//-----------------------------------------------------------------------------
+void OskLayout::setDefaultChords()
+{
+  m_numChords = sizeof( c_defaultChords ) / sizeof( c_defaultChords[ 0 ] );
+  memcpy( m_chords, c_defaultChords, sizeof( c_defaultChords ) );
+}
+//-----------------------------------------------------------------------------
+bool OskLayout::parseChord
+(
+  const char * const * tokens_,
+  int numTokens_,
+  int lineNo_
+)
+{
+  if ( m_numChords == MaxChords )
+  {
+    DBG(( "OSK: Layout line %d: more than %d chords\n", lineNo_, MaxChords ));
+    return false;
+  }
+
+  Chord & chord = m_chords[ m_numChords ];
+  memset( &chord, 0, sizeof( chord ) );
+
+  int next = 1;
+  if ( next >= numTokens_ || !parseButtons( tokens_[ next++ ], chord.buttons ) )
+  {
+    DBG(( "OSK: Layout line %d: bad chord buttons\n", lineNo_ ));
+    return false;
+  }
+
+  // Optional hold time
+  if ( next < numTokens_ && '0' <= tokens_[ next ][ 0 ] && tokens_[ next ][ 0 ] <= '9' )
+  {
+    char * end;
+    chord.holdTime = strtoul( tokens_[ next++ ], &end, 10 ) * 1000;
+    if ( strcmp( end, "ms" ) != 0 )
+    {
+      DBG(( "OSK: Layout line %d: bad hold time\n", lineNo_ ));
+      return false;
+    }
+  }
+
+  int action = ACT_Count;
+  for ( int i = 0; i < ACT_Count && next < numTokens_; i++ )
+  {
+    if ( c_actionNames[ i ] != NULL &&
+         strcmp( tokens_[ next ], c_actionNames[ i ] ) == 0 )
+    {
+      action = i;
+    }
+  }
+
+  const char * const arg = ( next + 1 < numTokens_ ) ? tokens_[ next + 1 ] : NULL;
+  const int numArgs = numTokens_ - next - 1;
+  bool rt = false;
+
+  switch ( action )
+  {
+  case ACT_Console:
+    if ( numArgs == 1 && strcmp( arg, "next" ) == 0 )
+    {
+      action = ACT_ConsoleNext;
+      rt = true;
+    }
+    else if ( numArgs == 1 && strcmp( arg, "prev" ) == 0 )
+    {
+      action = ACT_ConsolePrev;
+      rt = true;
+    }
+    else if ( numArgs == 1 && '1' <= arg[ 0 ] && arg[ 0 ] <= '6' && arg[ 1 ] == 0 )
+    {
+      // Counted from 1, like the -v option
+      chord.arg = arg[ 0 ] - '1';
+      rt = true;
+    }
+    break;
+
+  case ACT_Screenshot:
+  case ACT_PowerOff:
+  case ACT_Trace:
+    rt = ( numArgs == 0 );
+    break;
+
+  case ACT_Type:
+    rt = ( numArgs == 1 && parseText( arg, chord.text, MaxTextLength ) );
+    break;
+
+  case ACT_LockLayer:
+    chord.arg = ( numArgs == 1 ) ? findLayer( arg ) : -1;
+    rt = ( chord.arg >= 0 );
+    break;
+
+  case ACT_Modifier:
+    for ( unsigned int i = 0;
+          i < sizeof( c_modifierNames ) / sizeof( c_modifierNames[ 0 ] );
+          i++ )
+    {
+      if ( numArgs == 1 && strcmp( arg, c_modifierNames[ i ].name ) == 0 )
+      {
+        chord.arg = c_modifierNames[ i ].key;
+        rt = true;
+      }
+    }
+    break;
+
+  case ACT_Run:
+    {
+      // The arguments go one after another, each with its 0, and there is
+      // no PATH search
+      int length = 0;
+      rt = ( numArgs > 0 && numArgs <= MaxCommandArgs && arg[ 0 ] == '/' );
+      for ( int i = 0; rt && i < numArgs; i++ )
+      {
+        // Whatever is left of chord.text, after the 0 of the last one
+        rt = ( length < MaxTextLength &&
+               parseText( tokens_[ next + 1 + i ], chord.text + length,
+                          MaxTextLength - length ) );
+        if ( rt )
+        {
+          length += strlen( chord.text + length ) + 1;
+        }
+      }
+      chord.arg = numArgs;
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  if ( !rt )
+  {
+    DBG(( "OSK: Layout line %d: bad chord action\n", lineNo_ ));
+    return false;
+  }
+
+  chord.action = (Action)action;
+  m_numChords++;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskLayout::checkChords() const
+{
+  for ( int i = 0; i < m_numChords; i++ )
+  {
+    const Chord & chord = m_chords[ i ];
+
+    // Two actions on one press, and nothing to say which goes first
+    for ( int j = i + 1; j < m_numChords; j++ )
+    {
+      if ( chord.buttons == m_chords[ j ].buttons &&
+           chord.holdTime == m_chords[ j ].holdTime )
+      {
+        DBG(( "OSK: Chords %d and %d are the same\n", i + 1, j + 1 ));
+        return false;
+      }
+    }
+
+    // The chord would take the buttons before the trigger sees them
+    for ( int trig = TRIG_None + 1; trig < TRIG_Count; trig++ )
+    {
+      const unsigned long triggerButtons =
+          ( ( trig & TRIG_L ) ? (unsigned long)OskInput::KEY_LTRG : 0 ) |
+          ( ( trig & TRIG_R ) ? (unsigned long)OskInput::KEY_RTRG : 0 );
+
+      if ( m_triggers[ trig ] >= 0 && chord.buttons == triggerButtons )
+      {
+        DBG(( "OSK: Chord %d hides trigger %s\n", i + 1, c_triggerNames[ trig ] ));
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+int OskLayout::findLayer(const char * name_) const
+{
+  for ( int layer = 0; layer < m_numLayers; layer++ )
+  {
+    if ( strcmp( m_layers[ layer ].name, name_ ) == 0 )
+      return layer;
+  }
+
+  return -1;
+}
+//-----------------------------------------------------------------------------
+bool OskLayout::parseKey(const char * token_, int & key_)
+{
+  if ( token_[ 1 ] == 0 )
+  {
+    key_ = (unsigned char)token_[ 0 ];
+    return true;
+  }
+
+  // ^@ to ^_, and ^? for DEL
+  if ( token_[ 0 ] == '^' && token_[ 2 ] == 0 )
+  {
+    const char c = token_[ 1 ];
+    if ( c == '?' )
+    {
+      key_ = 0x7f;
+      return true;
+    }
+
+    if ( ( '@' <= c && c <= '_' ) || ( 'a' <= c && c <= 'z' ) )
+    {
+      key_ = c & 0x1f;
+      return true;
+    }
+
+    return false;
+  }
+
+  if ( token_[ 0 ] == '0' && ( token_[ 1 ] == 'x' || token_[ 1 ] == 'X' ) )
+  {
+    char * end;
+    const unsigned long value = strtoul( token_, &end, 16 );
+    if ( *end != 0 || value > 0xffffffffUL )
+      return false;
+
+    key_ = (int)value;
+    return true;
+  }
+
+  for ( unsigned int i = 0; i < sizeof( c_keyNames ) / sizeof( c_keyNames[ 0 ] ); i++ )
+  {
+    if ( strcmp( token_, c_keyNames[ i ].name ) == 0 )
+    {
+      key_ = c_keyNames[ i ].key;
+      return true;
+    }
+  }
+
+  return false;
+}
+//-----------------------------------------------------------------------------
+bool OskLayout::parseButtons(const char * token_, unsigned long & buttons_)
+{
+  buttons_ = 0;
+  while ( *token_ != 0 )
+  {
+    const char * const end = strchr( token_, '+' );
+    const size_t length = ( end != NULL ) ? (size_t)( end - token_ )
+                                          : strlen( token_ );
+
+    unsigned long button = 0;
+    for ( unsigned int i = 0; i < sizeof( c_buttonNames ) / sizeof( c_buttonNames[ 0 ] ); i++ )
+    {
+      if ( strlen( c_buttonNames[ i ].name ) == length &&
+           strncmp( token_, c_buttonNames[ i ].name, length ) == 0 )
+      {
+        button = c_buttonNames[ i ].button;
+      }
+    }
+
+    if ( button == 0 || ( buttons_ & button ) != 0 )
+      return false;
+
+    buttons_ |= button;
+    token_ += length;
+    if ( *token_ == '+' )
+    {
+      token_++;
+    }
+  } // end while
+
+  return ( buttons_ != 0 );
+}
+//-----------------------------------------------------------------------------
+bool OskLayout::parseText(const char * token_, char * text_, int maxLength_)
+{
+  int length = 0;
+  for ( const char * c = token_; *c != 0; c++ )
+  {
+    char out = *c;
+    if ( out == '\\' )
+    {
+      switch ( *++c )
+      {
+      case 's':   out = ' ';  break;
+      case 't':   out = '\t'; break;
+      case 'n':   out = '\n'; break;
+      case 'e':   out = 0x1b; break;
+      case '\\':  out = '\\'; break;
+      default:    return false;
+      }
+    }
+
+    if ( length >= maxLength_ )
+      return false;
+
+    text_[ length++ ] = out;
+  } // end for
+
+  text_[ length ] = 0;
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -14,19 +14,19 @@ int main(int argc_, char * argv_[])
 {
   const char * cmdline = NULL;
   OskCore::OskFlags flags;
-  int numVts;
+  OskCore::OskSettings settings;
 
   if ( argc_ >= 2 )
   {
     cmdline = argv_[ 1 ];
   }
 
-  if ( !OskCore::ParseFlags( cmdline, flags, numVts ) )
+  if ( !OskCore::ParseFlags( cmdline, flags, settings ) )
   {
     return 0;
   }
 
-  OskCore core( flags, numVts );
+  OskCore core( flags, settings );
   if ( !core.Initialize( NULL, NULL ) )
   {
     return -1;
@@ -35,6 +35,10 @@ int main(int argc_, char * argv_[])
   // Entering the main loop
   core.Main();
 
+#ifdef DEBUG
+  core.Report( stdout );
+#endif
+
   return 0;
 }
 
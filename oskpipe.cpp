@@ -0,0 +1,419 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+
+//-----------------------------------------------------------------------------
+// Macros
+//-----------------------------------------------------------------------------
+// Neither the compiler nor the CPU may move memory accesses across it
+#define MEMORY_BARRIER()    __sync_synchronize()
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+// How long a producer backs off when the consumer is a whole queue behind
+static const unsigned int QueueFullWait = 1000;    // in us
+
+
+//-----------------------------------------------------------------------------
+// Class: OskQueue
+//-----------------------------------------------------------------------------
+OskQueue::OskQueue()
+  : m_items( NULL ),
+    m_itemSize( 0 ),
+    m_mask( 0 ),
+    m_head( 0 ),
+    m_tail( 0 )
+{
+  m_pipe[ 0 ] = -1;
+  m_pipe[ 1 ] = -1;
+}
+//-----------------------------------------------------------------------------
+OskQueue::~OskQueue()
+{
+  for ( int i = 0; i < 2; i++ )
+  {
+    if ( m_pipe[ i ] >= 0 )
+    {
+      (void)close( m_pipe[ i ] );
+      m_pipe[ i ] = -1;
+    }
+  }
+
+  if ( m_items != NULL )
+  {
+    free( m_items );
+    m_items = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskQueue::Initialize(int itemSize_, int numItems_)
+{
+  if ( numItems_ <= 0 || numItems_ > MaxItems ||
+       ( numItems_ & ( numItems_ - 1 ) ) != 0 )
+  {
+    DBG(( "OSK: Bad queue size %d\n", numItems_ ));
+    return false;
+  }
+
+  m_items = (unsigned char *)malloc( itemSize_ * numItems_ );
+  if ( m_items == NULL )
+    return false;
+
+  if ( pipe( m_pipe ) < 0 )
+  {
+    DBG(( "OSK: Failed to create the queue pipe, err=%d\n", errno ));
+    return false;
+  }
+
+  m_itemSize = itemSize_;
+  m_mask = (unsigned long)( numItems_ - 1 );
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskQueue::Push(const void * item_)
+{
+  const unsigned long head = m_head;
+  if ( head - m_tail > m_mask )
+    return false;
+
+  memcpy( m_items + ( head & m_mask ) * m_itemSize, item_, m_itemSize );
+
+  // The item is complete before the consumer can see it
+  MEMORY_BARRIER();
+  m_head = head + 1;
+
+  const char bell = 0;
+  while ( ::write( m_pipe[ 1 ], &bell, 1 ) < 0 && errno == EINTR )
+  {
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskQueue::Pop(void * item_)
+{
+  // One byte per item, written after the item is in
+  char bell;
+  int rt;
+  while ( ( rt = read( m_pipe[ 0 ], &bell, 1 ) ) < 0 && errno == EINTR )
+  {
+  }
+
+  if ( rt != 1 )
+    return false;
+
+  MEMORY_BARRIER();
+  const unsigned long tail = m_tail;
+  memcpy( item_, m_items + ( tail & m_mask ) * m_itemSize, m_itemSize );
+
+  // The slot is copied out before the producer can reuse it
+  MEMORY_BARRIER();
+  m_tail = tail + 1;
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInputStage
+//-----------------------------------------------------------------------------
+OskInputStage::OskInputStage(OskInput * input_)
+  : OskInput(),
+    m_input( input_ ),
+    m_queue(),
+    m_running( false ),
+    m_end( false ),
+    m_readTime( 0 ),
+    m_numEvents( 0 ),
+    m_numStalls( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+OskInputStage::~OskInputStage()
+{
+  if ( m_running )
+  {
+    // Most likely waiting on the joypad, in a cancellation point
+    (void)pthread_cancel( m_thread );
+    (void)pthread_join( m_thread, NULL );
+    m_running = false;
+  }
+
+  if ( m_input != NULL )
+  {
+    delete m_input;
+    m_input = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskInputStage::Initialize(void * param_)
+{
+  if ( !m_input->Initialize( param_ ) )
+    return false;
+
+  if ( !m_queue.Initialize( sizeof( Event ), QueueItems ) )
+    return false;
+
+  if ( pthread_create( &m_thread, NULL, threadMain, this ) != 0 )
+  {
+    DBG(( "OSK: Failed to start the input thread\n" ));
+    return false;
+  }
+
+  m_running = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+unsigned long OskInputStage::ReadKeys()
+{
+  if ( m_end )
+    return 0;
+
+  Event event;
+  if ( !m_queue.Pop( &event ) )
+  {
+    DBG(( "OSK: Failed to take a joypad word from the input thread\n" ));
+    m_end = true;
+    return 0;
+  }
+
+  m_numEvents++;
+  m_readTime = event.time;
+  m_end = ( event.end != 0 );
+  return event.keys;
+}
+//-----------------------------------------------------------------------------
+void OskInputStage::Report(FILE * file_)
+{
+  fprintf( file_, "input stage: events=%lu stalls=%lu\n",
+           m_numEvents, m_numStalls );
+  m_input->Report( file_ );
+}
+//-----------------------------------------------------------------------------
+void * OskInputStage::threadMain(void * param_)
+{
+  ( (OskInputStage *)param_ )->run();
+  return NULL;
+}
+//-----------------------------------------------------------------------------
+void OskInputStage::run()
+{
+  for ( ;; )
+  {
+    Event event;
+    event.keys = m_input->ReadKeys();
+    event.time = OskClock::Now();
+    event.end = m_input->IsEnd() ? 1 : 0;
+
+    // The state machine is a whole queue behind; the joypad driver holds
+    // on to whatever comes meanwhile
+    while ( !m_queue.Push( &event ) )
+    {
+      m_numStalls++;
+      (void)usleep( QueueFullWait );
+    }
+
+    if ( event.end )
+      break;
+  } // end for
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskConsoleStage
+//-----------------------------------------------------------------------------
+OskConsoleStage::OskConsoleStage(OskConsole * console_, OskStats & stats_)
+  : OskConsole(),
+    m_console( console_ ),
+    m_stats( stats_ ),
+    m_queue(),
+    m_running( false ),
+    m_eventTime( 0 ),
+    m_numPosted( 0 ),
+    m_numStalls( 0 ),
+    m_numDrains( 0 ),
+    m_numWritten( 0 ),
+    m_failed( false )
+{
+  m_ackPipe[ 0 ] = -1;
+  m_ackPipe[ 1 ] = -1;
+}
+//-----------------------------------------------------------------------------
+OskConsoleStage::~OskConsoleStage()
+{
+  if ( m_running )
+  {
+    // Everything typed still goes out before the thread stops
+    Batch batch;
+    batch.eventTime = 0;
+    batch.count = BatchStop;
+    (void)post( batch );
+    (void)pthread_join( m_thread, NULL );
+    m_running = false;
+  }
+
+  for ( int i = 0; i < 2; i++ )
+  {
+    if ( m_ackPipe[ i ] >= 0 )
+    {
+      (void)close( m_ackPipe[ i ] );
+      m_ackPipe[ i ] = -1;
+    }
+  }
+
+  if ( m_console != NULL )
+  {
+    delete m_console;
+    m_console = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskConsoleStage::Initialize(void * param_)
+{
+  if ( !m_console->Initialize( param_ ) )
+    return false;
+
+  if ( !m_queue.Initialize( sizeof( Batch ), QueueItems ) )
+    return false;
+
+  if ( pipe( m_ackPipe ) < 0 )
+  {
+    DBG(( "OSK: Failed to create the console ack pipe, err=%d\n", errno ));
+    return false;
+  }
+
+  if ( pthread_create( &m_thread, NULL, threadMain, this ) != 0 )
+  {
+    DBG(( "OSK: Failed to start the console thread\n" ));
+    return false;
+  }
+
+  m_running = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+int OskConsoleStage::ChangeConsole(int con_)
+{
+  drain();
+  return m_console->ChangeConsole( con_ );
+}
+//-----------------------------------------------------------------------------
+bool OskConsoleStage::Update()
+{
+  drain();
+  return m_console->Update();
+}
+//-----------------------------------------------------------------------------
+void OskConsoleStage::Report(FILE * file_)
+{
+  fprintf( file_, "console stage: batches=%lu stalls=%lu drains=%lu\n",
+           m_numPosted, m_numStalls, m_numDrains );
+}
+//-----------------------------------------------------------------------------
+bool OskConsoleStage::write(const char * bytes_, int count_)
+{
+  Batch batch;
+  batch.eventTime = m_eventTime;
+  batch.count = count_;
+  memcpy( batch.bytes, bytes_, count_ );
+  m_eventTime = 0;
+
+  // A failure on the console thread shows up on the next batch
+  return post( batch ) && !m_failed;
+}
+//-----------------------------------------------------------------------------
+bool OskConsoleStage::post(const Batch & batch_)
+{
+  if ( !m_running )
+    return false;
+
+  while ( !m_queue.Push( &batch_ ) )
+  {
+    m_numStalls++;
+    (void)usleep( QueueFullWait );
+  }
+
+  m_numPosted++;
+  return true;
+}
+//-----------------------------------------------------------------------------
+void OskConsoleStage::drain()
+{
+  if ( m_numWritten == m_numPosted )
+    return;
+
+  // The queue is in order, so once the marker is answered every batch
+  // before it is written
+  Batch batch;
+  batch.eventTime = 0;
+  batch.count = BatchAck;
+  if ( !post( batch ) )
+    return;
+
+  m_numDrains++;
+  char ack;
+  while ( read( m_ackPipe[ 0 ], &ack, 1 ) < 0 && errno == EINTR )
+  {
+  }
+
+  MEMORY_BARRIER();
+}
+//-----------------------------------------------------------------------------
+void * OskConsoleStage::threadMain(void * param_)
+{
+  ( (OskConsoleStage *)param_ )->run();
+  return NULL;
+}
+//-----------------------------------------------------------------------------
+void OskConsoleStage::run()
+{
+  Batch batch;
+  while ( m_queue.Pop( &batch ) && batch.count != BatchStop )
+  {
+    if ( batch.count != BatchAck )
+    {
+      // The send stages are timed here rather than in OskCore::flushKeys(),
+      // which only queues
+      const unsigned long sendTime = m_stats.Start();
+      if ( !m_console->write( batch.bytes, batch.count ) )
+      {
+        m_failed = true;
+      }
+
+      m_stats.AddSince( OskStats::STAGE_Send, sendTime );
+      if ( batch.eventTime != 0 )
+      {
+        m_stats.AddSince( OskStats::STAGE_ToSend, batch.eventTime );
+      }
+    }
+
+    MEMORY_BARRIER();
+    m_numWritten++;
+
+    if ( batch.count == BatchAck )
+    {
+      const char ack = 0;
+      while ( ::write( m_ackPipe[ 1 ], &ack, 1 ) < 0 && errno == EINTR )
+      {
+      }
+    }
+  } // end while
+
+  m_numWritten++;
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,441 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+//-----------------------------------------------------------------------------
+// Classes
+//-----------------------------------------------------------------------------
+class OskInput_Record;
+class OskInput_Replay;
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const char c_recordEnv[]             = "OSK_RECORD";
+static const char c_replayEnv[]             = "OSK_REPLAY";
+static const char c_replaySpeedEnv[]        = "OSK_REPLAY_SPEED";
+static const char c_replaySpeedMax[]        = "max";
+
+
+//-----------------------------------------------------------------------------
+// Type definitions
+//-----------------------------------------------------------------------------
+// A recording is the magic and version words, then one of these per word
+// returned by ReadKeys(), all in native byte order
+typedef struct
+{
+  unsigned int delay;     // us since the previous word was returned
+  unsigned int keys;
+} OskReplayRecord;
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+static const char * getPath(const char * env_)
+{
+  const char * path = getenv( env_ );
+  return ( path != NULL && *path != 0 ) ? path : NULL;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Record
+//
+// Passes through another input and writes down every word it returns.
+//-----------------------------------------------------------------------------
+class OskInput_Record : public OskInput
+{
+public:
+  OskInput_Record(OskInput * input_);
+  virtual ~OskInput_Record();
+
+  virtual bool Initialize(void * param_);
+  virtual unsigned long ReadKeys();
+
+  virtual bool IsEnd()
+  {
+    return m_input->IsEnd();
+  }
+
+  virtual int GetFd()
+  {
+    return m_input->GetFd();
+  }
+
+  virtual bool WaitForKeys(int timeout_)
+  {
+    return m_input->WaitForKeys( timeout_ );
+  }
+
+  virtual void Report(FILE * file_);
+
+protected:
+  OskInput * m_input;
+  FILE * m_file;
+  unsigned long m_lastTime;
+  unsigned long m_numRecords;
+
+private:
+  // Not implemented
+  OskInput_Record();
+  OskInput_Record(const OskInput_Record &);
+  OskInput_Record & operator = (const OskInput_Record &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Replay
+//
+// Feeds a recording back on its recorded schedule, each word due the
+// recorded gap after the one before. Waiting for a word stops at the
+// core's timer timeout, so timers fire between the words as they did
+// live; at full speed the clock is moved ahead instead of slept, which
+// keeps the timers in step without the wait. The time from handing out
+// one word to being asked for the next is what the core spent on it,
+// which is reported. Read without waiting, as the input stage does, the
+// words come at the recorded pace or as fast as they are taken.
+//-----------------------------------------------------------------------------
+class OskInput_Replay : public OskInput
+{
+public:
+  OskInput_Replay();
+  virtual ~OskInput_Replay();
+
+  virtual bool Initialize(void * param_);
+  virtual unsigned long ReadKeys();
+  virtual bool WaitForKeys(int timeout_);
+
+  virtual bool IsEnd()
+  {
+    return m_end;
+  }
+
+  virtual void Report(FILE * file_);
+
+protected:
+  bool loadNext();
+  void endProcessing();
+
+  FILE * m_file;
+  bool m_maxSpeed;
+  bool m_end;
+  bool m_haveNext;          // m_next is read, and due at m_due
+  bool m_processing;        // The core has the last word
+  OskReplayRecord m_next;
+  unsigned long m_due;
+  unsigned long m_startTime;
+  unsigned long m_lastTime;
+  unsigned long m_endTime;
+  unsigned long m_numEvents;
+  unsigned long m_processTime;
+  unsigned long m_maxProcessTime;
+  unsigned long m_sleepTime;
+  unsigned long m_skipTime;
+
+private:
+  // Not implemented
+  OskInput_Replay(const OskInput_Replay &);
+  OskInput_Replay & operator = (const OskInput_Replay &);
+};
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Record
+//-----------------------------------------------------------------------------
+OskInput_Record::OskInput_Record(OskInput * input_)
+  : OskInput(),
+    m_input( input_ ),
+    m_file( NULL ),
+    m_lastTime( 0 ),
+    m_numRecords( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+OskInput_Record::~OskInput_Record()
+{
+  if ( m_file != NULL )
+  {
+    (void)fclose( m_file );
+    m_file = NULL;
+  }
+
+  if ( m_input != NULL )
+  {
+    delete m_input;
+    m_input = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Record::Initialize(void * param_)
+{
+  if ( !m_input->Initialize( param_ ) )
+    return false;
+
+  const char * path = getPath( c_recordEnv );
+  m_file = fopen( path, "wb" );
+  if ( m_file == NULL )
+  {
+    DBG(( "OSK: Failed to open %s for recording\n", path ));
+    return false;
+  }
+
+  const unsigned int header[ 2 ] = { OskReplay::FileMagic,
+                                      OskReplay::FileVersion };
+  if ( fwrite( header, sizeof( header ), 1, m_file ) != 1 )
+    return false;
+
+  m_lastTime = OskClock::Now();
+  return true;
+}
+//-----------------------------------------------------------------------------
+unsigned long OskInput_Record::ReadKeys()
+{
+  const unsigned long keys = m_input->ReadKeys();
+  if ( m_input->IsEnd() )
+    return keys;
+
+  const unsigned long now = OskClock::Now();
+
+  OskReplayRecord record;
+  record.delay = (unsigned int)( now - m_lastTime );
+  record.keys = (unsigned int)keys;
+  m_lastTime = now;
+
+  // Flushed every time, so a session that is killed is still usable
+  if ( fwrite( &record, sizeof( record ), 1, m_file ) != 1 ||
+       fflush( m_file ) != 0 )
+  {
+    DBG(( "OSK: Failed to record joypad word %08lx\n", keys ));
+  }
+  else
+  {
+    m_numRecords++;
+  }
+
+  return keys;
+}
+//-----------------------------------------------------------------------------
+void OskInput_Record::Report(FILE * file_)
+{
+  fprintf( file_, "record: words=%lu\n", m_numRecords );
+  m_input->Report( file_ );
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskInput_Replay
+//-----------------------------------------------------------------------------
+OskInput_Replay::OskInput_Replay()
+  : OskInput(),
+    m_file( NULL ),
+    m_maxSpeed( false ),
+    m_end( false ),
+    m_haveNext( false ),
+    m_processing( false ),
+    m_due( 0 ),
+    m_startTime( 0 ),
+    m_lastTime( 0 ),
+    m_endTime( 0 ),
+    m_numEvents( 0 ),
+    m_processTime( 0 ),
+    m_maxProcessTime( 0 ),
+    m_sleepTime( 0 ),
+    m_skipTime( 0 )
+{
+  memset( &m_next, 0, sizeof( m_next ) );
+}
+//-----------------------------------------------------------------------------
+OskInput_Replay::~OskInput_Replay()
+{
+  if ( m_file != NULL )
+  {
+    (void)fclose( m_file );
+    m_file = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Replay::Initialize(void * param_)
+{
+  const char * path = getPath( c_replayEnv );
+  m_file = fopen( path, "rb" );
+  if ( m_file == NULL )
+  {
+    DBG(( "OSK: Failed to open %s for replay\n", path ));
+    return false;
+  }
+
+  unsigned int header[ 2 ];
+  if ( fread( header, sizeof( header ), 1, m_file ) != 1 ||
+       header[ 0 ] != OskReplay::FileMagic ||
+       header[ 1 ] != OskReplay::FileVersion )
+  {
+    DBG(( "OSK: %s is not a joypad recording\n", path ));
+    return false;
+  }
+
+  const char * speed = getenv( c_replaySpeedEnv );
+  m_maxSpeed = ( speed != NULL && strcmp( speed, c_replaySpeedMax ) == 0 );
+  return true;
+}
+//-----------------------------------------------------------------------------
+unsigned long OskInput_Replay::ReadKeys()
+{
+  if ( m_file == NULL || m_end )
+    return 0;
+
+  endProcessing();
+  if ( !loadNext() )
+  {
+    m_end = true;
+    m_endTime = OskClock::Now();
+    return 0;
+  }
+
+  // Not waited for; keep the recorded pace unless told otherwise
+  const long left = (long)( m_due - OskClock::Now() );
+  if ( !m_maxSpeed && left > 0 )
+  {
+    (void)usleep( (unsigned long)left );
+    m_sleepTime += (unsigned long)left;
+  }
+
+  m_haveNext = false;
+  m_processing = true;
+  m_numEvents++;
+  m_lastTime = OskClock::Now();
+  return m_next.keys;
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Replay::WaitForKeys(int timeout_)
+{
+  if ( m_file == NULL || m_end )
+    return true;
+
+  // At the end ReadKeys() has to find out and say so
+  endProcessing();
+  if ( !loadNext() )
+    return true;
+
+  const long left = (long)( m_due - OskClock::Now() );
+  if ( left <= 0 )
+    return true;
+
+  unsigned long wait = (unsigned long)left;
+  bool ready = true;
+  if ( timeout_ >= 0 && (unsigned long)timeout_ * 1000 < wait )
+  {
+    wait = (unsigned long)timeout_ * 1000;
+    ready = false;
+  }
+
+  if ( m_maxSpeed )
+  {
+    OskClock::Skip( wait );
+    m_skipTime += wait;
+  }
+  else
+  {
+    (void)usleep( wait );
+    m_sleepTime += wait;
+  }
+
+  return ready;
+}
+//-----------------------------------------------------------------------------
+bool OskInput_Replay::loadNext()
+{
+  if ( m_haveNext )
+    return true;
+
+  if ( fread( &m_next, sizeof( m_next ), 1, m_file ) != 1 )
+    return false;
+
+  // The recorded gap includes the time the core took, so it runs from
+  // when the last word was handed out
+  const unsigned long now = OskClock::Now();
+  if ( m_numEvents == 0 )
+  {
+    m_startTime = now;
+    m_due = now;
+  }
+  else
+  {
+    m_due = m_lastTime + m_next.delay;
+  }
+
+  m_haveNext = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+void OskInput_Replay::endProcessing()
+{
+  if ( !m_processing )
+    return;
+
+  const unsigned long elapsed = OskClock::Now() - m_lastTime;
+  m_processTime += elapsed;
+  if ( elapsed > m_maxProcessTime )
+    m_maxProcessTime = elapsed;
+
+  m_processing = false;
+}
+//-----------------------------------------------------------------------------
+void OskInput_Replay::Report(FILE * file_)
+{
+  // Skipped time never passed
+  const unsigned long wall =
+      ( m_end ? m_endTime : m_lastTime ) - m_startTime - m_skipTime;
+  const unsigned long busy = wall - m_sleepTime;
+
+  fprintf( file_,
+           "replay: speed=%s events=%lu wall-us=%lu events-per-sec=%lu "
+           "process-avg-us=%lu process-max-us=%lu\n",
+           m_maxSpeed ? "max" : "real",
+           m_numEvents,
+           wall,
+           ( busy != 0 )
+               ? (unsigned long)( (double)m_numEvents * 1000000.0 / busy )
+               : 0,
+           ( m_numEvents != 0 ) ? m_processTime / m_numEvents : 0,
+           m_maxProcessTime );
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskReplay
+//-----------------------------------------------------------------------------
+bool OskReplay::IsRecording()
+{
+  return ( getPath( c_recordEnv ) != NULL );
+}
+//-----------------------------------------------------------------------------
+bool OskReplay::IsReplaying()
+{
+  return ( getPath( c_replayEnv ) != NULL );
+}
+//-----------------------------------------------------------------------------
+OskInput * OskReplay::CreateRecorder(OskInput * input_)
+{
+  return new OskInput_Record( input_ );
+}
+//-----------------------------------------------------------------------------
+OskInput * OskReplay::CreateInput()
+{
+  return new OskInput_Replay();
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,1452 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const int BmpFileHeaderSize = 14;
+static const int BmpInfoHeaderSize = 40;
+static const int BmpPixelsPerMeter = 2834;    // 72 DPI
+static const int BmpRle8 = 1;                 // BI_RLE8
+static const int ShotBufferSize = 4096;
+static const int PngIdatSize = 8192;
+static const int QoiHeaderSize = 14;
+
+
+//-----------------------------------------------------------------------------
+// Static Data
+//-----------------------------------------------------------------------------
+static char s_screenshotDir[] = "/usr/screenshots";
+static char s_screenshotPrefix[] = "screenshot";
+
+static const unsigned char s_pngSignature[ 8 ] =
+{
+  0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+};
+
+// Deflate length codes 257-285: base length and number of extra bits
+static const unsigned short s_deflateLengthBase[ 29 ] =
+{
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const unsigned char s_deflateLengthExtra[ 29 ] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+static inline void put16(unsigned char * p_, unsigned long v_)
+{
+  p_[ 0 ] = (unsigned char)( v_ & 0xff );
+  p_[ 1 ] = (unsigned char)( ( v_ >> 8 ) & 0xff );
+}
+//-----------------------------------------------------------------------------
+static inline void put32(unsigned char * p_, unsigned long v_)
+{
+  put16( p_, v_ & 0xffff );
+  put16( p_ + 2, ( v_ >> 16 ) & 0xffff );
+}
+//-----------------------------------------------------------------------------
+static inline void putBe32(unsigned char * p_, unsigned long v_)
+{
+  p_[ 0 ] = (unsigned char)( ( v_ >> 24 ) & 0xff );
+  p_[ 1 ] = (unsigned char)( ( v_ >> 16 ) & 0xff );
+  p_[ 2 ] = (unsigned char)( ( v_ >> 8 ) & 0xff );
+  p_[ 3 ] = (unsigned char)( v_ & 0xff );
+}
+//-----------------------------------------------------------------------------
+static unsigned long updateCrc
+(
+  const unsigned long * table_,
+  unsigned long crc_,
+  const unsigned char * data_,
+  int size_
+)
+{
+  for ( int i = 0; i < size_; i++ )
+  {
+    crc_ = table_[ ( crc_ ^ data_[ i ] ) & 0xff ] ^ ( crc_ >> 8 );
+  }
+
+  return crc_;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskScreenshot::Sink
+//
+// Buffered output that counts what passes through it. Without a file it
+// only counts, which is what the benchmark wants.
+//-----------------------------------------------------------------------------
+class OskScreenshot::Sink
+{
+public:
+  Sink(FILE * file_);
+  ~Sink();
+
+  bool IsValid() const
+  {
+    return ( m_buf != NULL );
+  }
+
+  bool PutByte(unsigned char c_)
+  {
+    if ( m_used == ShotBufferSize && !Flush() )
+      return false;
+
+    m_buf[ m_used++ ] = c_;
+    return true;
+  }
+
+  bool Put(const void * data_, int size_);
+  bool Flush();
+
+  // Rewrites bytes already flushed, for sizes only known at the end
+  bool Patch(long offset_, const unsigned char * data_, int size_);
+
+  unsigned long GetCount() const
+  {
+    return m_count + m_used;
+  }
+
+protected:
+  FILE *          m_file;
+  unsigned char * m_buf;
+  int             m_used;
+  unsigned long   m_count;
+
+private:
+  // Not implemented
+  Sink();
+  Sink(const Sink &);
+  Sink & operator = (const Sink &);
+};
+//-----------------------------------------------------------------------------
+OskScreenshot::Sink::Sink(FILE * file_)
+  : m_file( file_ ),
+    m_buf( new unsigned char[ ShotBufferSize ] ),
+    m_used( 0 ),
+    m_count( 0 )
+{
+}
+//-----------------------------------------------------------------------------
+OskScreenshot::Sink::~Sink()
+{
+  if ( m_buf != NULL )
+  {
+    delete[] m_buf;
+    m_buf = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Sink::Put(const void * data_, int size_)
+{
+  if ( m_used + size_ <= ShotBufferSize )
+  {
+    memcpy( m_buf + m_used, data_, size_ );
+    m_used += size_;
+    return true;
+  }
+
+  if ( !Flush() )
+    return false;
+
+  if ( size_ < ShotBufferSize )
+  {
+    memcpy( m_buf, data_, size_ );
+    m_used = size_;
+    return true;
+  }
+
+  // Big enough to go straight to the file, no point copying it again
+  if ( m_file != NULL &&
+       fwrite( data_, 1, size_, m_file ) != (size_t)size_ )
+  {
+    return false;
+  }
+
+  m_count += size_;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Sink::Flush()
+{
+  if ( m_used == 0 )
+    return true;
+
+  if ( m_file != NULL &&
+       fwrite( m_buf, 1, m_used, m_file ) != (size_t)m_used )
+  {
+    return false;
+  }
+
+  m_count += m_used;
+  m_used = 0;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Sink::Patch
+(
+  long offset_,
+  const unsigned char * data_,
+  int size_
+)
+{
+  if ( !Flush() )
+    return false;
+
+  if ( m_file == NULL )
+    return true;
+
+  return ( fseek( m_file, offset_, SEEK_SET ) == 0 &&
+           fwrite( data_, 1, size_, m_file ) == (size_t)size_ &&
+           fseek( m_file, 0, SEEK_END ) == 0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskScreenshot::Palette
+//
+// Up to 256 colours, hashed on the colour for the per-pixel lookups.
+//-----------------------------------------------------------------------------
+class OskScreenshot::Palette
+{
+public:
+  Palette();
+
+  // Index of the colour, or -1 when it is not in the palette
+  int Find(OskPixel32 color_) const;
+
+  // Index of the colour, adding it if needed; -1 when the palette is full
+  int Add(OskPixel32 color_);
+
+  int GetCount() const
+  {
+    return m_count;
+  }
+
+  OskPixel32 GetColor(int index_) const
+  {
+    return m_colors[ index_ ];
+  }
+
+  static const int MaxColors = 256;
+
+protected:
+  static const int HashSize = 1024;   // Power of 2, at most 1/4 full
+
+  static int hash(OskPixel32 color_)
+  {
+    return (int)( ( color_ * 0x9e3779b1u ) >> 22 ) & ( HashSize - 1 );
+  }
+
+  int         m_count;
+  OskPixel32  m_colors[ MaxColors ];
+  short       m_slots[ HashSize ];
+};
+//-----------------------------------------------------------------------------
+OskScreenshot::Palette::Palette()
+  : m_count( 0 )
+{
+  memset( m_slots, 0xff, sizeof( m_slots ) );
+}
+//-----------------------------------------------------------------------------
+int OskScreenshot::Palette::Find(OskPixel32 color_) const
+{
+  for ( int i = hash( color_ ); m_slots[ i ] >= 0; i = ( i + 1 ) & ( HashSize - 1 ) )
+  {
+    if ( m_colors[ m_slots[ i ] ] == color_ )
+      return m_slots[ i ];
+  }
+
+  return -1;
+}
+//-----------------------------------------------------------------------------
+int OskScreenshot::Palette::Add(OskPixel32 color_)
+{
+  int i = hash( color_ );
+  for ( ; m_slots[ i ] >= 0; i = ( i + 1 ) & ( HashSize - 1 ) )
+  {
+    if ( m_colors[ m_slots[ i ] ] == color_ )
+      return m_slots[ i ];
+  }
+
+  if ( m_count == MaxColors )
+    return -1;
+
+  m_colors[ m_count ] = color_;
+  m_slots[ i ] = (short)m_count;
+  return m_count++;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskScreenshot::Deflater
+//
+// The zlib stream inside a PNG's IDAT chunks: one fixed-Huffman block, in
+// which the only matches are runs of the previous byte (distance 1). After
+// the PNG Sub filter a run of one colour is a run of zeros, which is most
+// of a console screen. Every full IDAT buffer goes out as its own chunk.
+//-----------------------------------------------------------------------------
+class OskScreenshot::Deflater
+{
+public:
+  Deflater(const OskScreenshot & shot_, Sink & sink_);
+  ~Deflater();
+
+  bool IsValid() const
+  {
+    return ( m_idat != NULL );
+  }
+
+  bool Begin();
+  bool Write(const unsigned char * data_, int size_);
+  bool End();
+
+protected:
+  bool putBits(unsigned long value_, int count_);
+  bool putLiteral(int symbol_);
+  bool putRun();
+  bool putByte(unsigned char c_);
+  bool flushIdat();
+
+  const OskScreenshot & m_shot;
+  Sink &                m_sink;
+  unsigned char *       m_idat;
+  int                   m_idatUsed;
+  unsigned long         m_bitBuf;
+  int                   m_bitCount;
+  int                   m_last;
+  int                   m_run;
+  unsigned long         m_adlerA;
+  unsigned long         m_adlerB;
+  unsigned short        m_litCodes[ 288 ];
+  unsigned char         m_litLengths[ 288 ];
+
+private:
+  // Not implemented
+  Deflater();
+  Deflater(const Deflater &);
+  Deflater & operator = (const Deflater &);
+};
+//-----------------------------------------------------------------------------
+OskScreenshot::Deflater::Deflater(const OskScreenshot & shot_, Sink & sink_)
+  : m_shot( shot_ ),
+    m_sink( sink_ ),
+    m_idat( new unsigned char[ PngIdatSize ] ),
+    m_idatUsed( 0 ),
+    m_bitBuf( 0 ),
+    m_bitCount( 0 ),
+    m_last( -1 ),
+    m_run( 0 ),
+    m_adlerA( 1 ),
+    m_adlerB( 0 )
+{
+  // The fixed literal/length code of RFC 1951 3.2.6, bit-reversed since
+  // bits are packed starting from the least significant one
+  for ( int sym = 0; sym < 288; sym++ )
+  {
+    int code, length;
+    if ( sym < 144 )
+    {
+      code = 0x30 + sym;
+      length = 8;
+    }
+    else if ( sym < 256 )
+    {
+      code = 0x190 + sym - 144;
+      length = 9;
+    }
+    else if ( sym < 280 )
+    {
+      code = sym - 256;
+      length = 7;
+    }
+    else
+    {
+      code = 0xc0 + sym - 280;
+      length = 8;
+    }
+
+    int reversed = 0;
+    for ( int i = 0; i < length; i++ )
+    {
+      reversed = ( reversed << 1 ) | ( ( code >> i ) & 1 );
+    }
+
+    m_litCodes[ sym ] = (unsigned short)reversed;
+    m_litLengths[ sym ] = (unsigned char)length;
+  }
+}
+//-----------------------------------------------------------------------------
+OskScreenshot::Deflater::~Deflater()
+{
+  if ( m_idat != NULL )
+  {
+    delete[] m_idat;
+    m_idat = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::Begin()
+{
+  // zlib header: deflate with a 32K window, no dictionary, fastest
+  return ( putByte( 0x78 ) &&
+           putByte( 0x01 ) &&
+           putBits( 1, 1 ) &&     // BFINAL, this is the only block
+           putBits( 1, 2 ) );     // BTYPE 01, fixed Huffman
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::Write(const unsigned char * data_, int size_)
+{
+  // Adler-32; 5552 bytes is the most that cannot overflow before the modulo
+  for ( int done = 0; done < size_; )
+  {
+    const int count = ( size_ - done < 5552 ) ? size_ - done : 5552;
+    for ( int i = 0; i < count; i++ )
+    {
+      m_adlerA += data_[ done + i ];
+      m_adlerB += m_adlerA;
+    }
+    m_adlerA %= 65521;
+    m_adlerB %= 65521;
+    done += count;
+  }
+
+  for ( int i = 0; i < size_; i++ )
+  {
+    const int c = data_[ i ];
+    if ( c == m_last )
+    {
+      if ( ++m_run == 258 && !putRun() )
+        return false;
+
+      continue;
+    }
+
+    if ( !putRun() || !putLiteral( c ) )
+      return false;
+
+    m_last = c;
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::End()
+{
+  if ( !putRun() || !putLiteral( 256 ) )
+    return false;
+
+  // Pad to a byte, then the checksum, most significant byte first
+  if ( m_bitCount > 0 && !putBits( 0, 8 - m_bitCount ) )
+    return false;
+
+  const unsigned long adler = ( m_adlerB << 16 ) | m_adlerA;
+  return ( putByte( (unsigned char)( adler >> 24 ) ) &&
+           putByte( (unsigned char)( adler >> 16 ) ) &&
+           putByte( (unsigned char)( adler >> 8 ) ) &&
+           putByte( (unsigned char)adler ) &&
+           flushIdat() );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::putBits(unsigned long value_, int count_)
+{
+  m_bitBuf |= value_ << m_bitCount;
+  m_bitCount += count_;
+
+  while ( m_bitCount >= 8 )
+  {
+    if ( !putByte( (unsigned char)( m_bitBuf & 0xff ) ) )
+      return false;
+
+    m_bitBuf >>= 8;
+    m_bitCount -= 8;
+  }
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::putLiteral(int symbol_)
+{
+  return putBits( m_litCodes[ symbol_ ], m_litLengths[ symbol_ ] );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::putRun()
+{
+  const int run = m_run;
+  m_run = 0;
+
+  // Too short for a match, repeat the literal
+  if ( run < 3 )
+  {
+    for ( int i = 0; i < run; i++ )
+    {
+      if ( !putLiteral( m_last ) )
+        return false;
+    }
+    return true;
+  }
+
+  int code = 28;
+  while ( s_deflateLengthBase[ code ] > run )
+  {
+    code--;
+  }
+
+  // Distance 1 is distance code 0, five zero bits
+  return ( putLiteral( 257 + code ) &&
+           putBits( run - s_deflateLengthBase[ code ],
+                    s_deflateLengthExtra[ code ] ) &&
+           putBits( 0, 5 ) );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::putByte(unsigned char c_)
+{
+  if ( m_idatUsed == PngIdatSize && !flushIdat() )
+    return false;
+
+  m_idat[ m_idatUsed++ ] = c_;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Deflater::flushIdat()
+{
+  if ( m_idatUsed == 0 )
+    return true;
+
+  const bool rt = m_shot.writePngChunk( m_sink, "IDAT", m_idat, m_idatUsed );
+  m_idatUsed = 0;
+  return rt;
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskScreenshot
+//-----------------------------------------------------------------------------
+OskScreenshot::OskScreenshot()
+  : m_width( 0 ),
+    m_height( 0 ),
+    m_format(),
+    m_rowBuf( NULL ),
+    m_encoder( ENC_Bmp ),
+    m_nextFileIndex( 0 ),
+    m_numSlots( 0 ),
+    m_seq( 0 ),
+    m_workerRowBuf( NULL ),
+    m_workerRunning( false ),
+    m_stopWorker( false ),
+    m_numShots( 0 ),
+    m_numBytes( 0 ),
+    m_totalTime( 0 ),
+    m_numCaptures( 0 ),
+    m_captureTime( 0 ),
+    m_numCoalesced( 0 ),
+    m_numDropped( 0 )
+{
+  memset( m_slots, 0, sizeof( m_slots ) );
+
+  // CRC-32 as used by PNG chunks
+  for ( unsigned long n = 0; n < 256; n++ )
+  {
+    unsigned long c = n;
+    for ( int k = 0; k < 8; k++ )
+    {
+      c = ( c & 1 ) ? ( 0xedb88320 ^ ( c >> 1 ) ) : ( c >> 1 );
+    }
+    m_crcTable[ n ] = c;
+  }
+
+  (void)pthread_mutex_init( &m_mutex, NULL );
+  (void)pthread_cond_init( &m_cond, NULL );
+}
+//-----------------------------------------------------------------------------
+OskScreenshot::~OskScreenshot()
+{
+  release();
+  (void)pthread_cond_destroy( &m_cond );
+  (void)pthread_mutex_destroy( &m_mutex );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Initialize
+(
+  int width_,
+  int height_,
+  const OskPixelFormat & format_,
+  int numSlots_,
+  Encoder encoder_
+)
+{
+  release();
+
+  m_width = width_;
+  m_height = height_;
+  m_format = format_;
+  m_encoder = ( ENC_First <= encoder_ && encoder_ < ENC_Count ) ? encoder_
+                                                                : ENC_Bmp;
+  m_rowBuf = new OskPixel32[ width_ ];
+  if ( m_rowBuf == NULL )
+    return false;
+
+  if ( numSlots_ <= 0 )
+    return true;
+
+  if ( numSlots_ > MaxSlots )
+    numSlots_ = MaxSlots;
+
+  // Allocate everything up front; capturing must never allocate
+  const int slotSize = width_ * height_ * format_.GetBytesPerPixel();
+  for ( m_numSlots = 0; m_numSlots < numSlots_; m_numSlots++ )
+  {
+    Slot & slot = m_slots[ m_numSlots ];
+    slot.state = SLOT_FREE;
+    slot.seq = 0;
+    slot.bits = new unsigned char[ slotSize ];
+    if ( slot.bits == NULL )
+      break;
+  }
+
+  m_workerRowBuf = new OskPixel32[ width_ ];
+  if ( m_numSlots == 0 || m_workerRowBuf == NULL )
+  {
+    DBG(( "OSK: No memory for background screenshots\n" ));
+    release();
+    m_rowBuf = new OskPixel32[ width_ ];
+    return ( m_rowBuf != NULL );
+  }
+
+  m_stopWorker = false;
+  if ( pthread_create( &m_worker, NULL, workerMain, this ) != 0 )
+  {
+    DBG(( "OSK: Failed to start the screenshot writer\n" ));
+    release();
+    m_rowBuf = new OskPixel32[ width_ ];
+    return ( m_rowBuf != NULL );
+  }
+
+  m_workerRunning = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Capture(OskCanvas & canvas_)
+{
+  if ( m_rowBuf == NULL ||
+       canvas_.GetWidth() != m_width || canvas_.GetHeight() != m_height )
+  {
+    return false;
+  }
+
+  if ( !m_workerRunning )
+  {
+    // Synchronous: stream straight from the canvas into the file
+    FILE * newFile = createNewFile( GetEncoderExtension( m_encoder ) );
+    if ( newFile == NULL )
+      return false;
+
+    const bool rt = write( newFile, readCanvasRow, &canvas_, m_rowBuf );
+    (void)fclose( newFile );
+    return rt;
+  }
+
+  const unsigned long start = OskClock::Now();
+  (void)pthread_mutex_lock( &m_mutex );
+
+  // A free slot, or else the newest shot that is still waiting
+  Slot * slot = NULL;
+  for ( int i = 0; i < m_numSlots; i++ )
+  {
+    if ( m_slots[ i ].state == SLOT_FREE )
+    {
+      slot = &m_slots[ i ];
+      break;
+    }
+  }
+
+  if ( slot == NULL )
+  {
+    for ( int i = 0; i < m_numSlots; i++ )
+    {
+      if ( m_slots[ i ].state == SLOT_PENDING &&
+           ( slot == NULL || m_slots[ i ].seq > slot->seq ) )
+      {
+        slot = &m_slots[ i ];
+      }
+    }
+
+    if ( slot == NULL )
+    {
+      m_numDropped++;
+      (void)pthread_mutex_unlock( &m_mutex );
+      return false;
+    }
+
+    m_numCoalesced++;
+  }
+
+  // The worker never touches a pending slot without the lock, so the copy
+  // can be done while holding it; it is a plain memcpy of the page
+  const bool rt = canvas_.CopyVisible(
+      slot->bits, m_width * m_height * m_format.GetBytesPerPixel() );
+
+  if ( rt )
+  {
+    slot->state = SLOT_PENDING;
+    slot->seq = ++m_seq;
+    m_numCaptures++;
+    m_captureTime += OskClock::Now() - start;
+    (void)pthread_cond_signal( &m_cond );
+  }
+  else
+  {
+    slot->state = SLOT_FREE;
+  }
+
+  (void)pthread_mutex_unlock( &m_mutex );
+  return rt;
+}
+//-----------------------------------------------------------------------------
+void OskScreenshot::Report(FILE * file_)
+{
+  (void)pthread_mutex_lock( &m_mutex );
+
+  // Bytes per us is the same as MB/s
+  fprintf( file_,
+           "screenshot: encoder=%s shots=%lu bytes=%lu us=%lu rate=%lu KB/s "
+           "buffer=%lu bytes\n",
+           GetEncoderName( m_encoder ),
+           m_numShots,
+           m_numBytes,
+           m_totalTime,
+           ( m_totalTime != 0 )
+               ? (unsigned long)( (double)m_numBytes * 1000000.0 /
+                                  1024.0 / m_totalTime )
+               : 0,
+           (unsigned long)( m_width * sizeof( OskPixel32 ) ) );
+
+  if ( m_workerRunning )
+  {
+    fprintf( file_,
+             "screenshot queue: slots=%d captures=%lu capture-avg-us=%lu "
+             "coalesced=%lu dropped=%lu\n",
+             m_numSlots,
+             m_numCaptures,
+             ( m_numCaptures != 0 ) ? m_captureTime / m_numCaptures : 0,
+             m_numCoalesced,
+             m_numDropped );
+  }
+
+  (void)pthread_mutex_unlock( &m_mutex );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::Benchmark(OskCanvas & canvas_, FILE * file_)
+{
+  if ( canvas_.GetWidth() != m_width || canvas_.GetHeight() != m_height )
+    return false;
+
+  // Every encoder sees the same frame, read from memory
+  const int size = m_width * m_height * m_format.GetBytesPerPixel();
+  unsigned char * const bits = new unsigned char[ size ];
+  OskPixel32 * const rowBuf = new OskPixel32[ m_width ];
+
+  bool rt = ( bits != NULL && rowBuf != NULL &&
+              canvas_.CopyVisible( bits, size ) );
+
+  unsigned long rawBytes = 0;
+  for ( int enc = ENC_First; rt && enc < ENC_Count; enc++ )
+  {
+    Sink sink( NULL );
+    SlotReader reader = { this, bits };
+
+    const unsigned long start = OskClock::Now();
+    rt = ( sink.IsValid() &&
+           encode( (Encoder)enc, sink, readSlotRow, &reader, rowBuf ) &&
+           sink.Flush() );
+    const unsigned long elapsed = OskClock::Now() - start;
+
+    if ( enc == ENC_Bmp )
+      rawBytes = sink.GetCount();
+
+    fprintf( file_,
+             "screenshot bench: encoder=%s bytes=%lu ratio=%lu%% us=%lu\n",
+             GetEncoderName( (Encoder)enc ),
+             sink.GetCount(),
+             ( rawBytes != 0 ) ? sink.GetCount() * 100 / rawBytes : 0,
+             elapsed );
+  }
+
+  if ( rowBuf != NULL )
+    delete[] rowBuf;
+
+  if ( bits != NULL )
+    delete[] bits;
+
+  return rt;
+}
+//-----------------------------------------------------------------------------
+const char * OskScreenshot::GetEncoderName(Encoder encoder_)
+{
+  switch ( encoder_ )
+  {
+  case ENC_Rle8:  return "rle8";
+  case ENC_Png:   return "png";
+  case ENC_Qoi:   return "qoi";
+  default:        return "bmp";
+  }
+}
+//-----------------------------------------------------------------------------
+const char * OskScreenshot::GetEncoderExtension(Encoder encoder_)
+{
+  switch ( encoder_ )
+  {
+  case ENC_Png:   return "png";
+  case ENC_Qoi:   return "qoi";
+  default:        return "bmp";
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::write
+(
+  FILE * file_,
+  RowReader reader_,
+  void * context_,
+  OskPixel32 * rowBuf_
+)
+{
+  const unsigned long start = OskClock::Now();
+
+  // The sink does all the buffering
+  (void)setvbuf( file_, NULL, _IONBF, 0 );
+
+  Sink sink( file_ );
+  if ( !sink.IsValid() ||
+       !encode( m_encoder, sink, reader_, context_, rowBuf_ ) ||
+       !sink.Flush() )
+  {
+    return false;
+  }
+
+  (void)pthread_mutex_lock( &m_mutex );
+  m_numShots++;
+  m_numBytes += sink.GetCount();
+  m_totalTime += OskClock::Now() - start;
+  (void)pthread_mutex_unlock( &m_mutex );
+
+  return true;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::encode
+(
+  Encoder encoder_,
+  Sink & sink_,
+  RowReader reader_,
+  void * context_,
+  OskPixel32 * rowBuf_
+) const
+{
+  switch ( encoder_ )
+  {
+  case ENC_Rle8:
+    return encodeRle8( sink_, reader_, context_, rowBuf_ );
+  case ENC_Png:
+    return encodePng( sink_, reader_, context_, rowBuf_ );
+  case ENC_Qoi:
+    return encodeQoi( sink_, reader_, context_, rowBuf_ );
+  default:
+    return encodeBmp( sink_, reader_, context_, rowBuf_ );
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::encodeBmp
+(
+  Sink & sink_,
+  RowReader reader_,
+  void * context_,
+  OskPixel32 * rowBuf_
+) const
+{
+  const int rowSize = m_width * sizeof( OskPixel32 );
+
+  unsigned char header[ BmpHeaderSize ];
+  MakeBmpHeader( header, m_width, m_height );
+  if ( !sink_.Put( header, sizeof( header ) ) )
+    return false;
+
+  // The header says top-down, so rows go out in screen order
+  for ( int y = 0; y < m_height; y++ )
+  {
+    if ( !reader_( context_, y, rowBuf_ ) ||
+         !sink_.Put( rowBuf_, rowSize ) )
+    {
+      return false;
+    }
+  }
+
+  // Write the ending
+  const unsigned char ending[ 2 ] = { 0, 0 };
+  return sink_.Put( ending, sizeof( ending ) );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::encodeRle8
+(
+  Sink & sink_,
+  RowReader reader_,
+  void * context_,
+  OskPixel32 * rowBuf_
+) const
+{
+  // First pass collects the palette; too many colours and it's a raw BMP
+  Palette palette;
+  for ( int y = 0; y < m_height; y++ )
+  {
+    if ( !reader_( context_, y, rowBuf_ ) )
+      return false;
+
+    OskPixel32 last = ~rowBuf_[ 0 ];
+    for ( int x = 0; x < m_width; x++ )
+    {
+      if ( rowBuf_[ x ] == last )
+        continue;
+
+      last = rowBuf_[ x ];
+      if ( palette.Add( last ) < 0 )
+        return encodeBmp( sink_, reader_, context_, rowBuf_ );
+    }
+  }
+
+  unsigned char * const indices = new unsigned char[ m_width ];
+  if ( indices == NULL )
+    return false;
+
+  // Same header as the raw one, except RLE bitmaps are always bottom-up
+  const int numColors = palette.GetCount();
+  const unsigned long dataOffset = BmpHeaderSize + numColors * 4;
+  unsigned char header[ BmpHeaderSize ];
+  MakeBmpHeader( header, m_width, m_height );
+  put32( header + 2, 0 );
+  put32( header + 10, dataOffset );
+
+  unsigned char * info = header + BmpFileHeaderSize;
+  put32( info + 8, (unsigned long)m_height );
+  put16( info + 14, 8 );
+  put32( info + 16, BmpRle8 );
+  put32( info + 20, 0 );
+  put32( info + 32, (unsigned long)numColors );
+  put32( info + 36, (unsigned long)numColors );
+
+  bool rt = sink_.Put( header, sizeof( header ) );
+  for ( int i = 0; rt && i < numColors; i++ )
+  {
+    unsigned char entry[ 4 ];
+    put32( entry, palette.GetColor( i ) );
+    rt = sink_.Put( entry, sizeof( entry ) );
+  }
+
+  for ( int y = m_height - 1; rt && y >= 0; y-- )
+  {
+    rt = reader_( context_, y, rowBuf_ );
+    if ( !rt )
+      break;
+
+    // A colour that showed up between the passes gets index 0
+    for ( int x = 0; x < m_width; x++ )
+    {
+      const int index = palette.Find( rowBuf_[ x ] );
+      indices[ x ] = (unsigned char)( ( index < 0 ) ? 0 : index );
+    }
+
+    for ( int x = 0; rt && x < m_width; )
+    {
+      int run = 1;
+      while ( x + run < m_width && run < 255 &&
+              indices[ x + run ] == indices[ x ] )
+      {
+        run++;
+      }
+
+      // Encoded mode: a count and an index
+      if ( run > 1 )
+      {
+        rt = ( sink_.PutByte( (unsigned char)run ) &&
+               sink_.PutByte( indices[ x ] ) );
+        x += run;
+        continue;
+      }
+
+      // Literal up to the next run of three
+      int count = 0;
+      while ( x + count < m_width && count < 255 &&
+              !( x + count + 2 < m_width &&
+                 indices[ x + count ] == indices[ x + count + 1 ] &&
+                 indices[ x + count ] == indices[ x + count + 2 ] ) )
+      {
+        count++;
+      }
+
+      if ( count < 3 )
+      {
+        // Absolute mode needs at least 3, these are cheaper one by one
+        for ( int i = 0; rt && i < count; i++ )
+        {
+          rt = ( sink_.PutByte( 1 ) && sink_.PutByte( indices[ x + i ] ) );
+        }
+      }
+      else
+      {
+        // Absolute mode, padded to a 16-bit boundary
+        rt = ( sink_.PutByte( 0 ) &&
+               sink_.PutByte( (unsigned char)count ) &&
+               sink_.Put( indices + x, count ) &&
+               ( ( count & 1 ) == 0 || sink_.PutByte( 0 ) ) );
+      }
+      x += count;
+    }
+
+    // End of line, or end of bitmap after the last one
+    rt = rt && sink_.PutByte( 0 ) && sink_.PutByte( ( y == 0 ) ? 1 : 0 );
+  }
+
+  delete[] indices;
+
+  if ( !rt )
+    return false;
+
+  // Now the sizes are known
+  unsigned char size[ 4 ];
+  put32( size, sink_.GetCount() );
+  if ( !sink_.Patch( 2, size, sizeof( size ) ) )
+    return false;
+
+  put32( size, sink_.GetCount() - dataOffset );
+  return sink_.Patch( BmpFileHeaderSize + 20, size, sizeof( size ) );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::encodePng
+(
+  Sink & sink_,
+  RowReader reader_,
+  void * context_,
+  OskPixel32 * rowBuf_
+) const
+{
+  // 8-bit RGB, no interlacing
+  unsigned char header[ 13 ];
+  putBe32( header, (unsigned long)m_width );
+  putBe32( header + 4, (unsigned long)m_height );
+  header[ 8 ] = 8;
+  header[ 9 ] = 2;
+  header[ 10 ] = 0;
+  header[ 11 ] = 0;
+  header[ 12 ] = 0;
+
+  if ( !sink_.Put( s_pngSignature, sizeof( s_pngSignature ) ) ||
+       !writePngChunk( sink_, "IHDR", header, sizeof( header ) ) )
+  {
+    return false;
+  }
+
+  // Filter type byte, then the row
+  const int lineSize = 1 + m_width * 3;
+  unsigned char * const line = new unsigned char[ lineSize ];
+  if ( line == NULL )
+    return false;
+
+  Deflater deflater( *this, sink_ );
+  bool rt = ( deflater.IsValid() && deflater.Begin() );
+
+  for ( int y = 0; rt && y < m_height; y++ )
+  {
+    rt = reader_( context_, y, rowBuf_ );
+    if ( !rt )
+      break;
+
+    // Sub filter: the difference from the pixel to the left, so a run of
+    // one colour turns into a run of zeros
+    unsigned char * dest = line;
+    *dest++ = 1;
+
+    OskPixel32 left = 0;
+    for ( int x = 0; x < m_width; x++ )
+    {
+      const OskPixel32 pixel = rowBuf_[ x ];
+      *dest++ = (unsigned char)( ( pixel >> 16 ) - ( left >> 16 ) );
+      *dest++ = (unsigned char)( ( pixel >> 8 ) - ( left >> 8 ) );
+      *dest++ = (unsigned char)( pixel - left );
+      left = pixel;
+    }
+
+    rt = deflater.Write( line, lineSize );
+  }
+
+  delete[] line;
+
+  return ( rt &&
+           deflater.End() &&
+           writePngChunk( sink_, "IEND", NULL, 0 ) );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::encodeQoi
+(
+  Sink & sink_,
+  RowReader reader_,
+  void * context_,
+  OskPixel32 * rowBuf_
+) const
+{
+  // "qoif", width, height, 3 channels, sRGB
+  unsigned char header[ QoiHeaderSize ];
+  memcpy( header, "qoif", 4 );
+  putBe32( header + 4, (unsigned long)m_width );
+  putBe32( header + 8, (unsigned long)m_height );
+  header[ 12 ] = 3;
+  header[ 13 ] = 0;
+
+  if ( !sink_.Put( header, sizeof( header ) ) )
+    return false;
+
+  // Colours are kept as 0xAARRGGBB; alpha is always 255, and the empty
+  // index entries, all zero, then never match
+  OskPixel32 index[ 64 ];
+  memset( index, 0, sizeof( index ) );
+
+  OskPixel32 prev = 0xff000000;
+  int run = 0;
+
+  for ( int y = 0; y < m_height; y++ )
+  {
+    if ( !reader_( context_, y, rowBuf_ ) )
+      return false;
+
+    for ( int x = 0; x < m_width; x++ )
+    {
+      const OskPixel32 pixel = rowBuf_[ x ] | 0xff000000;
+      if ( pixel == prev )
+      {
+        if ( ++run == 62 )
+        {
+          if ( !sink_.PutByte( (unsigned char)( 0xc0 | ( run - 1 ) ) ) )
+            return false;
+          run = 0;
+        }
+        continue;
+      }
+
+      if ( run > 0 )
+      {
+        if ( !sink_.PutByte( (unsigned char)( 0xc0 | ( run - 1 ) ) ) )
+          return false;
+        run = 0;
+      }
+
+      const int r = ( pixel >> 16 ) & 0xff;
+      const int g = ( pixel >> 8 ) & 0xff;
+      const int b = pixel & 0xff;
+      const int hash = ( r * 3 + g * 5 + b * 7 + 255 * 11 ) & 63;
+
+      bool ok;
+      if ( index[ hash ] == pixel )
+      {
+        ok = sink_.PutByte( (unsigned char)hash );
+      }
+      else
+      {
+        index[ hash ] = pixel;
+
+        const int dr = (signed char)( r - ( ( prev >> 16 ) & 0xff ) );
+        const int dg = (signed char)( g - ( ( prev >> 8 ) & 0xff ) );
+        const int db = (signed char)( b - ( prev & 0xff ) );
+        const int drg = dr - dg;
+        const int dbg = db - dg;
+
+        if ( -2 <= dr && dr <= 1 && -2 <= dg && dg <= 1 && -2 <= db && db <= 1 )
+        {
+          ok = sink_.PutByte( (unsigned char)( 0x40 | ( ( dr + 2 ) << 4 ) |
+                                               ( ( dg + 2 ) << 2 ) | ( db + 2 ) ) );
+        }
+        else if ( -32 <= dg && dg <= 31 &&
+                  -8 <= drg && drg <= 7 && -8 <= dbg && dbg <= 7 )
+        {
+          ok = ( sink_.PutByte( (unsigned char)( 0x80 | ( dg + 32 ) ) ) &&
+                 sink_.PutByte( (unsigned char)( ( ( drg + 8 ) << 4 ) | ( dbg + 8 ) ) ) );
+        }
+        else
+        {
+          ok = ( sink_.PutByte( 0xfe ) &&
+                 sink_.PutByte( (unsigned char)r ) &&
+                 sink_.PutByte( (unsigned char)g ) &&
+                 sink_.PutByte( (unsigned char)b ) );
+        }
+      }
+
+      if ( !ok )
+        return false;
+
+      prev = pixel;
+    }
+  }
+
+  if ( run > 0 && !sink_.PutByte( (unsigned char)( 0xc0 | ( run - 1 ) ) ) )
+    return false;
+
+  // End marker
+  const unsigned char ending[ 8 ] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+  return sink_.Put( ending, sizeof( ending ) );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::writePngChunk
+(
+  Sink & sink_,
+  const char * type_,
+  const unsigned char * data_,
+  int size_
+) const
+{
+  unsigned char buf[ 4 ];
+  putBe32( buf, (unsigned long)size_ );
+  if ( !sink_.Put( buf, sizeof( buf ) ) || !sink_.Put( type_, 4 ) )
+    return false;
+
+  if ( size_ > 0 && !sink_.Put( data_, size_ ) )
+    return false;
+
+  // The CRC covers the type and the data
+  unsigned long crc = 0xffffffff;
+  crc = updateCrc( m_crcTable, crc, (const unsigned char *)type_, 4 );
+  crc = updateCrc( m_crcTable, crc, data_, size_ );
+
+  putBe32( buf, crc ^ 0xffffffff );
+  return sink_.Put( buf, sizeof( buf ) );
+}
+//-----------------------------------------------------------------------------
+void OskScreenshot::release()
+{
+  if ( m_workerRunning )
+  {
+    // Let the worker drain what is queued, then stop
+    (void)pthread_mutex_lock( &m_mutex );
+    m_stopWorker = true;
+    (void)pthread_cond_signal( &m_cond );
+    (void)pthread_mutex_unlock( &m_mutex );
+
+    (void)pthread_join( m_worker, NULL );
+    m_workerRunning = false;
+  }
+
+  for ( int i = 0; i < MaxSlots; i++ )
+  {
+    if ( m_slots[ i ].bits != NULL )
+    {
+      delete[] m_slots[ i ].bits;
+    }
+  }
+  memset( m_slots, 0, sizeof( m_slots ) );
+  m_numSlots = 0;
+
+  if ( m_workerRowBuf != NULL )
+  {
+    delete[] m_workerRowBuf;
+    m_workerRowBuf = NULL;
+  }
+
+  if ( m_rowBuf != NULL )
+  {
+    delete[] m_rowBuf;
+    m_rowBuf = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+void OskScreenshot::worker()
+{
+  (void)pthread_mutex_lock( &m_mutex );
+
+  while ( true )
+  {
+    // Oldest pending shot first
+    Slot * slot = NULL;
+    for ( int i = 0; i < m_numSlots; i++ )
+    {
+      if ( m_slots[ i ].state == SLOT_PENDING &&
+           ( slot == NULL || m_slots[ i ].seq < slot->seq ) )
+      {
+        slot = &m_slots[ i ];
+      }
+    }
+
+    if ( slot == NULL )
+    {
+      if ( m_stopWorker )
+        break;
+
+      (void)pthread_cond_wait( &m_cond, &m_mutex );
+      continue;
+    }
+
+    slot->state = SLOT_WRITING;
+    (void)pthread_mutex_unlock( &m_mutex );
+
+    FILE * newFile = createNewFile( GetEncoderExtension( m_encoder ) );
+    if ( newFile != NULL )
+    {
+      SlotReader reader = { this, slot->bits };
+      if ( !write( newFile, readSlotRow, &reader, m_workerRowBuf ) )
+      {
+        DBG(( "OSK: Failed to write screenshot\n" ));
+      }
+      (void)fclose( newFile );
+    }
+
+    (void)pthread_mutex_lock( &m_mutex );
+    slot->state = SLOT_FREE;
+  }
+
+  (void)pthread_mutex_unlock( &m_mutex );
+}
+//-----------------------------------------------------------------------------
+void * OskScreenshot::workerMain(void * self_)
+{
+  ( (OskScreenshot *)self_ )->worker();
+  return NULL;
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::readCanvasRow(void * context_, int y_, OskPixel32 * buf_)
+{
+  return ( (OskCanvas *)context_ )->GetRow( y_, buf_ );
+}
+//-----------------------------------------------------------------------------
+bool OskScreenshot::readSlotRow(void * context_, int y_, OskPixel32 * buf_)
+{
+  const SlotReader * reader = (const SlotReader *)context_;
+  const OskScreenshot * shot = reader->shot;
+  const int pitch = shot->m_width * shot->m_format.GetBytesPerPixel();
+
+  shot->m_format.UnpackRow( buf_, reader->bits + y_ * pitch, shot->m_width );
+  return true;
+}
+//-----------------------------------------------------------------------------
+FILE * OskScreenshot::createNewFile(const char * extension_)
+{
+  // Other writers may have taken a name since the scan; O_EXCL catches
+  // that and the next index is tried
+  for ( int tries = 0; tries < MaxFileRetries; tries++ )
+  {
+    (void)pthread_mutex_lock( &m_mutex );
+    if ( m_nextFileIndex == 0 )
+    {
+      m_nextFileIndex = scanLastFileIndex() + 1;
+    }
+    const int index = m_nextFileIndex++;
+    (void)pthread_mutex_unlock( &m_mutex );
+
+    const size_t fileNameLen = 80;
+    char fileName[ fileNameLen + 1 ];
+
+    (void)snprintf( fileName, fileNameLen, "%s/%s%04d.%s",
+                    s_screenshotDir, s_screenshotPrefix, index, extension_ );
+    fileName[ fileNameLen ] = 0;
+
+    const int fd = open( fileName, O_WRONLY | O_CREAT | O_EXCL, 0644 );
+    if ( fd < 0 )
+    {
+      if ( errno == EEXIST )
+        continue;
+
+      DBG(( "OSK: Failed to create %s, err=%d\n", fileName, errno ));
+      return NULL;
+    }
+
+    FILE * newFile = fdopen( fd, "wb" );
+    if ( newFile == NULL )
+    {
+      (void)close( fd );
+      (void)unlink( fileName );
+    }
+
+    return newFile;
+  }
+
+  return NULL;
+}
+//-----------------------------------------------------------------------------
+int OskScreenshot::scanLastFileIndex()
+{
+  DIR * dir = opendir( s_screenshotDir );
+  if ( dir == NULL )
+    return 0;
+
+  // Highest index of any format, they all share one sequence
+  const size_t prefixLen = strlen( s_screenshotPrefix );
+  int last = 0;
+
+  struct dirent * entry;
+  while ( ( entry = readdir( dir ) ) != NULL )
+  {
+    const char * name = entry->d_name;
+    if ( strncmp( name, s_screenshotPrefix, prefixLen ) != 0 )
+      continue;
+
+    int index = 0;
+    const char * c = name + prefixLen;
+    for ( ; '0' <= *c && *c <= '9'; c++ )
+    {
+      index = index * 10 + ( *c - '0' );
+    }
+
+    if ( *c == '.' && index > last )
+    {
+      last = index;
+    }
+  }
+
+  (void)closedir( dir );
+  return last;
+}
+//-----------------------------------------------------------------------------
+void OskScreenshot::MakeBmpHeader
+(
+  unsigned char * header_,
+  int width_,
+  int height_
+)
+{
+  const unsigned long imageSize =
+      (unsigned long)width_ * height_ * sizeof( OskPixel32 );
+
+  memset( header_, 0, BmpHeaderSize );
+
+  // BITMAPFILEHEADER, the size includes the 2-byte ending
+  header_[ 0 ] = 'B';
+  header_[ 1 ] = 'M';
+  put32( header_ + 2, BmpHeaderSize + imageSize + 2 );
+  put32( header_ + 10, BmpHeaderSize );
+
+  // BITMAPINFOHEADER, a negative height makes it top-down
+  unsigned char * info = header_ + BmpFileHeaderSize;
+  put32( info, BmpInfoHeaderSize );
+  put32( info + 4, (unsigned long)width_ );
+  put32( info + 8, (unsigned long)( -height_ ) );
+  put16( info + 12, 1 );
+  put16( info + 14, 32 );
+  put32( info + 24, BmpPixelsPerMeter );
+  put32( info + 28, BmpPixelsPerMeter );
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
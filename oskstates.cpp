@@ -8,19 +8,72 @@
 //-----------------------------------------------------------------------------
 // Static data
 //-----------------------------------------------------------------------------
-const OskImage::ImageId OskCore::ActiveState::c_kbdImg[ KBID_Count ] =
+// Each entry is a constant expression of its index, which is
+// ( flags * ANALOG_POS_Count + stick ) * 16 + d-pad. The rules are tried in
+// order, so the corners win over the sides, and the first that the d-pad
+// or the stick satisfies gives the section and the d-pad bits it takes.
+#define SEC_UP            OskInput::KEY_ARROW_UP
+#define SEC_RT            OskInput::KEY_ARROW_RT
+#define SEC_DN            OskInput::KEY_ARROW_DN
+#define SEC_LT            OskInput::KEY_ARROW_LT
+#define SEC_DPAD(i_)      ( (i_) & 0xf )
+#define SEC_POS(i_)       ( ( (i_) >> 4 ) % OskCore::ANALOG_POS_Count )
+#define SEC_FLAGS(i_)     ( ( (i_) >> 4 ) / OskCore::ANALOG_POS_Count )
+#define SEC_HIT(i_, dpad_, pos_) \
+  ( ( ( SEC_FLAGS( i_ ) & OskCore::FLAGS_USE_DPAD ) && \
+      ( SEC_DPAD( i_ ) & (dpad_) ) == (dpad_) ) || \
+    ( ( SEC_FLAGS( i_ ) & OskCore::FLAGS_USE_ANALOG ) && \
+      SEC_POS( i_ ) == OskCore::pos_ ) )
+#define SEC_RULE(i_, dpad_, pos_, section_) \
+  SEC_HIT( i_, dpad_, pos_ ) ? ( ( (section_) << 4 ) | (dpad_) ) :
+#define SEC_ENTRY(i_) \
+  (unsigned char)( \
+    SEC_RULE( i_, SEC_UP | SEC_LT, ANALOG_POS_UPLEFT,    KSID_TopLeft ) \
+    SEC_RULE( i_, SEC_UP | SEC_RT, ANALOG_POS_UPRIGHT,   KSID_TopRight ) \
+    SEC_RULE( i_, SEC_DN | SEC_LT, ANALOG_POS_DOWNLEFT,  KSID_BottomLeft ) \
+    SEC_RULE( i_, SEC_DN | SEC_RT, ANALOG_POS_DOWNRIGHT, KSID_BottomRight ) \
+    SEC_RULE( i_, SEC_UP,          ANALOG_POS_UP,        KSID_Top ) \
+    SEC_RULE( i_, SEC_DN,          ANALOG_POS_DOWN,      KSID_Bottom ) \
+    SEC_RULE( i_, SEC_LT,          ANALOG_POS_LEFT,      KSID_Left ) \
+    SEC_RULE( i_, SEC_RT,          ANALOG_POS_RIGHT,     KSID_Right ) \
+    ( KSID_Center << 4 ) )
+#define SEC_ROW(r_) \
+  SEC_ENTRY( (r_) * 16 +  0 ), SEC_ENTRY( (r_) * 16 +  1 ), \
+  SEC_ENTRY( (r_) * 16 +  2 ), SEC_ENTRY( (r_) * 16 +  3 ), \
+  SEC_ENTRY( (r_) * 16 +  4 ), SEC_ENTRY( (r_) * 16 +  5 ), \
+  SEC_ENTRY( (r_) * 16 +  6 ), SEC_ENTRY( (r_) * 16 +  7 ), \
+  SEC_ENTRY( (r_) * 16 +  8 ), SEC_ENTRY( (r_) * 16 +  9 ), \
+  SEC_ENTRY( (r_) * 16 + 10 ), SEC_ENTRY( (r_) * 16 + 11 ), \
+  SEC_ENTRY( (r_) * 16 + 12 ), SEC_ENTRY( (r_) * 16 + 13 ), \
+  SEC_ENTRY( (r_) * 16 + 14 ), SEC_ENTRY( (r_) * 16 + 15 )
+#define SEC_FLAGS_ROWS(f_) \
+  SEC_ROW( (f_) * 9 + 0 ), SEC_ROW( (f_) * 9 + 1 ), SEC_ROW( (f_) * 9 + 2 ), \
+  SEC_ROW( (f_) * 9 + 3 ), SEC_ROW( (f_) * 9 + 4 ), SEC_ROW( (f_) * 9 + 5 ), \
+  SEC_ROW( (f_) * 9 + 6 ), SEC_ROW( (f_) * 9 + 7 ), SEC_ROW( (f_) * 9 + 8 )
+
+// One row per stick position, so it breaks if the positions change
+typedef char SectionTableRows[ ( OskCore::ANALOG_POS_Count == 9 ) ? 1 : -1 ];
+
+const unsigned char OskCore::s_sectionTable[ OskCore::SectionTableSize ] =
 {
-  OskImage::IMGID_Eng,  // KBID_Eng
-  OskImage::IMGID_Cap,  // KBID_Cap
-  OskImage::IMGID_Num,  // KBID_Num
+  SEC_FLAGS_ROWS( 0 ),    // Neither
+  SEC_FLAGS_ROWS( 1 ),    // FLAGS_USE_DPAD
+  SEC_FLAGS_ROWS( 2 ),    // FLAGS_USE_ANALOG
+  SEC_FLAGS_ROWS( 3 ),    // Both
 };
 
-const OskImage::ImageId OskCore::ActiveState::c_kbdImgActive[ KBID_Count ] =
-{
-  OskImage::IMGID_EngActive,  // KBID_Eng
-  OskImage::IMGID_CapActive,  // KBID_Cap
-  OskImage::IMGID_NumActive,  // KBID_Num
-};
+#undef SEC_FLAGS_ROWS
+#undef SEC_ROW
+#undef SEC_ENTRY
+#undef SEC_RULE
+#undef SEC_HIT
+#undef SEC_FLAGS
+#undef SEC_POS
+#undef SEC_DPAD
+#undef SEC_LT
+#undef SEC_DN
+#undef SEC_RT
+#undef SEC_UP
 
 
 //-----------------------------------------------------------------------------
@@ -44,40 +97,9 @@ void OskCore::BaseState::exitState()
 //-----------------------------------------------------------------------------
 OskCore::BaseState * OskCore::BaseState::processKeys()
 {
-  // +
-  if ( m_core.m_keys & OskInput::KEY_VOL_UP )
-  {
-    m_core.m_keys &= ~OskInput::KEY_VOL_UP;
-    (void)m_core.changeConsole( 1 );
-  }
-
-  // -
-  if ( m_core.m_keys & OskInput::KEY_VOL_DN )
-  {
-    m_core.m_keys &= ~OskInput::KEY_VOL_DN;
-    (void)m_core.changeConsole( -1 );
-  }
-
-  // LCD
-  if ( m_core.m_keys & OskInput::KEY_LCD )
-  {
-    m_core.m_keys &= ~OskInput::KEY_LCD;
-    if ( !m_core.takeScreenshot() )
-    {
-      DBG(( "OSK: Failed to take screenshot\n" ));
-    }
-  }
-
-  // HOME + CIRCLE + CROSS
-  if ( ( m_core.m_keys & OskInput::KEY_HOME ) &&
-       ( m_core.m_keys & OskInput::KEY_CIRCLE ) &&
-       ( m_core.m_keys & OskInput::KEY_CROSS ) )
-  {
-    m_core.m_keys &= ~( OskInput::KEY_HOME |
-                        OskInput::KEY_CIRCLE |
-                        OskInput::KEY_CROSS );
-    (void)m_core.shutdown();
-  }
+  // Console switching, screenshots, power off and whatever else the
+  // layout binds to a chord
+  m_core.m_chords.Match( m_core.m_keys );
 
   return this;
 }
@@ -138,13 +160,13 @@ OskCore::BaseState * OskCore::MouseState::processKeys()
 //-----------------------------------------------------------------------------
 bool OskCore::MouseState::draw()
 {
-  if ( !m_core.clear() )
+  if ( !m_core.beginFrame() )
     return false;
 
-  if ( !m_core.drawImage( OskImage::IMGID_Mouse ) )
-    return false;
+  const bool rt = m_core.clear() &&
+                  m_core.drawImage( OskImage::IMGID_Mouse );
 
-  return true;
+  return m_core.commitFrame() && rt;
 }
 
 
@@ -181,23 +203,17 @@ OskCore::BaseState * OskCore::KbdState::processKeys()
     return &m_core.m_mouseState;
   }
 
-  // L + R
-  if ( ( m_core.m_keys & OskInput::KEY_LTRG ) &&
-       ( m_core.m_keys & OskInput::KEY_RTRG ) )
-  {
-    return &m_core.m_activeCapState;
-  }
-
-  // R
-  if ( m_core.m_keys & OskInput::KEY_RTRG )
+  // L, R or L + R, or else a locked layer
+  int layer = m_core.m_layout.GetTriggerLayer(
+                  OskLayout::GetTrigger( m_core.m_keys ) );
+  if ( layer < 0 )
   {
-    return &m_core.m_activeEngState;
+    layer = m_core.m_lockedLayer;
   }
 
-  // L
-  if ( m_core.m_keys & OskInput::KEY_LTRG )
+  if ( layer >= 0 )
   {
-    return &m_core.m_activeNumState;
+    return m_core.m_activeStates[ layer ];
   }
 
   return &m_core.m_idleState;
@@ -205,39 +221,38 @@ OskCore::BaseState * OskCore::KbdState::processKeys()
 //-----------------------------------------------------------------------------
 OskCore::BaseState * OskCore::KbdState::processKeysFinal
 (
-  OskKeyboardId kbdId_,
+  int layer_,
   OskKeySectionId secId_
 )
 {
-  const OskKeySection & section =
-      s_OskKeyboards[ kbdId_ ].sections[ secId_ ];
+  const int * const keys = m_core.m_layout.GetKeys( layer_, secId_ );
 
   // Rectangle
   if ( m_core.m_keys & OskInput::KEY_RECTANGLE )
   {
     m_core.m_keys &= ~OskInput::KEY_RECTANGLE;
-    (void)m_core.sendKey( section.keys[ KDID_Left ] );
+    (void)m_core.typeKey( OskInput::KEY_RECTANGLE, keys[ KDID_Left ] );
   }
 
   // Triangle
   if ( m_core.m_keys & OskInput::KEY_TRIANGLE )
   {
     m_core.m_keys &= ~OskInput::KEY_TRIANGLE;
-    (void)m_core.sendKey( section.keys[ KDID_Top ] );
+    (void)m_core.typeKey( OskInput::KEY_TRIANGLE, keys[ KDID_Top ] );
   }
 
   // Circle
   if ( m_core.m_keys & OskInput::KEY_CIRCLE )
   {
     m_core.m_keys &= ~OskInput::KEY_CIRCLE;
-    (void)m_core.sendKey( section.keys[ KDID_Right ] );
+    (void)m_core.typeKey( OskInput::KEY_CIRCLE, keys[ KDID_Right ] );
   }
 
   // Cross
   if ( m_core.m_keys & OskInput::KEY_CROSS )
   {
     m_core.m_keys &= ~OskInput::KEY_CROSS;
-    (void)m_core.sendKey( section.keys[ KDID_Bottom ] );
+    (void)m_core.typeKey( OskInput::KEY_CROSS, keys[ KDID_Bottom ] );
   }
 
   return this;
@@ -278,52 +293,55 @@ OskCore::BaseState * OskCore::IdleState::processKeys()
   if ( m_core.m_keys & OskInput::KEY_ARROW_UP )
   {
     m_core.m_keys &= ~OskInput::KEY_ARROW_UP;
-    (void)m_core.sendKey( KEY_UP );
+    (void)m_core.typeKey( OskInput::KEY_ARROW_UP, KEY_UP );
   }
 
   // Right
   if ( m_core.m_keys & OskInput::KEY_ARROW_RT )
   {
     m_core.m_keys &= ~OskInput::KEY_ARROW_RT;
-    (void)m_core.sendKey( KEY_RIGHT );
+    (void)m_core.typeKey( OskInput::KEY_ARROW_RT, KEY_RIGHT );
   }
 
   // Down
   if ( m_core.m_keys & OskInput::KEY_ARROW_DN )
   {
     m_core.m_keys &= ~OskInput::KEY_ARROW_DN;
-    (void)m_core.sendKey( KEY_DOWN );
+    (void)m_core.typeKey( OskInput::KEY_ARROW_DN, KEY_DOWN );
   }
 
   // Left
   if ( m_core.m_keys & OskInput::KEY_ARROW_LT )
   {
     m_core.m_keys &= ~OskInput::KEY_ARROW_LT;
-    (void)m_core.sendKey( KEY_LEFT );
+    (void)m_core.typeKey( OskInput::KEY_ARROW_LT, KEY_LEFT );
   }
 
   // Other keys
-  return processKeysFinal( KBID_Eng, KSID_Center );
+  // The first layer doubles as the idle keyboard
+  return processKeysFinal( 0, KSID_Center );
 }
 //-----------------------------------------------------------------------------
 bool OskCore::IdleState::draw()
 {
-  if ( !m_core.clear() )
+  if ( !m_core.beginFrame() )
     return false;
 
-  if ( !m_core.drawImageSectionSingle( OskImage::IMGID_EngActive, KSID_Center ) )
-    return false;
+  const bool rt = m_core.clear() &&
+                  m_core.drawImageSectionSingle(
+                      m_core.m_layout.GetActiveImage( 0 ), KSID_Center ) &&
+                  m_core.drawModifiers();
 
-  return true;
+  return m_core.commitFrame() && rt;
 }
 
 
 //-----------------------------------------------------------------------------
 // Class: OskCore::ActiveState
 //-----------------------------------------------------------------------------
-OskCore::ActiveState::ActiveState(OskCore & core_,   OskKeyboardId kbdId_)
+OskCore::ActiveState::ActiveState(OskCore & core_, int layer_)
   : KbdState( core_ ),
-    c_kbdId( kbdId_ ),
+    c_layer( layer_ ),
     m_activeSection( KSID_Count )
 {
 }
@@ -343,177 +361,13 @@ OskCore::BaseState * OskCore::ActiveState::processKeys()
     return newState;
   }
 
-  const OskAnalogPos analogPos = m_core.getAnalogPos();
-
-  // Top left
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_UP ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_LT )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_UPLEFT )
-       )
-     )
-  {
-    m_core.m_keys &= ~( OskInput::KEY_ARROW_UP | OskInput::KEY_ARROW_LT );
-
-    if ( !update( KSID_TopLeft ) )
-      return &m_core.m_failedState;
-
-    return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Top right
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_UP ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_RT )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_UPRIGHT )
-       )
-     )
-  {
-    m_core.m_keys &= ~( OskInput::KEY_ARROW_UP | OskInput::KEY_ARROW_RT );
-
-    if ( !update( KSID_TopRight ) )
-      return &m_core.m_failedState;
-
-    return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Bottom left
-  if ( 
-       (    
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_DN ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_LT )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_DOWNLEFT )
-       )
-     )
-  {
-    m_core.m_keys &= ~( OskInput::KEY_ARROW_DN | OskInput::KEY_ARROW_LT );
-
-    if ( !update( KSID_BottomLeft ) )
-      return &m_core.m_failedState;
-
-    return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Bottom right
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_DN ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_RT )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_DOWNRIGHT )
-       )
-     )
-  {
-    m_core.m_keys &= ~( OskInput::KEY_ARROW_DN | OskInput::KEY_ARROW_RT );
-
-    if ( !update( KSID_BottomRight ) )
-      return &m_core.m_failedState;
-
-    return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Top
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_UP )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_UP )
-       )
-     )
-  {
-    m_core.m_keys &= ~OskInput::KEY_ARROW_UP;
-
-    if ( !update( KSID_Top ) )
-      return &m_core.m_failedState;
-
-    return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Bottom
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_DN )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_DOWN )
-       )
-     )
-  {
-    m_core.m_keys &= ~OskInput::KEY_ARROW_DN;
- 
-    if ( !update( KSID_Bottom ) )
-      return &m_core.m_failedState;
-
-   return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Left
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_LT )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_LEFT )
-       )
-     )
-  {
-    m_core.m_keys &= ~OskInput::KEY_ARROW_LT;
- 
-    if ( !update( KSID_Left ) )
-      return &m_core.m_failedState;
-
-   return processKeysFinal( c_kbdId, m_activeSection );
-  }
-
-  // Right
-  if (
-       (
-         ( m_core.c_flags & FLAGS_USE_DPAD ) &&
-         ( m_core.m_keys & OskInput::KEY_ARROW_RT )
-       ) ||
-       (
-         ( m_core.c_flags & FLAGS_USE_ANALOG ) &&
-         ( analogPos == ANALOG_POS_RIGHT )
-       )
-     )
-  {
-    m_core.m_keys &= ~OskInput::KEY_ARROW_RT;
- 
-    if ( !update( KSID_Right ) )
-      return &m_core.m_failedState;
-
-   return processKeysFinal( c_kbdId, m_activeSection );
-  }
+  const OskKeySectionId sectionId =
+      ResolveSection( m_core.c_flags, m_core.getAnalogPos(), m_core.m_keys );
 
-  // Center
-  if ( !update( KSID_Center ) )
+  if ( !update( sectionId ) )
     return &m_core.m_failedState;
 
-  return processKeysFinal( c_kbdId, m_activeSection );
+  return processKeysFinal( c_layer, m_activeSection );
 }
 //-----------------------------------------------------------------------------
 bool OskCore::ActiveState::update(OskKeySectionId activeSection_)
@@ -529,41 +383,15 @@ bool OskCore::ActiveState::update(OskKeySectionId activeSection_)
 //-----------------------------------------------------------------------------
 bool OskCore::ActiveState::draw()
 {
-  if ( !m_core.drawImage( c_kbdImg[ c_kbdId ] ) )
+  if ( !m_core.beginFrame() )
     return false;
 
-  if ( !m_core.drawImageSection( c_kbdImgActive[ c_kbdId ],
-                                 m_activeSection ) )
-    return false;
-
-  return true;
-}
-
-
-//-----------------------------------------------------------------------------
-// Class: OskCore::ActiveEngState
-//-----------------------------------------------------------------------------
-OskCore::ActiveEngState::ActiveEngState(OskCore & core_)
-  : ActiveState( core_, KBID_Eng )
-{
-}
+  const bool rt = m_core.drawKeyboard( m_core.m_layout.GetImage( c_layer ),
+                                       m_core.m_layout.GetActiveImage( c_layer ),
+                                       m_activeSection ) &&
+                  m_core.drawModifiers();
 
-
-//-----------------------------------------------------------------------------
-// Class: OskCore::ActiveCapState
-//-----------------------------------------------------------------------------
-OskCore::ActiveCapState::ActiveCapState(OskCore & core_)
-  : ActiveState( core_, KBID_Cap )
-{
-}
-
-
-//-----------------------------------------------------------------------------
-// Class: OskCore::ActiveNumState
-//-----------------------------------------------------------------------------
-OskCore::ActiveNumState::ActiveNumState(OskCore & core_)
-  : ActiveState( core_, KBID_Num )
-{
+  return m_core.commitFrame() && rt;
 }
 
 
@@ -21,6 +21,14 @@ public:
   virtual BaseState * processKeys();
   virtual bool IsTerminated() { return false; }
 
+  // As OskTrace records it
+  virtual int GetTraceId() const = 0;
+
+  bool Redraw()
+  {
+    return draw();
+  }
+
 protected:
   virtual bool draw() = 0;
 
@@ -45,6 +53,7 @@ public:
   virtual BaseState * enterState();
   virtual BaseState * processKeys();
   virtual bool IsTerminated() { return true; }
+  virtual int GetTraceId() const { return OskTrace::STATE_Failed; }
 
 protected:
   virtual bool draw()
@@ -70,6 +79,7 @@ public:
 
   virtual BaseState * enterState();
   virtual BaseState * processKeys();
+  virtual int GetTraceId() const { return OskTrace::STATE_Mouse; }
 
 protected:
   virtual bool draw();
@@ -94,7 +104,7 @@ public:
   virtual BaseState * processKeys();
 
 protected:
-  BaseState * processKeysFinal(OskKeyboardId kbdId_, OskKeySectionId secId_);
+  BaseState * processKeysFinal(int layer_, OskKeySectionId secId_);
   bool update(OskKeySectionId activeSection_);
 
 private:
@@ -115,6 +125,7 @@ public:
 
   virtual BaseState * enterState();
   virtual BaseState * processKeys();
+  virtual int GetTraceId() const { return OskTrace::STATE_Idle; }
 
 protected:
   virtual bool draw();
@@ -129,6 +140,8 @@ private:
    
 //-----------------------------------------------------------------------------
 // Class: OskCore::ActiveState
+//
+// The keyboard showing one layer of OskCore::m_layout.
 //-----------------------------------------------------------------------------
 class ActiveState : public KbdState
 {
@@ -136,20 +149,19 @@ public:
   ActiveState
   (
     OskCore & core_,
-    OskKeyboardId kbdId_
+    int layer_
   );
 
   virtual BaseState * enterState();
   virtual BaseState * processKeys();
+  virtual int GetTraceId() const { return OskTrace::STATE_Layer + c_layer; }
 
 protected:
   bool update(OskKeySectionId activeSection_);
   virtual bool draw();
 
-  const OskKeyboardId c_kbdId;
+  const int       c_layer;
   OskKeySectionId m_activeSection;
-  static const OskImage::ImageId c_kbdImg[ KBID_Count ];
-  static const OskImage::ImageId c_kbdImgActive[ KBID_Count ];
 
 private:
   // Not implemented
@@ -159,57 +171,6 @@ private:
 };
 
 
-//-----------------------------------------------------------------------------
-// Class: OskCore::ActiveEngState
-//-----------------------------------------------------------------------------
-class ActiveEngState : public ActiveState
-{
-public:
-  ActiveEngState(OskCore & core_);
-
-protected:
-private:
-  // Not implemented
-  ActiveEngState();
-  ActiveEngState(const ActiveEngState &);
-  ActiveEngState & operator = (const ActiveEngState &);
-};
-
-
-//-----------------------------------------------------------------------------
-// Class: OskCore::ActiveCapState
-//-----------------------------------------------------------------------------
-class ActiveCapState : public ActiveState
-{
-public:
-  ActiveCapState(OskCore & core_);
-
-protected:
-private:
-  // Not implemented
-  ActiveCapState();
-  ActiveCapState(const ActiveCapState &);
-  ActiveCapState & operator = (const ActiveCapState &);
-};
-
-
-//-----------------------------------------------------------------------------
-// Class: OskCore::ActiveNumState
-//-----------------------------------------------------------------------------
-class ActiveNumState : public ActiveState
-{
-public:
-  ActiveNumState(OskCore & core_);
-
-protected:
-private:
-  // Not implemented
-  ActiveNumState();
-  ActiveNumState(const ActiveNumState &);
-  ActiveNumState & operator = (const ActiveNumState &);
-};
-
-
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -0,0 +1,393 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+
+
+//-----------------------------------------------------------------------------
+// Constants
+//-----------------------------------------------------------------------------
+static const char * const c_stageNames[ OskStats::STAGE_Count ] =
+{
+  "read",
+  "event",
+  "draw",
+  "to-draw",
+  "send",
+  "to-send",
+};
+
+static const char * const c_metricNames[ OskMetrics::MET_Count ] =
+{
+  "wakeups",
+  "input-events",
+  "timers-fired",
+  "state-changes",
+  "transition-loops",
+  "analog-moves",
+  "analog-suppressed",
+  "chord-scans",
+  "chords-fired",
+  "blits",
+  "blit-bytes",
+  "clears",
+  "clear-bytes",
+  "flushes",
+  "page-flips",
+  "fb-syscalls",
+  "keys-sent",
+  "key-repeats",
+  "keys-modified",
+  "console-bytes",
+  "console-switches",
+  "console-updates",
+  "console-syscalls",
+  "screenshots",
+  "commands-run",
+  "commands-refused",
+};
+
+static const char * const c_stateNames[ OskTrace::STATE_Layer ] =
+{
+  "failed",
+  "idle",
+  "mouse",
+};
+
+// One line of the metrics or trace dumps; these are built on the signal
+// handler's stack, which is only a few KB on the PSP
+static const int c_lineSize = 128;
+
+
+//-----------------------------------------------------------------------------
+// Static Data
+//-----------------------------------------------------------------------------
+const char OskStats::StatsFileName[] = "/tmp/psposk2.stats";
+OskStats * OskStats::s_instance = NULL;
+
+const char OskMetrics::SnapshotFileName[] = "/tmp/psposk2.metrics";
+unsigned long OskMetrics::s_counters[ OskMetrics::MET_Count ];
+unsigned long OskMetrics::s_lastCounters[ OskMetrics::MET_Count ];
+unsigned long OskMetrics::s_lastTime = 0;
+
+const char OskTrace::TraceFileName[] = "/tmp/psposk2.trace";
+OskTrace::Entry OskTrace::s_entries[ OskTrace::NumEntries ];
+volatile unsigned long OskTrace::s_next = 0;
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+// Text for the signal handlers, so no printf
+static void appendText(char * buf_, int size_, int & len_, const char * str_)
+{
+  while ( *str_ != 0 && len_ < size_ )
+  {
+    buf_[ len_++ ] = *str_++;
+  }
+}
+//-----------------------------------------------------------------------------
+static void appendNumber(char * buf_, int size_, int & len_, unsigned long value_)
+{
+  char digits[ 24 ];
+  int n = sizeof( digits ) - 1;
+  digits[ n ] = 0;
+  do
+  {
+    digits[ --n ] = (char)( '0' + value_ % 10 );
+    value_ /= 10;
+  } while ( value_ != 0 );
+
+  appendText( buf_, size_, len_, &digits[ n ] );
+}
+//-----------------------------------------------------------------------------
+static void appendHex(char * buf_, int size_, int & len_, unsigned long value_)
+{
+  static const char hexDigits[] = "0123456789abcdef";
+  char digits[ 11 ];
+  digits[ 0 ] = '0';
+  digits[ 1 ] = 'x';
+  for ( int i = 0; i < 8; i++ )
+  {
+    digits[ 2 + i ] = hexDigits[ ( value_ >> ( ( 7 - i ) * 4 ) ) & 0xf ];
+  }
+  digits[ 10 ] = 0;
+
+  appendText( buf_, size_, len_, digits );
+}
+//-----------------------------------------------------------------------------
+static void appendState(char * buf_, int size_, int & len_, int state_)
+{
+  if ( state_ < OskTrace::STATE_Layer )
+  {
+    appendText( buf_, size_, len_, c_stateNames[ state_ ] );
+  }
+  else
+  {
+    appendText( buf_, size_, len_, "layer" );
+    appendNumber( buf_, size_, len_, state_ - OskTrace::STATE_Layer );
+  }
+}
+//-----------------------------------------------------------------------------
+static void writeFile(const char * name_, const char * buf_, int len_)
+{
+  // The main loop may be in the middle of a call that checks errno
+  const int savedErrno = errno;
+
+  const int fd = open( name_, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+  if ( fd >= 0 )
+  {
+    (void)write( fd, buf_, len_ );
+    (void)close( fd );
+  }
+
+  errno = savedErrno;
+}
+//-----------------------------------------------------------------------------
+static void writeFile(const char * name_, void (*writeTo_)(int))
+{
+  const int savedErrno = errno;
+
+  const int fd = open( name_, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+  if ( fd >= 0 )
+  {
+    writeTo_( fd );
+    (void)close( fd );
+  }
+
+  errno = savedErrno;
+}
+//-----------------------------------------------------------------------------
+static void reportTo(FILE * file_, void (*writeTo_)(int))
+{
+  // Unbuffered, straight after what is already queued on the stream
+  (void)fflush( file_ );
+  writeTo_( fileno( file_ ) );
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskStats
+//-----------------------------------------------------------------------------
+OskStats::OskStats()
+  : m_enabled( false ),
+    m_textLen( 0 )
+{
+  memset( m_histograms, 0, sizeof( m_histograms ) );
+}
+//-----------------------------------------------------------------------------
+OskStats::~OskStats()
+{
+  if ( s_instance == this )
+  {
+    (void)signal( SIGUSR1, SIG_DFL );
+    s_instance = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+bool OskStats::Enable()
+{
+  if ( s_instance != NULL && s_instance != this )
+  {
+    DBG(( "OSK: Only one OskStats can take SIGUSR1\n" ));
+    return false;
+  }
+
+  s_instance = this;
+
+  struct sigaction action;
+  memset( &action, 0, sizeof( action ) );
+  action.sa_handler = onSignal;
+  (void)sigemptyset( &action.sa_mask );
+  action.sa_flags = SA_RESTART;
+  if ( sigaction( SIGUSR1, &action, NULL ) < 0 )
+  {
+    s_instance = NULL;
+    return false;
+  }
+
+  m_enabled = true;
+  return true;
+}
+//-----------------------------------------------------------------------------
+void OskStats::Report(FILE * file_)
+{
+  if ( !m_enabled )
+    return;
+
+  (void)fwrite( m_text, 1, format(), file_ );
+}
+//-----------------------------------------------------------------------------
+int OskStats::format()
+{
+  const int size = sizeof( m_text );
+  m_textLen = 0;
+
+  for ( int stage = STAGE_First; stage < STAGE_Count; stage++ )
+  {
+    const Histogram & h = m_histograms[ stage ];
+
+    appendText( m_text, size, m_textLen, "stats: " );
+    appendText( m_text, size, m_textLen, c_stageNames[ stage ] );
+    appendText( m_text, size, m_textLen, " count=" );
+    appendNumber( m_text, size, m_textLen, h.count );
+    appendText( m_text, size, m_textLen, " avg-us=" );
+    appendNumber( m_text, size, m_textLen,
+                  ( h.count != 0 ) ? h.total / h.count : 0 );
+    appendText( m_text, size, m_textLen, " max-us=" );
+    appendNumber( m_text, size, m_textLen, h.max );
+    appendText( m_text, size, m_textLen, "\n" );
+
+    if ( h.count == 0 )
+      continue;
+
+    // Only the buckets that were hit, as <upper bound in us>:<count>
+    appendText( m_text, size, m_textLen, "  " );
+    for ( int n = 0; n < NumBuckets; n++ )
+    {
+      if ( h.buckets[ n ] == 0 )
+        continue;
+
+      appendText( m_text, size, m_textLen, " <" );
+      appendNumber( m_text, size, m_textLen, 1UL << n );
+      appendText( m_text, size, m_textLen, ":" );
+      appendNumber( m_text, size, m_textLen, h.buckets[ n ] );
+    } // end for
+    appendText( m_text, size, m_textLen, "\n" );
+  } // end for
+
+  return m_textLen;
+}
+//-----------------------------------------------------------------------------
+void OskStats::onSignal(int signal_)
+{
+  OskStats * const stats = s_instance;
+  if ( stats != NULL )
+  {
+    writeFile( StatsFileName, stats->m_text, stats->format() );
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskMetrics
+//-----------------------------------------------------------------------------
+bool OskMetrics::Enable()
+{
+  s_lastTime = OskClock::Now();
+
+  struct sigaction action;
+  memset( &action, 0, sizeof( action ) );
+  action.sa_handler = onSignal;
+  (void)sigemptyset( &action.sa_mask );
+  action.sa_flags = SA_RESTART;
+  return ( sigaction( SIGUSR2, &action, NULL ) == 0 );
+}
+//-----------------------------------------------------------------------------
+void OskMetrics::Report(FILE * file_)
+{
+  reportTo( file_, writeTo );
+}
+//-----------------------------------------------------------------------------
+void OskMetrics::writeTo(int fd_)
+{
+  const unsigned long now = OskClock::Now();
+  const unsigned long interval = now - s_lastTime;
+  char buf[ c_lineSize ];
+  int len = 0;
+
+  appendText( buf, sizeof( buf ), len, "metrics: interval-ms=" );
+  appendNumber( buf, sizeof( buf ), len, interval / 1000 );
+  appendText( buf, sizeof( buf ), len, "\n" );
+  (void)write( fd_, buf, len );
+
+  for ( int metric = MET_First; metric < MET_Count; metric++ )
+  {
+    // Read once, the main loop may still be counting
+    const unsigned long total = s_counters[ metric ];
+    const unsigned long delta = total - s_lastCounters[ metric ];
+
+    len = 0;
+    appendText( buf, sizeof( buf ), len, "  " );
+    appendText( buf, sizeof( buf ), len, c_metricNames[ metric ] );
+    appendText( buf, sizeof( buf ), len, "=" );
+    appendNumber( buf, sizeof( buf ), len, total );
+    appendText( buf, sizeof( buf ), len, " per-sec=" );
+    appendNumber( buf, sizeof( buf ), len,
+                  ( interval != 0 )
+                      ? (unsigned long)( (double)delta * 1000000.0 / interval )
+                      : 0 );
+    appendText( buf, sizeof( buf ), len, "\n" );
+    (void)write( fd_, buf, len );
+
+    s_lastCounters[ metric ] = total;
+  } // end for
+
+  s_lastTime = now;
+}
+//-----------------------------------------------------------------------------
+void OskMetrics::onSignal(int signal_)
+{
+  writeFile( SnapshotFileName, writeTo );
+
+  OskTrace::Write();
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskTrace
+//-----------------------------------------------------------------------------
+void OskTrace::Write()
+{
+  writeFile( TraceFileName, writeTo );
+}
+//-----------------------------------------------------------------------------
+void OskTrace::Report(FILE * file_)
+{
+  reportTo( file_, writeTo );
+}
+//-----------------------------------------------------------------------------
+void OskTrace::writeTo(int fd_)
+{
+  // Read once; the oldest slot may be half way through being reused
+  const unsigned long next = s_next;
+  const unsigned long first = ( next >= NumEntries ) ? next - NumEntries + 1 : 0;
+  char buf[ c_lineSize ];
+
+  for ( unsigned long n = first; n < next; n++ )
+  {
+    const Entry & entry = s_entries[ n & ( NumEntries - 1 ) ];
+    int len = 0;
+
+    appendText( buf, sizeof( buf ), len, "trace: t-us=" );
+    appendNumber( buf, sizeof( buf ), len, entry.time );
+    appendText( buf, sizeof( buf ), len, " depth=" );
+    appendNumber( buf, sizeof( buf ), len, entry.depth );
+    appendText( buf, sizeof( buf ), len, " " );
+    appendState( buf, sizeof( buf ), len, entry.from );
+    appendText( buf, sizeof( buf ), len, "->" );
+    appendState( buf, sizeof( buf ), len, entry.to );
+    appendText( buf, sizeof( buf ), len, " keys=" );
+    appendHex( buf, sizeof( buf ), len, entry.keys );
+    appendText( buf, sizeof( buf ), len, " us=" );
+    appendNumber( buf, sizeof( buf ), len, entry.us );
+    appendText( buf, sizeof( buf ), len, " pixels=" );
+    appendNumber( buf, sizeof( buf ), len, entry.pixels );
+    appendText( buf, sizeof( buf ), len, "\n" );
+    (void)write( fd_, buf, len );
+  } // end for
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
@@ -0,0 +1,165 @@
+/*-----------------------------------------------------------------------------
+ * On-Screen Keyboard 2 for uClinux on PSP
+ * Created by Jackson Mo, Jan 2, 2008
+ *---------------------------------------------------------------------------*/
+#include "osk.h"
+
+
+//-----------------------------------------------------------------------------
+// Local functions
+//-----------------------------------------------------------------------------
+// The clock wraps, so due or not is the sign of the difference
+static bool isDue(unsigned long due_, unsigned long now_)
+{
+  return ( (long)( now_ - due_ ) >= 0 );
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskTimer
+//-----------------------------------------------------------------------------
+OskTimer::OskTimer()
+  : m_next( NULL ),
+    m_due( 0 ),
+    m_armed( false )
+{
+}
+
+
+//-----------------------------------------------------------------------------
+// Class: OskTimerWheel
+//-----------------------------------------------------------------------------
+OskTimerWheel::OskTimerWheel()
+  : m_cursor( OskClock::Now() / TickUs ),
+    m_numArmed( 0 )
+{
+  for ( int i = 0; i < NumSlots; i++ )
+  {
+    m_slots[ i ] = NULL;
+  }
+}
+//-----------------------------------------------------------------------------
+void OskTimerWheel::Schedule(OskTimer & timer_, unsigned long delay_)
+{
+  if ( timer_.m_armed )
+  {
+    Cancel( timer_ );
+  }
+
+  timer_.m_due = OskClock::Now() + delay_;
+
+  OskTimer ** const slot = &m_slots[ slotOf( timer_.m_due ) ];
+  timer_.m_next = *slot;
+  timer_.m_armed = true;
+  *slot = &timer_;
+  m_numArmed++;
+}
+//-----------------------------------------------------------------------------
+void OskTimerWheel::Cancel(OskTimer & timer_)
+{
+  if ( !timer_.m_armed )
+    return;
+
+  for ( OskTimer ** link = &m_slots[ slotOf( timer_.m_due ) ];
+        *link != NULL;
+        link = &(*link)->m_next )
+  {
+    if ( *link == &timer_ )
+    {
+      *link = timer_.m_next;
+      break;
+    }
+  } // end for
+
+  timer_.m_next = NULL;
+  timer_.m_armed = false;
+  m_numArmed--;
+}
+//-----------------------------------------------------------------------------
+int OskTimerWheel::GetTimeout() const
+{
+  if ( m_numArmed == 0 )
+    return -1;
+
+  // Only a handful are ever armed, so a full scan is cheaper than keeping
+  // them sorted
+  const unsigned long now = OskClock::Now();
+  unsigned long earliest = 0;
+  bool found = false;
+  for ( int i = 0; i < NumSlots; i++ )
+  {
+    for ( const OskTimer * timer = m_slots[ i ];
+          timer != NULL;
+          timer = timer->m_next )
+    {
+      if ( isDue( timer->m_due, now ) )
+        return 0;
+
+      const unsigned long left = timer->m_due - now;
+      if ( !found || left < earliest )
+      {
+        earliest = left;
+        found = true;
+      }
+    } // end for
+  } // end for
+
+  return (int)( ( earliest + 999 ) / 1000 );
+}
+//-----------------------------------------------------------------------------
+int OskTimerWheel::Expire()
+{
+  const unsigned long now = OskClock::Now();
+  const unsigned long tick = now / TickUs;
+
+  // Every slot once the clock has gone all the way round, or wrapped
+  unsigned long numTicks = tick - m_cursor + 1;
+  if ( numTicks > (unsigned long)NumSlots )
+    numTicks = NumSlots;
+
+  // Unlink everything that is due first, so a timer can re-arm itself
+  OskTimer * due = NULL;
+  for ( unsigned long i = 0; i < numTicks && m_numArmed > 0; i++ )
+  {
+    OskTimer ** link = &m_slots[ ( m_cursor + i ) % NumSlots ];
+    while ( *link != NULL )
+    {
+      OskTimer * const timer = *link;
+      if ( isDue( timer->m_due, now ) )
+      {
+        *link = timer->m_next;
+        timer->m_next = due;
+        timer->m_armed = false;
+        due = timer;
+        m_numArmed--;
+      }
+      else
+      {
+        link = &timer->m_next;
+      }
+    } // end while
+  } // end for
+
+  m_cursor = tick;
+
+  int numFired = 0;
+  while ( due != NULL )
+  {
+    OskTimer * const timer = due;
+    due = timer->m_next;
+    timer->m_next = NULL;
+    timer->OnTimer();
+    numFired++;
+  } // end while
+
+  OskMetrics::Count( OskMetrics::MET_TimersFired, numFired );
+  return numFired;
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------